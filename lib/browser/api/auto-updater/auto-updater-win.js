@@ -41,7 +41,7 @@ class AutoUpdater extends EventEmitter {
       return this.emitError('Can not find Squirrel')
     }
     this.emit('checking-for-update')
-    squirrelUpdate.checkForUpdate(this.updateURL, (error, update) => {
+    squirrelUpdate.checkForUpdate(this.updateURL, (error, update, releaseSummary) => {
       if (error != null) {
         return this.emitError(error)
       }
@@ -50,7 +50,10 @@ class AutoUpdater extends EventEmitter {
       }
       this.updateAvailable = true
       this.emit('update-available')
-      squirrelUpdate.update(this.updateURL, (error) => {
+      const onProgress = (percent) => {
+        this.emit('update-download-progress', { ...releaseSummary, percent })
+      }
+      squirrelUpdate.update(this.updateURL, onProgress, (error) => {
         if (error != null) {
           return this.emitError(error)
         }
@@ -15,9 +15,31 @@ let spawnedProcess
 
 const isSameArgs = (args) => args.length === spawnedArgs.length && args.every((e, i) => e === spawnedArgs[i])
 
+// Summarize the releases Squirrel plans to apply. When the feed publishes
+// delta packages Squirrel prefers them over full ones, so this tells us how
+// much of the payload is binary diffs.
+const summarizeReleases = function (releasesToApply) {
+  const summary = { count: releasesToApply.length, deltas: 0, totalBytes: 0 }
+  for (const release of releasesToApply) {
+    if (release.isDelta) {
+      summary.deltas += 1
+    }
+    if (typeof release.filesize === 'number') {
+      summary.totalBytes += release.filesize
+    }
+  }
+  return summary
+}
+
 // Spawn a command and invoke the callback when it completes with an error
-// and the output from standard out.
-const spawnUpdate = function (args, detached, callback) {
+// and the output from standard out. Update.exe reports download/apply
+// progress as bare integer percentages on stdout; they are forwarded to
+// onProgress when a handler is given.
+const spawnUpdate = function (args, detached, onProgress, callback) {
+  if (callback == null) {
+    callback = onProgress
+    onProgress = null
+  }
   let error, errorEmitted, stderr, stdout
 
   try {
@@ -48,7 +70,17 @@ const spawnUpdate = function (args, detached, callback) {
   stdout = ''
   stderr = ''
 
-  spawnedProcess.stdout.on('data', (data) => { stdout += data })
+  spawnedProcess.stdout.on('data', (data) => {
+    stdout += data
+    if (onProgress) {
+      for (const line of data.toString().split('\n')) {
+        const percent = parseInt(line.trim(), 10)
+        if (!Number.isNaN(percent) && percent >= 0 && percent <= 100) {
+          onProgress(percent)
+        }
+      }
+    }
+  })
   spawnedProcess.stderr.on('data', (data) => { stderr += data })
 
   errorEmitted = false
@@ -87,25 +119,37 @@ exports.processStart = function () {
 exports.checkForUpdate = function (updateURL, callback) {
   return spawnUpdate(['--checkForUpdate', updateURL], false, function (error, stdout) {
     let ref, ref1, update
+    let releases = []
     if (error != null) {
       return callback(error)
     }
     try {
       // Last line of output is the JSON details about the releases
       const json = stdout.trim().split('\n').pop()
-      update = (ref = JSON.parse(json)) != null ? (ref1 = ref.releasesToApply) != null ? typeof ref1.pop === 'function' ? ref1.pop() : void 0 : void 0 : void 0
+      const parsed = JSON.parse(json)
+      if (parsed != null && Array.isArray(parsed.releasesToApply)) {
+        releases = parsed.releasesToApply.slice()
+      }
+      update = (ref = parsed) != null ? (ref1 = ref.releasesToApply) != null ? typeof ref1.pop === 'function' ? ref1.pop() : void 0 : void 0 : void 0
     } catch {
       // Disabled for backwards compatibility:
       // eslint-disable-next-line standard/no-callback-literal
       return callback(`Invalid result:\n${stdout}`)
     }
-    return callback(null, update)
+    return callback(null, update, summarizeReleases(releases))
   })
 }
 
 // Update the application to the latest remote version specified by URL.
-exports.update = function (updateURL, callback) {
-  return spawnUpdate(['--update', updateURL], false, callback)
+// Squirrel downloads and applies delta packages automatically when the
+// feed publishes them; progress percentages are forwarded when a handler
+// is given.
+exports.update = function (updateURL, progress, callback) {
+  if (callback == null) {
+    callback = progress
+    progress = null
+  }
+  return spawnUpdate(['--update', updateURL], false, progress, callback)
 }
 
 // Is the Update.exe installed with the current application?
@@ -6,6 +6,10 @@ const { BrowserWindow } = process.electronBinding('window')
 
 Object.setPrototypeOf(BrowserWindow.prototype, TopLevelWindow.prototype)
 
+// Index from webContents id to window, so fromWebContents() does not have to
+// scan every open window; apps routinely call it once per IPC event.
+const windowsByWebContentsId = new Map()
+
 BrowserWindow.prototype._init = function () {
   // Call parent class's _init.
   TopLevelWindow.prototype._init.call(this)
@@ -16,6 +20,12 @@ BrowserWindow.prototype._init = function () {
   // Create WebContentsView.
   this.setContentView(new WebContentsView(this.webContents))
 
+  const webContentsId = this.webContents.id
+  windowsByWebContentsId.set(webContentsId, this)
+  this.once('closed', () => {
+    windowsByWebContentsId.delete(webContentsId)
+  })
+
   const nativeSetBounds = this.setBounds
   this.setBounds = (bounds, ...opts) => {
     bounds = {
@@ -115,11 +125,12 @@ BrowserWindow.getFocusedWindow = () => {
 }
 
 BrowserWindow.fromWebContents = (webContents) => {
-  for (const window of BrowserWindow.getAllWindows()) {
-    if (window.webContents.equal(webContents)) return window
-  }
+  const window = windowsByWebContentsId.get(webContents.id)
+  return window === undefined || window.isDestroyed() ? null : window
+}
 
-  return null
+BrowserWindow.batchUpdate = (fn) => {
+  TopLevelWindow.batchUpdate(fn)
 }
 
 BrowserWindow.fromBrowserView = (browserView) => {
@@ -180,8 +191,8 @@ Object.assign(BrowserWindow.prototype, {
   setTouchBar (touchBar) {
     electron.TouchBar._setOnWindow(touchBar, this)
   },
-  setBackgroundThrottling (allowed) {
-    this.webContents.setBackgroundThrottling(allowed)
+  setBackgroundThrottling (...args) {
+    this.webContents.setBackgroundThrottling(...args)
   }
 })
 
@@ -133,6 +133,26 @@ Menu.prototype.insert = function (pos, item) {
   this.commandsMap[item.commandId] = item
 }
 
+Menu.prototype.remove = function (item) {
+  const pos = this.items.indexOf(item)
+  if (pos === -1) {
+    throw new Error('The item is not in this menu')
+  }
+
+  // Patches the existing model in place instead of requiring a rebuild of
+  // the whole menu; the native menu is created from the model when shown.
+  this.removeItem(pos)
+
+  this.items.splice(pos, 1)
+  delete this.commandsMap[item.commandId]
+  if (item.groupId != null && this.groupsMap[item.groupId] != null) {
+    const group = this.groupsMap[item.groupId]
+    const index = group.indexOf(item)
+    if (index !== -1) group.splice(index, 1)
+    if (group.length === 0) delete this.groupsMap[item.groupId]
+  }
+}
+
 Menu.prototype._callMenuWillShow = function () {
   if (this.delegate) this.delegate.menuWillShow(this)
   this.items.forEach(item => {
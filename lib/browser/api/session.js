@@ -1,6 +1,7 @@
 'use strict'
 
 const { EventEmitter } = require('events')
+const { Readable } = require('stream')
 const { app, deprecate } = require('electron')
 const { fromPartition, Session, Cookies, NetLog, Protocol } = process.electronBinding('session')
 
@@ -23,6 +24,21 @@ Session.prototype._init = function () {
   app.emit('session-created', this)
 }
 
+Session.prototype.getBlobDataStream = function (uuid) {
+  // The native reader hands out one bounded chunk per read() call, so
+  // memory usage stays capped no matter how large the blob is.
+  const reader = this._getBlobDataStream(uuid)
+  return new Readable({
+    read () {
+      reader.read().then((chunk) => {
+        this.push(chunk)
+      }, (error) => {
+        this.destroy(error)
+      })
+    }
+  })
+}
+
 const _originalStartLogging = NetLog.prototype.startLogging
 NetLog.prototype.startLogging = function (path, ...args) {
   this._currentlyLoggingPath = path
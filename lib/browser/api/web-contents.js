@@ -222,6 +222,12 @@ WebContents.prototype.printToPDF = function (options) {
   if (options.printSelectionOnly) {
     printingSetting.shouldPrintSelectionOnly = options.printSelectionOnly
   }
+  if (options.path) {
+    if (typeof options.path !== 'string') {
+      return Promise.reject(new Error('path must be a string'))
+    }
+    printingSetting.outputPath = options.path
+  }
   if (options.printBackground) {
     printingSetting.shouldPrintBackgrounds = options.printBackground
   }
@@ -317,6 +323,26 @@ const addReturnValueToEvent = (event) => {
 
 // Add JavaScript wrappers for WebContents class.
 WebContents.prototype._init = function () {
+  // These native events fire at high frequency (cursor-changed can fire for
+  // every mouse move), so the C++ side skips converting and emitting them
+  // while nothing is subscribed. Report listener transitions back to it.
+  const nativeGatedEvents = new Set([
+    'cursor-changed',
+    'did-start-navigation',
+    'did-redirect-navigation',
+    'page-favicon-updated'
+  ])
+  this.on('newListener', (eventName) => {
+    if (nativeGatedEvents.has(eventName) && this.listenerCount(eventName) === 0) {
+      this._setEventListened(eventName, true)
+    }
+  })
+  this.on('removeListener', (eventName) => {
+    if (nativeGatedEvents.has(eventName) && this.listenerCount(eventName) === 0) {
+      this._setEventListened(eventName, false)
+    }
+  })
+
   // The navigation controller.
   NavigationController.call(this, this)
 
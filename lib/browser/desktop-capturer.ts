@@ -9,6 +9,20 @@ let currentlyRunning: {
   getSources: Promise<ElectronInternal.GetSourcesResult[]>;
 }[] = []
 
+// Active subscriptions keyed by `${webContents.id}-${subscriptionId}`.
+const subscriptions = new Map<string, () => void>()
+
+const serializeSource = (source: Electron.DesktopCapturerSource, fetchWindowIcons: boolean, targetWebContentsId: number): ElectronInternal.GetSourcesResult => ({
+  id: source.id,
+  name: source.name,
+  // The images cross to the renderer as shared memory handles instead of
+  // encoded bytes; only the requesting WebContents can claim them with
+  // ipc.takeSharedImage().
+  thumbnail: (source.thumbnail as any)._exportForSharedTransfer(targetWebContentsId),
+  display_id: source.display_id,
+  appIcon: (fetchWindowIcons && source.appIcon) ? (source.appIcon as any)._exportForSharedTransfer(targetWebContentsId) : null
+})
+
 export const getSources = (event: Electron.IpcMainEvent, options: ElectronInternal.GetSourcesOptions) => {
   for (const running of currentlyRunning) {
     if (deepEqual(running.options, options)) {
@@ -39,13 +53,7 @@ export const getSources = (event: Electron.IpcMainEvent, options: ElectronIntern
 
     emitter.once('finished', (event, sources: Electron.DesktopCapturerSource[], fetchWindowIcons: boolean) => {
       stopRunning()
-      resolve(sources.map(source => ({
-        id: source.id,
-        name: source.name,
-        thumbnail: source.thumbnail.toDataURL(),
-        display_id: source.display_id,
-        appIcon: (fetchWindowIcons && source.appIcon) ? source.appIcon.toDataURL() : null
-      })))
+      resolve(sources.map(source => serializeSource(source, fetchWindowIcons, event.sender.id)))
     })
 
     capturer.emit = emitter.emit.bind(emitter)
@@ -64,3 +72,52 @@ export const getSources = (event: Electron.IpcMainEvent, options: ElectronIntern
 
   return getSources
 }
+
+export const subscribeToSources = (event: Electron.IpcMainEvent, subscriptionId: number, options: ElectronInternal.SubscribeToSourcesOptions) => {
+  const key = `${event.sender.id}-${subscriptionId}`
+  if (subscriptions.has(key)) return
+
+  let capturer: ElectronInternal.DesktopCapturer | null = createDesktopCapturer()
+  const channel = `ELECTRON_RENDERER_DESKTOP_CAPTURER_EVENT_${subscriptionId}`
+  const emitter = new EventEmitter()
+
+  const stop = () => {
+    if (capturer) {
+      capturer.stopListening()
+      capturer.emit = null
+      capturer = null
+    }
+    subscriptions.delete(key)
+  }
+
+  const forward = (eventName: string, hasSource: boolean) => {
+    emitter.on(eventName, (_e: any, ...args: any[]) => {
+      if (hasSource) {
+        args[args.length - 1] = serializeSource(args[args.length - 1], options.fetchWindowIcons, event.sender.id)
+      }
+      if (!event.sender.isDestroyed()) {
+        (event.sender as Electron.WebContentsInternal)._sendInternal(channel, eventName, ...args)
+      }
+    })
+  }
+  forward('source-added', true)
+  forward('source-name-changed', true)
+  forward('source-thumbnail-changed', true)
+  forward('source-removed', false)
+  emitter.on('error', (_e: any, error: string) => {
+    if (!event.sender.isDestroyed()) {
+      (event.sender as Electron.WebContentsInternal)._sendInternal(channel, 'error', error)
+    }
+  })
+
+  capturer.emit = emitter.emit.bind(emitter)
+  capturer.startListening(options.captureWindow, options.captureScreen, options.thumbnailSize, options.fetchWindowIcons, options.updateInterval)
+
+  subscriptions.set(key, stop)
+  event.sender.once('destroyed', stop)
+}
+
+export const unsubscribeFromSources = (event: Electron.IpcMainEvent, subscriptionId: number) => {
+  const stop = subscriptions.get(`${event.sender.id}-${subscriptionId}`)
+  if (stop) stop()
+}
@@ -298,6 +298,9 @@ const watchEmbedder = function (embedder) {
   embedder.on('-window-visibility-change', onVisibilityChange)
 
   embedder.once('will-destroy', () => {
+    // Drop all of this embedder's guests from the native manager in one
+    // pass; the per-guest detach below then only has JS state to clean up.
+    webViewManager.removeEmbedderGuests(embedder)
     // Usually the guestInstances is cleared when guest is destroyed, but it
     // may happen that the embedder gets manually destroyed earlier than guest,
     // and the embedder will be invalid in the usual code path.
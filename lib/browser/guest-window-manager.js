@@ -189,6 +189,19 @@ ipcMainInternal.on('ELECTRON_GUEST_WINDOW_MANAGER_WINDOW_OPEN', (event, url, fra
   if (frameName == null) frameName = ''
   if (features == null) features = ''
 
+  // Declarative rules decide the common case before any parsing or events.
+  const policyRule = event.sender._evaluateWindowOpenPolicy(url)
+  if (policyRule != null) {
+    if (policyRule.policy === 'deny') {
+      event.returnValue = null
+      return
+    }
+    if (policyRule.features.length > 0) {
+      const extra = policyRule.features.join(',')
+      features = features === '' ? extra : `${features},${extra}`
+    }
+  }
+
   const options = {}
 
   const ints = ['x', 'y', 'width', 'height', 'minWidth', 'maxWidth', 'minHeight', 'maxHeight', 'zoomFactor']
@@ -79,21 +79,51 @@ if (features.isDesktopCapturerEnabled()) {
 
     return desktopCapturer.getSources(event, options)
   })
+
+  ipcMainInternal.handle('ELECTRON_BROWSER_DESKTOP_CAPTURER_SUBSCRIBE', function (event, subscriptionId, options, stack) {
+    logStack(event.sender, 'desktopCapturer.subscribeToSources()', stack)
+    const customEvent = emitCustomEvent(event.sender, 'desktop-capturer-get-sources')
+
+    if (customEvent.defaultPrevented) {
+      console.error('Blocked desktopCapturer.subscribeToSources()')
+      return
+    }
+
+    desktopCapturer.subscribeToSources(event, subscriptionId, options)
+  })
+
+  ipcMainInternal.on('ELECTRON_BROWSER_DESKTOP_CAPTURER_UNSUBSCRIBE', function (event, subscriptionId) {
+    desktopCapturer.unsubscribeFromSources(event, subscriptionId)
+  })
 }
 
 const isRemoteModuleEnabled = features.isRemoteModuleEnabled()
   ? require('@electron/internal/browser/remote/server').isRemoteModuleEnabled
   : () => false
 
+// Preload source and V8 code cache blobs keyed by path, validated against
+// mtime, so each new renderer doesn't re-read and fully re-compile the same
+// preload bundle.
+const preloadCache = new Map()
+
 const getPreloadScript = async function (preloadPath) {
   let preloadSrc = null
   let preloadError = null
+  let preloadCacheData = null
   try {
-    preloadSrc = (await fs.promises.readFile(preloadPath)).toString()
+    const stats = await fs.promises.stat(preloadPath)
+    const cached = preloadCache.get(preloadPath)
+    if (cached && cached.mtimeMs === stats.mtimeMs) {
+      preloadSrc = cached.source
+      preloadCacheData = cached.cacheData
+    } else {
+      preloadSrc = (await fs.promises.readFile(preloadPath)).toString()
+      preloadCache.set(preloadPath, { mtimeMs: stats.mtimeMs, source: preloadSrc, cacheData: null })
+    }
   } catch (error) {
     preloadError = error
   }
-  return { preloadPath, preloadSrc, preloadError }
+  return { preloadPath, preloadSrc, preloadError, preloadCacheData }
 }
 
 if (features.isExtensionsEnabled()) {
@@ -131,3 +161,12 @@ ipcMainUtils.handleSync('ELECTRON_BROWSER_SANDBOX_LOAD', async function (event)
 ipcMainInternal.on('ELECTRON_BROWSER_PRELOAD_ERROR', function (event, preloadPath, error) {
   event.sender.emit('preload-error', event, preloadPath, error)
 })
+
+// The first renderer to compile a preload sends the produced code cache blob
+// back; later renderers receive it with the source and skip full compilation.
+ipcMainInternal.on('ELECTRON_BROWSER_PRELOAD_CACHE_DATA', function (event, preloadPath, cacheData) {
+  const cached = preloadCache.get(preloadPath)
+  if (cached && cacheData instanceof Uint8Array) {
+    cached.cacheData = cacheData
+  }
+})
@@ -513,7 +513,10 @@
         return
       }
 
-      if (info.unpacked) {
+      // Unpacked entries live on disk, and compressed entries are stored as
+      // gzip streams that only the native layer can decode; in both cases
+      // read the file copyFileOut hands back instead of raw archive bytes.
+      if (info.unpacked || info.compressed) {
         const realPath = archive.copyFileOut(filePath)
         return fs.readFile(realPath, options, callback)
       }
@@ -546,7 +549,7 @@
       if (!info) throw createError(AsarError.NOT_FOUND, { asarPath, filePath })
 
       if (info.size === 0) return (options) ? '' : Buffer.alloc(0)
-      if (info.unpacked) {
+      if (info.unpacked || info.compressed) {
         const realPath = archive.copyFileOut(filePath)
         return fs.readFileSync(realPath, options)
       }
@@ -626,7 +629,9 @@
       const info = archive.getFileInfo(filePath)
       if (!info) return
       if (info.size === 0) return ''
-      if (info.unpacked) {
+      // Compressed entries must go through the native decompression path,
+      // same as the readFile overrides above.
+      if (info.unpacked || info.compressed) {
         const realPath = archive.copyFileOut(filePath)
         return fs.readFileSync(realPath, { encoding: 'utf8' })
       }
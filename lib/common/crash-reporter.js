@@ -21,7 +21,9 @@ class CrashReporter {
       extra = {},
       ignoreSystemCrashHandler = false,
       submitURL,
-      uploadToServer = true
+      uploadToServer = true,
+      rateLimit = false,
+      compress = false
     } = options
 
     if (companyName == null) throw new Error('companyName is a required option to crashReporter.start')
@@ -39,7 +41,7 @@ class CrashReporter {
     if (extra._companyName == null) extra._companyName = companyName
     if (extra._version == null) extra._version = ret.appVersion
 
-    binding.start(ret.productName, companyName, submitURL, ret.crashesDirectory, uploadToServer, ignoreSystemCrashHandler, extra)
+    binding.start(ret.productName, companyName, submitURL, ret.crashesDirectory, uploadToServer, ignoreSystemCrashHandler, rateLimit, compress, extra)
   }
 
   getLastCrashReport () {
@@ -77,10 +79,26 @@ class CrashReporter {
     }
   }
 
+  getUploadQueueStats () {
+    if (process.type === 'browser') {
+      return binding.getUploadQueueStats()
+    } else {
+      throw new Error('getUploadQueueStats can only be called from the main process')
+    }
+  }
+
   addExtraParameter (key, value) {
     binding.addExtraParameter(key, value)
   }
 
+  registerBreadcrumbKey (name) {
+    return binding.registerBreadcrumbKey(name)
+  }
+
+  setBreadcrumb (slot, value) {
+    binding.setBreadcrumb(slot, value)
+  }
+
   removeExtraParameter (key) {
     binding.removeExtraParameter(key)
   }
@@ -55,6 +55,28 @@ if (process.type === 'browser') {
   global.setInterval = timers.setInterval
 }
 
+// Attribute native addon load costs: wrap process.dlopen so each .node
+// load records its wall time, CPU time and resident-set growth. Builtin
+// modules are recorded natively at registration time; both sets are
+// returned by process.getModuleLoadMetrics().
+const dlopen = process.dlopen
+process.dlopen = function (this: any, module: any, filename: string, ...args: any[]) {
+  const wallStart = process.hrtime()
+  const cpuStart = process.cpuUsage()
+  const rssBefore = process.memoryUsage().rss
+  try {
+    return dlopen.call(this, module, filename, ...args)
+  } finally {
+    const wall = process.hrtime(wallStart)
+    const cpu = process.cpuUsage(cpuStart)
+    process._recordModuleLoadMetric(
+      filename, 'addon',
+      wall[0] * 1e3 + wall[1] / 1e6,
+      (cpu.user + cpu.system) / 1e3,
+      process.memoryUsage().rss - rssBefore)
+  }
+}
+
 if (process.platform === 'win32') {
   // Always returns EOF for stdin stream.
   const { Readable } = require('stream')
@@ -1,7 +1,8 @@
-import { nativeImage } from 'electron'
+import { EventEmitter } from 'events'
 import { ipcRendererInternal } from '@electron/internal/renderer/ipc-renderer-internal'
 
 const { hasSwitch } = process.electronBinding('command_line')
+const { ipc } = process.electronBinding('ipc')
 
 // |options.types| can't be empty and must be an array
 function isValid (options: Electron.SourcesOptions) {
@@ -35,11 +36,57 @@ export async function getSources (options: Electron.SourcesOptions) {
     fetchWindowIcons
   } as ElectronInternal.GetSourcesOptions, getCurrentStack())
 
-  return sources.map(source => ({
-    id: source.id,
-    name: source.name,
-    thumbnail: nativeImage.createFromDataURL(source.thumbnail),
-    display_id: source.display_id,
-    appIcon: source.appIcon ? nativeImage.createFromDataURL(source.appIcon) : null
-  }))
+  return Promise.all(sources.map(deserializeSource))
+}
+
+// The browser process sends images as shared-memory transfer IDs; claiming
+// one maps the pixels into this process instead of decoding a data URL.
+const deserializeSource = async (source: ElectronInternal.GetSourcesResult) => ({
+  id: source.id,
+  name: source.name,
+  thumbnail: await ipc.takeSharedImage(source.thumbnail),
+  display_id: source.display_id,
+  appIcon: source.appIcon != null ? await ipc.takeSharedImage(source.appIcon) : null
+})
+
+let nextSubscriptionId = 1
+
+export function subscribeToSources (options: Electron.SourcesOptions & { updateInterval?: number }) {
+  if (!isValid(options)) throw new Error('Invalid options')
+
+  const captureWindow = options.types.includes('window')
+  const captureScreen = options.types.includes('screen')
+
+  const { thumbnailSize = { width: 150, height: 150 } } = options
+  const { fetchWindowIcons = false } = options
+  const { updateInterval = 1000 } = options
+
+  const subscriptionId = nextSubscriptionId++
+  const channel = `ELECTRON_RENDERER_DESKTOP_CAPTURER_EVENT_${subscriptionId}`
+  const emitter = new EventEmitter()
+  let stopped = false
+
+  ipcRendererInternal.on(channel, async (_event, eventName: string, ...args: any[]) => {
+    if (eventName === 'source-added' || eventName === 'source-name-changed' || eventName === 'source-thumbnail-changed') {
+      args[args.length - 1] = await deserializeSource(args[args.length - 1])
+    }
+    emitter.emit(eventName, ...args)
+  })
+
+  ipcRendererInternal.invoke('ELECTRON_BROWSER_DESKTOP_CAPTURER_SUBSCRIBE', subscriptionId, {
+    captureWindow,
+    captureScreen,
+    thumbnailSize,
+    fetchWindowIcons,
+    updateInterval
+  } as ElectronInternal.SubscribeToSourcesOptions, getCurrentStack())
+
+  return Object.assign(emitter, {
+    stop: () => {
+      if (stopped) return
+      stopped = true
+      ipcRendererInternal.removeAllListeners(channel)
+      ipcRendererInternal.send('ELECTRON_BROWSER_DESKTOP_CAPTURER_UNSUBSCRIBE', subscriptionId)
+    }
+  })
 }
@@ -1,4 +1,4 @@
-import { webFrame, WebFrame } from 'electron'
+import { WebFrame } from 'electron'
 import * as ipcRendererUtils from '@electron/internal/renderer/ipc-renderer-internal-utils'
 
 // All keys of WebFrame that extend Function
@@ -12,6 +12,11 @@ export const webFrameInit = () => {
   ipcRendererUtils.handle('ELECTRON_INTERNAL_RENDERER_WEB_FRAME_METHOD', (
     event, method: keyof WebFrameMethod, ...args: any[]
   ) => {
+    // Resolve webFrame lazily: requiring it at module scope would initialize
+    // the native web_frame binding in every renderer at bootstrap, even when
+    // no webFrame method is ever invoked.
+    const { webFrame } = require('electron')
+
     // The TypeScript compiler cannot handle the sheer number of
     // call signatures here and simply gives up. Incorrect invocations
     // will be caught by "keyof WebFrameMethod" though.
@@ -147,22 +147,28 @@ if (process.isMainFrame) {
 // - `process`: The `preloadProcess` object
 // - `Buffer`: Shim of `Buffer` implementation
 // - `global`: The window object, which is aliased to `global` by webpack.
-function runPreloadScript (preloadSrc) {
+function runPreloadScript (preloadPath, preloadSrc, preloadCacheData) {
   const preloadWrapperSrc = `(function(require, process, Buffer, global, setImmediate, clearImmediate, exports) {
   ${preloadSrc}
   })`
 
-  // eval in window scope
-  const preloadFn = binding.createPreloadScript(preloadWrapperSrc)
+  // eval in window scope, consuming the browser's code cache blob when one
+  // exists for this preload
+  const { preloadFn, cacheData } = binding.createPreloadScript(preloadWrapperSrc, preloadCacheData)
+  if (cacheData) {
+    // Freshly compiled (no blob, or the blob was stale) - hand the new code
+    // cache back to the browser for subsequent renderers.
+    ipcRendererInternal.send('ELECTRON_BROWSER_PRELOAD_CACHE_DATA', preloadPath, cacheData)
+  }
   const { setImmediate, clearImmediate } = require('timers')
 
   preloadFn(preloadRequire, preloadProcess, Buffer, global, setImmediate, clearImmediate, {})
 }
 
-for (const { preloadPath, preloadSrc, preloadError } of preloadScripts) {
+for (const { preloadPath, preloadSrc, preloadError, preloadCacheData } of preloadScripts) {
   try {
     if (preloadSrc) {
-      runPreloadScript(preloadSrc)
+      runPreloadScript(preloadPath, preloadSrc, preloadCacheData)
     } else if (preloadError) {
       throw preloadError
     }
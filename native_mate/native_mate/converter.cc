@@ -4,6 +4,13 @@
 
 #include "native_mate/converter.h"
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "base/strings/string_util.h"
+#include "node.h"
 #include "v8/include/v8.h"
 
 namespace mate {
@@ -18,6 +25,24 @@ bool FromMaybe(v8::Maybe<T> maybe, U* out) {
   return true;
 }
 
+// Payloads at least this large take the externalized path below; for small
+// strings a copy is cheaper than the external-resource bookkeeping.
+const size_t kExternalStringMinSize = 64 * 1024;
+
+// Hands a C++ buffer to v8 without copying. v8 deletes the resource (and
+// with it the buffer) when the string is garbage collected.
+class ExternalOneByteString : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit ExternalOneByteString(std::string data) : data_(std::move(data)) {}
+  ~ExternalOneByteString() override = default;
+
+  const char* data() const override { return data_.data(); }
+  size_t length() const override { return data_.size(); }
+
+ private:
+  const std::string data_;
+};
+
 }  // namespace
 
 v8::Local<v8::Value> Converter<bool>::ToV8(v8::Isolate* isolate, bool val) {
@@ -151,6 +176,19 @@ v8::Local<v8::Value> Converter<std::string>::ToV8(v8::Isolate* isolate,
   return Converter<base::StringPiece>::ToV8(isolate, val);
 }
 
+v8::Local<v8::Value> Converter<std::string>::ToV8(v8::Isolate* isolate,
+                                                  std::string&& val) {
+  // One-byte external strings hold Latin-1 data, so only ASCII payloads --
+  // the common case for the JSON and source text that reach this size --
+  // can be handed over without transcoding.
+  if (val.size() >= kExternalStringMinSize && base::IsStringASCII(val)) {
+    return v8::String::NewExternalOneByte(
+               isolate, new ExternalOneByteString(std::move(val)))
+        .ToLocalChecked();
+  }
+  return Converter<base::StringPiece>::ToV8(isolate, val);
+}
+
 bool Converter<std::string>::FromV8(v8::Isolate* isolate,
                                     v8::Local<v8::Value> val,
                                     std::string* out) {
@@ -258,12 +296,67 @@ bool Converter<v8::Local<v8::Value>>::FromV8(v8::Isolate* isolate,
   return true;
 }
 
-v8::Local<v8::String> StringToSymbol(v8::Isolate* isolate,
-                                     base::StringPiece val) {
+namespace {
+
+struct InternedKey {
+  std::string bytes;
+  v8::Eternal<v8::String> handle;
+};
+
+using InternedKeyTable = std::unordered_map<const char*, InternedKey>;
+
+// One table per isolate; thread_local because an isolate is only ever
+// entered from one thread at a time.
+std::map<v8::Isolate*, InternedKeyTable>& GetInternedKeyTables() {
+  thread_local std::map<v8::Isolate*, InternedKeyTable> tables;
+  return tables;
+}
+
+// Environment cleanup hook; drops the dying isolate's table so its
+// address can be reused by a later isolate without the lookup matching
+// handles that belong to the dead one.
+void PurgeInternedKeyTable(void* isolate) {
+  GetInternedKeyTables().erase(static_cast<v8::Isolate*>(isolate));
+}
+
+v8::Local<v8::String> CreateSymbol(v8::Isolate* isolate,
+                                   base::StringPiece val) {
   return v8::String::NewFromUtf8(isolate, val.data(),
                                  v8::NewStringType::kInternalized,
                                  static_cast<uint32_t>(val.length()))
       .ToLocalChecked();
 }
 
+}  // namespace
+
+v8::Local<v8::String> StringToSymbol(v8::Isolate* isolate,
+                                     base::StringPiece val) {
+  // Property names come almost exclusively from C string literals, so the
+  // data pointer identifies the key across calls and the same handful of
+  // strings would otherwise be UTF-8 decoded and re-interned on every
+  // options-object parse. Entries are verified against the stored bytes
+  // before use, which keeps the cache correct for the rare heap-allocated
+  // key whose storage got reused.
+  auto& tables = GetInternedKeyTables();
+  auto tables_iter = tables.find(isolate);
+  if (tables_iter == tables.end()) {
+    // Without a node environment there is no teardown signal to purge
+    // the table on, so skip the cache entirely.
+    if (!isolate->InContext() ||
+        node::GetCurrentEnvironment(isolate->GetCurrentContext()) == nullptr)
+      return CreateSymbol(isolate, val);
+    node::AddEnvironmentCleanupHook(isolate, PurgeInternedKeyTable, isolate);
+    tables_iter = tables.emplace(isolate, InternedKeyTable()).first;
+  }
+
+  InternedKey& entry = tables_iter->second[val.data()];
+  if (!entry.handle.IsEmpty() && entry.bytes == val)
+    return entry.handle.Get(isolate);
+
+  v8::Local<v8::String> result = CreateSymbol(isolate, val);
+  entry.bytes = val.as_string();
+  entry.handle.Set(isolate, result);
+  return result;
+}
+
 }  // namespace mate
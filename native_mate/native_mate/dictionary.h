@@ -45,7 +45,7 @@ class Dictionary {
     // Check for existence before getting, otherwise this method will always
     // returns true when T == v8::Local<v8::Value>.
     v8::Local<v8::Context> context = isolate_->GetCurrentContext();
-    v8::Local<v8::String> v8_key = StringToV8(isolate_, key);
+    v8::Local<v8::String> v8_key = StringToSymbol(isolate_, key);
     if (!internal::IsTrue(GetHandle()->Has(context, v8_key)))
       return false;
 
@@ -61,7 +61,7 @@ class Dictionary {
     if (!TryConvertToV8(isolate_, val, &v8_value))
       return false;
     v8::Maybe<bool> result = GetHandle()->Set(
-        isolate_->GetCurrentContext(), StringToV8(isolate_, key), v8_value);
+        isolate_->GetCurrentContext(), StringToSymbol(isolate_, key), v8_value);
     return !result.IsNothing() && result.FromJust();
   }
 
@@ -71,7 +71,7 @@ class Dictionary {
     if (!TryConvertToV8(isolate_, val, &v8_value))
       return false;
     v8::Maybe<bool> result = GetHandle()->DefineOwnProperty(
-        isolate_->GetCurrentContext(), StringToV8(isolate_, key), v8_value,
+        isolate_->GetCurrentContext(), StringToSymbol(isolate_, key), v8_value,
         v8::ReadOnly);
     return !result.IsNothing() && result.FromJust();
   }
@@ -79,7 +79,7 @@ class Dictionary {
   template <typename T>
   bool SetMethod(base::StringPiece key, const T& callback) {
     return GetHandle()
-        ->Set(isolate_->GetCurrentContext(), StringToV8(isolate_, key),
+        ->Set(isolate_->GetCurrentContext(), StringToSymbol(isolate_, key),
               CallbackTraits<T>::CreateTemplate(isolate_, callback)
                   ->GetFunction(isolate_->GetCurrentContext())
                   .ToLocalChecked())
@@ -88,7 +88,7 @@ class Dictionary {
 
   bool Delete(base::StringPiece key) {
     v8::Maybe<bool> result = GetHandle()->Delete(isolate_->GetCurrentContext(),
-                                                 StringToV8(isolate_, key));
+                                                 StringToSymbol(isolate_, key));
     return !result.IsNothing() && result.FromJust();
   }
 
@@ -5,6 +5,8 @@
 #ifndef NATIVE_MATE_NATIVE_MATE_FUNCTION_TEMPLATE_H_
 #define NATIVE_MATE_NATIVE_MATE_FUNCTION_TEMPLATE_H_
 
+#include <type_traits>
+
 #include "base/callback.h"
 #include "native_mate/arguments.h"
 #include "native_mate/wrappable_base.h"
@@ -141,6 +143,21 @@ struct IndicesGenerator<0, indices...> {
   using type = IndicesHolder<indices...>;
 };
 
+// Parameters that are filled from the call context rather than converted
+// from a JavaScript argument. Extracting them never consumes an argument
+// and cannot fail, so which path each parameter takes is resolved at
+// template-instantiation time instead of being re-decided on every call.
+template <typename T>
+struct IsContextArgument : std::false_type {};
+template <>
+struct IsContextArgument<Arguments> : std::true_type {};
+template <>
+struct IsContextArgument<Arguments*> : std::true_type {};
+template <>
+struct IsContextArgument<v8::Isolate*> : std::true_type {};
+template <>
+struct IsContextArgument<gin_helper::ErrorThrower> : std::true_type {};
+
 // Class template for extracting and storing single argument for callback
 // at position |index|.
 template <size_t index, typename ArgType>
@@ -148,9 +165,30 @@ struct ArgumentHolder {
   using ArgLocalType = typename CallbackParamTraits<ArgType>::LocalType;
 
   ArgLocalType value;
-  bool ok = false;
+  bool ok;
+
+  ArgumentHolder(Arguments* args, int create_flags)
+      : ArgumentHolder(
+            args,
+            create_flags,
+            std::integral_constant<bool,
+                                   IsContextArgument<ArgLocalType>::value>()) {}
+
+ private:
+  // Context parameters skip the conversion failure bookkeeping entirely;
+  // the branch below compiles away for signatures made up of them.
+  ArgumentHolder(Arguments* args, int create_flags, std::true_type) : ok(true) {
+    if (index == 0 && (create_flags & HolderIsFirstArgument) &&
+        gin_helper::Destroyable::IsDestroyed(args->GetHolder())) {
+      args->ThrowError("Object has been destroyed");
+      ok = false;
+      return;
+    }
+    GetNextArgument(args, create_flags, index == 0, &value);
+  }
 
-  ArgumentHolder(Arguments* args, int create_flags) {
+  ArgumentHolder(Arguments* args, int create_flags, std::false_type)
+      : ok(false) {
     if (index == 0 && (create_flags & HolderIsFirstArgument) &&
         gin_helper::Destroyable::IsDestroyed(args->GetHolder())) {
       args->ThrowError("Object has been destroyed");
@@ -226,10 +264,11 @@ struct Dispatcher<ReturnType(ArgTypes...)> {
   static void DispatchToCallback(
       const v8::FunctionCallbackInfo<v8::Value>& info) {
     Arguments args(info);
-    v8::Local<v8::External> v8_holder;
-    args.GetData(&v8_holder);
-    CallbackHolderBase* holder_base =
-        reinterpret_cast<CallbackHolderBase*>(v8_holder->Value());
+    // The data is always the v8::External installed by
+    // CreateFunctionTemplate; decode it directly rather than running a
+    // converter round trip on every call.
+    CallbackHolderBase* holder_base = static_cast<CallbackHolderBase*>(
+        v8::Local<v8::External>::Cast(info.Data())->Value());
 
     typedef CallbackHolder<ReturnType(ArgTypes...)> HolderT;
     HolderT* holder = static_cast<HolderT*>(holder_base);
@@ -28,6 +28,14 @@ ObjectTemplateBuilder& ObjectTemplateBuilder::SetPropertyImpl(
   return *this;
 }
 
+ObjectTemplateBuilder& ObjectTemplateBuilder::SetLazyMethodImpl(
+    base::StringPiece name,
+    v8::AccessorNameGetterCallback getter,
+    v8::Local<v8::Value> data) {
+  template_->SetLazyDataProperty(StringToSymbol(isolate_, name), getter, data);
+  return *this;
+}
+
 v8::Local<v8::ObjectTemplate> ObjectTemplateBuilder::Build() {
   v8::Local<v8::ObjectTemplate> result = template_;
   template_.Clear();
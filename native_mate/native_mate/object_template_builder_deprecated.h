@@ -5,6 +5,8 @@
 #ifndef NATIVE_MATE_NATIVE_MATE_OBJECT_TEMPLATE_BUILDER_DEPRECATED_H_
 #define NATIVE_MATE_NATIVE_MATE_OBJECT_TEMPLATE_BUILDER_DEPRECATED_H_
 
+#include <utility>
+
 #include "base/bind.h"
 #include "base/callback.h"
 #include "base/strings/string_piece.h"
@@ -60,6 +62,38 @@ struct CallbackTraits<v8::Local<v8::FunctionTemplate>> {
   }
 };
 
+namespace internal {
+
+// Keeps the C++ callback alive until the lazy getter below materializes the
+// method. Deliberately leaked: it has the same lifetime as the object
+// template it is installed on, which lives as long as the isolate.
+template <typename T>
+struct LazyMethodHolder {
+  explicit LazyMethodHolder(T callback) : callback(std::move(callback)) {}
+  T callback;
+};
+
+// Creates the bound function for a method the first time it is accessed.
+// v8 then replaces the lazy property with a plain data property holding the
+// function, so every later lookup is as cheap as an eagerly installed one.
+template <typename T>
+void LazyMethodGetter(v8::Local<v8::Name> name,
+                      const v8::PropertyCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  T& callback = static_cast<LazyMethodHolder<T>*>(
+                    v8::Local<v8::External>::Cast(info.Data())->Value())
+                    ->callback;
+  v8::Local<v8::Function> function;
+  if (CallbackTraits<T>::CreateTemplate(isolate, callback)
+          ->GetFunction(isolate->GetCurrentContext())
+          .ToLocal(&function)) {
+    function->SetName(v8::Local<v8::String>::Cast(name));
+    info.GetReturnValue().Set(function);
+  }
+}
+
+}  // namespace internal
+
 // ObjectTemplateBuilder provides a handy interface to creating
 // v8::ObjectTemplate instances with various sorts of properties.
 class ObjectTemplateBuilder {
@@ -82,7 +116,19 @@ class ObjectTemplateBuilder {
   // for creating raw function templates.
   template <typename T>
   ObjectTemplateBuilder& SetMethod(base::StringPiece name, T callback) {
-    return SetImpl(name, CallbackTraits<T>::CreateTemplate(isolate_, callback));
+    // Creating a function template for every method is the bulk of the cost
+    // of building a prototype; classes like WebContents install dozens of
+    // methods the app may never call. Defer the template creation until the
+    // method is first accessed.
+    return SetLazyMethodImpl(
+        name, &internal::LazyMethodGetter<T>,
+        v8::External::New(isolate_,
+                          new internal::LazyMethodHolder<T>(callback)));
+  }
+  // Function templates built by the caller have to be installed eagerly.
+  ObjectTemplateBuilder& SetMethod(base::StringPiece name,
+                                   v8::Local<v8::FunctionTemplate> templ) {
+    return SetImpl(name, templ);
   }
   template <typename T>
   ObjectTemplateBuilder& SetProperty(base::StringPiece name, T getter) {
@@ -108,6 +154,9 @@ class ObjectTemplateBuilder {
       base::StringPiece name,
       v8::Local<v8::FunctionTemplate> getter,
       v8::Local<v8::FunctionTemplate> setter);
+  ObjectTemplateBuilder& SetLazyMethodImpl(base::StringPiece name,
+                                           v8::AccessorNameGetterCallback getter,
+                                           v8::Local<v8::Value> data);
 
   v8::Isolate* isolate_;
 
@@ -4,13 +4,104 @@
 
 #include "native_mate/wrappable.h"
 
+#include <stdlib.h>
+
 #include "base/logging.h"
+#include "base/macros.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
 #include "gin/arguments.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder_deprecated.h"
 
 namespace mate {
 
+namespace {
+
+// Size-classed pool backing WrappableBase allocation. Each block carries
+// a small header recording its size class so plain (unsized) delete can
+// return it to the right free list. The header is pointer-size aligned
+// padding, so the object itself keeps the alignment malloc provided.
+constexpr size_t kPoolHeaderSize = 16;
+constexpr size_t kBucketSizes[] = {64, 128, 256, 512, 1024};
+constexpr int kBucketCount = static_cast<int>(base::size(kBucketSizes));
+
+// Bounds how much memory an idle pool can pin per size class.
+constexpr size_t kMaxFreeBlocksPerBucket = 256;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+// Wrappables are created and collected on isolate threads; the browser
+// and renderer each have one, but a worker isolate may share the pool,
+// so mutate under a lock. The fast path is a pointer swap.
+struct WrappablePool {
+  base::Lock lock;
+  FreeBlock* free_lists[kBucketCount] = {};
+  size_t free_counts[kBucketCount] = {};
+};
+
+WrappablePool& GetWrappablePool() {
+  static base::NoDestructor<WrappablePool> pool;
+  return *pool;
+}
+
+int BucketForSize(size_t total) {
+  for (int i = 0; i < kBucketCount; ++i) {
+    if (total <= kBucketSizes[i])
+      return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+// static
+void* WrappableBase::operator new(size_t size) {
+  const size_t total = size + kPoolHeaderSize;
+  const int bucket = BucketForSize(total);
+
+  void* block = nullptr;
+  if (bucket >= 0) {
+    WrappablePool& pool = GetWrappablePool();
+    base::AutoLock lock(pool.lock);
+    if (pool.free_lists[bucket]) {
+      block = pool.free_lists[bucket];
+      pool.free_lists[bucket] = pool.free_lists[bucket]->next;
+      --pool.free_counts[bucket];
+    }
+  }
+  if (!block) {
+    block = malloc(bucket >= 0 ? kBucketSizes[bucket] : total);
+    CHECK(block);
+  }
+
+  *static_cast<int*>(block) = bucket;
+  return static_cast<char*>(block) + kPoolHeaderSize;
+}
+
+// static
+void WrappableBase::operator delete(void* ptr) {
+  if (!ptr)
+    return;
+
+  void* block = static_cast<char*>(ptr) - kPoolHeaderSize;
+  const int bucket = *static_cast<int*>(block);
+  if (bucket >= 0) {
+    WrappablePool& pool = GetWrappablePool();
+    base::AutoLock lock(pool.lock);
+    if (pool.free_counts[bucket] < kMaxFreeBlocksPerBucket) {
+      auto* free_block = static_cast<FreeBlock*>(block);
+      free_block->next = pool.free_lists[bucket];
+      pool.free_lists[bucket] = free_block;
+      ++pool.free_counts[bucket];
+      return;
+    }
+  }
+  free(block);
+}
+
 WrappableBase::WrappableBase() = default;
 
 WrappableBase::~WrappableBase() {
@@ -5,6 +5,8 @@
 #ifndef NATIVE_MATE_NATIVE_MATE_WRAPPABLE_BASE_H_
 #define NATIVE_MATE_NATIVE_MATE_WRAPPABLE_BASE_H_
 
+#include <stddef.h>
+
 namespace gin {
 class Arguments;
 struct Destroyable;
@@ -33,6 +35,13 @@ class WrappableBase {
   WrappableBase();
   virtual ~WrappableBase();
 
+  // Wrappable instances churn constantly (events, menu items, requests),
+  // so allocation goes through a size-classed pool: blocks freed on the
+  // weak-callback death path are kept on per-class free lists and reused
+  // by the next allocation instead of going back to the system allocator.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   // Retrieve the v8 wrapper object cooresponding to this object.
   v8::Local<v8::Object> GetWrapper() const;
   v8::MaybeLocal<v8::Object> GetWrapper(v8::Isolate* isolate) const;
@@ -4,6 +4,8 @@
 
 #include "shell/browser/api/atom_api_app.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 
 #include <string>
@@ -13,9 +15,11 @@
 #include "base/environment.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/optional.h"
 #include "base/path_service.h"
 #include "base/system/sys_info.h"
+#include "base/task/thread_pool/thread_pool_instance.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/common/chrome_paths.h"
@@ -27,8 +31,14 @@
 #include "content/public/browser/client_certificate_delegate.h"
 #include "content/public/browser/gpu_data_manager.h"
 #include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
 #include "content/public/common/content_switches.h"
+#include "electron/shell/common/api/api.mojom.h"
+#include "extensions/common/url_pattern.h"
 #include "media/audio/audio_manager.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "net/http/http_network_session.h"
+#include "net/socket/client_socket_pool_manager.h"
 #include "net/ssl/client_cert_identity.h"
 #include "net/ssl/ssl_cert_request_info.h"
 #include "services/service_manager/sandbox/switches.h"
@@ -36,11 +46,16 @@
 #include "shell/browser/api/atom_api_session.h"
 #include "shell/browser/api/atom_api_web_contents.h"
 #include "shell/browser/api/gpuinfo_manager.h"
+#include "shell/browser/api/process_metrics_sampler.h"
 #include "shell/browser/atom_browser_context.h"
 #include "shell/browser/atom_browser_main_parts.h"
 #include "shell/browser/atom_paths.h"
+#include "shell/browser/javascript_environment.h"
 #include "shell/browser/login_handler.h"
+#include "shell/browser/microtasks_runner.h"
 #include "shell/browser/relauncher.h"
+#include "shell/browser/responsiveness_watchdog.h"
+#include "shell/browser/ui/inspectable_web_contents_impl.h"
 #include "shell/common/application_info.h"
 #include "shell/common/atom_command_line.h"
 #include "shell/common/gin_converters/callback_converter.h"
@@ -51,7 +66,10 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/ipc_metrics.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/pooled_array_buffer_allocator.h"
+#include "shell/common/startup_metrics.h"
 #include "shell/common/options_switches.h"
 #include "ui/gfx/image/image.h"
 
@@ -498,10 +516,13 @@ void OnClientCertificateSelected(
 void PassLoginInformation(scoped_refptr<LoginHandler> login_handler,
                           gin_helper::Arguments* args) {
   base::string16 username, password;
-  if (args->GetNext(&username) && args->GetNext(&password))
-    login_handler->Login(username, password);
-  else
+  if (args->GetNext(&username) && args->GetNext(&password)) {
+    bool remember = false;
+    args->GetNext(&remember);
+    login_handler->Login(username, password, remember);
+  } else {
     login_handler->CancelAuth();
+  }
 }
 
 #if defined(USE_NSS_CERTS)
@@ -540,6 +561,49 @@ void OnIconDataAvailable(util::Promise<gfx::Image> promise, gfx::Image icon) {
   }
 }
 
+// Shared state for a getFileIcons batch; the promise resolves once every
+// missing icon has been loaded.
+struct FileIconBatch {
+  explicit FileIconBatch(util::Promise<std::vector<gfx::Image>> p)
+      : promise(std::move(p)) {}
+
+  util::Promise<std::vector<gfx::Image>> promise;
+  std::vector<gfx::Image> icons;
+  size_t pending = 0;
+};
+
+void OnBatchIconDataAvailable(std::shared_ptr<FileIconBatch> batch,
+                              const std::vector<size_t>& indices,
+                              gfx::Image icon) {
+  // Paths whose icon cannot be determined get an empty image instead of
+  // failing the whole batch.
+  for (size_t index : indices)
+    batch->icons[index] = icon;
+  if (--batch->pending == 0)
+    batch->promise.ResolveWithGin(batch->icons);
+}
+
+// Creates a fresh ProcessMetric for the metrics sampler. The sampler cannot
+// share the instances in |app_metrics_|: CPU usage is a delta since the last
+// query, so two readers of one instance would corrupt each other.
+std::unique_ptr<electron::ProcessMetric> MakeSamplerMetric(
+    int process_type,
+    base::ProcessHandle handle) {
+  if (base::GetProcId(handle) == base::GetCurrentProcId()) {
+    return std::make_unique<electron::ProcessMetric>(
+        content::PROCESS_TYPE_BROWSER, base::GetCurrentProcessHandle(),
+        base::ProcessMetrics::CreateCurrentProcessMetrics());
+  }
+#if defined(OS_MACOSX)
+  auto metrics = base::ProcessMetrics::CreateProcessMetrics(
+      handle, content::BrowserChildProcessHost::GetPortProvider());
+#else
+  auto metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
+#endif
+  return std::make_unique<electron::ProcessMetric>(process_type, handle,
+                                                   std::move(metrics));
+}
+
 }  // namespace
 
 App::App(v8::Isolate* isolate) {
@@ -831,10 +895,16 @@ void App::ChildProcessLaunched(int process_type, base::ProcessHandle handle) {
 #endif
   app_metrics_[pid] = std::make_unique<electron::ProcessMetric>(
       process_type, handle, std::move(metrics));
+
+  if (metrics_sampler_ && metrics_sampler_->IsRunning())
+    metrics_sampler_->AddProcess(MakeSamplerMetric(process_type, handle));
 }
 
 void App::ChildProcessDisconnected(base::ProcessId pid) {
   app_metrics_.erase(pid);
+
+  if (metrics_sampler_)
+    metrics_sampler_->RemoveProcess(pid);
 }
 
 base::FilePath App::GetAppPath() const {
@@ -1198,6 +1268,54 @@ v8::Local<v8::Promise> App::GetFileIcon(const base::FilePath& path,
   return handle;
 }
 
+v8::Local<v8::Promise> App::GetFileIcons(
+    const std::vector<base::FilePath>& paths,
+    gin_helper::Arguments* args) {
+  util::Promise<std::vector<gfx::Image>> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  IconLoader::IconSize icon_size;
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options)) {
+    icon_size = IconLoader::IconSize::NORMAL;
+  } else {
+    std::string icon_size_string;
+    options.Get("size", &icon_size_string);
+    icon_size = GetIconSizeByString(icon_size_string);
+  }
+
+  auto* icon_manager = AtomBrowserMainParts::Get()->GetIconManager();
+  auto batch = std::make_shared<FileIconBatch>(std::move(promise));
+  batch->icons.resize(paths.size());
+
+  // Serve cache hits synchronously and coalesce duplicate misses, so a
+  // file list full of same-type entries costs one platform query.
+  std::map<base::FilePath, std::vector<size_t>> misses;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    base::FilePath normalized_path = paths[i].NormalizePathSeparators();
+    gfx::Image* icon =
+        icon_manager->LookupIconFromFilepath(normalized_path, icon_size);
+    if (icon)
+      batch->icons[i] = *icon;
+    else
+      misses[normalized_path].push_back(i);
+  }
+
+  if (misses.empty()) {
+    batch->promise.ResolveWithGin(batch->icons);
+    return handle;
+  }
+
+  batch->pending = misses.size();
+  for (const auto& miss : misses) {
+    icon_manager->LoadIcon(
+        miss.first, icon_size,
+        base::BindOnce(&OnBatchIconDataAvailable, batch, miss.second),
+        &cancelable_task_tracker_);
+  }
+  return handle;
+}
+
 std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   std::vector<gin_helper::Dictionary> result;
   result.reserve(app_metrics_.size());
@@ -1271,6 +1389,231 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+void App::StartAppMetricsSampling(gin_helper::Arguments* args) {
+  int interval_ms = 1000;
+  int max_samples = 60;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("interval", &interval_ms);
+    options.Get("maxSamples", &max_samples);
+  }
+
+  if (!metrics_sampler_)
+    metrics_sampler_ = std::make_unique<ProcessMetricsSampler>();
+  metrics_sampler_->Start(
+      base::TimeDelta::FromMilliseconds(std::max(100, interval_ms)),
+      static_cast<size_t>(std::max(1, max_samples)));
+
+  // Seed the sampler with every process alive right now; later launches and
+  // exits flow in through ChildProcessLaunched/ChildProcessDisconnected.
+  for (const auto& process_metric : app_metrics_) {
+    metrics_sampler_->AddProcess(
+        MakeSamplerMetric(process_metric.second->type,
+                          process_metric.second->process.Handle()));
+  }
+}
+
+void App::StopAppMetricsSampling() {
+  if (metrics_sampler_)
+    metrics_sampler_->Stop();
+}
+
+v8::Local<v8::Promise> App::GetAppMetricsHistory(v8::Isolate* isolate) {
+  util::Promise<base::Value> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!metrics_sampler_) {
+    promise.ResolveWithGin(base::Value(base::Value::Type::LIST));
+    return handle;
+  }
+
+  metrics_sampler_->GetHistory(base::BindOnce(
+      [](util::Promise<base::Value> promise, base::Value history) {
+        promise.ResolveWithGin(history);
+      },
+      std::move(promise)));
+  return handle;
+}
+
+std::vector<gin_helper::Dictionary> App::GetIPCMetrics(v8::Isolate* isolate) {
+  // Counters recorded by the UI-thread IPC dispatch; this method runs on the
+  // same thread, so it reads the same thread-local instance.
+  const auto& metrics = IPCMetrics::Get()->metrics();
+
+  std::vector<gin_helper::Dictionary> result;
+  result.reserve(metrics.size());
+
+  for (const auto& entry : metrics) {
+    gin_helper::Dictionary channel_dict = gin::Dictionary::CreateEmpty(isolate);
+    // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+    gin_helper::Dictionary(isolate, channel_dict.GetHandle())
+        .SetHidden("simple", true);
+
+    channel_dict.Set("channel", entry.first);
+    channel_dict.Set("messageCount",
+                     static_cast<double>(entry.second.message_count));
+    channel_dict.Set("totalBytes",
+                     static_cast<double>(entry.second.total_bytes));
+    channel_dict.Set("totalDispatchTime",
+                     entry.second.total_dispatch_time.InMillisecondsF());
+    channel_dict.Set("maxDispatchTime",
+                     entry.second.max_dispatch_time.InMillisecondsF());
+
+    result.push_back(channel_dict);
+  }
+
+  return result;
+}
+
+std::vector<gin_helper::Dictionary> App::GetStartupMetrics(
+    v8::Isolate* isolate) {
+  auto* metrics = StartupMetrics::Get();
+  size_t count = metrics->sample_count();
+
+  std::vector<gin_helper::Dictionary> result;
+  result.reserve(count);
+
+  // Times are reported relative to the first recorded phase so telemetry can
+  // diff adjacent samples into per-phase durations.
+  base::TimeTicks origin =
+      count > 0 ? metrics->samples()[0].ticks : base::TimeTicks();
+
+  for (size_t i = 0; i < count; ++i) {
+    const StartupMetrics::Sample& sample = metrics->samples()[i];
+
+    gin_helper::Dictionary phase_dict = gin::Dictionary::CreateEmpty(isolate);
+    // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+    gin_helper::Dictionary(isolate, phase_dict.GetHandle())
+        .SetHidden("simple", true);
+
+    phase_dict.Set("phase", sample.phase);
+    phase_dict.Set("time", (sample.ticks - origin).InMillisecondsF());
+
+    result.push_back(phase_dict);
+  }
+
+  return result;
+}
+
+gin_helper::Dictionary App::GetMicrotaskMetrics(v8::Isolate* isolate) {
+  const MicrotasksRunner::Metrics& metrics = MicrotasksRunner::GetMetrics();
+
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+  gin_helper::Dictionary(isolate, dict.GetHandle()).SetHidden("simple", true);
+
+  dict.Set("checkpointCount", static_cast<double>(metrics.checkpoint_count));
+  dict.Set("totalTime", metrics.total_time.InMillisecondsF());
+  dict.Set("maxTime", metrics.max_time.InMillisecondsF());
+  dict.Set("overBudgetCount", static_cast<double>(metrics.over_budget_count));
+  dict.Set("deferredCount", static_cast<double>(metrics.deferred_count));
+  return dict;
+}
+
+gin_helper::Dictionary App::GetResponsivenessReport(v8::Isolate* isolate) {
+  ResponsivenessWatchdog::Report report =
+      ResponsivenessWatchdog::GetInstance()->GetReport();
+
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+  gin_helper::Dictionary(isolate, dict.GetHandle()).SetHidden("simple", true);
+
+  dict.Set("stallCount", report.stall_count);
+  dict.Set("totalStallTime", report.total_stall_time.InMillisecondsF());
+  dict.Set("longestStall", report.longest_stall.InMillisecondsF());
+
+  std::vector<gin_helper::Dictionary> profiles;
+  profiles.reserve(report.profiles.size());
+  for (const auto& profile : report.profiles) {
+    gin_helper::Dictionary profile_dict = gin::Dictionary::CreateEmpty(isolate);
+    gin_helper::Dictionary(isolate, profile_dict.GetHandle())
+        .SetHidden("simple", true);
+    profile_dict.Set("stack", profile.stack);
+    profile_dict.Set("sampleCount", profile.sample_count);
+    profiles.push_back(profile_dict);
+  }
+  dict.Set("profiles", profiles);
+  return dict;
+}
+
+gin_helper::Dictionary App::GetThreadPoolMetrics(v8::Isolate* isolate) {
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+  gin_helper::Dictionary(isolate, dict.GetHandle()).SetHidden("simple", true);
+
+  // How many tasks of each priority Chromium's pool would run concurrently
+  // right now; the pool sizes itself from the core count at startup.
+  auto* thread_pool = base::ThreadPoolInstance::Get();
+  if (thread_pool) {
+    dict.Set(
+        "foregroundPoolSize",
+        thread_pool->GetMaxConcurrentNonBlockedTasksWithTraitsDeprecated(
+            {base::TaskPriority::USER_VISIBLE}));
+    dict.Set(
+        "backgroundPoolSize",
+        thread_pool->GetMaxConcurrentNonBlockedTasksWithTraitsDeprecated(
+            {base::TaskPriority::BEST_EFFORT}));
+  }
+  dict.Set("nodeWorkerPoolSize",
+           JavascriptEnvironment::GetNodeWorkerPoolSize());
+  return dict;
+}
+
+void App::SetMicrotaskCheckpointBudget(int budget_ms) {
+  if (budget_ms < 0)
+    budget_ms = 0;
+  MicrotasksRunner::SetCheckpointBudget(
+      base::TimeDelta::FromMilliseconds(budget_ms));
+}
+
+gin_helper::Dictionary App::GetSocketLimits(v8::Isolate* isolate) {
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  // TODO(zcbenz): Just call SetHidden when this file is converted to gin.
+  gin_helper::Dictionary(isolate, dict.GetHandle()).SetHidden("simple", true);
+
+  // Reading the pool statics is valid because the network service runs in
+  // the browser process; they reflect both the defaults and any values set
+  // through the socket limit switches.
+  dict.Set("maxSocketsPerHost",
+           net::ClientSocketPoolManager::max_sockets_per_group(
+               net::HttpNetworkSession::NORMAL_SOCKET_POOL));
+  dict.Set("maxConnectionsPerProxy",
+           net::ClientSocketPoolManager::max_sockets_per_proxy_server(
+               net::HttpNetworkSession::NORMAL_SOCKET_POOL));
+  return dict;
+}
+
+void App::TriggerMemoryCleanup(gin_helper::Arguments* args) {
+  std::string level = "moderate";
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("level", &level);
+  if (level != "moderate" && level != "critical") {
+    args->ThrowError("Invalid level: must be 'moderate' or 'critical'");
+    return;
+  }
+  bool critical = level == "critical";
+
+  // Browser process: every memory pressure listener reacts, including the
+  // main isolate, the array buffer pool and the OSR bitmap pool.
+  base::MemoryPressureListener::NotifyMemoryPressure(
+      critical ? base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
+               : base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+
+  // Renderers: fire-and-forget, mirroring the crash reporter's pipe name
+  // broadcast.
+  for (auto* page : InspectableWebContentsImpl::GetAll()) {
+    auto* frame_host = page->GetWebContents()->GetMainFrame();
+    if (!frame_host)
+      continue;
+
+    mojo::AssociatedRemote<mojom::ElectronRenderer> electron_renderer;
+    frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+        &electron_renderer);
+    electron_renderer->TriggerMemoryCleanup(critical);
+  }
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   auto status = content::GetFeatureStatus();
   base::DictionaryValue temp;
@@ -1333,6 +1676,70 @@ void App::EnableSandbox(gin_helper::ErrorThrower thrower) {
   command_line->AppendSwitch(switches::kEnableSandbox);
 }
 
+void App::SetArrayBufferPoolLimit(int limit_bytes) {
+  if (limit_bytes < 0)
+    limit_bytes = 0;
+  PooledArrayBufferAllocator::SharedInstance()->SetPoolLimitPerClass(
+      static_cast<size_t>(limit_bytes));
+}
+
+void App::SetRendererProcessPoolSize(int size) {
+  auto* browser_client = AtomBrowserClient::Get();
+  browser_client->SetRendererProcessPoolSize(size);
+  // When the app is already running, spin up the spare right away so the
+  // next window creation can claim it; before that the first renderer
+  // launch replenishes the pool.
+  if (size > 0 && Browser::Get()->is_ready()) {
+    auto browser_context = AtomBrowserContext::From("", false);
+    browser_client->WarmupSpareRenderProcess(browser_context.get());
+  }
+}
+
+int App::GetRendererProcessPoolSize() {
+  return AtomBrowserClient::Get()->renderer_process_pool_size();
+}
+
+void App::SetProcessConsolidationPolicy(gin_helper::Arguments* args) {
+  std::string mode = "default";
+  int max_process_count = 0;
+  std::vector<std::string> pinned_url_patterns;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("mode", &mode);
+    options.Get("maxProcessCount", &max_process_count);
+    options.Get("pinnedURLPatterns", &pinned_url_patterns);
+  }
+
+  if (mode != "default" && mode != "process-per-site") {
+    args->ThrowError(
+        "Invalid mode: must be 'default' or 'process-per-site'");
+    return;
+  }
+  if (max_process_count < 0) {
+    args->ThrowError("maxProcessCount must not be negative");
+    return;
+  }
+
+  std::vector<URLPattern> pinned_patterns;
+  for (const std::string& pattern_string : pinned_url_patterns) {
+    URLPattern pattern(URLPattern::SCHEME_ALL);
+    const URLPattern::ParseResult result = pattern.Parse(pattern_string);
+    if (result != URLPattern::ParseResult::kSuccess) {
+      args->ThrowError("Invalid url pattern " + pattern_string + ": " +
+                       URLPattern::GetParseResultString(result));
+      return;
+    }
+    pinned_patterns.push_back(std::move(pattern));
+  }
+
+  AtomBrowserClient::Get()->SetProcessConsolidationPolicy(
+      mode == "process-per-site", std::move(pinned_patterns));
+  // 0 restores the platform default limit; over the cap the content layer
+  // reuses existing renderer processes for new site instances.
+  content::RenderProcessHost::SetMaxRendererProcessCount(
+      static_cast<size_t>(max_process_count));
+}
+
 void App::SetUserAgentFallback(const std::string& user_agent) {
   AtomBrowserClient::Get()->SetUserAgent(user_agent);
 }
@@ -1520,7 +1927,20 @@ void App::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("disableDomainBlockingFor3DAPIs",
                  &App::DisableDomainBlockingFor3DAPIs)
       .SetMethod("getFileIcon", &App::GetFileIcon)
+      .SetMethod("getFileIcons", &App::GetFileIcons)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("startAppMetricsSampling", &App::StartAppMetricsSampling)
+      .SetMethod("stopAppMetricsSampling", &App::StopAppMetricsSampling)
+      .SetMethod("getAppMetricsHistory", &App::GetAppMetricsHistory)
+      .SetMethod("getIPCMetrics", &App::GetIPCMetrics)
+      .SetMethod("getStartupMetrics", &App::GetStartupMetrics)
+      .SetMethod("getMicrotaskMetrics", &App::GetMicrotaskMetrics)
+      .SetMethod("getResponsivenessReport", &App::GetResponsivenessReport)
+      .SetMethod("getThreadPoolMetrics", &App::GetThreadPoolMetrics)
+      .SetMethod("setMicrotaskCheckpointBudget",
+                 &App::SetMicrotaskCheckpointBudget)
+      .SetMethod("getSocketLimits", &App::GetSocketLimits)
+      .SetMethod("triggerMemoryCleanup", &App::TriggerMemoryCleanup)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if defined(MAS_BUILD)
@@ -1533,6 +1953,13 @@ void App::BuildPrototype(v8::Isolate* isolate,
       .SetProperty("userAgentFallback", &App::GetUserAgentFallback,
                    &App::SetUserAgentFallback)
       .SetMethod("enableSandbox", &App::EnableSandbox)
+      .SetMethod("setArrayBufferPoolLimit", &App::SetArrayBufferPoolLimit)
+      .SetMethod("setRendererProcessPoolSize",
+                 &App::SetRendererProcessPoolSize)
+      .SetMethod("getRendererProcessPoolSize",
+                 &App::GetRendererProcessPoolSize)
+      .SetMethod("setProcessConsolidationPolicy",
+                 &App::SetProcessConsolidationPolicy)
       .SetProperty("allowRendererProcessReuse",
                    &App::CanBrowserClientUseCustomSiteInstance,
                    &App::SetBrowserClientCanUseCustomSiteInstance);
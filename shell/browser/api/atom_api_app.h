@@ -44,6 +44,8 @@ namespace electron {
 enum class JumpListResult : int;
 #endif
 
+class ProcessMetricsSampler;
+
 namespace api {
 
 class App : public AtomBrowserClient::Delegate,
@@ -191,12 +193,29 @@ class App : public AtomBrowserClient::Delegate,
 #endif
   v8::Local<v8::Promise> GetFileIcon(const base::FilePath& path,
                                      gin_helper::Arguments* args);
+  v8::Local<v8::Promise> GetFileIcons(const std::vector<base::FilePath>& paths,
+                                      gin_helper::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  void StartAppMetricsSampling(gin_helper::Arguments* args);
+  void StopAppMetricsSampling();
+  v8::Local<v8::Promise> GetAppMetricsHistory(v8::Isolate* isolate);
+  std::vector<gin_helper::Dictionary> GetIPCMetrics(v8::Isolate* isolate);
+  std::vector<gin_helper::Dictionary> GetStartupMetrics(v8::Isolate* isolate);
+  gin_helper::Dictionary GetMicrotaskMetrics(v8::Isolate* isolate);
+  gin_helper::Dictionary GetResponsivenessReport(v8::Isolate* isolate);
+  gin_helper::Dictionary GetThreadPoolMetrics(v8::Isolate* isolate);
+  void SetMicrotaskCheckpointBudget(int budget_ms);
+  gin_helper::Dictionary GetSocketLimits(v8::Isolate* isolate);
+  void TriggerMemoryCleanup(gin_helper::Arguments* args);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
                                     const std::string& info_type);
   void EnableSandbox(gin_helper::ErrorThrower thrower);
+  void SetArrayBufferPoolLimit(int limit_bytes);
+  void SetRendererProcessPoolSize(int size);
+  int GetRendererProcessPoolSize();
+  void SetProcessConsolidationPolicy(gin_helper::Arguments* args);
   void SetUserAgentFallback(const std::string& user_agent);
   std::string GetUserAgentFallback();
   void SetBrowserClientCanUseCustomSiteInstance(bool should_disable);
@@ -239,6 +258,10 @@ class App : public AtomBrowserClient::Delegate,
                          std::unique_ptr<electron::ProcessMetric>>;
   ProcessMetricMap app_metrics_;
 
+  // Created on first startAppMetricsSampling() call; see
+  // process_metrics_sampler.h.
+  std::unique_ptr<ProcessMetricsSampler> metrics_sampler_;
+
   DISALLOW_COPY_AND_ASSIGN(App);
 };
 
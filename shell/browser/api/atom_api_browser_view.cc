@@ -123,6 +123,14 @@ void BrowserView::SetBackgroundColor(const std::string& color_name) {
   view_->SetBackgroundColor(ParseHexColor(color_name));
 }
 
+void BrowserView::SetVisible(bool visible) {
+  view_->SetVisible(visible);
+}
+
+bool BrowserView::IsVisible() {
+  return view_->IsVisible();
+}
+
 v8::Local<v8::Value> BrowserView::GetWebContents() {
   if (web_contents_.IsEmpty()) {
     return v8::Null(isolate());
@@ -141,6 +149,8 @@ void BrowserView::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setBounds", &BrowserView::SetBounds)
       .SetMethod("getBounds", &BrowserView::GetBounds)
       .SetMethod("setBackgroundColor", &BrowserView::SetBackgroundColor)
+      .SetMethod("setVisible", &BrowserView::SetVisible)
+      .SetMethod("isVisible", &BrowserView::IsVisible)
       .SetProperty("webContents", &BrowserView::GetWebContents)
       .SetProperty("id", &BrowserView::ID);
 }
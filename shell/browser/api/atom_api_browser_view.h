@@ -56,6 +56,8 @@ class BrowserView : public gin_helper::TrackableObject<BrowserView>,
   void SetBounds(const gfx::Rect& bounds);
   gfx::Rect GetBounds();
   void SetBackgroundColor(const std::string& color_name);
+  void SetVisible(bool visible);
+  bool IsVisible();
 
   v8::Local<v8::Value> GetWebContents();
 
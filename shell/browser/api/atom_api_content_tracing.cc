@@ -2,14 +2,19 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
 
+#include "base/files/file.h"
 #include "base/files/file_util.h"
+#include "base/logging.h"
 #include "base/optional.h"
+#include "base/task/post_task.h"
 #include "base/threading/thread_restrictions.h"
 #include "content/public/browser/tracing_controller.h"
+#include "third_party/zlib/google/compression_utils.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
@@ -56,6 +61,70 @@ namespace {
 
 using CompletionCallback = base::OnceCallback<void(const base::FilePath&)>;
 
+// Streams gzip-compressed trace chunks to a file from a blocking sequence as
+// they arrive from the tracing service, so stopping a large trace neither
+// accumulates it in memory nor stalls on one big synchronous flush. Each
+// chunk becomes its own gzip member; concatenated members form a valid gzip
+// stream (RFC 1952), so the file decompresses as a whole.
+class CompressedFileEndpoint : public TracingController::TraceDataEndpoint {
+ public:
+  CompressedFileEndpoint(const base::FilePath& path,
+                         base::OnceClosure completion_callback)
+      : path_(path),
+        completion_callback_(std::move(completion_callback)),
+        task_runner_(base::CreateSequencedTaskRunner(
+            {base::ThreadPool(), base::MayBlock(),
+             base::TaskPriority::USER_VISIBLE})) {}
+
+  // TracingController::TraceDataEndpoint:
+  void ReceiveTraceChunk(std::unique_ptr<std::string> chunk) override {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&CompressedFileEndpoint::WriteChunk, this,
+                                  std::move(chunk)));
+  }
+
+  void ReceivedTraceFinalContents() override {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&CompressedFileEndpoint::Finish, this));
+  }
+
+ private:
+  ~CompressedFileEndpoint() override = default;
+
+  void WriteChunk(std::unique_ptr<std::string> chunk) {
+    if (failed_)
+      return;
+    if (!file_.IsValid()) {
+      file_.Initialize(path_, base::File::FLAG_CREATE_ALWAYS |
+                                  base::File::FLAG_WRITE);
+      if (!file_.IsValid()) {
+        LOG(ERROR) << "Failed to open " << path_.value() << " for trace data";
+        failed_ = true;
+        return;
+      }
+    }
+    std::string compressed;
+    if (!compression::GzipCompress(*chunk, &compressed)) {
+      failed_ = true;
+      return;
+    }
+    int size = static_cast<int>(compressed.size());
+    if (file_.WriteAtCurrentPos(compressed.data(), size) != size)
+      failed_ = true;
+  }
+
+  void Finish() {
+    file_.Close();
+    std::move(completion_callback_).Run();
+  }
+
+  base::FilePath path_;
+  base::File file_;
+  bool failed_ = false;
+  base::OnceClosure completion_callback_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+};
+
 base::Optional<base::FilePath> CreateTemporaryFileOnIO() {
   base::FilePath temp_file_path;
   if (!base::CreateTemporaryFile(&temp_file_path))
@@ -64,13 +133,19 @@ base::Optional<base::FilePath> CreateTemporaryFileOnIO() {
 }
 
 void StopTracing(electron::util::Promise<base::FilePath> promise,
+                 bool compress,
                  base::Optional<base::FilePath> file_path) {
   if (file_path) {
-    auto endpoint = TracingController::CreateFileEndpoint(
-        *file_path,
-        base::AdaptCallbackForRepeating(base::BindOnce(
-            &electron::util::Promise<base::FilePath>::ResolvePromise,
-            std::move(promise), *file_path)));
+    auto callback = base::AdaptCallbackForRepeating(base::BindOnce(
+        &electron::util::Promise<base::FilePath>::ResolvePromise,
+        std::move(promise), *file_path));
+    scoped_refptr<TracingController::TraceDataEndpoint> endpoint;
+    if (compress) {
+      endpoint =
+          base::MakeRefCounted<CompressedFileEndpoint>(*file_path, callback);
+    } else {
+      endpoint = TracingController::CreateFileEndpoint(*file_path, callback);
+    }
     TracingController::GetInstance()->StopTracing(endpoint);
   } else {
     promise.RejectWithErrorMessage(
@@ -83,8 +158,15 @@ v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args) {
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
   base::FilePath path;
-  if (args->GetNext(&path) && !path.empty()) {
-    StopTracing(std::move(promise), base::make_optional(path));
+  bool has_path = args->GetNext(&path) && !path.empty();
+
+  bool compress = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("compress", &compress);
+
+  if (has_path) {
+    StopTracing(std::move(promise), compress, base::make_optional(path));
   } else {
     // use a temporary file.
     base::PostTaskAndReplyWithResult(
@@ -92,7 +174,7 @@ v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args) {
         {base::ThreadPool(), base::MayBlock(),
          base::TaskPriority::USER_VISIBLE},
         base::BindOnce(CreateTemporaryFileOnIO),
-        base::BindOnce(StopTracing, std::move(promise)));
+        base::BindOnce(StopTracing, std::move(promise), compress));
   }
 
   return handle;
@@ -6,7 +6,10 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "base/barrier_closure.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_context.h"
@@ -139,6 +142,38 @@ void FilterCookieWithStatuses(const base::Value& filter,
                 net::cookie_util::StripStatuses(list));
 }
 
+// Filters one snapshot of all cookies against each entry of |filters|, and
+// resolves with one cookie list per filter. When a filter has a "url" key the
+// snapshot is narrowed by domain, path and scheme; the per-request inclusion
+// rules of GetCookieList (e.g. SameSite) are not applied.
+void FilterManyCookies(base::ListValue filters,
+                       util::Promise<std::vector<net::CookieList>> promise,
+                       const net::CookieList& cookies) {
+  std::vector<net::CookieList> results;
+  for (const auto& filter : filters.GetList()) {
+    net::CookieList result;
+    if (!filter.is_dict()) {
+      results.push_back(std::move(result));
+      continue;
+    }
+    const std::string* url_string = filter.FindStringKey("url");
+    GURL url(url_string ? *url_string : "");
+    for (const auto& cookie : cookies) {
+      if (!MatchesCookie(filter, cookie))
+        continue;
+      if (url.is_valid() && !url.is_empty()) {
+        if (!cookie.IsDomainMatch(url.host()) ||
+            !cookie.IsOnPath(url.path()) ||
+            (cookie.IsSecure() && !url.SchemeIsCryptographic()))
+          continue;
+      }
+      result.push_back(cookie);
+    }
+    results.push_back(std::move(result));
+  }
+  promise.ResolveWithGin(results);
+}
+
 std::string InclusionStatusToString(
     net::CanonicalCookie::CookieInclusionStatus status) {
   if (status.HasExclusionReason(
@@ -162,6 +197,72 @@ std::string InclusionStatusToString(
   return "Setting cookie failed";
 }
 
+// Builds a canonical cookie from the |details| passed to set()/setMany(). On
+// failure returns nullptr and fills |error_out| with the rejection message.
+std::unique_ptr<net::CanonicalCookie> ParseCookieDetails(
+    const base::Value& details,
+    GURL* url_out,
+    net::CookieOptions* options_out,
+    std::string* error_out) {
+  const std::string* url_string = details.FindStringKey("url");
+  const std::string* name = details.FindStringKey("name");
+  const std::string* value = details.FindStringKey("value");
+  const std::string* domain = details.FindStringKey("domain");
+  const std::string* path = details.FindStringKey("path");
+  bool secure = details.FindBoolKey("secure").value_or(false);
+  bool http_only = details.FindBoolKey("httpOnly").value_or(false);
+  base::Optional<double> creation_date = details.FindDoubleKey("creationDate");
+  base::Optional<double> expiration_date =
+      details.FindDoubleKey("expirationDate");
+  base::Optional<double> last_access_date =
+      details.FindDoubleKey("lastAccessDate");
+
+  base::Time creation_time = creation_date
+                                 ? base::Time::FromDoubleT(*creation_date)
+                                 : base::Time::UnixEpoch();
+  base::Time expiration_time = expiration_date
+                                   ? base::Time::FromDoubleT(*expiration_date)
+                                   : base::Time::UnixEpoch();
+  base::Time last_access_time = last_access_date
+                                    ? base::Time::FromDoubleT(*last_access_date)
+                                    : base::Time::UnixEpoch();
+
+  GURL url(url_string ? *url_string : "");
+  if (!url.is_valid()) {
+    *error_out =
+        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
+            net::CanonicalCookie::CookieInclusionStatus::
+                EXCLUDE_INVALID_DOMAIN));
+    return nullptr;
+  }
+
+  if (!name || name->empty()) {
+    *error_out =
+        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
+            net::CanonicalCookie::CookieInclusionStatus::
+                EXCLUDE_FAILURE_TO_STORE));
+    return nullptr;
+  }
+
+  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
+      url, *name, value ? *value : "", domain ? *domain : "", path ? *path : "",
+      creation_time, expiration_time, last_access_time, secure, http_only,
+      net::CookieSameSite::NO_RESTRICTION, net::COOKIE_PRIORITY_DEFAULT);
+  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
+    *error_out =
+        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
+            net::CanonicalCookie::CookieInclusionStatus::
+                EXCLUDE_FAILURE_TO_STORE));
+    return nullptr;
+  }
+  if (http_only) {
+    options_out->set_include_httponly();
+  }
+
+  *url_out = std::move(url);
+  return canonical_cookie;
+}
+
 }  // namespace
 
 Cookies::Cookies(v8::Isolate* isolate, AtomBrowserContext* browser_context)
@@ -206,6 +307,23 @@ v8::Local<v8::Promise> Cookies::Get(const gin_helper::Dictionary& filter) {
   return handle;
 }
 
+v8::Local<v8::Promise> Cookies::GetMany(base::ListValue filters) {
+  util::Promise<std::vector<net::CookieList>> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto* storage_partition = content::BrowserContext::GetDefaultStoragePartition(
+      browser_context_.get());
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+
+  // A single snapshot of the store serves every filter, so the batch costs
+  // one round-trip to the network service regardless of how many filters are
+  // passed.
+  manager->GetAllCookies(base::BindOnce(&FilterManyCookies, std::move(filters),
+                                        std::move(promise)));
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Cookies::Remove(const GURL& url,
                                        const std::string& name) {
   util::Promise<void*> promise(isolate());
@@ -234,60 +352,13 @@ v8::Local<v8::Promise> Cookies::Set(base::DictionaryValue details) {
   util::Promise<void*> promise(isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
-  const std::string* url_string = details.FindStringKey("url");
-  const std::string* name = details.FindStringKey("name");
-  const std::string* value = details.FindStringKey("value");
-  const std::string* domain = details.FindStringKey("domain");
-  const std::string* path = details.FindStringKey("path");
-  bool secure = details.FindBoolKey("secure").value_or(false);
-  bool http_only = details.FindBoolKey("httpOnly").value_or(false);
-  base::Optional<double> creation_date = details.FindDoubleKey("creationDate");
-  base::Optional<double> expiration_date =
-      details.FindDoubleKey("expirationDate");
-  base::Optional<double> last_access_date =
-      details.FindDoubleKey("lastAccessDate");
-
-  base::Time creation_time = creation_date
-                                 ? base::Time::FromDoubleT(*creation_date)
-                                 : base::Time::UnixEpoch();
-  base::Time expiration_time = expiration_date
-                                   ? base::Time::FromDoubleT(*expiration_date)
-                                   : base::Time::UnixEpoch();
-  base::Time last_access_time = last_access_date
-                                    ? base::Time::FromDoubleT(*last_access_date)
-                                    : base::Time::UnixEpoch();
-
-  GURL url(url_string ? *url_string : "");
-  if (!url.is_valid()) {
-    promise.RejectWithErrorMessage(
-        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
-            net::CanonicalCookie::CookieInclusionStatus::
-                EXCLUDE_INVALID_DOMAIN)));
-    return handle;
-  }
-
-  if (!name || name->empty()) {
-    promise.RejectWithErrorMessage(
-        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
-            net::CanonicalCookie::CookieInclusionStatus::
-                EXCLUDE_FAILURE_TO_STORE)));
-    return handle;
-  }
-
-  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
-      url, *name, value ? *value : "", domain ? *domain : "", path ? *path : "",
-      creation_time, expiration_time, last_access_time, secure, http_only,
-      net::CookieSameSite::NO_RESTRICTION, net::COOKIE_PRIORITY_DEFAULT);
-  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
-    promise.RejectWithErrorMessage(
-        InclusionStatusToString(net::CanonicalCookie::CookieInclusionStatus(
-            net::CanonicalCookie::CookieInclusionStatus::
-                EXCLUDE_FAILURE_TO_STORE)));
-    return handle;
-  }
+  GURL url;
   net::CookieOptions options;
-  if (http_only) {
-    options.set_include_httponly();
+  std::string error;
+  auto canonical_cookie = ParseCookieDetails(details, &url, &options, &error);
+  if (!canonical_cookie) {
+    promise.RejectWithErrorMessage(error);
+    return handle;
   }
 
   auto* storage_partition = content::BrowserContext::GetDefaultStoragePartition(
@@ -309,6 +380,63 @@ v8::Local<v8::Promise> Cookies::Set(base::DictionaryValue details) {
   return handle;
 }
 
+v8::Local<v8::Promise> Cookies::SetMany(base::ListValue details_list) {
+  util::Promise<void*> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  const base::Value::ListStorage& entries = details_list.GetList();
+  if (entries.empty()) {
+    promise.Resolve();
+    return handle;
+  }
+
+  auto* storage_partition = content::BrowserContext::GetDefaultStoragePartition(
+      browser_context_.get());
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+
+  auto errors = std::make_unique<std::vector<std::string>>();
+  auto* errors_ptr = errors.get();
+  base::RepeatingClosure barrier = base::BarrierClosure(
+      entries.size(),
+      base::BindOnce(
+          [](util::Promise<void*> promise,
+             std::unique_ptr<std::vector<std::string>> errors) {
+            if (errors->empty())
+              promise.Resolve();
+            else
+              promise.RejectWithErrorMessage(errors->front());
+          },
+          std::move(promise), std::move(errors)));
+
+  // The writes are issued back to back on the CookieManager pipe, so the
+  // whole batch costs one round-trip to the network service instead of one
+  // per cookie.
+  for (const auto& entry : entries) {
+    GURL url;
+    net::CookieOptions options;
+    std::string error;
+    auto canonical_cookie = ParseCookieDetails(entry, &url, &options, &error);
+    if (!canonical_cookie) {
+      errors_ptr->push_back(error);
+      barrier.Run();
+      continue;
+    }
+    manager->SetCanonicalCookie(
+        *canonical_cookie, url.scheme(), options,
+        base::BindOnce(
+            [](std::vector<std::string>* errors,
+               base::RepeatingClosure barrier,
+               net::CanonicalCookie::CookieInclusionStatus status) {
+              if (!status.IsInclude())
+                errors->push_back(InclusionStatusToString(status));
+              barrier.Run();
+            },
+            errors_ptr, barrier));
+  }
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Cookies::FlushStore() {
   util::Promise<void*> promise(isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
@@ -324,10 +452,44 @@ v8::Local<v8::Promise> Cookies::FlushStore() {
 }
 
 void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
-  Emit("changed", gin::ConvertToV8(isolate(), change.cookie),
-       gin::ConvertToV8(isolate(), change.cause),
-       gin::ConvertToV8(isolate(),
-                        change.cause != net::CookieChangeCause::INSERTED));
+  // Changes arrive one mojo message at a time; a burst (e.g. session sync
+  // setting hundreds of cookies at login) is coalesced into a single posted
+  // task instead of paying the event-dispatch overhead per change.
+  pending_changes_.push_back(change);
+  if (change_flush_posted_)
+    return;
+  change_flush_posted_ = true;
+  base::SequencedTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&Cookies::FlushCookieChanges,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void Cookies::FlushCookieChanges() {
+  change_flush_posted_ = false;
+  std::vector<net::CookieChangeInfo> changes;
+  changes.swap(pending_changes_);
+
+  v8::HandleScope handle_scope(isolate());
+  auto weak = weak_factory_.GetWeakPtr();
+
+  std::vector<v8::Local<v8::Value>> batch;
+  batch.reserve(changes.size());
+  for (const auto& change : changes) {
+    bool removed = change.cause != net::CookieChangeCause::INSERTED;
+    gin::Dictionary entry(isolate(), v8::Object::New(isolate()));
+    entry.Set("cookie", change.cookie);
+    entry.Set("cause", change.cause);
+    entry.Set("removed", removed);
+    batch.push_back(gin::ConvertToV8(isolate(), entry));
+
+    Emit("changed", gin::ConvertToV8(isolate(), change.cookie),
+         gin::ConvertToV8(isolate(), change.cause),
+         gin::ConvertToV8(isolate(), removed));
+    // A "changed" listener may have destroyed us.
+    if (!weak)
+      return;
+  }
+  Emit("changed-batch", batch);
 }
 
 // static
@@ -342,8 +504,10 @@ void Cookies::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(gin::StringToV8(isolate, "Cookies"));
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("get", &Cookies::Get)
+      .SetMethod("getMany", &Cookies::GetMany)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
+      .SetMethod("setMany", &Cookies::SetMany)
       .SetMethod("flushStore", &Cookies::FlushStore);
 }
 
@@ -7,8 +7,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/callback_list.h"
+#include "base/memory/weak_ptr.h"
 #include "gin/handle.h"
 #include "net/cookies/canonical_cookie.h"
 #include "net/cookies/cookie_change_dispatcher.h"
@@ -17,7 +19,8 @@
 
 namespace base {
 class DictionaryValue;
-}
+class ListValue;
+}  // namespace base
 
 namespace gin_helper {
 class Dictionary;
@@ -47,7 +50,9 @@ class Cookies : public gin_helper::TrackableObject<Cookies> {
   ~Cookies() override;
 
   v8::Local<v8::Promise> Get(const gin_helper::Dictionary& filter);
+  v8::Local<v8::Promise> GetMany(base::ListValue filters);
   v8::Local<v8::Promise> Set(base::DictionaryValue details);
+  v8::Local<v8::Promise> SetMany(base::ListValue details_list);
   v8::Local<v8::Promise> Remove(const GURL& url, const std::string& name);
   v8::Local<v8::Promise> FlushStore();
 
@@ -55,11 +60,21 @@ class Cookies : public gin_helper::TrackableObject<Cookies> {
   void OnCookieChanged(const net::CookieChangeInfo& change);
 
  private:
+  // Emits changes buffered since the flush task was posted as one
+  // "changed-batch" event.
+  void FlushCookieChanges();
+
   std::unique_ptr<base::CallbackList<void(
       const net::CookieChangeInfo& change)>::Subscription>
       cookie_change_subscription_;
   scoped_refptr<AtomBrowserContext> browser_context_;
 
+  // Changes waiting to be delivered by the posted FlushCookieChanges task.
+  std::vector<net::CookieChangeInfo> pending_changes_;
+  bool change_flush_posted_ = false;
+
+  base::WeakPtrFactory<Cookies> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(Cookies);
 };
 
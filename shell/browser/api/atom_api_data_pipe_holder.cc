@@ -4,11 +4,14 @@
 
 #include "shell/browser/api/atom_api_data_pipe_holder.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/optional.h"
 #include "base/strings/string_number_conversions.h"
+#include "gin/object_template_builder.h"
 #include "mojo/public/cpp/system/data_pipe.h"
 #include "mojo/public/cpp/system/simple_watcher.h"
 #include "net/base/net_errors.h"
@@ -136,6 +139,185 @@ class DataPipeReader {
   DISALLOW_COPY_AND_ASSIGN(DataPipeReader);
 };
 
+// Size of the chunks handed to JS, which also bounds the native memory a
+// stream holds at any time.
+constexpr size_t kStreamChunkSize = 64 * 1024;
+
+// Reads a data pipe in bounded chunks, one chunk per |read| call. This is
+// what backs session.getBlobDataStream, which must not materialize the
+// whole blob like DataPipeReader does.
+class ChunkedDataPipeReader : public gin::Wrappable<ChunkedDataPipeReader> {
+ public:
+  static gin::WrapperInfo kWrapperInfo;
+
+  static gin::Handle<ChunkedDataPipeReader> Create(
+      v8::Isolate* isolate,
+      mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter) {
+    return gin::CreateHandle(
+        isolate, new ChunkedDataPipeReader(std::move(data_pipe_getter)));
+  }
+
+  // Resolves with the next chunk as a Buffer, or with null once the whole
+  // pipe has been consumed.
+  v8::Local<v8::Promise> Read(v8::Isolate* isolate) {
+    util::Promise<v8::Local<v8::Value>> promise(isolate);
+    v8::Local<v8::Promise> handle = promise.GetHandle();
+    if (failed_) {
+      promise.RejectWithErrorMessage("Could not get blob data");
+      return handle;
+    }
+    if (pending_read_) {
+      promise.RejectWithErrorMessage("A read is already pending");
+      return handle;
+    }
+    if (done_) {
+      promise.Resolve(v8::Null(isolate).As<v8::Value>());
+      return handle;
+    }
+    pending_read_.emplace(std::move(promise));
+    // Before the size is known ReadCallback arms the watcher for us.
+    if (size_known_)
+      handle_watcher_.ArmOrNotify();
+    return handle;
+  }
+
+ protected:
+  // gin::Wrappable:
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override {
+    return gin::Wrappable<ChunkedDataPipeReader>::GetObjectTemplateBuilder(
+               isolate)
+        .SetMethod("read", &ChunkedDataPipeReader::Read);
+  }
+
+ private:
+  explicit ChunkedDataPipeReader(
+      mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter)
+      : data_pipe_getter_(std::move(data_pipe_getter)),
+        handle_watcher_(FROM_HERE,
+                        mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+                        base::SequencedTaskRunnerHandle::Get()) {
+    // Get a new data pipe and start.
+    mojo::DataPipe data_pipe;
+    data_pipe_getter_->Read(
+        std::move(data_pipe.producer_handle),
+        base::BindOnce(&ChunkedDataPipeReader::ReadCallback,
+                       weak_factory_.GetWeakPtr()));
+    data_pipe_ = std::move(data_pipe.consumer_handle);
+    handle_watcher_.Watch(
+        data_pipe_.get(), MOJO_HANDLE_SIGNAL_READABLE,
+        base::BindRepeating(&ChunkedDataPipeReader::OnHandleReadable,
+                            weak_factory_.GetWeakPtr()));
+  }
+
+  ~ChunkedDataPipeReader() override = default;
+
+  // Callback invoked by DataPipeGetter::Read.
+  void ReadCallback(int32_t status, uint64_t size) {
+    if (status != net::OK) {
+      OnFailure();
+      return;
+    }
+    remaining_size_ = size;
+    size_known_ = true;
+    if (remaining_size_ == 0) {
+      Finish();
+      return;
+    }
+    if (pending_read_)
+      handle_watcher_.ArmOrNotify();
+  }
+
+  // Called by |handle_watcher_| when data is available or the pipe was
+  // closed, and there's a pending read() call.
+  void OnHandleReadable(MojoResult result) {
+    if (!pending_read_)
+      return;
+    if (result != MOJO_RESULT_OK) {
+      OnFailure();
+      return;
+    }
+
+    // Read at most one chunk.
+    uint32_t length = static_cast<uint32_t>(
+        std::min(remaining_size_, static_cast<uint64_t>(kStreamChunkSize)));
+    chunk_.resize(length);
+    result = data_pipe_->ReadData(chunk_.data(), &length,
+                                  MOJO_READ_DATA_FLAG_NONE);
+    if (result == MOJO_RESULT_OK) {  // success
+      remaining_size_ -= length;
+      util::Promise<v8::Local<v8::Value>> promise = TakePendingRead();
+      v8::Isolate* isolate = promise.isolate();
+      v8::Locker locker(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Value> buffer =
+          node::Buffer::Copy(isolate, chunk_.data(), length).ToLocalChecked();
+      promise.Resolve(buffer);
+      if (remaining_size_ == 0)
+        Finish();
+    } else if (result == MOJO_RESULT_SHOULD_WAIT) {  // IO pending
+      handle_watcher_.ArmOrNotify();
+    } else {  // error
+      OnFailure();
+    }
+  }
+
+  void OnFailure() {
+    failed_ = true;
+    CloseDataPipe();
+    if (pending_read_)
+      TakePendingRead().RejectWithErrorMessage("Could not get blob data");
+  }
+
+  void Finish() {
+    done_ = true;
+    CloseDataPipe();
+    if (pending_read_) {
+      util::Promise<v8::Local<v8::Value>> promise = TakePendingRead();
+      v8::Isolate* isolate = promise.isolate();
+      v8::Locker locker(isolate);
+      v8::HandleScope handle_scope(isolate);
+      promise.Resolve(v8::Null(isolate).As<v8::Value>());
+    }
+  }
+
+  void CloseDataPipe() {
+    handle_watcher_.Cancel();
+    data_pipe_.reset();
+    data_pipe_getter_.reset();
+  }
+
+  util::Promise<v8::Local<v8::Value>> TakePendingRead() {
+    util::Promise<v8::Local<v8::Value>> promise = std::move(*pending_read_);
+    pending_read_.reset();
+    return promise;
+  }
+
+  mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter_;
+  mojo::ScopedDataPipeConsumerHandle data_pipe_;
+  mojo::SimpleWatcher handle_watcher_;
+
+  // Holds the chunk currently being read.
+  std::vector<char> chunk_;
+
+  // Settled by the next chunk, EOF or error.
+  base::Optional<util::Promise<v8::Local<v8::Value>>> pending_read_;
+
+  // Remaining data to read, valid once |size_known_| is true.
+  uint64_t remaining_size_ = 0;
+  bool size_known_ = false;
+
+  bool done_ = false;
+  bool failed_ = false;
+
+  base::WeakPtrFactory<ChunkedDataPipeReader> weak_factory_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(ChunkedDataPipeReader);
+};
+
+gin::WrapperInfo ChunkedDataPipeReader::kWrapperInfo = {
+    gin::kEmbedderNativeGin};
+
 }  // namespace
 
 gin::WrapperInfo DataPipeHolder::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -159,6 +341,12 @@ v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
   return handle;
 }
 
+v8::Local<v8::Value> DataPipeHolder::OpenStream(v8::Isolate* isolate) {
+  if (!data_pipe_)
+    return v8::Local<v8::Value>();
+  return ChunkedDataPipeReader::Create(isolate, std::move(data_pipe_)).ToV8();
+}
+
 // static
 gin::Handle<DataPipeHolder> DataPipeHolder::Create(
     v8::Isolate* isolate,
@@ -34,6 +34,12 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   // no one has complained about it yet.
   v8::Local<v8::Promise> ReadAll(v8::Isolate* isolate);
 
+  // Hands the pipe to a ChunkedDataPipeReader, which reads it in bounded
+  // chunks so large data never has to be materialized at once. Like
+  // ReadAll() this consumes the pipe. Returns an empty handle when the
+  // pipe was already consumed.
+  v8::Local<v8::Value> OpenStream(v8::Isolate* isolate);
+
   // The unique ID that can be used to receive the object.
   const std::string& id() const { return id_; }
 
@@ -23,6 +23,13 @@ namespace electron {
 
 namespace api {
 
+Debugger::PendingBatch::PendingBatch(
+    electron::util::Promise<base::ListValue> promise_,
+    size_t count)
+    : promise(std::move(promise_)), results(count), remaining(count) {}
+Debugger::PendingBatch::PendingBatch(PendingBatch&& other) = default;
+Debugger::PendingBatch::~PendingBatch() = default;
+
 Debugger::Debugger(v8::Isolate* isolate, content::WebContents* web_contents)
     : content::WebContentsObserver(web_contents), web_contents_(web_contents) {
   Init(isolate);
@@ -62,8 +69,10 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
     Emit("message", method, params);
   } else {
     auto it = pending_requests_.find(id);
-    if (it == pending_requests_.end())
+    if (it == pending_requests_.end()) {
+      OnBatchCommandResponse(id, dict);
       return;
+    }
 
     electron::util::Promise<base::DictionaryValue> promise =
         std::move(it->second);
@@ -85,6 +94,43 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
   }
 }
 
+void Debugger::OnBatchCommandResponse(int id, base::DictionaryValue* dict) {
+  auto request_it = batch_requests_.find(id);
+  if (request_it == batch_requests_.end())
+    return;
+  int batch_id = request_it->second.first;
+  size_t index = request_it->second.second;
+  batch_requests_.erase(request_it);
+
+  auto batch_it = pending_batches_.find(batch_id);
+  if (batch_it == pending_batches_.end())
+    return;
+  PendingBatch& batch = batch_it->second;
+
+  base::DictionaryValue entry;
+  base::DictionaryValue* error = nullptr;
+  if (dict->GetDictionary("error", &error)) {
+    std::string message;
+    error->GetString("message", &message);
+    entry.SetString("error", message);
+  } else {
+    base::DictionaryValue* result_body = nullptr;
+    base::DictionaryValue result;
+    if (dict->GetDictionary("result", &result_body))
+      result.Swap(result_body);
+    entry.SetKey("result", std::move(result));
+  }
+  batch.results[index] = std::move(entry);
+
+  if (--batch.remaining == 0) {
+    base::ListValue results;
+    for (auto& result : batch.results)
+      results.GetList().push_back(std::move(result));
+    batch.promise.ResolveWithGin(results);
+    pending_batches_.erase(batch_it);
+  }
+}
+
 void Debugger::RenderFrameHostChanged(content::RenderFrameHost* old_rfh,
                                       content::RenderFrameHost* new_rfh) {
   if (agent_host_) {
@@ -163,9 +209,88 @@ v8::Local<v8::Promise> Debugger::SendCommand(gin_helper::Arguments* args) {
   return handle;
 }
 
+v8::Local<v8::Promise> Debugger::SendCommands(gin_helper::Arguments* args) {
+  electron::util::Promise<base::ListValue> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!agent_host_) {
+    promise.RejectWithErrorMessage("No target available");
+    return handle;
+  }
+
+  base::ListValue commands;
+  if (!args->GetNext(&commands)) {
+    promise.RejectWithErrorMessage("Invalid commands");
+    return handle;
+  }
+
+  size_t count = commands.GetList().size();
+  if (count == 0) {
+    promise.ResolveWithGin(base::ListValue());
+    return handle;
+  }
+
+  int batch_id = ++previous_batch_id_;
+  auto inserted = pending_batches_.emplace(
+      batch_id, PendingBatch(std::move(promise), count));
+  PendingBatch& batch = inserted.first->second;
+
+  // One serialization buffer is reused across the whole batch; every
+  // command is dispatched to the agent host from this single call so the
+  // per-command JS -> native crossing is paid once.
+  std::string json_args;
+  for (size_t i = 0; i < count; ++i) {
+    base::DictionaryValue* command = nullptr;
+    std::string method;
+    if (!commands.GetDictionary(i, &command) ||
+        !command->GetString("method", &method)) {
+      base::DictionaryValue entry;
+      entry.SetString("error", "Invalid method");
+      batch.results[i] = std::move(entry);
+      --batch.remaining;
+      continue;
+    }
+
+    base::DictionaryValue request;
+    int request_id = ++previous_request_id_;
+    batch_requests_.emplace(request_id, std::make_pair(batch_id, i));
+    request.SetInteger("id", request_id);
+    request.SetString("method", method);
+    base::DictionaryValue* command_params = nullptr;
+    if (command->GetDictionary("params", &command_params) &&
+        !command_params->empty()) {
+      request.Set("params",
+                  base::Value::ToUniquePtrValue(command_params->Clone()));
+    }
+
+    json_args.clear();
+    base::JSONWriter::Write(request, &json_args);
+    agent_host_->DispatchProtocolMessage(this, json_args);
+  }
+
+  // Every command may have been rejected up front; the agent host never
+  // answers in that case, so resolve here.
+  if (batch.remaining == 0) {
+    base::ListValue results;
+    for (auto& result : batch.results)
+      results.GetList().push_back(std::move(result));
+    batch.promise.ResolveWithGin(results);
+    pending_batches_.erase(batch_id);
+  }
+
+  return handle;
+}
+
 void Debugger::ClearPendingRequests() {
   for (auto& it : pending_requests_)
     it.second.RejectWithErrorMessage("target closed while handling command");
+  pending_requests_.clear();
+  for (auto& it : pending_batches_) {
+    it.second.promise.RejectWithErrorMessage(
+        "target closed while handling command");
+  }
+  pending_batches_.clear();
+  batch_requests_.clear();
 }
 
 // static
@@ -182,7 +307,8 @@ void Debugger::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("attach", &Debugger::Attach)
       .SetMethod("isAttached", &Debugger::IsAttached)
       .SetMethod("detach", &Debugger::Detach)
-      .SetMethod("sendCommand", &Debugger::SendCommand);
+      .SetMethod("sendCommand", &Debugger::SendCommand)
+      .SetMethod("sendCommands", &Debugger::SendCommands);
 }
 
 }  // namespace api
@@ -7,6 +7,8 @@
 
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/values.h"
@@ -45,6 +47,10 @@ class Debugger : public gin_helper::TrackableObject<Debugger>,
   void DispatchProtocolMessage(content::DevToolsAgentHost* agent_host,
                                const std::string& message) override;
 
+  // Routes a response that belongs to a sendCommands() batch into its slot
+  // and resolves the batch promise once every slot has been filled.
+  void OnBatchCommandResponse(int id, base::DictionaryValue* dict);
+
   // content::WebContentsObserver:
   void RenderFrameHostChanged(content::RenderFrameHost* old_rfh,
                               content::RenderFrameHost* new_rfh) override;
@@ -53,10 +59,24 @@ class Debugger : public gin_helper::TrackableObject<Debugger>,
   using PendingRequestMap =
       std::map<int, electron::util::Promise<base::DictionaryValue>>;
 
+  // One sendCommands() call: the promise resolves with one entry per
+  // command, in order, once every response has arrived.
+  struct PendingBatch {
+    PendingBatch(electron::util::Promise<base::ListValue> promise,
+                 size_t count);
+    PendingBatch(PendingBatch&& other);
+    ~PendingBatch();
+
+    electron::util::Promise<base::ListValue> promise;
+    std::vector<base::Value> results;
+    size_t remaining;
+  };
+
   void Attach(gin_helper::Arguments* args);
   bool IsAttached();
   void Detach();
   v8::Local<v8::Promise> SendCommand(gin_helper::Arguments* args);
+  v8::Local<v8::Promise> SendCommands(gin_helper::Arguments* args);
   void ClearPendingRequests();
 
   content::WebContents* web_contents_;  // Weak Reference.
@@ -65,6 +85,12 @@ class Debugger : public gin_helper::TrackableObject<Debugger>,
   PendingRequestMap pending_requests_;
   int previous_request_id_ = 0;
 
+  // Batches in flight, keyed by batch id, plus the mapping from an
+  // individual request id to its (batch id, slot) pair.
+  std::map<int, PendingBatch> pending_batches_;
+  std::map<int, std::pair<int, size_t>> batch_requests_;
+  int previous_batch_id_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(Debugger);
 };
 
@@ -4,10 +4,13 @@
 
 #include "shell/browser/api/atom_api_desktop_capturer.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "base/hash/hash.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_restrictions.h"
@@ -114,6 +117,79 @@ void DesktopCapturer::StartHandling(bool capture_window,
   }
 }
 
+void DesktopCapturer::StartListening(bool capture_window,
+                                     bool capture_screen,
+                                     const gfx::Size& thumbnail_size,
+                                     bool fetch_window_icons,
+                                     int update_interval) {
+  listening_ = true;
+  listen_capture_window_ = capture_window;
+  listen_capture_screen_ = capture_screen;
+  listen_thumbnail_size_ = thumbnail_size;
+  listen_fetch_window_icons_ = fetch_window_icons;
+  known_sources_.clear();
+
+  // Run the first enumeration right away; every source it finds is reported
+  // as "source-added". Afterwards re-enumerate on the configured cadence and
+  // only emit what changed.
+  StartHandling(capture_window, capture_screen, thumbnail_size,
+                fetch_window_icons);
+  refresh_timer_.Start(
+      FROM_HERE,
+      base::TimeDelta::FromMilliseconds(std::max(update_interval, 100)),
+      base::BindRepeating(&DesktopCapturer::RefreshSources,
+                          base::Unretained(this)));
+}
+
+void DesktopCapturer::StopListening() {
+  listening_ = false;
+  refresh_timer_.Stop();
+  window_capturer_.reset();
+  screen_capturer_.reset();
+  known_sources_.clear();
+}
+
+void DesktopCapturer::RefreshSources() {
+  // Don't pile up when the previous enumeration is still in flight.
+  if (capture_window_ || capture_screen_)
+    return;
+  StartHandling(listen_capture_window_, listen_capture_screen_,
+                listen_thumbnail_size_, listen_fetch_window_icons_);
+}
+
+void DesktopCapturer::EmitSourceDeltas() {
+  std::map<content::DesktopMediaID, SourceState> current_sources;
+  for (const auto& source : captured_sources_) {
+    SourceState state;
+    state.name = source.media_list_source.name;
+    const SkBitmap* thumbnail = source.media_list_source.thumbnail.bitmap();
+    if (thumbnail && !thumbnail->isNull()) {
+      state.thumbnail_hash = base::FastHash(base::make_span(
+          static_cast<const uint8_t*>(thumbnail->getPixels()),
+          thumbnail->computeByteSize()));
+    }
+
+    const auto& id = source.media_list_source.id;
+    auto iter = known_sources_.find(id);
+    if (iter == known_sources_.end()) {
+      Emit("source-added", source);
+    } else {
+      if (iter->second.name != state.name)
+        Emit("source-name-changed", source);
+      if (iter->second.thumbnail_hash != state.thumbnail_hash)
+        Emit("source-thumbnail-changed", source);
+    }
+    current_sources[id] = std::move(state);
+  }
+
+  for (const auto& known : known_sources_) {
+    if (!current_sources.count(known.first))
+      Emit("source-removed", known.first.ToString());
+  }
+
+  known_sources_ = std::move(current_sources);
+}
+
 void DesktopCapturer::OnSourceUnchanged(DesktopMediaList* list) {
   UpdateSourcesList(list);
 }
@@ -183,8 +259,12 @@ void DesktopCapturer::UpdateSourcesList(DesktopMediaList* list) {
               std::back_inserter(captured_sources_));
   }
 
-  if (!capture_window_ && !capture_screen_)
-    Emit("finished", captured_sources_, fetch_window_icons_);
+  if (!capture_window_ && !capture_screen_) {
+    if (listening_)
+      EmitSourceDeltas();
+    else
+      Emit("finished", captured_sources_, fetch_window_icons_);
+  }
 }
 
 // static
@@ -198,7 +278,9 @@ void DesktopCapturer::BuildPrototype(
     v8::Local<v8::FunctionTemplate> prototype) {
   prototype->SetClassName(gin::StringToV8(isolate, "DesktopCapturer"));
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
-      .SetMethod("startHandling", &DesktopCapturer::StartHandling);
+      .SetMethod("startHandling", &DesktopCapturer::StartHandling)
+      .SetMethod("startListening", &DesktopCapturer::StartListening)
+      .SetMethod("stopListening", &DesktopCapturer::StopListening);
 }
 
 }  // namespace api
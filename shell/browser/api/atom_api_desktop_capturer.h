@@ -5,10 +5,13 @@
 #ifndef SHELL_BROWSER_API_ATOM_API_DESKTOP_CAPTURER_H_
 #define SHELL_BROWSER_API_ATOM_API_DESKTOP_CAPTURER_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "base/strings/string16.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/media/webrtc/desktop_media_list_observer.h"
 #include "chrome/browser/media/webrtc/native_desktop_media_list.h"
 #include "gin/handle.h"
@@ -40,6 +43,16 @@ class DesktopCapturer : public gin_helper::TrackableObject<DesktopCapturer>,
                      const gfx::Size& thumbnail_size,
                      bool fetch_window_icons);
 
+  // Keeps enumerating on a fixed cadence and emits "source-added",
+  // "source-removed", "source-name-changed" and "source-thumbnail-changed"
+  // deltas instead of a one-shot "finished" snapshot.
+  void StartListening(bool capture_window,
+                      bool capture_screen,
+                      const gfx::Size& thumbnail_size,
+                      bool fetch_window_icons,
+                      int update_interval);
+  void StopListening();
+
  protected:
   explicit DesktopCapturer(v8::Isolate* isolate);
   ~DesktopCapturer() override;
@@ -55,7 +68,15 @@ class DesktopCapturer : public gin_helper::TrackableObject<DesktopCapturer>,
   void OnSourceUnchanged(DesktopMediaList* list) override;
 
  private:
+  // What we remember about a source between two enumerations.
+  struct SourceState {
+    base::string16 name;
+    size_t thumbnail_hash = 0;
+  };
+
   void UpdateSourcesList(DesktopMediaList* list);
+  void RefreshSources();
+  void EmitSourceDeltas();
 
   std::unique_ptr<DesktopMediaList> window_capturer_;
   std::unique_ptr<DesktopMediaList> screen_capturer_;
@@ -63,6 +84,15 @@ class DesktopCapturer : public gin_helper::TrackableObject<DesktopCapturer>,
   bool capture_window_ = false;
   bool capture_screen_ = false;
   bool fetch_window_icons_ = false;
+
+  // Subscription state.
+  bool listening_ = false;
+  bool listen_capture_window_ = false;
+  bool listen_capture_screen_ = false;
+  gfx::Size listen_thumbnail_size_;
+  bool listen_fetch_window_icons_ = false;
+  base::RepeatingTimer refresh_timer_;
+  std::map<content::DesktopMediaID, SourceState> known_sources_;
 #if defined(OS_WIN)
   bool using_directx_capturer_ = false;
 #endif  // defined(OS_WIN)
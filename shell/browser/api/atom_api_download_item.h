@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "components/download/public/common/download_item.h"
 #include "gin/handle.h"
 #include "shell/browser/ui/file_dialog.h"
@@ -50,6 +52,8 @@ class DownloadItem : public gin_helper::TrackableObject<DownloadItem>,
   std::string GetLastModifiedTime() const;
   std::string GetETag() const;
   double GetStartTime() const;
+  void SetUpdateInterval(int interval_ms);
+  int GetUpdateInterval() const;
 
  protected:
   DownloadItem(v8::Isolate* isolate, download::DownloadItem* download_item);
@@ -60,10 +64,20 @@ class DownloadItem : public gin_helper::TrackableObject<DownloadItem>,
   void OnDownloadDestroyed(download::DownloadItem* download) override;
 
  private:
+  // Emits 'updated' and records the emission time.
+  void EmitUpdatedEvent();
+
   base::FilePath save_path_;
   file_dialog::DialogSettings dialog_options_;
   download::DownloadItem* download_item_;
 
+  // Progress ticks arrive far faster than a UI can usefully render them;
+  // 'updated' is emitted at most once per |update_interval_|, with a
+  // trailing emission reading the freshest item state.
+  base::TimeDelta update_interval_;
+  base::OneShotTimer update_timer_;
+  base::TimeTicks last_update_time_;
+
   DISALLOW_COPY_AND_ASSIGN(DownloadItem);
 };
 
@@ -73,18 +73,22 @@ bool GlobalShortcut::RegisterAll(
     const base::Closure& callback) {
   std::vector<ui::Accelerator> registered;
 
+  // All platform calls happen back to back inside this loop, so a bulk
+  // registration (e.g. re-registering every shortcut on a profile switch)
+  // does not interleave with other work; failures roll the whole batch back.
+  GlobalShortcutListener* listener = GlobalShortcutListener::GetInstance();
   for (auto& accelerator : accelerators) {
 #if defined(OS_MACOSX)
-    if (RegisteringMediaKeyForUntrustedClient(accelerator))
+    if (RegisteringMediaKeyForUntrustedClient(accelerator)) {
+      UnregisterSome(registered);
       return false;
-
-    GlobalShortcutListener* listener = GlobalShortcutListener::GetInstance();
+    }
+#endif
     if (!listener->RegisterAccelerator(accelerator, this)) {
       // unregister all shortcuts if any failed
       UnregisterSome(registered);
       return false;
     }
-#endif
     registered.push_back(accelerator);
     accelerator_callback_map_[accelerator] = callback;
   }
@@ -141,10 +141,18 @@ void Menu::InsertSubMenuAt(int index,
   model_->InsertSubMenuAt(index, command_id, label, menu->model_.get());
 }
 
+void Menu::RemoveItemAt(int index) {
+  model_->RemoveItemAt(index);
+}
+
 void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, image);
 }
 
+void Menu::SetLabel(int index, const base::string16& label) {
+  model_->SetLabel(index, label);
+}
+
 void Menu::SetSublabel(int index, const base::string16& sublabel) {
   model_->SetSublabel(index, sublabel);
 }
@@ -228,7 +236,9 @@ void Menu::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("insertRadioItem", &Menu::InsertRadioItemAt)
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
+      .SetMethod("removeItem", &Menu::RemoveItemAt)
       .SetMethod("setIcon", &Menu::SetIcon)
+      .SetMethod("setLabel", &Menu::SetLabel)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setToolTip", &Menu::SetToolTip)
       .SetMethod("setRole", &Menu::SetRole)
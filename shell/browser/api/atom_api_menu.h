@@ -86,7 +86,9 @@ class Menu : public gin_helper::TrackableObject<Menu>,
                        int command_id,
                        const base::string16& label,
                        Menu* menu);
+  void RemoveItemAt(int index);
   void SetIcon(int index, const gfx::Image& image);
+  void SetLabel(int index, const base::string16& label);
   void SetSublabel(int index, const base::string16& sublabel);
   void SetToolTip(int index, const base::string16& toolTip);
   void SetRole(int index, const base::string16& role);
@@ -21,8 +21,20 @@ namespace electron {
 
 namespace api {
 
+namespace {
+
+// Platform themes fire bursts of notifications during transitions (for
+// example Windows accent-color animations); notifications within this
+// interval collapse into a single "updated" event.
+constexpr base::TimeDelta kThemeUpdateDebounceInterval =
+    base::TimeDelta::FromMilliseconds(10);
+
+}  // namespace
+
 NativeTheme::NativeTheme(v8::Isolate* isolate, ui::NativeTheme* theme)
-    : theme_(theme) {
+    : theme_(theme),
+      last_dark_colors_(theme->ShouldUseDarkColors()),
+      last_high_contrast_(theme->UsesHighContrastColors()) {
   theme_->AddObserver(this);
   Init(isolate);
 }
@@ -32,6 +44,25 @@ NativeTheme::~NativeTheme() {
 }
 
 void NativeTheme::OnNativeThemeUpdatedOnUI() {
+  if (update_debounce_timer_.IsRunning())
+    return;
+  update_debounce_timer_.Start(
+      FROM_HERE, kThemeUpdateDebounceInterval,
+      base::BindOnce(&NativeTheme::EmitUpdated, base::Unretained(this)));
+}
+
+void NativeTheme::EmitUpdated() {
+  // Re-query the computed state once per burst and swallow notifications
+  // that did not change anything JS can observe, so theme transitions stop
+  // causing app-wide style-recalc storms.
+  bool dark_colors = theme_->ShouldUseDarkColors();
+  bool high_contrast = theme_->UsesHighContrastColors();
+  if (dark_colors == last_dark_colors_ &&
+      high_contrast == last_high_contrast_) {
+    return;
+  }
+  last_dark_colors_ = dark_colors;
+  last_high_contrast_ = high_contrast;
   Emit("updated");
 }
 
@@ -5,6 +5,7 @@
 #ifndef SHELL_BROWSER_API_ATOM_API_NATIVE_THEME_H_
 #define SHELL_BROWSER_API_ATOM_API_NATIVE_THEME_H_
 
+#include "base/timer/timer.h"
 #include "shell/common/gin_helper/event_emitter.h"
 #include "ui/native_theme/native_theme.h"
 #include "ui/native_theme/native_theme_observer.h"
@@ -40,8 +41,19 @@ class NativeTheme : public gin_helper::EventEmitter<NativeTheme>,
   void OnNativeThemeUpdatedOnUI();
 
  private:
+  // Emits "updated" once per coalesced burst of theme notifications, and
+  // only when the state observable from JS actually changed.
+  void EmitUpdated();
+
   ui::NativeTheme* theme_;
 
+  // The theme state as of the last emitted "updated" event; platform theme
+  // ticks that do not change it are swallowed.
+  bool last_dark_colors_ = false;
+  bool last_high_contrast_ = false;
+
+  base::OneShotTimer update_debounce_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(NativeTheme);
 };
 
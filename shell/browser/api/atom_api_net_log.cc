@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "base/command_line.h"
+#include "base/files/file_util.h"
 #include "chrome/browser/browser_process.h"
 #include "components/net_log/chrome_net_log.h"
 #include "content/public/browser/storage_partition.h"
@@ -62,6 +63,31 @@ base::File OpenFileForWriting(base::FilePath path) {
                     base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
 }
 
+// Creates the scratch file the bounded recorder writes into.
+std::pair<base::FilePath, base::File> CreateScratchFile() {
+  base::FilePath path;
+  if (!base::CreateTemporaryFile(&path))
+    return std::make_pair(base::FilePath(), base::File());
+  return std::make_pair(
+      path, base::File(path, base::File::FLAG_OPEN | base::File::FLAG_WRITE));
+}
+
+bool MoveScratchFile(base::FilePath from, base::FilePath to) {
+  return base::Move(from, to);
+}
+
+base::Value GetCustomConstants() {
+  auto command_line_string =
+      base::CommandLine::ForCurrentProcess()->GetCommandLineString();
+  auto channel_string = std::string("Electron " ELECTRON_VERSION);
+  return base::Value::FromUniquePtrValue(
+      net_log::GetPlatformConstantsForNetLog(command_line_string,
+                                             channel_string));
+}
+
+// Default cap for the recorder's ring of recent events.
+constexpr uint64_t kDefaultRecordingBufferSize = 10 * 1024 * 1024;
+
 void ResolvePromiseWithNetError(util::Promise<void*> promise, int32_t error) {
   if (error == net::OK) {
     promise.Resolve();
@@ -120,12 +146,7 @@ v8::Local<v8::Promise> NetLog::StartLogging(base::FilePath log_path,
   pending_start_promise_ = base::make_optional<util::Promise<void*>>(isolate());
   v8::Local<v8::Promise> handle = pending_start_promise_->GetHandle();
 
-  auto command_line_string =
-      base::CommandLine::ForCurrentProcess()->GetCommandLineString();
-  auto channel_string = std::string("Electron " ELECTRON_VERSION);
-  base::Value custom_constants =
-      base::Value::FromUniquePtrValue(net_log::GetPlatformConstantsForNetLog(
-          command_line_string, channel_string));
+  base::Value custom_constants = GetCustomConstants();
 
   auto* network_context =
       content::BrowserContext::GetDefaultStoragePartition(browser_context_)
@@ -209,6 +230,177 @@ v8::Local<v8::Promise> NetLog::StopLogging(gin_helper::Arguments* args) {
   return handle;
 }
 
+v8::Local<v8::Promise> NetLog::StartRecording(gin_helper::Arguments* args) {
+  util::Promise<void*> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (net_log_recorder_ || recorder_busy_) {
+    promise.RejectWithErrorMessage("There is already a recording running");
+    return handle;
+  }
+
+  recording_capture_mode_ = net::NetLogCaptureMode::kDefault;
+  recording_max_size_ = kDefaultRecordingBufferSize;
+
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    v8::Local<v8::Value> capture_mode_v8;
+    if (dict.Get("captureMode", &capture_mode_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), capture_mode_v8,
+                              &recording_capture_mode_)) {
+        args->ThrowError("Invalid value for captureMode");
+        return v8::Local<v8::Promise>();
+      }
+    }
+    v8::Local<v8::Value> max_buffer_size_v8;
+    if (dict.Get("maxBufferSize", &max_buffer_size_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), max_buffer_size_v8,
+                              &recording_max_size_)) {
+        args->ThrowError("Invalid value for maxBufferSize");
+        return v8::Local<v8::Promise>();
+      }
+    }
+  }
+
+  recorder_busy_ = true;
+  base::PostTaskAndReplyWithResult(
+      file_task_runner_.get(), FROM_HERE, base::BindOnce(CreateScratchFile),
+      base::BindOnce(&NetLog::StartRecorderAfterCreateFile,
+                     weak_ptr_factory_.GetWeakPtr(),
+                     base::make_optional(std::move(promise))));
+
+  return handle;
+}
+
+void NetLog::StartRecorderAfterCreateFile(
+    base::Optional<util::Promise<void*>> promise,
+    std::pair<base::FilePath, base::File> scratch) {
+  if (!scratch.second.IsValid()) {
+    recorder_busy_ = false;
+    if (promise)
+      promise->RejectWithErrorMessage("Failed to create scratch file");
+    return;
+  }
+  recording_scratch_path_ = scratch.first;
+
+  auto* network_context =
+      content::BrowserContext::GetDefaultStoragePartition(browser_context_)
+          ->GetNetworkContext();
+  network_context->CreateNetLogExporter(mojo::MakeRequest(&net_log_recorder_));
+  net_log_recorder_.set_connection_error_handler(base::BindOnce(
+      &NetLog::OnRecorderConnectionError, base::Unretained(this)));
+
+  // A bounded exporter keeps the most recent events within the size cap, so
+  // steady-state overhead is fixed no matter how long it runs.
+  net_log_recorder_->Start(
+      std::move(scratch.second), GetCustomConstants(), recording_capture_mode_,
+      recording_max_size_,
+      base::BindOnce(&NetLog::RecorderStarted, base::Unretained(this),
+                     std::move(promise)));
+}
+
+void NetLog::RecorderStarted(base::Optional<util::Promise<void*>> promise,
+                             int32_t error) {
+  recorder_busy_ = false;
+  if (error != net::OK)
+    net_log_recorder_.reset();
+  if (promise)
+    ResolvePromiseWithNetError(std::move(*promise), error);
+}
+
+void NetLog::OnRecorderConnectionError() {
+  net_log_recorder_.reset();
+  recorder_busy_ = false;
+}
+
+bool NetLog::IsCurrentlyRecording() const {
+  return !!net_log_recorder_;
+}
+
+v8::Local<v8::Promise> NetLog::DumpRecent(base::FilePath path,
+                                          gin_helper::Arguments* args) {
+  util::Promise<void*> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (path.empty()) {
+    args->ThrowError("The first parameter must be a valid string");
+    return v8::Local<v8::Promise>();
+  }
+  if (!net_log_recorder_ || recorder_busy_) {
+    promise.RejectWithErrorMessage("No recording in progress");
+    return handle;
+  }
+
+  // Stopping the exporter flushes the ring of recent events into the scratch
+  // file, which is then moved to the requested path and recording restarts.
+  recorder_busy_ = true;
+  net_log_recorder_->Stop(
+      base::Value(base::Value::Type::DICTIONARY),
+      base::BindOnce(&NetLog::DumpRecentStopped, base::Unretained(this),
+                     std::move(path), std::move(promise)));
+
+  return handle;
+}
+
+void NetLog::DumpRecentStopped(base::FilePath dest,
+                               util::Promise<void*> promise,
+                               int32_t error) {
+  net_log_recorder_.reset();
+  if (error != net::OK) {
+    recorder_busy_ = false;
+    ResolvePromiseWithNetError(std::move(promise), error);
+    return;
+  }
+  base::PostTaskAndReplyWithResult(
+      file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(MoveScratchFile, recording_scratch_path_,
+                     std::move(dest)),
+      base::BindOnce(&NetLog::DumpRecentMoved, weak_ptr_factory_.GetWeakPtr(),
+                     std::move(promise)));
+}
+
+void NetLog::DumpRecentMoved(util::Promise<void*> promise, bool success) {
+  if (success)
+    promise.Resolve();
+  else
+    promise.RejectWithErrorMessage("Failed to write dump file");
+
+  // Restart recording so the always-on capture continues.
+  base::PostTaskAndReplyWithResult(
+      file_task_runner_.get(), FROM_HERE, base::BindOnce(CreateScratchFile),
+      base::BindOnce(&NetLog::StartRecorderAfterCreateFile,
+                     weak_ptr_factory_.GetWeakPtr(), base::nullopt));
+}
+
+v8::Local<v8::Promise> NetLog::StopRecording(gin_helper::Arguments* args) {
+  util::Promise<void*> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!net_log_recorder_ || recorder_busy_) {
+    promise.RejectWithErrorMessage("No recording in progress");
+    return handle;
+  }
+
+  // Move the recorder into the callback so the pipe stays alive until the
+  // network service acknowledges the stop, then discard the scratch file.
+  net_log_recorder_->Stop(
+      base::Value(base::Value::Type::DICTIONARY),
+      base::BindOnce(
+          [](network::mojom::NetLogExporterPtr,
+             scoped_refptr<base::TaskRunner> file_task_runner,
+             base::FilePath scratch_path, util::Promise<void*> promise,
+             int32_t error) {
+            file_task_runner->PostTask(
+                FROM_HERE, base::BindOnce(base::IgnoreResult(&base::DeleteFile),
+                                          scratch_path, false));
+            ResolvePromiseWithNetError(std::move(promise), error);
+          },
+          std::move(net_log_recorder_), file_task_runner_,
+          recording_scratch_path_, std::move(promise)));
+
+  return handle;
+}
+
 // static
 gin::Handle<NetLog> NetLog::Create(v8::Isolate* isolate,
                                    AtomBrowserContext* browser_context) {
@@ -221,8 +413,12 @@ void NetLog::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(gin::StringToV8(isolate, "NetLog"));
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetProperty("currentlyLogging", &NetLog::IsCurrentlyLogging)
+      .SetProperty("currentlyRecording", &NetLog::IsCurrentlyRecording)
       .SetMethod("startLogging", &NetLog::StartLogging)
-      .SetMethod("stopLogging", &NetLog::StopLogging);
+      .SetMethod("stopLogging", &NetLog::StopLogging)
+      .SetMethod("startRecording", &NetLog::StartRecording)
+      .SetMethod("stopRecording", &NetLog::StopRecording)
+      .SetMethod("dumpRecent", &NetLog::DumpRecent);
 }
 
 }  // namespace api
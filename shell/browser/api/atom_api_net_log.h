@@ -8,6 +8,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "base/callback.h"
 #include "base/optional.h"
@@ -36,6 +37,12 @@ class NetLog : public gin_helper::TrackableObject<NetLog> {
   v8::Local<v8::Promise> StopLogging(gin_helper::Arguments* args);
   bool IsCurrentlyLogging() const;
 
+  v8::Local<v8::Promise> StartRecording(gin_helper::Arguments* args);
+  v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args);
+  v8::Local<v8::Promise> DumpRecent(base::FilePath path,
+                                    gin_helper::Arguments* args);
+  bool IsCurrentlyRecording() const;
+
  protected:
   explicit NetLog(v8::Isolate* isolate, AtomBrowserContext* browser_context);
   ~NetLog() override;
@@ -48,11 +55,34 @@ class NetLog : public gin_helper::TrackableObject<NetLog> {
                                   base::File output_file);
   void NetLogStarted(int32_t error);
 
+  // Bounded recorder plumbing. The recorder is a second exporter writing the
+  // most recent events into a scratch file with a fixed size cap, which
+  // DumpRecent snapshots to a caller-provided path.
+  void StartRecorderAfterCreateFile(
+      base::Optional<util::Promise<void*>> promise,
+      std::pair<base::FilePath, base::File> scratch);
+  void RecorderStarted(base::Optional<util::Promise<void*>> promise,
+                       int32_t error);
+  void OnRecorderConnectionError();
+  void DumpRecentStopped(base::FilePath dest,
+                         util::Promise<void*> promise,
+                         int32_t error);
+  void DumpRecentMoved(util::Promise<void*> promise, bool success);
+
  private:
   AtomBrowserContext* browser_context_;
 
   network::mojom::NetLogExporterPtr net_log_exporter_;
 
+  network::mojom::NetLogExporterPtr net_log_recorder_;
+  net::NetLogCaptureMode recording_capture_mode_ =
+      net::NetLogCaptureMode::kDefault;
+  uint64_t recording_max_size_ = 0;
+  base::FilePath recording_scratch_path_;
+  // True while the recorder is starting, restarting or dumping; concurrent
+  // operations are rejected instead of queued.
+  bool recorder_busy_ = false;
+
   base::Optional<util::Promise<void*>> pending_start_promise_;
 
   scoped_refptr<base::TaskRunner> file_task_runner_;
@@ -71,6 +71,7 @@ Notification::Notification(gin::Arguments* args) {
     opts.Get("actions", &actions_);
     opts.Get("sound", &sound_);
     opts.Get("closeButtonText", &close_button_text_);
+    opts.Get("tag", &tag_);
   }
 }
 
@@ -134,6 +135,10 @@ base::string16 Notification::GetCloseButtonText() const {
   return close_button_text_;
 }
 
+std::string Notification::GetTag() const {
+  return tag_;
+}
+
 // Setters
 void Notification::SetTitle(const base::string16& new_title) {
   title_ = new_title;
@@ -180,6 +185,10 @@ void Notification::SetCloseButtonText(const base::string16& text) {
   close_button_text_ = text;
 }
 
+void Notification::SetTag(const std::string& tag) {
+  tag_ = tag;
+}
+
 void Notification::NotificationAction(int index) {
   Emit("action", index);
 }
@@ -203,34 +212,71 @@ void Notification::NotificationClosed() {
 }
 
 void Notification::Close() {
+  update_timer_.Stop();
   if (notification_) {
     notification_->Dismiss();
     notification_.reset();
   }
 }
 
+electron::NotificationOptions Notification::GetOptions() const {
+  electron::NotificationOptions options;
+  options.title = title_;
+  options.subtitle = subtitle_;
+  options.msg = body_;
+  options.icon_url = GURL();
+  options.icon = icon_.AsBitmap();
+  options.silent = silent_;
+  options.has_reply = has_reply_;
+  options.timeout_type = timeout_type_;
+  options.reply_placeholder = reply_placeholder_;
+  options.actions = actions_;
+  options.sound = sound_;
+  options.close_button_text = close_button_text_;
+  options.urgency = urgency_;
+  options.tag = tag_;
+  return options;
+}
+
+void Notification::ApplyUpdate() {
+  if (!notification_)
+    return;
+  last_update_time_ = base::TimeTicks::Now();
+  notification_->Update(GetOptions());
+}
+
 // Showing notifications
 void Notification::Show() {
-  Close();
-  if (presenter_) {
-    notification_ = presenter_->CreateNotification(this, base::GenerateGUID());
-    if (notification_) {
-      electron::NotificationOptions options;
-      options.title = title_;
-      options.subtitle = subtitle_;
-      options.msg = body_;
-      options.icon_url = GURL();
-      options.icon = icon_.AsBitmap();
-      options.silent = silent_;
-      options.has_reply = has_reply_;
-      options.timeout_type = timeout_type_;
-      options.reply_placeholder = reply_placeholder_;
-      options.actions = actions_;
-      options.sound = sound_;
-      options.close_button_text = close_button_text_;
-      options.urgency = urgency_;
-      notification_->Show(options);
+  if (!presenter_)
+    return;
+
+  if (notification_) {
+    // The platform notification is still alive, so mutate it in place
+    // instead of tearing it down and re-creating it. Updates arriving
+    // faster than the platform can usefully display them (e.g. progress
+    // ticks) are coalesced; the flush reads the current property values,
+    // so the latest update always wins.
+    constexpr auto kUpdateCoalesceInterval =
+        base::TimeDelta::FromMilliseconds(100);
+    const base::TimeDelta since_last =
+        base::TimeTicks::Now() - last_update_time_;
+    if (since_last < kUpdateCoalesceInterval) {
+      if (!update_timer_.IsRunning()) {
+        update_timer_.Start(FROM_HERE, kUpdateCoalesceInterval - since_last,
+                            base::BindOnce(&Notification::ApplyUpdate,
+                                           base::Unretained(this)));
+      }
+      return;
     }
+    ApplyUpdate();
+    return;
+  }
+
+  update_timer_.Stop();
+  notification_ = presenter_->CreateNotification(this, base::GenerateGUID());
+  if (notification_) {
+    last_update_time_ = base::TimeTicks::Now();
+    notification_->Show(GetOptions());
   }
 }
 
@@ -264,7 +310,8 @@ void Notification::BuildPrototype(v8::Isolate* isolate,
       .SetProperty("actions", &Notification::GetActions,
                    &Notification::SetActions)
       .SetProperty("closeButtonText", &Notification::GetCloseButtonText,
-                   &Notification::SetCloseButtonText);
+                   &Notification::SetCloseButtonText)
+      .SetProperty("tag", &Notification::GetTag, &Notification::SetTag);
 }
 
 }  // namespace api
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/strings/utf_string_conversions.h"
+#include "base/timer/timer.h"
 #include "shell/browser/notifications/notification.h"
 #include "shell/browser/notifications/notification_delegate.h"
 #include "shell/browser/notifications/notification_presenter.h"
@@ -62,6 +63,7 @@ class Notification : public gin_helper::TrackableObject<Notification>,
   base::string16 GetSound() const;
   std::vector<electron::NotificationAction> GetActions() const;
   base::string16 GetCloseButtonText() const;
+  std::string GetTag() const;
 
   // Prop Setters
   void SetTitle(const base::string16& new_title);
@@ -75,8 +77,12 @@ class Notification : public gin_helper::TrackableObject<Notification>,
   void SetSound(const base::string16& sound);
   void SetActions(const std::vector<electron::NotificationAction>& actions);
   void SetCloseButtonText(const base::string16& text);
+  void SetTag(const std::string& tag);
 
  private:
+  electron::NotificationOptions GetOptions() const;
+  void ApplyUpdate();
+
   base::string16 title_;
   base::string16 subtitle_;
   base::string16 body_;
@@ -91,11 +97,16 @@ class Notification : public gin_helper::TrackableObject<Notification>,
   base::string16 urgency_;
   std::vector<electron::NotificationAction> actions_;
   base::string16 close_button_text_;
+  std::string tag_;
 
   electron::NotificationPresenter* presenter_;
 
   base::WeakPtr<electron::Notification> notification_;
 
+  // Coalesces rapid-fire updates of an already-shown notification.
+  base::OneShotTimer update_timer_;
+  base::TimeTicks last_update_time_;
+
   DISALLOW_COPY_AND_ASSIGN(Notification);
 };
 
@@ -4,8 +4,10 @@
 
 #include "shell/browser/api/atom_api_power_monitor.h"
 
+#include "base/bind.h"
 #include "base/power_monitor/power_monitor.h"
 #include "base/power_monitor/power_monitor_device_source.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "gin/dictionary.h"
 #include "gin/handle.h"
 #include "shell/browser/browser.h"
@@ -73,24 +75,56 @@ void PowerMonitor::UnblockShutdown() {
 #endif
 
 void PowerMonitor::OnPowerStateChange(bool on_battery_power) {
-  if (on_battery_power)
-    Emit("on-battery");
-  else
-    Emit("on-ac");
+  pending_on_battery_ = on_battery_power;
+  SchedulePowerStateEmit();
 }
 
 void PowerMonitor::OnSuspend() {
-  Emit("suspend");
+  pending_suspended_ = true;
+  SchedulePowerStateEmit();
 }
 
 void PowerMonitor::OnResume() {
-  Emit("resume");
+  pending_suspended_ = false;
+  SchedulePowerStateEmit();
+}
+
+void PowerMonitor::SchedulePowerStateEmit() {
+  if (power_emit_posted_)
+    return;
+  power_emit_posted_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&PowerMonitor::EmitPendingPowerStateChanges,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void PowerMonitor::EmitPendingPowerStateChanges() {
+  power_emit_posted_ = false;
+  if (pending_suspended_ && *pending_suspended_ != suspended_) {
+    suspended_ = *pending_suspended_;
+    Emit(suspended_ ? "suspend" : "resume");
+  }
+  pending_suspended_.reset();
+  if (pending_on_battery_ && pending_on_battery_ != on_battery_) {
+    on_battery_ = pending_on_battery_;
+    Emit(*on_battery_ ? "on-battery" : "on-ac");
+  }
+  pending_on_battery_.reset();
 }
 
 ui::IdleState PowerMonitor::GetSystemIdleState(v8::Isolate* isolate,
                                                int idle_threshold) {
   if (idle_threshold > 0) {
-    return ui::CalculateIdleState(idle_threshold);
+    base::TimeTicks now = base::TimeTicks::Now();
+    if (locked_sampled_at_.is_null() ||
+        now - locked_sampled_at_ >= idle_cache_max_age_) {
+      cached_locked_ = ui::CheckIdleStateIsLocked();
+      locked_sampled_at_ = now;
+    }
+    if (cached_locked_)
+      return ui::IDLE_STATE_LOCKED;
+    return GetSystemIdleTime() >= idle_threshold ? ui::IDLE_STATE_IDLE
+                                                 : ui::IDLE_STATE_ACTIVE;
   } else {
     isolate->ThrowException(v8::Exception::TypeError(gin::StringToV8(
         isolate, "Invalid idle threshold, must be greater than 0")));
@@ -99,7 +133,55 @@ ui::IdleState PowerMonitor::GetSystemIdleState(v8::Isolate* isolate,
 }
 
 int PowerMonitor::GetSystemIdleTime() {
-  return ui::CalculateIdleTime();
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (idle_time_sampled_at_.is_null() ||
+      now - idle_time_sampled_at_ >= idle_cache_max_age_) {
+    cached_idle_time_ = ui::CalculateIdleTime();
+    idle_time_sampled_at_ = now;
+  }
+  return cached_idle_time_;
+}
+
+void PowerMonitor::SetIdleCacheMaxAge(v8::Isolate* isolate, double max_age) {
+  if (max_age < 0) {
+    isolate->ThrowException(v8::Exception::TypeError(gin::StringToV8(
+        isolate, "Invalid max age, must not be negative")));
+    return;
+  }
+  idle_cache_max_age_ = base::TimeDelta::FromSecondsD(max_age);
+}
+
+void PowerMonitor::AddIdleThreshold(v8::Isolate* isolate, int threshold) {
+  if (threshold <= 0) {
+    isolate->ThrowException(v8::Exception::TypeError(gin::StringToV8(
+        isolate, "Invalid idle threshold, must be greater than 0")));
+    return;
+  }
+  idle_thresholds_[threshold] = GetSystemIdleTime() >= threshold;
+  if (!idle_poll_timer_.IsRunning()) {
+    idle_poll_timer_.Start(FROM_HERE, base::TimeDelta::FromSeconds(1), this,
+                           &PowerMonitor::OnIdlePollTick);
+  }
+}
+
+void PowerMonitor::RemoveIdleThreshold(int threshold) {
+  idle_thresholds_.erase(threshold);
+  if (idle_thresholds_.empty())
+    idle_poll_timer_.Stop();
+}
+
+void PowerMonitor::OnIdlePollTick() {
+  // Refresh the cache on every tick regardless of its age so threshold
+  // crossings stay timely; getSystemIdleTime callers benefit for free.
+  cached_idle_time_ = ui::CalculateIdleTime();
+  idle_time_sampled_at_ = base::TimeTicks::Now();
+  for (auto& threshold : idle_thresholds_) {
+    const bool idle = cached_idle_time_ >= threshold.first;
+    if (idle != threshold.second) {
+      threshold.second = idle;
+      Emit("idle-threshold", threshold.first, idle);
+    }
+  }
 }
 
 // static
@@ -126,7 +208,10 @@ void PowerMonitor::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("unblockShutdown", &PowerMonitor::UnblockShutdown)
 #endif
       .SetMethod("getSystemIdleState", &PowerMonitor::GetSystemIdleState)
-      .SetMethod("getSystemIdleTime", &PowerMonitor::GetSystemIdleTime);
+      .SetMethod("getSystemIdleTime", &PowerMonitor::GetSystemIdleTime)
+      .SetMethod("setIdleCacheMaxAge", &PowerMonitor::SetIdleCacheMaxAge)
+      .SetMethod("addIdleThreshold", &PowerMonitor::AddIdleThreshold)
+      .SetMethod("removeIdleThreshold", &PowerMonitor::RemoveIdleThreshold);
 }
 
 }  // namespace api
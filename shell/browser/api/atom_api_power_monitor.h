@@ -5,7 +5,13 @@
 #ifndef SHELL_BROWSER_API_ATOM_API_POWER_MONITOR_H_
 #define SHELL_BROWSER_API_ATOM_API_POWER_MONITOR_H_
 
+#include <map>
+
 #include "base/compiler_specific.h"
+#include "base/memory/weak_ptr.h"
+#include "base/optional.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "shell/browser/lib/power_observer.h"
 #include "shell/common/gin_helper/trackable_object.h"
 #include "ui/base/idle/idle.h"
@@ -47,6 +53,37 @@ class PowerMonitor : public gin_helper::TrackableObject<PowerMonitor>,
  private:
   ui::IdleState GetSystemIdleState(v8::Isolate* isolate, int idle_threshold);
   int GetSystemIdleTime();
+  void SetIdleCacheMaxAge(v8::Isolate* isolate, double max_age);
+  void AddIdleThreshold(v8::Isolate* isolate, int threshold);
+  void RemoveIdleThreshold(int threshold);
+
+  // Posts EmitPendingPowerStateChanges if a flush is not already scheduled,
+  // so rapid suspend/resume or AC/battery flaps collapse into the net
+  // transition (or nothing at all).
+  void SchedulePowerStateEmit();
+  void EmitPendingPowerStateChanges();
+
+  void OnIdlePollTick();
+
+  // System idle queries served from a cache so per-second pollers across
+  // processes hit the OS at most once per freshness window.
+  base::TimeDelta idle_cache_max_age_ = base::TimeDelta::FromSeconds(1);
+  base::TimeTicks idle_time_sampled_at_;
+  int cached_idle_time_ = 0;
+  base::TimeTicks locked_sampled_at_;
+  bool cached_locked_ = false;
+
+  // Maps registered idle thresholds (seconds) to whether the system is
+  // currently past them; crossings are pushed as "idle-threshold" events.
+  std::map<int, bool> idle_thresholds_;
+  base::RepeatingTimer idle_poll_timer_;
+
+  // Last emitted and not-yet-emitted power states.
+  bool suspended_ = false;
+  base::Optional<bool> pending_suspended_;
+  base::Optional<bool> on_battery_;
+  base::Optional<bool> pending_on_battery_;
+  bool power_emit_posted_ = false;
 
 #if defined(OS_WIN)
   // Static callback invoked when a message comes in to our messaging window.
@@ -70,6 +107,8 @@ class PowerMonitor : public gin_helper::TrackableObject<PowerMonitor>,
   HWND window_;
 #endif
 
+  base::WeakPtrFactory<PowerMonitor> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(PowerMonitor);
 };
 
@@ -5,6 +5,7 @@
 #include "shell/browser/api/atom_api_power_save_blocker.h"
 
 #include <string>
+#include <vector>
 
 #include "base/bind_helpers.h"
 #include "base/task/post_task.h"
@@ -35,6 +36,17 @@ struct Converter<device::mojom::WakeLockType> {
       return false;
     return true;
   }
+
+  static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
+                                   device::mojom::WakeLockType type) {
+    switch (type) {
+      case device::mojom::WakeLockType::kPreventDisplaySleep:
+        return StringToV8(isolate, "prevent-display-sleep");
+      case device::mojom::WakeLockType::kPreventAppSuspension:
+      default:
+        return StringToV8(isolate, "prevent-app-suspension");
+    }
+  }
 };
 
 }  // namespace gin
@@ -69,7 +81,8 @@ void PowerSaveBlocker::UpdatePowerSaveBlocker() {
   device::mojom::WakeLockType new_lock_type =
       device::mojom::WakeLockType::kPreventAppSuspension;
   for (const auto& element : wake_lock_types_) {
-    if (element.second == device::mojom::WakeLockType::kPreventDisplaySleep) {
+    if (element.second.type ==
+        device::mojom::WakeLockType::kPreventDisplaySleep) {
       new_lock_type = device::mojom::WakeLockType::kPreventDisplaySleep;
       break;
     }
@@ -104,7 +117,7 @@ device::mojom::WakeLock* PowerSaveBlocker::GetWakeLock() {
 
 int PowerSaveBlocker::Start(device::mojom::WakeLockType type) {
   static int count = 0;
-  wake_lock_types_[count] = type;
+  wake_lock_types_[count] = {type, base::Time::Now()};
   UpdatePowerSaveBlocker();
   return count++;
 }
@@ -119,6 +132,20 @@ bool PowerSaveBlocker::IsStarted(int id) {
   return wake_lock_types_.find(id) != wake_lock_types_.end();
 }
 
+v8::Local<v8::Value> PowerSaveBlocker::GetActiveBlockers(
+    v8::Isolate* isolate) {
+  std::vector<gin::Dictionary> blockers;
+  blockers.reserve(wake_lock_types_.size());
+  for (const auto& element : wake_lock_types_) {
+    gin::Dictionary blocker = gin::Dictionary::CreateEmpty(isolate);
+    blocker.Set("id", element.first);
+    blocker.Set("type", element.second.type);
+    blocker.Set("startTime", element.second.started_at.ToJsTime());
+    blockers.push_back(blocker);
+  }
+  return gin::ConvertToV8(isolate, blockers);
+}
+
 // static
 gin::Handle<PowerSaveBlocker> PowerSaveBlocker::Create(v8::Isolate* isolate) {
   return gin::CreateHandle(isolate, new PowerSaveBlocker(isolate));
@@ -129,7 +156,8 @@ gin::ObjectTemplateBuilder PowerSaveBlocker::GetObjectTemplateBuilder(
   return gin::Wrappable<PowerSaveBlocker>::GetObjectTemplateBuilder(isolate)
       .SetMethod("start", &PowerSaveBlocker::Start)
       .SetMethod("stop", &PowerSaveBlocker::Stop)
-      .SetMethod("isStarted", &PowerSaveBlocker::IsStarted);
+      .SetMethod("isStarted", &PowerSaveBlocker::IsStarted)
+      .SetMethod("getActiveBlockers", &PowerSaveBlocker::GetActiveBlockers);
 }
 
 }  // namespace api
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 
+#include "base/time/time.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
@@ -36,6 +37,7 @@ class PowerSaveBlocker : public gin::Wrappable<PowerSaveBlocker> {
   int Start(device::mojom::WakeLockType type);
   bool Stop(int id);
   bool IsStarted(int id);
+  v8::Local<v8::Value> GetActiveBlockers(v8::Isolate* isolate);
 
   device::mojom::WakeLock* GetWakeLock();
 
@@ -45,8 +47,13 @@ class PowerSaveBlocker : public gin::Wrappable<PowerSaveBlocker> {
   // Whether the wake lock is currently active.
   bool is_wake_lock_active_;
 
-  // Map from id to the corresponding blocker type for each request.
-  using WakeLockTypeMap = std::map<int, device::mojom::WakeLockType>;
+  // Map from id to the corresponding blocker type and start time for each
+  // request; all requests share the single OS wake lock below.
+  struct BlockerRecord {
+    device::mojom::WakeLockType type;
+    base::Time started_at;
+  };
+  using WakeLockTypeMap = std::map<int, BlockerRecord>;
   WakeLockTypeMap wake_lock_types_;
 
   device::mojom::WakeLockPtr wake_lock_;
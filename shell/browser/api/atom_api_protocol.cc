@@ -14,6 +14,7 @@
 #include "shell/browser/browser.h"
 #include "shell/common/deprecate_util.h"
 #include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -173,6 +174,10 @@ void Protocol::RegisterURLLoaderFactories(
     factories->emplace(it.first, std::make_unique<AtomURLLoaderFactory>(
                                      it.second.first, it.second.second));
   }
+  for (const auto& it : static_directories_) {
+    factories->emplace(it.first,
+                       std::make_unique<AtomURLLoaderFactory>(it.second));
+  }
 }
 
 ProtocolError Protocol::RegisterProtocol(ProtocolType type,
@@ -184,14 +189,27 @@ ProtocolError Protocol::RegisterProtocol(ProtocolType type,
 
 void Protocol::UnregisterProtocol(const std::string& scheme,
                                   gin::Arguments* args) {
-  const bool removed = handlers_.erase(scheme) != 0;
+  const bool removed =
+      handlers_.erase(scheme) != 0 || static_directories_.erase(scheme) != 0;
   const auto error =
       removed ? ProtocolError::OK : ProtocolError::NOT_REGISTERED;
   HandleOptionalCallback(args, error);
 }
 
 bool Protocol::IsProtocolRegistered(const std::string& scheme) {
-  return base::Contains(handlers_, scheme);
+  return base::Contains(handlers_, scheme) ||
+         base::Contains(static_directories_, scheme);
+}
+
+void Protocol::RegisterStaticDirectory(const std::string& scheme,
+                                       const base::FilePath& root,
+                                       gin::Arguments* args) {
+  ProtocolError error = ProtocolError::OK;
+  if (IsProtocolRegistered(scheme))
+    error = ProtocolError::REGISTERED;
+  else
+    static_directories_[scheme] = root;
+  HandleOptionalCallback(args, error);
 }
 
 ProtocolError Protocol::InterceptProtocol(ProtocolType type,
@@ -276,6 +294,8 @@ void Protocol::BuildPrototype(v8::Isolate* isolate,
                  &Protocol::RegisterProtocolFor<ProtocolType::kStream>)
       .SetMethod("registerProtocol",
                  &Protocol::RegisterProtocolFor<ProtocolType::kFree>)
+      .SetMethod("registerStaticDirectory",
+                 &Protocol::RegisterStaticDirectory)
       .SetMethod("unregisterProtocol", &Protocol::UnregisterProtocol)
       .SetMethod("isProtocolRegistered", &Protocol::IsProtocolRegistered)
       .SetMethod("isProtocolHandled", &Protocol::IsProtocolHandled)
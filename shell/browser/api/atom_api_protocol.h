@@ -5,9 +5,11 @@
 #ifndef SHELL_BROWSER_API_ATOM_API_PROTOCOL_H_
 #define SHELL_BROWSER_API_ATOM_API_PROTOCOL_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "content/public/browser/content_browser_client.h"
 #include "gin/handle.h"
 #include "shell/browser/net/atom_url_loader_factory.h"
@@ -64,6 +66,12 @@ class Protocol : public gin_helper::TrackableObject<Protocol> {
   void UnregisterProtocol(const std::string& scheme, gin::Arguments* args);
   bool IsProtocolRegistered(const std::string& scheme);
 
+  // Serves files under |root| for |scheme| entirely in C++, without the
+  // main-thread JS hop a file protocol handler would take per request.
+  void RegisterStaticDirectory(const std::string& scheme,
+                               const base::FilePath& root,
+                               gin::Arguments* args);
+
   ProtocolError InterceptProtocol(ProtocolType type,
                                   const std::string& scheme,
                                   const ProtocolHandler& handler);
@@ -93,6 +101,9 @@ class Protocol : public gin_helper::TrackableObject<Protocol> {
 
   HandlersMap handlers_;
   HandlersMap intercept_handlers_;
+
+  // scheme => root directory for handler-free static serving.
+  std::map<std::string, base::FilePath> static_directories_;
 };
 
 }  // namespace api
@@ -5,6 +5,7 @@
 #include "shell/browser/api/atom_api_screen.h"
 
 #include <algorithm>
+#include <map>
 #include <string>
 
 #include "base/bind.h"
@@ -17,6 +18,7 @@
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/node_includes.h"
 #include "ui/display/display.h"
+#include "ui/display/display_finder.h"
 #include "ui/display/screen.h"
 #include "ui/gfx/geometry/point.h"
 
@@ -32,7 +34,7 @@ namespace {
 
 // Find an item in container according to its ID.
 template <class T>
-typename T::iterator FindById(T* container, int id) {
+typename T::iterator FindById(T* container, int64_t id) {
   auto predicate = [id](const typename T::value_type& item) -> bool {
     return item.id() == id;
   };
@@ -59,18 +61,13 @@ void DelayEmit(Screen* screen,
   screen->Emit(name, display);
 }
 
-void DelayEmitWithMetrics(Screen* screen,
-                          base::StringPiece name,
-                          const display::Display& display,
-                          const std::vector<std::string>& metrics) {
-  screen->Emit(name, display, metrics);
-}
-
 }  // namespace
 
 Screen::Screen(v8::Isolate* isolate, display::Screen* screen)
     : screen_(screen) {
   screen_->AddObserver(this);
+  cached_displays_ = screen_->GetAllDisplays();
+  cached_primary_display_ = screen_->GetPrimaryDisplay();
   Init(isolate);
 }
 
@@ -83,19 +80,23 @@ gfx::Point Screen::GetCursorScreenPoint() {
 }
 
 display::Display Screen::GetPrimaryDisplay() {
-  return screen_->GetPrimaryDisplay();
+  return cached_primary_display_;
 }
 
 std::vector<display::Display> Screen::GetAllDisplays() {
-  return screen_->GetAllDisplays();
+  return cached_displays_;
 }
 
 display::Display Screen::GetDisplayNearestPoint(const gfx::Point& point) {
-  return screen_->GetDisplayNearestPoint(point);
+  const display::Display* nearest =
+      display::FindDisplayNearestPoint(cached_displays_, point);
+  return nearest ? *nearest : screen_->GetDisplayNearestPoint(point);
 }
 
 display::Display Screen::GetDisplayMatching(const gfx::Rect& match_rect) {
-  return screen_->GetDisplayMatching(match_rect);
+  const display::Display* matching =
+      display::FindDisplayWithBiggestIntersection(cached_displays_, match_rect);
+  return matching ? *matching : screen_->GetDisplayMatching(match_rect);
 }
 
 #if defined(OS_WIN)
@@ -115,12 +116,22 @@ static gfx::Rect DIPToScreenRect(electron::NativeWindow* window,
 #endif
 
 void Screen::OnDisplayAdded(const display::Display& new_display) {
+  if (FindById(&cached_displays_, new_display.id()) == cached_displays_.end())
+    cached_displays_.push_back(new_display);
+  cached_primary_display_ = screen_->GetPrimaryDisplay();
+
   base::ThreadTaskRunnerHandle::Get()->PostNonNestableTask(
       FROM_HERE, base::Bind(&DelayEmit, base::Unretained(this), "display-added",
                             new_display));
 }
 
 void Screen::OnDisplayRemoved(const display::Display& old_display) {
+  const auto iter = FindById(&cached_displays_, old_display.id());
+  if (iter != cached_displays_.end())
+    cached_displays_.erase(iter);
+  pending_metrics_changes_.erase(old_display.id());
+  cached_primary_display_ = screen_->GetPrimaryDisplay();
+
   base::ThreadTaskRunnerHandle::Get()->PostNonNestableTask(
       FROM_HERE, base::Bind(&DelayEmit, base::Unretained(this),
                             "display-removed", old_display));
@@ -128,10 +139,32 @@ void Screen::OnDisplayRemoved(const display::Display& old_display) {
 
 void Screen::OnDisplayMetricsChanged(const display::Display& display,
                                      uint32_t changed_metrics) {
+  const auto iter = FindById(&cached_displays_, display.id());
+  if (iter != cached_displays_.end())
+    *iter = display;
+  cached_primary_display_ = screen_->GetPrimaryDisplay();
+
+  // DPI changes fire a burst of metrics callbacks per display; fold them
+  // into one batched emit carrying the union of the changed metrics.
+  pending_metrics_changes_[display.id()] |= changed_metrics;
+  if (metrics_emit_posted_)
+    return;
+  metrics_emit_posted_ = true;
   base::ThreadTaskRunnerHandle::Get()->PostNonNestableTask(
-      FROM_HERE, base::Bind(&DelayEmitWithMetrics, base::Unretained(this),
-                            "display-metrics-changed", display,
-                            MetricsToArray(changed_metrics)));
+      FROM_HERE, base::Bind(&Screen::EmitPendingMetricsChanges,
+                            base::Unretained(this)));
+}
+
+void Screen::EmitPendingMetricsChanges() {
+  metrics_emit_posted_ = false;
+  std::map<int64_t, uint32_t> changes;
+  changes.swap(pending_metrics_changes_);
+  for (const auto& change : changes) {
+    const auto iter = FindById(&cached_displays_, change.first);
+    if (iter == cached_displays_.end())
+      continue;
+    Emit("display-metrics-changed", *iter, MetricsToArray(change.second));
+  }
 }
 
 // static
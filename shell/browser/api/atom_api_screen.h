@@ -5,6 +5,7 @@
 #ifndef SHELL_BROWSER_API_ATOM_API_SCREEN_H_
 #define SHELL_BROWSER_API_ATOM_API_SCREEN_H_
 
+#include <map>
 #include <vector>
 
 #include "shell/common/gin_helper/error_thrower.h"
@@ -47,8 +48,22 @@ class Screen : public gin_helper::EventEmitter<Screen>,
                                uint32_t changed_metrics) override;
 
  private:
+  // Emits one display-metrics-changed per display for everything
+  // accumulated in |pending_metrics_changes_|.
+  void EmitPendingMetricsChanges();
+
   display::Screen* screen_;
 
+  // Display topology mirrored from the observer events, so reads do not
+  // make a platform round-trip per call.
+  std::vector<display::Display> cached_displays_;
+  display::Display cached_primary_display_;
+
+  // Metrics-changed storms (common during DPI changes) are coalesced
+  // into one batched emit per display: display id => changed metrics.
+  std::map<int64_t, uint32_t> pending_metrics_changes_;
+  bool metrics_emit_posted_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(Screen);
 };
 
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_closure.h"
 #include "base/files/file_path.h"
 #include "base/guid.h"
 #include "base/strings/string_number_conversions.h"
@@ -32,13 +33,16 @@
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "net/base/address_list.h"
 #include "net/base/completion_repeating_callback.h"
+#include "net/base/host_port_pair.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_auth_handler_factory.h"
 #include "net/http/http_auth_preferences.h"
 #include "net/http/http_cache.h"
 #include "services/network/network_service.h"
 #include "services/network/public/cpp/features.h"
+#include "services/network/public/mojom/host_resolver.mojom.h"
 #include "shell/browser/api/atom_api_cookies.h"
 #include "shell/browser/api/atom_api_data_pipe_holder.h"
 #include "shell/browser/api/atom_api_download_item.h"
@@ -51,6 +55,7 @@
 #include "shell/browser/browser.h"
 #include "shell/browser/media/media_device_id_salt.h"
 #include "shell/browser/net/cert_verifier_client.h"
+#include "shell/browser/net/resolve_proxy_helper.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/content_converter.h"
@@ -79,28 +84,31 @@ struct ClearStorageDataOptions {
   uint32_t quota_types = StoragePartition::QUOTA_MANAGED_STORAGE_MASK_ALL;
 };
 
+struct ClearStorageType {
+  const char* name;
+  uint32_t mask;
+};
+
+constexpr ClearStorageType kClearStorageTypes[] = {
+    {"appcache", StoragePartition::REMOVE_DATA_MASK_APPCACHE},
+    {"cookies", StoragePartition::REMOVE_DATA_MASK_COOKIES},
+    {"filesystem", StoragePartition::REMOVE_DATA_MASK_FILE_SYSTEMS},
+    {"indexdb", StoragePartition::REMOVE_DATA_MASK_INDEXEDDB},
+    {"localstorage", StoragePartition::REMOVE_DATA_MASK_LOCAL_STORAGE},
+    {"shadercache", StoragePartition::REMOVE_DATA_MASK_SHADER_CACHE},
+    {"websql", StoragePartition::REMOVE_DATA_MASK_WEBSQL},
+    {"serviceworkers", StoragePartition::REMOVE_DATA_MASK_SERVICE_WORKERS},
+    {"cachestorage", StoragePartition::REMOVE_DATA_MASK_CACHE_STORAGE},
+};
+
 uint32_t GetStorageMask(const std::vector<std::string>& storage_types) {
   uint32_t storage_mask = 0;
   for (const auto& it : storage_types) {
     auto type = base::ToLowerASCII(it);
-    if (type == "appcache")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_APPCACHE;
-    else if (type == "cookies")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_COOKIES;
-    else if (type == "filesystem")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_FILE_SYSTEMS;
-    else if (type == "indexdb")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_INDEXEDDB;
-    else if (type == "localstorage")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_LOCAL_STORAGE;
-    else if (type == "shadercache")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_SHADER_CACHE;
-    else if (type == "websql")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_WEBSQL;
-    else if (type == "serviceworkers")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_SERVICE_WORKERS;
-    else if (type == "cachestorage")
-      storage_mask |= StoragePartition::REMOVE_DATA_MASK_CACHE_STORAGE;
+    for (const auto& entry : kClearStorageTypes) {
+      if (type == entry.name)
+        storage_mask |= entry.mask;
+    }
   }
   return storage_mask;
 }
@@ -277,6 +285,33 @@ v8::Local<v8::Promise> Session::GetCacheSize() {
   return handle;
 }
 
+v8::Local<v8::Promise> Session::PreWarmCache() {
+  auto* isolate = v8::Isolate::GetCurrent();
+  util::Promise<void*> promise(isolate);
+  auto handle = promise.GetHandle();
+
+  // Computing the cache size forces the network service to open the cache
+  // backend and load its index, so the first real request does not pay for
+  // backend initialization. The size itself is discarded.
+  content::BrowserContext::GetDefaultStoragePartition(browser_context_.get())
+      ->GetNetworkContext()
+      ->ComputeHttpCacheSize(
+          base::Time(), base::Time::Max(),
+          base::BindOnce(
+              [](util::Promise<void*> promise, bool is_upper_bound,
+                 int64_t size_or_error) {
+                if (size_or_error < 0) {
+                  promise.RejectWithErrorMessage(
+                      net::ErrorToString(size_or_error));
+                } else {
+                  promise.Resolve();
+                }
+              },
+              std::move(promise)));
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Session::ClearCache() {
   auto* isolate = v8::Isolate::GetCurrent();
   util::Promise<void*> promise(isolate);
@@ -307,11 +342,48 @@ v8::Local<v8::Promise> Session::ClearStorageData(gin_helper::Arguments* args) {
     MediaDeviceIDSalt::Reset(browser_context()->prefs());
   }
 
-  storage_partition->ClearData(
-      options.storage_types, options.quota_types, options.origin, base::Time(),
-      base::Time::Max(),
-      base::BindOnce(util::Promise<void*>::ResolveEmptyPromise,
-                     std::move(promise)));
+  // Issue one ClearData call per storage type instead of one monolithic
+  // call: the backends then clear in parallel, each completion is surfaced
+  // as a 'clear-storage-data-progress' event, and the operation takes the
+  // time of the slowest backend rather than the sum.
+  std::vector<const ClearStorageType*> types;
+  uint32_t remainder = options.storage_types;
+  for (const auto& entry : kClearStorageTypes) {
+    if (options.storage_types & entry.mask) {
+      types.push_back(&entry);
+      remainder &= ~entry.mask;
+    }
+  }
+
+  const int num_tasks = static_cast<int>(types.size()) + (remainder ? 1 : 0);
+  if (num_tasks == 0) {
+    promise.Resolve();
+    return handle;
+  }
+
+  base::RepeatingClosure barrier = base::BarrierClosure(
+      num_tasks, base::BindOnce(util::Promise<void*>::ResolveEmptyPromise,
+                                std::move(promise)));
+  for (const auto* type : types) {
+    storage_partition->ClearData(
+        type->mask, options.quota_types, options.origin, base::Time(),
+        base::Time::Max(),
+        base::BindOnce(
+            [](Session* session, const std::string& type_name,
+               base::RepeatingClosure barrier) {
+              // Sessions are retained in |g_sessions| until app shutdown, so
+              // |session| outlives the clear operation.
+              session->Emit("clear-storage-data-progress", type_name);
+              barrier.Run();
+            },
+            base::Unretained(this), std::string(type->name), barrier));
+  }
+  // Mask bits without an entry in kClearStorageTypes (only reachable when
+  // the caller passed no "storages" filter) are cleared in one extra call.
+  if (remainder) {
+    storage_partition->ClearData(remainder, options.quota_types, options.origin,
+                                 base::Time(), base::Time::Max(), barrier);
+  }
   return handle;
 }
 
@@ -355,6 +427,9 @@ v8::Local<v8::Promise> Session::SetProxy(gin_helper::Arguments* args) {
         WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
   }
 
+  // Cached resolveProxy results reflect the previous configuration.
+  browser_context_->GetResolveProxyHelper()->InvalidateCache();
+
   base::ThreadTaskRunnerHandle::Get()->PostTask(
       FROM_HERE, base::BindOnce(util::Promise<void*>::ResolveEmptyPromise,
                                 std::move(promise)));
@@ -455,6 +530,85 @@ void Session::SetPermissionCheckHandler(v8::Local<v8::Value> val,
   permission_manager->SetPermissionCheckHandler(handler);
 }
 
+namespace {
+
+// Shared state for a prefetchDNS batch; resolves the promise with the
+// number of successfully resolved hosts once every lookup has completed.
+struct DNSPrefetchBatch {
+  explicit DNSPrefetchBatch(util::Promise<int> p) : promise(std::move(p)) {}
+
+  util::Promise<int> promise;
+  int resolved = 0;
+  size_t pending = 0;
+
+  void OnHostComplete(bool success) {
+    if (success)
+      ++resolved;
+    if (--pending == 0)
+      promise.Resolve(resolved);
+  }
+};
+
+// Self-owned client for one host resolution of a prefetchDNS batch. The
+// resolved addresses land in the network service's host cache; the result
+// itself is only used to count successes.
+class DNSPrefetchClient : public network::mojom::ResolveHostClient {
+ public:
+  explicit DNSPrefetchClient(std::shared_ptr<DNSPrefetchBatch> batch)
+      : batch_(std::move(batch)) {}
+  ~DNSPrefetchClient() override {
+    // A severed pipe without OnComplete counts as a failed lookup.
+    if (!completed_)
+      batch_->OnHostComplete(false);
+  }
+
+ private:
+  // network::mojom::ResolveHostClient:
+  void OnComplete(
+      int32_t result,
+      const base::Optional<net::AddressList>& resolved_addresses) override {
+    completed_ = true;
+    batch_->OnHostComplete(result == net::OK);
+  }
+  void OnTextResults(const std::vector<std::string>& text_results) override {}
+  void OnHostnameResults(
+      const std::vector<net::HostPortPair>& hosts) override {}
+
+  std::shared_ptr<DNSPrefetchBatch> batch_;
+  bool completed_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(DNSPrefetchClient);
+};
+
+}  // namespace
+
+v8::Local<v8::Promise> Session::PrefetchDNS(
+    const std::vector<std::string>& hosts) {
+  auto* isolate = v8::Isolate::GetCurrent();
+  util::Promise<int> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto batch = std::make_shared<DNSPrefetchBatch>(std::move(promise));
+  if (hosts.empty()) {
+    batch->promise.Resolve(0);
+    return handle;
+  }
+  batch->pending = hosts.size();
+
+  auto* network_context = content::BrowserContext::GetDefaultStoragePartition(
+                              browser_context_.get())
+                              ->GetNetworkContext();
+  for (const std::string& host : hosts) {
+    mojo::PendingRemote<network::mojom::ResolveHostClient> client_remote;
+    mojo::MakeSelfOwnedReceiver(
+        std::make_unique<DNSPrefetchClient>(batch),
+        client_remote.InitWithNewPipeAndPassReceiver());
+    network_context->ResolveHost(net::HostPortPair(host, 443), nullptr,
+                                 std::move(client_remote));
+  }
+  return handle;
+}
+
 v8::Local<v8::Promise> Session::ClearHostResolverCache(
     gin_helper::Arguments* args) {
   v8::Isolate* isolate = args->isolate();
@@ -517,6 +671,20 @@ v8::Local<v8::Promise> Session::GetBlobData(v8::Isolate* isolate,
   return holder->ReadAll(isolate);
 }
 
+v8::Local<v8::Value> Session::GetBlobDataStream(v8::Isolate* isolate,
+                                                const std::string& uuid) {
+  gin::Handle<DataPipeHolder> holder = DataPipeHolder::From(isolate, uuid);
+  v8::Local<v8::Value> reader;
+  if (!holder.IsEmpty())
+    reader = holder->OpenStream(isolate);
+  if (reader.IsEmpty()) {
+    isolate->ThrowException(v8::Exception::Error(
+        gin::StringToV8(isolate, "Could not get blob data handle")));
+    return v8::Null(isolate);
+  }
+  return reader;
+}
+
 void Session::DownloadURL(const GURL& url) {
   auto* download_manager =
       content::BrowserContext::GetDownloadManager(browser_context());
@@ -569,11 +737,50 @@ std::vector<base::FilePath::StringType> Session::GetPreloads() const {
   return prefs->preloads();
 }
 
+void Session::SetInjectionScripts(
+    const std::vector<gin_helper::Dictionary>& scripts,
+    gin_helper::Arguments* args) {
+  std::vector<InjectionScript> entries;
+  for (const auto& script : scripts) {
+    InjectionScript entry;
+    if (!script.Get("urlPattern", &entry.url_pattern) ||
+        !script.Get("file", &entry.script)) {
+      args->ThrowError("Each entry must have 'urlPattern' and 'file'");
+      return;
+    }
+    if (!entry.script.IsAbsolute()) {
+      args->ThrowError("Injection script must have absolute path: " +
+                       entry.script.AsUTF8Unsafe());
+      return;
+    }
+    entries.push_back(std::move(entry));
+  }
+  auto* prefs = SessionPreferences::FromBrowserContext(browser_context());
+  DCHECK(prefs);
+  prefs->set_injection_scripts(entries);
+}
+
+v8::Local<v8::Value> Session::GetInjectionScripts(v8::Isolate* isolate) const {
+  auto* prefs = SessionPreferences::FromBrowserContext(browser_context());
+  DCHECK(prefs);
+  std::vector<gin_helper::Dictionary> result;
+  for (const auto& entry : prefs->injection_scripts()) {
+    gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+    dict.Set("urlPattern", entry.url_pattern);
+    dict.Set("file", entry.script);
+    result.push_back(dict);
+  }
+  return gin::ConvertToV8(isolate, result);
+}
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 void Session::LoadChromeExtension(const base::FilePath extension_path) {
   auto* extension_system = static_cast<extensions::AtomExtensionSystem*>(
       extensions::ExtensionSystem::Get(browser_context()));
-  extension_system->LoadExtension(extension_path);
+  // Loads parse on the thread pool, so sideloading several extensions
+  // at startup doesn't serialize on the UI thread; each registers as
+  // soon as its own parse finishes.
+  extension_system->LoadExtensionAsync(extension_path);
 }
 #endif
 
@@ -646,6 +853,40 @@ void Session::Preconnect(const gin_helper::Dictionary& options,
                      url, num_sockets_to_preconnect));
 }
 
+void Session::SetPreconnectLearning(const gin_helper::Dictionary& options,
+                                    gin_helper::Arguments* args) {
+  bool enabled = false;
+  if (!options.Get("enabled", &enabled)) {
+    args->ThrowError(
+        "Must pass enabled to session.setPreconnectLearning.");
+    return;
+  }
+  int max_origins = 5;
+  if (options.Get("maxOrigins", &max_origins)) {
+    const int kMinOrigins = 1;
+    const int kMaxOrigins = 20;
+    if (max_origins < kMinOrigins || max_origins > kMaxOrigins) {
+      args->ThrowError(base::StringPrintf(
+          "maxOrigins is outside range [%d,%d]", kMinOrigins, kMaxOrigins));
+      return;
+    }
+  }
+  int num_sockets = 1;
+  if (options.Get("numSockets", &num_sockets)) {
+    const int kMinSocketsToPreconnect = 1;
+    const int kMaxSocketsToPreconnect = 6;
+    if (num_sockets < kMinSocketsToPreconnect ||
+        num_sockets > kMaxSocketsToPreconnect) {
+      args->ThrowError(
+          base::StringPrintf("numSocketsToPreconnect is outside range [%d,%d]",
+                             kMinSocketsToPreconnect, kMaxSocketsToPreconnect));
+      return;
+    }
+  }
+
+  browser_context_->SetPreconnectLearning(enabled, max_origins, num_sockets);
+}
+
 // static
 gin::Handle<Session> Session::CreateFrom(v8::Isolate* isolate,
                                          AtomBrowserContext* browser_context) {
@@ -690,6 +931,7 @@ void Session::BuildPrototype(v8::Isolate* isolate,
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("resolveProxy", &Session::ResolveProxy)
       .SetMethod("getCacheSize", &Session::GetCacheSize)
+      .SetMethod("preWarmCache", &Session::PreWarmCache)
       .SetMethod("clearCache", &Session::ClearCache)
       .SetMethod("clearStorageData", &Session::ClearStorageData)
       .SetMethod("flushStorageData", &Session::FlushStorageData)
@@ -702,6 +944,7 @@ void Session::BuildPrototype(v8::Isolate* isolate,
                  &Session::SetPermissionRequestHandler)
       .SetMethod("setPermissionCheckHandler",
                  &Session::SetPermissionCheckHandler)
+      .SetMethod("prefetchDNS", &Session::PrefetchDNS)
       .SetMethod("clearHostResolverCache", &Session::ClearHostResolverCache)
       .SetMethod("clearAuthCache", &Session::ClearAuthCache)
       .SetMethod("allowNTLMCredentialsForDomains",
@@ -709,15 +952,19 @@ void Session::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setUserAgent", &Session::SetUserAgent)
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("_getBlobDataStream", &Session::GetBlobDataStream)
       .SetMethod("downloadURL", &Session::DownloadURL)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
       .SetMethod("setPreloads", &Session::SetPreloads)
       .SetMethod("getPreloads", &Session::GetPreloads)
+      .SetMethod("setInjectionScripts", &Session::SetInjectionScripts)
+      .SetMethod("getInjectionScripts", &Session::GetInjectionScripts)
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
       .SetMethod("loadChromeExtension", &Session::LoadChromeExtension)
 #endif
       .SetMethod("preconnect", &Session::Preconnect)
+      .SetMethod("setPreconnectLearning", &Session::SetPreconnectLearning)
       .SetProperty("cookies", &Session::Cookies)
       .SetProperty("netLog", &Session::NetLog)
       .SetProperty("protocol", &Session::Protocol)
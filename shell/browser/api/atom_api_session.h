@@ -58,6 +58,7 @@ class Session : public gin_helper::TrackableObject<Session>,
   // Methods.
   v8::Local<v8::Promise> ResolveProxy(gin_helper::Arguments* args);
   v8::Local<v8::Promise> GetCacheSize();
+  v8::Local<v8::Promise> PreWarmCache();
   v8::Local<v8::Promise> ClearCache();
   v8::Local<v8::Promise> ClearStorageData(gin_helper::Arguments* args);
   void FlushStorageData();
@@ -71,6 +72,7 @@ class Session : public gin_helper::TrackableObject<Session>,
                                    gin_helper::Arguments* args);
   void SetPermissionCheckHandler(v8::Local<v8::Value> val,
                                  gin_helper::Arguments* args);
+  v8::Local<v8::Promise> PrefetchDNS(const std::vector<std::string>& hosts);
   v8::Local<v8::Promise> ClearHostResolverCache(gin_helper::Arguments* args);
   v8::Local<v8::Promise> ClearAuthCache();
   void AllowNTLMCredentialsForDomains(const std::string& domains);
@@ -78,16 +80,23 @@ class Session : public gin_helper::TrackableObject<Session>,
   std::string GetUserAgent();
   v8::Local<v8::Promise> GetBlobData(v8::Isolate* isolate,
                                      const std::string& uuid);
+  v8::Local<v8::Value> GetBlobDataStream(v8::Isolate* isolate,
+                                         const std::string& uuid);
   void DownloadURL(const GURL& url);
   void CreateInterruptedDownload(const gin_helper::Dictionary& options);
   void SetPreloads(const std::vector<base::FilePath::StringType>& preloads);
   std::vector<base::FilePath::StringType> GetPreloads() const;
+  void SetInjectionScripts(const std::vector<gin_helper::Dictionary>& scripts,
+                           gin_helper::Arguments* args);
+  v8::Local<v8::Value> GetInjectionScripts(v8::Isolate* isolate) const;
   v8::Local<v8::Value> Cookies(v8::Isolate* isolate);
   v8::Local<v8::Value> Protocol(v8::Isolate* isolate);
   v8::Local<v8::Value> WebRequest(v8::Isolate* isolate);
   v8::Local<v8::Value> NetLog(v8::Isolate* isolate);
   void Preconnect(const gin_helper::Dictionary& options,
                   gin_helper::Arguments* args);
+  void SetPreconnectLearning(const gin_helper::Dictionary& options,
+                             gin_helper::Arguments* args);
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   void LoadChromeExtension(const base::FilePath extension_path);
@@ -19,12 +19,14 @@ namespace api {
 
 SystemPreferences::SystemPreferences(v8::Isolate* isolate) {
   Init(isolate);
+  ui::NativeTheme::GetInstanceForNativeUi()->AddObserver(this);
 #if defined(OS_WIN)
   InitializeWindow();
 #endif
 }
 
 SystemPreferences::~SystemPreferences() {
+  ui::NativeTheme::GetInstanceForNativeUi()->RemoveObserver(this);
 #if defined(OS_WIN)
   Browser::Get()->RemoveObserver(this);
 #endif
@@ -32,18 +34,59 @@ SystemPreferences::~SystemPreferences() {
 
 #if !defined(OS_MACOSX)
 bool SystemPreferences::IsDarkMode() {
-  return ui::NativeTheme::GetInstanceForNativeUi()->ShouldUseDarkColors();
+  if (!dark_mode_cache_) {
+    dark_mode_cache_ =
+        ui::NativeTheme::GetInstanceForNativeUi()->ShouldUseDarkColors();
+  }
+  return *dark_mode_cache_;
 }
 #endif
 
-bool SystemPreferences::IsInvertedColorScheme() {
+bool SystemPreferences::ComputeIsInvertedColorScheme() const {
   return color_utils::IsInvertedColorScheme();
 }
 
-bool SystemPreferences::IsHighContrastColorScheme() {
+bool SystemPreferences::ComputeIsHighContrastColorScheme() const {
   return ui::NativeTheme::GetInstanceForNativeUi()->UsesHighContrastColors();
 }
 
+bool SystemPreferences::IsInvertedColorScheme() {
+  if (!inverted_color_scheme_cache_)
+    inverted_color_scheme_cache_ = ComputeIsInvertedColorScheme();
+  return *inverted_color_scheme_cache_;
+}
+
+bool SystemPreferences::IsHighContrastColorScheme() {
+  if (!high_contrast_color_scheme_cache_)
+    high_contrast_color_scheme_cache_ = ComputeIsHighContrastColorScheme();
+  return *high_contrast_color_scheme_cache_;
+}
+
+void SystemPreferences::OnNativeThemeUpdated(ui::NativeTheme* theme) {
+  const bool inverted = ComputeIsInvertedColorScheme();
+  const bool high_contrast = ComputeIsHighContrastColorScheme();
+
+#if !defined(OS_WIN)
+  // Windows pushes these diffs from its system color change listener.
+  const bool inverted_changed = inverted_color_scheme_cache_.has_value() &&
+                                *inverted_color_scheme_cache_ != inverted;
+  const bool high_contrast_changed =
+      high_contrast_color_scheme_cache_.has_value() &&
+      *high_contrast_color_scheme_cache_ != high_contrast;
+#endif
+
+  dark_mode_cache_ = theme->ShouldUseDarkColors();
+  inverted_color_scheme_cache_ = inverted;
+  high_contrast_color_scheme_cache_ = high_contrast;
+
+#if !defined(OS_WIN)
+  if (inverted_changed)
+    Emit("inverted-color-scheme-changed", inverted);
+  if (high_contrast_changed)
+    Emit("high-contrast-color-scheme-changed", high_contrast);
+#endif
+}
+
 v8::Local<v8::Value> SystemPreferences::GetAnimationSettings(
     v8::Isolate* isolate) {
   gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
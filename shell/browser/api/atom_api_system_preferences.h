@@ -8,11 +8,13 @@
 #include <memory>
 #include <string>
 
+#include "base/optional.h"
 #include "base/values.h"
 #include "gin/handle.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/event_emitter.h"
 #include "shell/common/promise_util.h"
+#include "ui/native_theme/native_theme_observer.h"
 
 #if defined(OS_WIN)
 #include "shell/browser/browser.h"
@@ -32,7 +34,8 @@ enum NotificationCenterKind {
 };
 #endif
 
-class SystemPreferences : public gin_helper::EventEmitter<SystemPreferences>
+class SystemPreferences : public gin_helper::EventEmitter<SystemPreferences>,
+                          public ui::NativeThemeObserver
 #if defined(OS_WIN)
     ,
                           public BrowserObserver,
@@ -117,6 +120,9 @@ class SystemPreferences : public gin_helper::EventEmitter<SystemPreferences>
   bool IsHighContrastColorScheme();
   v8::Local<v8::Value> GetAnimationSettings(v8::Isolate* isolate);
 
+  // ui::NativeThemeObserver:
+  void OnNativeThemeUpdated(ui::NativeTheme* theme) override;
+
  protected:
   explicit SystemPreferences(v8::Isolate* isolate);
   ~SystemPreferences() override;
@@ -129,6 +135,18 @@ class SystemPreferences : public gin_helper::EventEmitter<SystemPreferences>
 #endif
 
  private:
+  // Uncached platform reads backing the cached getters; also used when a
+  // change notification needs the fresh value to diff against.
+  bool ComputeIsInvertedColorScheme() const;
+  bool ComputeIsHighContrastColorScheme() const;
+
+  // Values served to JS without a platform round-trip; refreshed (and
+  // diffed for the change events) by OnNativeThemeUpdated and, on
+  // Windows, by the system color change listener.
+  base::Optional<bool> dark_mode_cache_;
+  base::Optional<bool> inverted_color_scheme_cache_;
+  base::Optional<bool> high_contrast_color_scheme_cache_;
+
 #if defined(OS_WIN)
   // Static callback invoked when a message comes in to our messaging window.
   static LRESULT CALLBACK WndProcStatic(HWND hwnd,
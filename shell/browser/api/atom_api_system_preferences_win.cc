@@ -175,13 +175,16 @@ LRESULT CALLBACK SystemPreferences::WndProc(HWND hwnd,
 }
 
 void SystemPreferences::OnSysColorChange() {
-  bool new_invertered_color_scheme = IsInvertedColorScheme();
+  // Read the fresh values and refresh the caches the getters serve from.
+  bool new_invertered_color_scheme = ComputeIsInvertedColorScheme();
+  inverted_color_scheme_cache_ = new_invertered_color_scheme;
   if (new_invertered_color_scheme != invertered_color_scheme_) {
     invertered_color_scheme_ = new_invertered_color_scheme;
     Emit("inverted-color-scheme-changed", new_invertered_color_scheme);
   }
 
-  bool new_high_contrast_color_scheme = IsHighContrastColorScheme();
+  bool new_high_contrast_color_scheme = ComputeIsHighContrastColorScheme();
+  high_contrast_color_scheme_cache_ = new_high_contrast_color_scheme;
   if (new_high_contrast_color_scheme != high_contrast_color_scheme_) {
     high_contrast_color_scheme_ = new_high_contrast_color_scheme;
     Emit("high-contrast-color-scheme-changed", new_high_contrast_color_scheme);
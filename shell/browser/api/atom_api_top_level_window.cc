@@ -1236,6 +1236,13 @@ namespace {
 
 using electron::api::TopLevelWindow;
 
+void BatchUpdate(base::RepeatingCallback<void()> callback) {
+  // Geometry changes made by |callback| are collected and applied in one
+  // platform transaction when the batch goes out of scope.
+  electron::NativeWindowGeometryBatch batch;
+  callback.Run();
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -1250,6 +1257,7 @@ void Initialize(v8::Local<v8::Object> exports,
                                          .ToLocalChecked());
   constructor.SetMethod("fromId", &TopLevelWindow::FromWeakMapID);
   constructor.SetMethod("getAllWindows", &TopLevelWindow::GetAll);
+  constructor.SetMethod("batchUpdate", &BatchUpdate);
 
   gin_helper::Dictionary dict(isolate, exports);
   dict.Set("TopLevelWindow", constructor);
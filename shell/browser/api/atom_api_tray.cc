@@ -6,6 +6,7 @@
 
 #include <string>
 
+#include "base/bind.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "shell/browser/api/atom_api_menu.h"
 #include "shell/browser/browser.h"
@@ -57,6 +58,9 @@ namespace api {
 Tray::Tray(gin::Handle<NativeImage> image, gin_helper::Arguments* args)
     : tray_icon_(TrayIcon::Create()) {
   SetImage(args->isolate(), image);
+  // Show the initial image right away instead of waiting for the posted
+  // flush.
+  FlushPendingUpdates();
   tray_icon_->AddObserver(this);
 
   InitWithArgs(args);
@@ -138,11 +142,21 @@ void Tray::OnDragEnded() {
 }
 
 void Tray::SetImage(v8::Isolate* isolate, gin::Handle<NativeImage> image) {
+  // Animated trays commonly cycle through a fixed set of images; setting
+  // the image that is already showing is a no-op.
+  if (image.get() == current_image_)
+    return;
+  image_.Reset(isolate, image.ToV8());
+  current_image_ = image.get();
 #if defined(OS_WIN)
-  tray_icon_->SetImage(image->GetHICON(GetSystemMetrics(SM_CXSMICON)));
+  // NativeImage caches the converted HICON per size, so cycling through a
+  // fixed set of images reuses their platform icons.
+  pending_icon_ = image->GetHICON(GetSystemMetrics(SM_CXSMICON));
 #else
-  tray_icon_->SetImage(image->image());
+  pending_image_ = image->image();
 #endif
+  image_update_pending_ = true;
+  ScheduleUpdate();
 }
 
 void Tray::SetPressedImage(v8::Isolate* isolate,
@@ -155,7 +169,13 @@ void Tray::SetPressedImage(v8::Isolate* isolate,
 }
 
 void Tray::SetToolTip(const std::string& tool_tip) {
-  tray_icon_->SetToolTip(tool_tip);
+  if (has_tool_tip_ && tool_tip == current_tool_tip_)
+    return;
+  has_tool_tip_ = true;
+  current_tool_tip_ = tool_tip;
+  pending_tool_tip_ = tool_tip;
+  tool_tip_update_pending_ = true;
+  ScheduleUpdate();
 }
 
 void Tray::SetTitle(const std::string& title) {
@@ -249,6 +269,31 @@ gfx::Rect Tray::GetBounds() {
   return tray_icon_->GetBounds();
 }
 
+void Tray::ScheduleUpdate() {
+  if (update_posted_)
+    return;
+  update_posted_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&Tray::FlushPendingUpdates, weak_factory_.GetWeakPtr()));
+}
+
+void Tray::FlushPendingUpdates() {
+  update_posted_ = false;
+  if (image_update_pending_) {
+    image_update_pending_ = false;
+#if defined(OS_WIN)
+    tray_icon_->SetImage(pending_icon_);
+#else
+    tray_icon_->SetImage(pending_image_);
+#endif
+  }
+  if (tool_tip_update_pending_) {
+    tool_tip_update_pending_ = false;
+    tray_icon_->SetToolTip(pending_tool_tip_);
+  }
+}
+
 // static
 void Tray::BuildPrototype(v8::Isolate* isolate,
                           v8::Local<v8::FunctionTemplate> prototype) {
@@ -9,15 +9,13 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "gin/handle.h"
 #include "shell/browser/ui/tray_icon.h"
 #include "shell/browser/ui/tray_icon_observer.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/trackable_object.h"
-
-namespace gfx {
-class Image;
-}
+#include "ui/gfx/image/image.h"
 
 namespace gin_helper {
 class Dictionary;
@@ -81,9 +79,35 @@ class Tray : public gin_helper::TrackableObject<Tray>, public TrayIconObserver {
   gfx::Rect GetBounds();
 
  private:
+  // Posts FlushPendingUpdates if a flush is not already scheduled, so that
+  // bursts of setImage/setToolTip calls within one task reach the platform
+  // tray icon at most once.
+  void ScheduleUpdate();
+  void FlushPendingUpdates();
+
   v8::Global<v8::Value> menu_;
   std::unique_ptr<TrayIcon> tray_icon_;
 
+  // Keeps the current image alive so |current_image_| stays a valid
+  // identity to diff new setImage calls against.
+  v8::Global<v8::Value> image_;
+  NativeImage* current_image_ = nullptr;
+  std::string current_tool_tip_;
+  bool has_tool_tip_ = false;
+
+  // Updates accumulated since the last flush.
+  bool image_update_pending_ = false;
+  bool tool_tip_update_pending_ = false;
+#if defined(OS_WIN)
+  HICON pending_icon_ = nullptr;
+#else
+  gfx::Image pending_image_;
+#endif
+  std::string pending_tool_tip_;
+  bool update_posted_ = false;
+
+  base::WeakPtrFactory<Tray> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(Tray);
 };
 
@@ -4,8 +4,10 @@
 
 #include "shell/browser/api/atom_api_url_request.h"
 
+#include <cstring>
 #include <utility>
 
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "gin/handle.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
 #include "mojo/public/cpp/system/string_data_source.h"
@@ -13,6 +15,7 @@
 #include "services/network/public/mojom/chunked_data_pipe_getter.mojom.h"
 #include "shell/browser/api/atom_api_session.h"
 #include "shell/browser/atom_browser_context.h"
+#include "shell/common/pooled_array_buffer_allocator.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -79,6 +82,25 @@ const net::NetworkTrafficAnnotationTag kTrafficAnnotation =
           setting: "This feature cannot be disabled."
         })");
 
+// Chunks at least this big skip the copy into browser-side storage and are
+// written from the Buffer's backing store directly; smaller chunks are
+// coalesced so a burst of little write() calls costs one mojo write.
+constexpr size_t kZeroCopyThreshold = 16 * 1024;
+
+// Response chunks smaller than this are coalesced before crossing into V8,
+// so a burst of little reads costs one Buffer instead of dozens.
+constexpr size_t kCoalesceThreshold = 4 * 1024;
+
+// Coalesced response data is flushed once this much has accumulated.
+constexpr size_t kReceiveFlushSize = 64 * 1024;
+
+// Returns an emitted chunk's backing store to the shared pool once the JS
+// Buffer is garbage collected. |hint| carries the allocation length.
+void FreePooledChunk(char* data, void* hint) {
+  PooledArrayBufferAllocator::SharedInstance()->Free(
+      data, static_cast<size_t>(reinterpret_cast<uintptr_t>(hint)));
+}
+
 }  // namespace
 
 // Common class for streaming data.
@@ -264,8 +286,26 @@ bool URLRequest::Write(v8::Local<v8::Value> data, bool is_last) {
     loader_->DownloadAsStream(url_loader_factory_.get(), this);
   }
 
-  if (length > 0)
-    pending_writes_.emplace_back(node::Buffer::Data(data), length);
+  if (length > 0) {
+    // Writes do not start before the last chunk is queued, so the queue is
+    // never mutated while a chunk is being written to the pipe.
+    if (length >= kZeroCopyThreshold) {
+      // Pin the Buffer and upload its backing store in place.
+      PendingWrite write;
+      write.keep_alive.Reset(isolate(), data);
+      write.bytes = node::Buffer::Data(data);
+      write.length = length;
+      pending_writes_.push_back(std::move(write));
+    } else if (!pending_writes_.empty() &&
+               !pending_writes_.back().zero_copy()) {
+      // Coalesce the small chunk into the previous copied one.
+      pending_writes_.back().storage.append(node::Buffer::Data(data), length);
+    } else {
+      PendingWrite write;
+      write.storage.assign(node::Buffer::Data(data), length);
+      pending_writes_.push_back(std::move(write));
+    }
+  }
 
   if (is_last) {
     // The ElementsUploadDataStream requires the knowledge of content length
@@ -363,15 +403,54 @@ void URLRequest::OnDataReceived(base::StringPiece data,
   // In case we received an unexpected event from Chromium net, don't emit any
   // data event after request cancel/error/close.
   if (!(request_state_ & STATE_ERROR) && !(response_state_ & STATE_ERROR)) {
-    v8::HandleScope handle_scope(isolate());
-    v8::Local<v8::Value> buffer;
-    auto maybe = node::Buffer::Copy(isolate(), data.data(), data.size());
-    if (maybe.ToLocal(&buffer))
-      Emit("data", buffer);
+    if (pending_data_.empty() && data.size() >= kCoalesceThreshold) {
+      EmitReceivedChunk(data.data(), data.size());
+    } else {
+      pending_data_.insert(pending_data_.end(), data.begin(), data.end());
+      if (pending_data_.size() >= kReceiveFlushSize) {
+        FlushReceivedData();
+      } else if (!flush_posted_) {
+        // Flush behind the mojo messages already queued on this sequence,
+        // so back-to-back small chunks coalesce while a lone chunk is
+        // delayed by at most one task-queue round trip.
+        flush_posted_ = true;
+        base::SequencedTaskRunnerHandle::Get()->PostTask(
+            FROM_HERE, base::BindOnce(&URLRequest::FlushReceivedData,
+                                      weak_factory_.GetWeakPtr()));
+      }
+    }
   }
   std::move(resume).Run();
 }
 
+void URLRequest::FlushReceivedData() {
+  flush_posted_ = false;
+  if (pending_data_.empty())
+    return;
+  EmitReceivedChunk(pending_data_.data(), pending_data_.size());
+  pending_data_.clear();
+}
+
+void URLRequest::EmitReceivedChunk(const char* data, size_t size) {
+  // Wrap the chunk in an external Buffer backed by a pooled block, so
+  // emitting it skips V8-side allocation and the block is recycled when
+  // the Buffer is garbage collected.
+  auto* allocator = PooledArrayBufferAllocator::SharedInstance();
+  char* block = static_cast<char*>(allocator->AllocateUninitialized(size));
+  if (!block)
+    return;
+  memcpy(block, data, size);
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Value> buffer;
+  auto maybe =
+      node::Buffer::New(isolate(), block, size, &FreePooledChunk,
+                        reinterpret_cast<void*>(static_cast<uintptr_t>(size)));
+  if (maybe.ToLocal(&buffer))
+    Emit("data", buffer);
+  else
+    allocator->Free(block, size);
+}
+
 void URLRequest::OnRetry(base::OnceClosure start_retry) {}
 
 void URLRequest::OnComplete(bool success) {
@@ -379,10 +458,12 @@ void URLRequest::OnComplete(bool success) {
     // In case we received an unexpected event from Chromium net, don't emit any
     // data event after request cancel/error/close.
     if (!(request_state_ & STATE_ERROR) && !(response_state_ & STATE_ERROR)) {
+      FlushReceivedData();
       response_state_ |= STATE_FINISHED;
       Emit("end");
     }
   } else {  // failed
+    pending_data_.clear();
     // If response is started then emit response event, else emit request error.
     //
     // Error is only emitted when there is no previous failure. This is to align
@@ -475,8 +556,9 @@ void URLRequest::DoWrite() {
   DCHECK(!pending_writes_.empty());
   producer_->Write(
       std::make_unique<mojo::StringDataSource>(
-          pending_writes_.front(), mojo::StringDataSource::AsyncWritingMode::
-                                       STRING_STAYS_VALID_UNTIL_COMPLETION),
+          pending_writes_.front().data(),
+          mojo::StringDataSource::AsyncWritingMode::
+              STRING_STAYS_VALID_UNTIL_COMPLETION),
       base::BindOnce(&URLRequest::OnWrite, weak_factory_.GetWeakPtr()));
 }
 
@@ -485,8 +567,8 @@ void URLRequest::StartWriting() {
     return;
 
   size_t size = 0;
-  for (const auto& data : pending_writes_)
-    size += data.size();
+  for (const auto& write : pending_writes_)
+    size += write.size();
   std::move(size_callback_).Run(net::OK, size);
   DoWrite();
 }
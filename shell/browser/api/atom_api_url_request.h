@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/strings/string_piece.h"
 #include "gin/arguments.h"
 #include "gin/dictionary.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
@@ -75,6 +76,13 @@ class URLRequest : public gin_helper::EventEmitter<URLRequest>,
   // Write the first data of |pending_writes_|.
   void DoWrite();
 
+  // Emits |pending_data_| as one Buffer, if any data is buffered.
+  void FlushReceivedData();
+
+  // Emits a chunk of response data as an external Buffer backed by a
+  // pooled block.
+  void EmitReceivedChunk(const char* data, size_t size);
+
   // Start streaming.
   void StartWriting();
 
@@ -126,8 +134,34 @@ class URLRequest : public gin_helper::EventEmitter<URLRequest>,
   int request_state_ = 0;
   int response_state_ = 0;
 
+  // A chunk queued for upload. Large Buffers are pinned by |keep_alive| and
+  // their backing store is written in place without copying; bursts of small
+  // chunks are coalesced into |storage| so one mojo write covers them all.
+  struct PendingWrite {
+    bool zero_copy() const { return !keep_alive.IsEmpty(); }
+    size_t size() const { return zero_copy() ? length : storage.size(); }
+    base::StringPiece data() const {
+      return zero_copy() ? base::StringPiece(bytes, length)
+                         : base::StringPiece(storage);
+    }
+
+    v8::Global<v8::Value> keep_alive;
+    // Points at the pinned Buffer's backing store, which is external memory
+    // and therefore stable while |keep_alive| holds the Buffer.
+    const char* bytes = nullptr;
+    size_t length = 0;
+    std::string storage;
+  };
+
   // Pending writes that not yet sent to NetworkService.
-  std::list<std::string> pending_writes_;
+  std::list<PendingWrite> pending_writes_;
+
+  // Small response chunks coalesced here before being emitted to JS; see
+  // OnDataReceived.
+  std::vector<char> pending_data_;
+
+  // Whether a FlushReceivedData task is queued.
+  bool flush_posted_ = false;
 
   // Used by pin/unpin to manage lifetime.
   v8::Global<v8::Object> wrapper_;
@@ -38,8 +38,54 @@ void View::AddChildViewAt(gin::Handle<View> child, size_t index) {
     return;
   child_views_.emplace(child_views_.begin() + index,     // index
                        isolate(), child->GetWrapper());  // v8::Global(args...)
+  if (batching_layout_) {
+    pending_native_children_.emplace_back(child->view(), index);
+    return;
+  }
   view()->AddChildViewAt(child->view(), index);
 }
+
+void View::AddChildViews(const std::vector<gin::Handle<View>>& children) {
+  bool was_batching = batching_layout_;
+  batching_layout_ = true;
+  for (const auto& child : children)
+    AddChildView(child);
+  batching_layout_ = was_batching;
+  // When called inside batchLayout() the surrounding batch flushes.
+  if (!was_batching)
+    FlushPendingLayout();
+}
+
+void View::BatchLayout(gin_helper::Arguments* args) {
+  v8::Local<v8::Function> fn;
+  if (!args->GetNext(&fn)) {
+    args->ThrowError("Must pass a Function");
+    return;
+  }
+
+  if (batching_layout_) {
+    // Nested batches just run inline; the outermost one flushes.
+    ignore_result(fn->Call(isolate()->GetCurrentContext(),
+                           v8::Undefined(isolate()), 0, nullptr));
+    return;
+  }
+
+  batching_layout_ = true;
+  v8::MaybeLocal<v8::Value> result = fn->Call(
+      isolate()->GetCurrentContext(), v8::Undefined(isolate()), 0, nullptr);
+  batching_layout_ = false;
+  // Flush even when the callback threw, so the native tree matches the
+  // bookkeeping; the exception propagates to the caller afterwards.
+  FlushPendingLayout();
+  ignore_result(result);
+}
+
+void View::FlushPendingLayout() {
+  for (const auto& pending : pending_native_children_)
+    view()->AddChildViewAt(pending.first, pending.second);
+  pending_native_children_.clear();
+  view()->Layout();
+}
 #endif
 
 // static
@@ -57,7 +103,9 @@ void View::BuildPrototype(v8::Isolate* isolate,
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("setLayoutManager", &View::SetLayoutManager)
       .SetMethod("addChildView", &View::AddChildView)
-      .SetMethod("addChildViewAt", &View::AddChildViewAt);
+      .SetMethod("addChildViewAt", &View::AddChildViewAt)
+      .SetMethod("addChildViews", &View::AddChildViews)
+      .SetMethod("batchLayout", &View::BatchLayout);
 #endif
 }
 
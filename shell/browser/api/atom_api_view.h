@@ -6,11 +6,13 @@
 #define SHELL_BROWSER_API_ATOM_API_VIEW_H_
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "electron/buildflags/buildflags.h"
 #include "gin/handle.h"
 #include "shell/browser/api/views/atom_api_layout_manager.h"
+#include "shell/common/gin_helper/arguments.h"
 #include "ui/views/view.h"
 
 namespace electron {
@@ -28,6 +30,8 @@ class View : public gin_helper::TrackableObject<View> {
   void SetLayoutManager(gin::Handle<LayoutManager> layout_manager);
   void AddChildView(gin::Handle<View> view);
   void AddChildViewAt(gin::Handle<View> view, size_t index);
+  void AddChildViews(const std::vector<gin::Handle<View>>& children);
+  void BatchLayout(gin_helper::Arguments* args);
 #endif
 
   views::View* view() const { return view_; }
@@ -41,9 +45,22 @@ class View : public gin_helper::TrackableObject<View> {
   void set_delete_view(bool should) { delete_view_ = should; }
 
  private:
+#if BUILDFLAG(ENABLE_VIEW_API)
+  // Adds the children queued while batching to the native view and runs
+  // the single deferred layout pass.
+  void FlushPendingLayout();
+#endif
+
   v8::Global<v8::Object> layout_manager_;
   std::vector<v8::Global<v8::Object>> child_views_;
 
+  // When true, AddChildViewAt() queues the native adds instead of applying
+  // them, so populating a view from JS costs one layout pass instead of
+  // one per child. Set for the duration of batchLayout() and
+  // addChildViews().
+  bool batching_layout_ = false;
+  std::vector<std::pair<views::View*, size_t>> pending_native_children_;
+
   bool delete_view_ = true;
   views::View* view_ = nullptr;
 
@@ -13,6 +13,7 @@
 #include "base/message_loop/message_loop_current.h"
 #include "base/no_destructor.h"
 #include "base/optional.h"
+#include "base/process/process.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/threading/thread_task_runner_handle.h"
@@ -24,6 +25,7 @@
 #include "content/browser/renderer_host/render_widget_host_impl.h"  // nogncheck
 #include "content/browser/renderer_host/render_widget_host_view_base.h"  // nogncheck
 #include "content/common/widget_messages.h"
+#include "content/public/browser/browser_child_process_host.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "content/public/browser/download_request_utils.h"
 #include "content/public/browser/favicon_status.h"
@@ -62,12 +64,14 @@
 #include "shell/browser/native_window.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/browser/ui/drag_util.h"
+#include "shell/common/asar/asar_util.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
 #include "shell/browser/ui/inspectable_web_contents_view.h"
 #include "shell/browser/web_contents_permission_helper.h"
 #include "shell/browser/web_contents_preferences.h"
 #include "shell/browser/web_contents_zoom_controller.h"
 #include "shell/browser/web_view_guest_delegate.h"
+#include "shell/browser/window_open_policy.h"
 #include "shell/common/api/atom_api_native_image.h"
 #include "shell/common/color_util.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -81,9 +85,11 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/ipc_metrics.h"
 #include "shell/common/mouse_util.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
+#include "shell/common/shared_memory_image.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/common/page/page_zoom.h"
 #include "third_party/blink/public/mojom/frame/find_in_page.mojom.h"
@@ -94,6 +100,7 @@
 #include "ui/events/base_event_utils.h"
 
 #if BUILDFLAG(ENABLE_OSR)
+#include "shell/browser/osr/osr_paint_metrics.h"
 #include "shell/browser/osr/osr_render_widget_host_view.h"
 #include "shell/browser/osr/osr_web_contents_view.h"
 #endif
@@ -222,6 +229,89 @@ struct Converter<WindowOpenDisposition> {
   }
 };
 
+template <>
+struct Converter<electron::NavigationPolicyRules::Policy> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::NavigationPolicyRules::Policy* out) {
+    using Policy = electron::NavigationPolicyRules::Policy;
+    std::string policy;
+    if (ConvertFromV8(isolate, val, &policy)) {
+      if (policy == "allow") {
+        *out = Policy::kAllow;
+        return true;
+      }
+      if (policy == "deny") {
+        *out = Policy::kDeny;
+        return true;
+      }
+      if (policy == "defer") {
+        *out = Policy::kDeferToJS;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+template <>
+struct Converter<electron::NavigationPolicyRules::Rule> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::NavigationPolicyRules::Rule* out) {
+    gin_helper::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    std::string pattern;
+    if (!dict.Get("urlPattern", &pattern) || !dict.Get("policy", &out->policy))
+      return false;
+    out->pattern = URLPattern(URLPattern::SCHEME_ALL);
+    return out->pattern.Parse(pattern) == URLPattern::ParseResult::kSuccess;
+  }
+};
+
+template <>
+struct Converter<electron::WindowOpenPolicy::Policy> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::WindowOpenPolicy::Policy* out) {
+    using Policy = electron::WindowOpenPolicy::Policy;
+    std::string policy;
+    if (ConvertFromV8(isolate, val, &policy)) {
+      if (policy == "allow") {
+        *out = Policy::kAllow;
+        return true;
+      }
+      if (policy == "deny") {
+        *out = Policy::kDeny;
+        return true;
+      }
+      if (policy == "defer") {
+        *out = Policy::kDeferToJS;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+template <>
+struct Converter<electron::WindowOpenPolicy::Rule> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::WindowOpenPolicy::Rule* out) {
+    gin_helper::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    std::string pattern;
+    if (!dict.Get("urlPattern", &pattern) || !dict.Get("policy", &out->policy))
+      return false;
+    dict.Get("features", &out->features);
+    out->pattern = URLPattern(URLPattern::SCHEME_ALL);
+    return out->pattern.Parse(pattern) == URLPattern::ParseResult::kSuccess;
+  }
+};
+
 template <>
 struct Converter<content::SavePageType> {
   static bool FromV8(v8::Isolate* isolate,
@@ -383,6 +473,14 @@ WebContents::WebContents(v8::Isolate* isolate,
   // Read options.
   options.Get("backgroundThrottling", &background_throttling_);
 
+  std::string background_policy;
+  if (options.Get("backgroundPolicy", &background_policy)) {
+    background_policy_ = ParseBackgroundPolicy(background_policy);
+    background_throttling_ = background_policy_ != BackgroundPolicy::kNone;
+  } else if (!background_throttling_) {
+    background_policy_ = BackgroundPolicy::kNone;
+  }
+
   // Get type
   options.Get("type", &type_);
 
@@ -456,6 +554,14 @@ WebContents::WebContents(v8::Isolate* isolate,
   } else {
     content::WebContents::CreateParams params(session->browser_context());
     params.initially_hidden = !initially_shown;
+    // Restoring many background tabs at once would fork a renderer process
+    // per tab up front; with lazyRenderer the process is spawned by the
+    // first load (or an explicit preWarmRenderer call) instead.
+    bool lazy_renderer = false;
+    if (options.Get("lazyRenderer", &lazy_renderer) && lazy_renderer) {
+      params.desired_renderer_state =
+          content::WebContents::CreateParams::kNoRendererProcess;
+    }
     web_contents = content::WebContents::Create(params);
   }
 
@@ -595,11 +701,25 @@ void WebContents::OnCreateWindow(
     WindowOpenDisposition disposition,
     const std::vector<std::string>& features,
     const scoped_refptr<network::ResourceRequestBody>& body) {
+  // Deny rules are normally enforced inside CanCreateWindow before this is
+  // reached; the check here covers the remaining callers. Allow rules
+  // proceed with the rule's extra features merged in.
+  auto* policy = WindowOpenPolicy::FromWebContents(web_contents());
+  const WindowOpenPolicy::Rule* rule =
+      policy ? policy->Evaluate(target_url) : nullptr;
+  if (rule && rule->policy == WindowOpenPolicy::Policy::kDeny)
+    return;
+  std::vector<std::string> merged_features = features;
+  if (rule && rule->policy == WindowOpenPolicy::Policy::kAllow) {
+    merged_features.insert(merged_features.end(), rule->features.begin(),
+                           rule->features.end());
+  }
+
   if (type_ == Type::BROWSER_WINDOW || type_ == Type::OFF_SCREEN)
-    Emit("-new-window", target_url, frame_name, disposition, features, body,
-         referrer);
+    Emit("-new-window", target_url, frame_name, disposition, merged_features,
+         body, referrer);
   else
-    Emit("new-window", target_url, frame_name, disposition, features);
+    Emit("new-window", target_url, frame_name, disposition, merged_features);
 }
 
 void WebContents::WebContentsCreated(content::WebContents* source_contents,
@@ -640,6 +760,14 @@ content::WebContents* WebContents::OpenURLFromTab(
     content::WebContents* source,
     const content::OpenURLParams& params) {
   if (params.disposition != WindowOpenDisposition::CURRENT_TAB) {
+    // This path does not go through CanCreateWindow, so deny rules are
+    // applied here.
+    auto* policy = WindowOpenPolicy::FromWebContents(web_contents());
+    if (policy) {
+      const WindowOpenPolicy::Rule* rule = policy->Evaluate(params.url);
+      if (rule && rule->policy == WindowOpenPolicy::Policy::kDeny)
+        return nullptr;
+    }
     if (type_ == Type::BROWSER_WINDOW || type_ == Type::OFF_SCREEN)
       Emit("-new-window", params.url, "", params.disposition);
     else
@@ -647,6 +775,16 @@ content::WebContents* WebContents::OpenURLFromTab(
     return nullptr;
   }
 
+  // Declarative rules decide the common case without a JS round-trip.
+  switch (navigation_policy_rules_.Evaluate(params.url)) {
+    case NavigationPolicyRules::Policy::kAllow:
+      return CommonWebContentsDelegate::OpenURLFromTab(source, params);
+    case NavigationPolicyRules::Policy::kDeny:
+      return nullptr;
+    case NavigationPolicyRules::Policy::kDeferToJS:
+      break;
+  }
+
   // Give user a chance to cancel navigation.
   if (Emit("will-navigate", params.url))
     return nullptr;
@@ -1020,28 +1158,42 @@ void WebContents::OnElectronBrowserConnectionError() {
 
 void WebContents::Message(bool internal,
                           const std::string& channel,
-                          blink::CloneableMessage arguments) {
+                          mojo_base::BigBuffer arguments) {
   // webContents.emit('-ipc-message', new Event(), internal, channel,
   // arguments);
+  ScopedIPCDispatchTimer timer(channel, arguments.size());
   EmitWithSender("-ipc-message", bindings_.dispatch_context(), InvokeCallback(),
                  internal, channel, std::move(arguments));
 }
 
+void WebContents::MessageBatch(std::vector<mojom::IpcMessagePtr> messages) {
+  // A burst of send() calls coalesced by the renderer within one microtask
+  // checkpoint; emit them in order within this single task.
+  for (auto& message : messages) {
+    ScopedIPCDispatchTimer timer(message->channel, message->arguments.size());
+    EmitWithSender("-ipc-message", bindings_.dispatch_context(),
+                   InvokeCallback(), message->internal, message->channel,
+                   std::move(message->arguments));
+  }
+}
+
 void WebContents::Invoke(bool internal,
                          const std::string& channel,
-                         blink::CloneableMessage arguments,
+                         mojo_base::BigBuffer arguments,
                          InvokeCallback callback) {
   // webContents.emit('-ipc-invoke', new Event(), internal, channel, arguments);
+  ScopedIPCDispatchTimer timer(channel, arguments.size());
   EmitWithSender("-ipc-invoke", bindings_.dispatch_context(),
                  std::move(callback), internal, channel, std::move(arguments));
 }
 
 void WebContents::MessageSync(bool internal,
                               const std::string& channel,
-                              blink::CloneableMessage arguments,
+                              mojo_base::BigBuffer arguments,
                               MessageSyncCallback callback) {
   // webContents.emit('-ipc-message-sync', new Event(sender, message), internal,
   // channel, arguments);
+  ScopedIPCDispatchTimer timer(channel, arguments.size());
   EmitWithSender("-ipc-message-sync", bindings_.dispatch_context(),
                  std::move(callback), internal, channel, std::move(arguments));
 }
@@ -1050,7 +1202,7 @@ void WebContents::MessageTo(bool internal,
                             bool send_to_all,
                             int32_t web_contents_id,
                             const std::string& channel,
-                            blink::CloneableMessage arguments) {
+                            mojo_base::BigBuffer arguments) {
   auto* web_contents = gin_helper::TrackableObject<WebContents>::FromWeakMapID(
       isolate(), web_contents_id);
 
@@ -1060,14 +1212,48 @@ void WebContents::MessageTo(bool internal,
   }
 }
 
+void WebContents::CreateDirectChannel(int32_t web_contents_id,
+                                      mojom::ElectronPeerRequest peer,
+                                      CreateDirectChannelCallback callback) {
+  auto* web_contents = gin_helper::TrackableObject<WebContents>::FromWeakMapID(
+      isolate(), web_contents_id);
+  if (!web_contents) {
+    std::move(callback).Run(false);
+    return;
+  }
+  auto* frame_host = web_contents->web_contents()->GetMainFrame();
+  if (!frame_host) {
+    std::move(callback).Run(false);
+    return;
+  }
+  // Forward the request to the target's main frame, stamping the sender's
+  // WebContents ID. The renderers then talk directly; when either end goes
+  // away the pipe breaks and the sender re-brokers on the next sendTo.
+  mojo::AssociatedRemote<mojom::ElectronRenderer> electron_renderer;
+  frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+      &electron_renderer);
+  electron_renderer->BindElectronPeer(ID(), std::move(peer));
+  std::move(callback).Run(true);
+}
+
 void WebContents::MessageHost(const std::string& channel,
-                              blink::CloneableMessage arguments) {
+                              mojo_base::BigBuffer arguments) {
   // webContents.emit('ipc-message-host', new Event(), channel, args);
   EmitWithSender("ipc-message-host", bindings_.dispatch_context(),
                  InvokeCallback(), channel, std::move(arguments));
 }
 
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
+void WebContents::DereferenceRemoteJSObjects(
+    std::vector<mojom::RemoteObjectReleasePtr> releases) {
+  // One renderer GC sweep's worth of dereferences, unreferenced here within
+  // a single task instead of one task per collected proxy.
+  for (auto& release : releases) {
+    DereferenceRemoteJSObject(release->context_id, release->object_id,
+                              release->ref_count);
+  }
+}
+
 void WebContents::DereferenceRemoteJSObject(const std::string& context_id,
                                             int object_id,
                                             int ref_count) {
@@ -1104,11 +1290,15 @@ void WebContents::RenderFrameDeleted(
 
 void WebContents::DidStartNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (!IsListening("did-start-navigation"))
+    return;
   EmitNavigationEvent("did-start-navigation", navigation_handle);
 }
 
 void WebContents::DidRedirectNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (!IsListening("did-redirect-navigation"))
+    return;
   EmitNavigationEvent("did-redirect-navigation", navigation_handle);
 }
 
@@ -1130,6 +1320,11 @@ void WebContents::DidFinishNavigation(
     // webContents.destroy()).
     auto url = navigation_handle->GetURL();
     bool is_same_document = navigation_handle->IsSameDocument();
+    if (is_main_frame && !is_same_document) {
+      auto* browser_context = static_cast<AtomBrowserContext*>(
+          web_contents()->GetBrowserContext());
+      browser_context->RecordPreconnectDemand(url);
+    }
     if (is_same_document) {
       Emit("did-navigate-in-page", url, is_main_frame, frame_process_id,
            frame_routing_id);
@@ -1182,6 +1377,8 @@ void WebContents::TitleWasSet(content::NavigationEntry* entry) {
 
 void WebContents::DidUpdateFaviconURL(
     const std::vector<content::FaviconURL>& urls) {
+  if (!IsListening("page-favicon-updated"))
+    return;
   std::set<GURL> unique_urls;
   for (const auto& iter : urls) {
     if (iter.icon_type != content::FaviconURL::IconType::kFavicon)
@@ -1282,14 +1479,64 @@ void WebContents::NavigationEntryCommitted(
        details.is_same_document, details.did_replace_entry);
 }
 
-void WebContents::SetBackgroundThrottling(bool allowed) {
-  background_throttling_ = allowed;
+void WebContents::OnVisibilityChanged(content::Visibility visibility) {
+  ApplyBackgroundPolicy(visibility);
+}
+
+// static
+WebContents::BackgroundPolicy WebContents::ParseBackgroundPolicy(
+    const std::string& policy) {
+  if (policy == "none")
+    return BackgroundPolicy::kNone;
+  if (policy == "suspend")
+    return BackgroundPolicy::kSuspend;
+  return BackgroundPolicy::kThrottle;
+}
+
+void WebContents::ApplyBackgroundPolicy(content::Visibility visibility) {
+  auto* contents = web_contents();
+  if (!contents)
+    return;
+
+  // Never freeze a page that is still audible, e.g. a hidden music player.
+  bool should_freeze = background_policy_ == BackgroundPolicy::kSuspend &&
+                       visibility == content::Visibility::HIDDEN &&
+                       !contents->IsCurrentlyAudible();
+  if (should_freeze == page_frozen_)
+    return;
+
+  page_frozen_ = should_freeze;
+  contents->SetPageFrozen(should_freeze);
+}
+
+void WebContents::SetEventListened(const std::string& event, bool listened) {
+  if (listened)
+    listened_events_.insert(event);
+  else
+    listened_events_.erase(event);
+}
+
+bool WebContents::IsListening(const std::string& event) const {
+  return listened_events_.count(event) != 0;
+}
+
+void WebContents::SetBackgroundThrottling(bool allowed,
+                                          gin_helper::Arguments* args) {
+  std::string policy;
+  if (allowed && args->GetNext(&policy))
+    background_policy_ = ParseBackgroundPolicy(policy);
+  else
+    background_policy_ =
+        allowed ? BackgroundPolicy::kThrottle : BackgroundPolicy::kNone;
+  background_throttling_ = background_policy_ != BackgroundPolicy::kNone;
 
   auto* contents = web_contents();
   if (!contents) {
     return;
   }
 
+  ApplyBackgroundPolicy(contents->GetVisibility());
+
   auto* render_view_host = contents->GetRenderViewHost();
   if (!render_view_host) {
     return;
@@ -1313,6 +1560,33 @@ void WebContents::SetBackgroundThrottling(bool allowed) {
   }
 }
 
+void WebContents::SetProcessPriority(const std::string& level,
+                                     gin_helper::Arguments* args) {
+  bool background = false;
+  if (level == "background") {
+    background = true;
+  } else if (level != "normal") {
+    args->ThrowError("Invalid process priority: " + level);
+    return;
+  }
+
+  auto* frame_host = web_contents()->GetMainFrame();
+  if (!frame_host)
+    return;
+  base::Process process = frame_host->GetProcess()->GetProcess().Duplicate();
+  if (!process.IsValid())
+    return;
+  // Note that Chromium recomputes renderer priorities on visibility and
+  // audibility changes, so a priority set here lasts until the next such
+  // transition.
+#if defined(OS_MACOSX)
+  process.SetProcessBackgrounded(
+      content::BrowserChildProcessHost::GetPortProvider(), background);
+#else
+  process.SetProcessBackgrounded(background);
+#endif
+}
+
 int WebContents::GetProcessID() const {
   return web_contents()->GetMainFrame()->GetProcess()->GetID();
 }
@@ -1425,6 +1699,15 @@ void WebContents::DownloadURL(const GURL& url) {
   download_manager->DownloadUrl(std::move(download_params));
 }
 
+void WebContents::PreWarmRenderer() {
+  // Spawn the renderer process ahead of the first load. Used together with
+  // lazyRenderer to warm restored background tabs in priority order.
+  content::RenderProcessHost* process =
+      web_contents()->GetMainFrame()->GetProcess();
+  if (!process->IsInitializedAndNotDead())
+    process->Init();
+}
+
 GURL WebContents::GetURL() const {
   return web_contents()->GetURL();
 }
@@ -2000,7 +2283,7 @@ bool WebContents::SendIPCMessage(bool internal,
                                  bool send_to_all,
                                  const std::string& channel,
                                  v8::Local<v8::Value> args) {
-  blink::CloneableMessage message;
+  mojo_base::BigBuffer message;
   if (!gin::ConvertFromV8(isolate(), args, &message)) {
     isolate()->ThrowException(v8::Exception::Error(
         gin::StringToV8(isolate(), "Failed to serialize arguments")));
@@ -2013,7 +2296,7 @@ bool WebContents::SendIPCMessage(bool internal,
 bool WebContents::SendIPCMessageWithSender(bool internal,
                                            bool send_to_all,
                                            const std::string& channel,
-                                           blink::CloneableMessage args,
+                                           mojo_base::BigBuffer args,
                                            int32_t sender_id) {
   std::vector<content::RenderFrameHost*> target_hosts;
   if (!send_to_all) {
@@ -2025,11 +2308,17 @@ bool WebContents::SendIPCMessageWithSender(bool internal,
     target_hosts = web_contents()->GetAllFrames();
   }
 
-  for (auto* frame_host : target_hosts) {
+  for (size_t i = 0; i < target_hosts.size(); ++i) {
     mojo::AssociatedRemote<mojom::ElectronRenderer> electron_renderer;
-    frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+    target_hosts[i]->GetRemoteAssociatedInterfaces()->GetInterface(
         &electron_renderer);
-    electron_renderer->Message(internal, false, channel, std::move(args),
+    // BigBuffer is move-only; clone the payload for every target but the
+    // last, which takes the original.
+    mojo_base::BigBuffer payload =
+        i + 1 == target_hosts.size()
+            ? std::move(args)
+            : mojo_base::BigBuffer(base::make_span(args.data(), args.size()));
+    electron_renderer->Message(internal, false, channel, std::move(payload),
                                sender_id);
   }
   return true;
@@ -2040,7 +2329,7 @@ bool WebContents::SendIPCMessageToFrame(bool internal,
                                         int32_t frame_id,
                                         const std::string& channel,
                                         v8::Local<v8::Value> args) {
-  blink::CloneableMessage message;
+  mojo_base::BigBuffer message;
   if (!gin::ConvertFromV8(isolate(), args, &message)) {
     isolate()->ThrowException(v8::Exception::Error(
         gin::StringToV8(isolate(), "Failed to serialize arguments")));
@@ -2124,6 +2413,136 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
       v8::Exception::Error(gin::StringToV8(isolate, "Invalid event object")));
 }
 
+void WebContents::SetNavigationPolicyRules(
+    std::vector<NavigationPolicyRules::Rule> rules) {
+  navigation_policy_rules_.SetRules(std::move(rules));
+}
+
+void WebContents::SetWindowOpenPolicyRules(
+    std::vector<WindowOpenPolicy::Rule> rules) {
+  WindowOpenPolicy::CreateForWebContents(web_contents());
+  WindowOpenPolicy::FromWebContents(web_contents())
+      ->SetRules(std::move(rules));
+}
+
+v8::Local<v8::Value> WebContents::EvaluateWindowOpenPolicy(v8::Isolate* isolate,
+                                                           const GURL& url) {
+  auto* policy = WindowOpenPolicy::FromWebContents(web_contents());
+  const WindowOpenPolicy::Rule* rule =
+      policy ? policy->Evaluate(url) : nullptr;
+  if (!rule || rule->policy == WindowOpenPolicy::Policy::kDeferToJS)
+    return v8::Null(isolate);
+
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.Set("policy",
+           rule->policy == WindowOpenPolicy::Policy::kDeny ? "deny" : "allow");
+  dict.Set("features", rule->features);
+  return dict.GetHandle();
+}
+
+void WebContents::SendInputEvents(
+    v8::Isolate* isolate,
+    const std::vector<v8::Local<v8::Value>>& input_events) {
+  content::RenderWidgetHostView* view =
+      web_contents()->GetRenderWidgetHostView();
+  if (!view)
+    return;
+
+  content::RenderWidgetHost* rwh = view->GetRenderWidgetHost();
+
+  // All events are converted before any is forwarded, so an invalid entry
+  // rejects the whole batch instead of replaying a prefix of it.
+  struct ConvertedEvent {
+    blink::WebInputEvent::Type type;
+    blink::WebMouseEvent mouse_event;
+    blink::WebMouseWheelEvent mouse_wheel_event;
+    content::NativeWebKeyboardEvent keyboard_event{
+        blink::WebKeyboardEvent::kRawKeyDown,
+        blink::WebInputEvent::kNoModifiers, ui::EventTimeForNow()};
+  };
+  std::vector<ConvertedEvent> converted;
+  converted.reserve(input_events.size());
+
+  // Mouse-move streams dominate replayed input and differ only in their
+  // coordinates, so within a run of moves the previous converted event is
+  // reused and only the position fields are re-read from the dictionary.
+  bool in_mouse_move_run = false;
+  for (v8::Local<v8::Value> input_event : input_events) {
+    ConvertedEvent event;
+    event.type = gin::GetWebInputEventType(isolate, input_event);
+    bool ok = false;
+    if (event.type == blink::WebInputEvent::kMouseMove &&
+        in_mouse_move_run) {
+      event.mouse_event = converted.back().mouse_event;
+      gin_helper::Dictionary dict;
+      float x = 0.f;
+      float y = 0.f;
+      if (gin::ConvertFromV8(isolate, input_event, &dict) &&
+          dict.Get("x", &x) && dict.Get("y", &y)) {
+        event.mouse_event.SetPositionInWidget(x, y);
+        float global_x = event.mouse_event.PositionInScreen().x;
+        float global_y = event.mouse_event.PositionInScreen().y;
+        dict.Get("globalX", &global_x);
+        dict.Get("globalY", &global_y);
+        event.mouse_event.SetPositionInScreen(global_x, global_y);
+        dict.Get("movementX", &event.mouse_event.movement_x);
+        dict.Get("movementY", &event.mouse_event.movement_y);
+        ok = true;
+      }
+    } else if (blink::WebInputEvent::IsMouseEventType(event.type)) {
+      ok = gin::ConvertFromV8(isolate, input_event, &event.mouse_event);
+    } else if (blink::WebInputEvent::IsKeyboardEventType(event.type)) {
+      ok = gin::ConvertFromV8(isolate, input_event, &event.keyboard_event);
+    } else if (event.type == blink::WebInputEvent::kMouseWheel) {
+      ok = gin::ConvertFromV8(isolate, input_event, &event.mouse_wheel_event);
+    }
+    if (!ok) {
+      isolate->ThrowException(v8::Exception::Error(
+          gin::StringToV8(isolate, "Invalid event object")));
+      return;
+    }
+    in_mouse_move_run = event.type == blink::WebInputEvent::kMouseMove;
+    converted.push_back(std::move(event));
+  }
+
+  for (const ConvertedEvent& event : converted) {
+    if (blink::WebInputEvent::IsMouseEventType(event.type)) {
+      if (IsOffScreen()) {
+#if BUILDFLAG(ENABLE_OSR)
+        GetOffScreenRenderWidgetHostView()->SendMouseEvent(event.mouse_event);
+#endif
+      } else {
+        rwh->ForwardMouseEvent(event.mouse_event);
+      }
+    } else if (blink::WebInputEvent::IsKeyboardEventType(event.type)) {
+      rwh->ForwardKeyboardEvent(event.keyboard_event);
+    } else if (event.type == blink::WebInputEvent::kMouseWheel) {
+      if (IsOffScreen()) {
+#if BUILDFLAG(ENABLE_OSR)
+        GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(
+            event.mouse_wheel_event);
+#endif
+      } else {
+        // Chromium expects phase info in wheel events (and applies a
+        // DCHECK to verify it). See: https://crbug.com/756524.
+        blink::WebMouseWheelEvent mouse_wheel_event = event.mouse_wheel_event;
+        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseBegan;
+        mouse_wheel_event.dispatch_type = blink::WebInputEvent::kBlocking;
+        rwh->ForwardWheelEvent(mouse_wheel_event);
+
+        // Send a synthetic wheel event with phaseEnded to finish scrolling.
+        mouse_wheel_event.has_synthetic_phase = true;
+        mouse_wheel_event.delta_x = 0;
+        mouse_wheel_event.delta_y = 0;
+        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseEnded;
+        mouse_wheel_event.dispatch_type =
+            blink::WebInputEvent::kEventNonBlocking;
+        rwh->ForwardWheelEvent(mouse_wheel_event);
+      }
+    }
+  }
+}
+
 void WebContents::BeginFrameSubscription(gin_helper::Arguments* args) {
   bool only_dirty = false;
   FrameSubscriber::FrameCaptureCallback callback;
@@ -2134,8 +2553,8 @@ void WebContents::BeginFrameSubscription(gin_helper::Arguments* args) {
     return;
   }
 
-  frame_subscriber_ =
-      std::make_unique<FrameSubscriber>(web_contents(), callback, only_dirty);
+  frame_subscriber_ = std::make_unique<FrameSubscriber>(
+      args->isolate(), web_contents(), callback, only_dirty, IsOffScreen());
 }
 
 void WebContents::EndFrameSubscription() {
@@ -2167,12 +2586,18 @@ void WebContents::StartDrag(const gin_helper::Dictionary& item,
 
 v8::Local<v8::Promise> WebContents::CapturePage(gin_helper::Arguments* args) {
   gfx::Rect rect;
+  gfx::Size scale_size;
   util::Promise<gfx::Image> promise(isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
   // get rect arguments if they exist
   args->GetNext(&rect);
 
+  // get capture options if they exist
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("size", &scale_size);
+
   auto* const view = web_contents()->GetRenderWidgetHostView();
   if (!view) {
     promise.ResolveWithGin(gfx::Image());
@@ -2194,12 +2619,23 @@ v8::Local<v8::Promise> WebContents::CapturePage(gin_helper::Arguments* args) {
   if (scale > 1.0f)
     bitmap_size = gfx::ScaleToCeiledSize(view_size, scale);
 
+  // When a target size is given, the scale happens inside the compositor's
+  // copy request before readback, so a thumbnail reads back only the
+  // downscaled pixels instead of a full-resolution frame.
+  if (!scale_size.IsEmpty())
+    bitmap_size = scale_size;
+
   view->CopyFromSurface(gfx::Rect(rect.origin(), view_size), bitmap_size,
                         base::BindOnce(&OnCapturePageDone, std::move(promise)));
   return handle;
 }
 
 void WebContents::OnCursorChange(const content::WebCursor& cursor) {
+  // This fires for practically every mouse move; skip the conversion work
+  // (which may copy a custom cursor bitmap) when nothing is subscribed.
+  if (!IsListening("cursor-changed"))
+    return;
+
   const content::CursorInfo& info = cursor.info();
 
   if (info.type == ui::CursorType::kCustom) {
@@ -2253,16 +2689,75 @@ bool WebContents::IsPainting() const {
   return osr_wcv && osr_wcv->IsPainting();
 }
 
-void WebContents::SetFrameRate(int frame_rate) {
+void WebContents::SetFrameRate(v8::Local<v8::Value> value) {
   auto* osr_wcv = GetOffScreenWebContentsView();
-  if (osr_wcv)
+  if (!osr_wcv)
+    return;
+
+  int frame_rate = 0;
+  if (gin::ConvertFromV8(isolate(), value, &frame_rate)) {
     osr_wcv->SetFrameRate(frame_rate);
+    return;
+  }
+
+  gin_helper::Dictionary options;
+  int min_frame_rate = 0;
+  int max_frame_rate = 0;
+  if (gin::ConvertFromV8(isolate(), value, &options) &&
+      options.Get("minimum", &min_frame_rate) &&
+      options.Get("maximum", &max_frame_rate)) {
+    osr_wcv->SetAdaptiveFrameRate(min_frame_rate, max_frame_rate);
+  }
 }
 
 int WebContents::GetFrameRate() const {
   auto* osr_wcv = GetOffScreenWebContentsView();
   return osr_wcv ? osr_wcv->GetFrameRate() : 0;
 }
+
+void WebContents::SetPaintDirtyOnly(bool dirty_only) {
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (osr_wcv)
+    osr_wcv->SetPaintDirtyOnly(dirty_only);
+}
+
+bool WebContents::IsPaintDirtyOnly() const {
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  return osr_wcv && osr_wcv->IsPaintDirtyOnly();
+}
+
+v8::Local<v8::Value> WebContents::GetPaintMetrics() {
+  auto* metrics = OffScreenPaintMetrics::Get();
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate());
+  dict.Set("framesCaptured", metrics->frames_captured());
+  dict.Set("framesDropped", metrics->frames_dropped());
+  dict.Set("subscriberFrames", metrics->subscriber_frames());
+
+  gin_helper::Dictionary capture = gin::Dictionary::CreateEmpty(isolate());
+  capture.Set("averageLatency",
+              metrics->frames_captured() == 0
+                  ? 0.0
+                  : metrics->total_capture_latency().InMillisecondsF() /
+                        metrics->frames_captured());
+  capture.Set("maxLatency", metrics->max_capture_latency().InMillisecondsF());
+  dict.Set("capture", capture);
+
+  gin_helper::Dictionary copy = gin::Dictionary::CreateEmpty(isolate());
+  copy.Set("count", metrics->copy_count());
+  copy.Set("averageTime", metrics->copy_count() == 0
+                              ? 0.0
+                              : metrics->total_copy_time().InMillisecondsF() /
+                                    metrics->copy_count());
+  copy.Set("maxTime", metrics->max_copy_time().InMillisecondsF());
+  dict.Set("copy", copy);
+
+  gin_helper::Dictionary pool = gin::Dictionary::CreateEmpty(isolate());
+  pool.Set("hits", metrics->pool_hits());
+  pool.Set("misses", metrics->pool_misses());
+  dict.Set("bufferPool", pool);
+
+  return dict.GetHandle();
+}
 #endif
 
 void WebContents::Invalidate() {
@@ -2326,6 +2821,31 @@ void WebContents::DoGetZoomLevel(DoGetZoomLevelCallback callback) {
   std::move(callback).Run(GetZoomLevel());
 }
 
+void WebContents::GetAsarHeader(const base::FilePath& archive_path,
+                                GetAsarHeaderCallback callback) {
+  std::move(callback).Run(asar::GetOrCreateSharedHeaderRegion(archive_path));
+}
+
+void WebContents::HeapNearLimit(uint64_t used_heap_size,
+                                uint64_t heap_limit) {
+  v8::HandleScope handle_scope(isolate());
+  gin_helper::Dictionary details =
+      gin_helper::Dictionary::CreateEmpty(isolate());
+  details.Set("usedHeapSize", static_cast<double>(used_heap_size));
+  details.Set("heapSizeLimit", static_cast<double>(heap_limit));
+  Emit("heap-near-limit", details);
+}
+
+void WebContents::TakeSharedImage(const std::string& image_id,
+                                  TakeSharedImageCallback callback) {
+  gfx::Image image;
+  if (!NativeImage::TakeSharedTransfer(image_id, ID(), &image)) {
+    std::move(callback).Run(base::ReadOnlySharedMemoryRegion());
+    return;
+  }
+  std::move(callback).Run(WriteImageToSharedMemory(image));
+}
+
 std::vector<base::FilePath::StringType> WebContents::GetPreloadPaths() const {
   auto result = SessionPreferences::GetValidPreloads(GetBrowserContext());
 
@@ -2432,7 +2952,13 @@ void WebContents::GrantOriginAccess(const GURL& url) {
 }
 
 v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
-    const base::FilePath& file_path) {
+    const base::FilePath& file_path,
+    gin_helper::Arguments* args) {
+  bool compress = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("compress", &compress);
+
   util::Promise<void*> promise(isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
@@ -2459,7 +2985,7 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
       electron_renderer.get());
   auto* raw_ptr = electron_renderer.get();
   (*raw_ptr)->TakeHeapSnapshot(
-      mojo::WrapPlatformFile(file.TakePlatformFile()),
+      mojo::WrapPlatformFile(file.TakePlatformFile()), compress,
       base::BindOnce(
           [](mojo::AssociatedRemote<mojom::ElectronRenderer>* ep,
              util::Promise<void*> promise, bool success) {
@@ -2473,6 +2999,85 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
   return handle;
 }
 
+v8::Local<v8::Promise> WebContents::ExecuteJavaScriptInAllFrames(
+    const base::string16& code) {
+  util::Promise<base::Value> promise(isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto* frame_host = web_contents()->GetMainFrame();
+  if (!frame_host) {
+    promise.RejectWithErrorMessage("executeJavaScriptInAllFrames failed");
+    return handle;
+  }
+
+  // See TakeHeapSnapshot for why the interface is wrapped in base::Owned.
+  auto electron_renderer =
+      std::make_unique<mojo::AssociatedRemote<mojom::ElectronRenderer>>();
+  frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+      electron_renderer.get());
+  auto* raw_ptr = electron_renderer.get();
+  (*raw_ptr)->ExecuteJavaScriptInAllFrames(
+      code, base::BindOnce(
+                [](mojo::AssociatedRemote<mojom::ElectronRenderer>* ep,
+                   util::Promise<base::Value> promise,
+                   std::vector<base::Value> results) {
+                  promise.ResolveWithGin(base::Value(std::move(results)));
+                },
+                base::Owned(std::move(electron_renderer)), std::move(promise)));
+  return handle;
+}
+
+void WebContents::StartCpuProfiling(gin_helper::Arguments* args) {
+  int interval_us = 1000;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("samplingInterval", &interval_us);
+  if (interval_us < 1) {
+    args->ThrowError("samplingInterval must be a positive number");
+    return;
+  }
+
+  auto* frame_host = web_contents()->GetMainFrame();
+  if (!frame_host)
+    return;
+
+  // Fire-and-forget, like TriggerMemoryCleanup; the profiler keeps
+  // sampling until stopCpuProfiling() collects the profile.
+  mojo::AssociatedRemote<mojom::ElectronRenderer> electron_renderer;
+  frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+      &electron_renderer);
+  electron_renderer->StartCpuProfiling(static_cast<uint32_t>(interval_us));
+}
+
+v8::Local<v8::Promise> WebContents::StopCpuProfiling(v8::Isolate* isolate) {
+  util::Promise<base::Value> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto* frame_host = web_contents()->GetMainFrame();
+  if (!frame_host) {
+    promise.RejectWithErrorMessage("stopCpuProfiling failed");
+    return handle;
+  }
+
+  // See TakeHeapSnapshot for why the interface is wrapped in base::Owned.
+  auto electron_renderer =
+      std::make_unique<mojo::AssociatedRemote<mojom::ElectronRenderer>>();
+  frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+      electron_renderer.get());
+  auto* raw_ptr = electron_renderer.get();
+  (*raw_ptr)->StopCpuProfiling(base::BindOnce(
+      [](mojo::AssociatedRemote<mojom::ElectronRenderer>* ep,
+         util::Promise<base::Value> promise, base::Value profile) {
+        if (profile.is_none()) {
+          promise.RejectWithErrorMessage("CPU profiling is not in progress");
+        } else {
+          promise.ResolveWithGin(std::move(profile));
+        }
+      },
+      base::Owned(std::move(electron_renderer)), std::move(promise)));
+  return handle;
+}
+
 // static
 void WebContents::BuildPrototype(v8::Isolate* isolate,
                                  v8::Local<v8::FunctionTemplate> prototype) {
@@ -2481,6 +3086,8 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("setBackgroundThrottling",
                  &WebContents::SetBackgroundThrottling)
+      .SetMethod("setProcessPriority", &WebContents::SetProcessPriority)
+      .SetMethod("_setEventListened", &WebContents::SetEventListened)
       .SetMethod("getProcessId", &WebContents::GetProcessID)
       .SetMethod("getOSProcessId", &WebContents::GetOSProcessID)
       .SetMethod("_getOSProcessIdForFrame",
@@ -2488,6 +3095,7 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("equal", &WebContents::Equal)
       .SetMethod("_loadURL", &WebContents::LoadURL)
       .SetMethod("downloadURL", &WebContents::DownloadURL)
+      .SetMethod("preWarmRenderer", &WebContents::PreWarmRenderer)
       .SetMethod("_getURL", &WebContents::GetURL)
       .SetMethod("getTitle", &WebContents::GetTitle)
       .SetMethod("isLoading", &WebContents::IsLoading)
@@ -2536,6 +3144,13 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("_send", &WebContents::SendIPCMessage)
       .SetMethod("_sendToFrame", &WebContents::SendIPCMessageToFrame)
       .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
+      .SetMethod("sendInputEvents", &WebContents::SendInputEvents)
+      .SetMethod("setWindowOpenPolicyRules",
+                 &WebContents::SetWindowOpenPolicyRules)
+      .SetMethod("_evaluateWindowOpenPolicy",
+                 &WebContents::EvaluateWindowOpenPolicy)
+      .SetMethod("setNavigationPolicyRules",
+                 &WebContents::SetNavigationPolicyRules)
       .SetMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
       .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
       .SetMethod("startDrag", &WebContents::StartDrag)
@@ -2550,6 +3165,9 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("_getFrameRate", &WebContents::GetFrameRate)
       .SetProperty("frameRate", &WebContents::GetFrameRate,
                    &WebContents::SetFrameRate)
+      .SetMethod("setPaintDirtyOnly", &WebContents::SetPaintDirtyOnly)
+      .SetMethod("isPaintDirtyOnly", &WebContents::IsPaintDirtyOnly)
+      .SetMethod("getPaintMetrics", &WebContents::GetPaintMetrics)
 #endif
       .SetMethod("invalidate", &WebContents::Invalidate)
       .SetMethod("_setZoomLevel", &WebContents::SetZoomLevel)
@@ -2590,6 +3208,10 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
                  &WebContents::GetWebRTCIPHandlingPolicy)
       .SetMethod("_grantOriginAccess", &WebContents::GrantOriginAccess)
       .SetMethod("takeHeapSnapshot", &WebContents::TakeHeapSnapshot)
+      .SetMethod("startCpuProfiling", &WebContents::StartCpuProfiling)
+      .SetMethod("stopCpuProfiling", &WebContents::StopCpuProfiling)
+      .SetMethod("executeJavaScriptInAllFrames",
+                 &WebContents::ExecuteJavaScriptInAllFrames)
       .SetProperty("id", &WebContents::ID)
       .SetProperty("session", &WebContents::Session)
       .SetProperty("hostWebContents", &WebContents::HostWebContents)
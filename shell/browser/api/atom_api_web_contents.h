@@ -6,6 +6,7 @@
 #define SHELL_BROWSER_API_ATOM_API_WEB_CONTENTS_H_
 
 #include <map>
+#include <set>
 #include <memory>
 #include <string>
 #include <vector>
@@ -28,6 +29,8 @@
 #include "shell/browser/api/frame_subscriber.h"
 #include "shell/browser/api/save_page_handler.h"
 #include "shell/browser/common_web_contents_delegate.h"
+#include "shell/browser/navigation_policy_rules.h"
+#include "shell/browser/window_open_policy.h"
 #include "shell/common/gin_helper/trackable_object.h"
 #include "ui/gfx/image/image.h"
 
@@ -135,7 +138,14 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // See https://github.com/electron/electron/issues/15133.
   void DestroyWebContents(bool async);
 
-  void SetBackgroundThrottling(bool allowed);
+  void SetBackgroundThrottling(bool allowed, gin_helper::Arguments* args);
+  void SetProcessPriority(const std::string& level,
+                          gin_helper::Arguments* args);
+
+  // Called from JS when the first listener for |event| is added or the last
+  // one is removed, so that high-frequency observer events can skip argument
+  // conversion and emission entirely while nothing is subscribed.
+  void SetEventListened(const std::string& event, bool listened);
   int GetProcessID() const;
   base::ProcessId GetOSProcessID() const;
   base::ProcessId GetOSProcessIdForFrame(const std::string& name,
@@ -144,6 +154,7 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   bool Equal(const WebContents* web_contents) const;
   void LoadURL(const GURL& url, const gin_helper::Dictionary& options);
   void DownloadURL(const GURL& url);
+  void PreWarmRenderer();
   GURL GetURL() const;
   base::string16 GetTitle() const;
   bool IsLoading() const;
@@ -224,7 +235,7 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   bool SendIPCMessageWithSender(bool internal,
                                 bool send_to_all,
                                 const std::string& channel,
-                                blink::CloneableMessage args,
+                                mojo_base::BigBuffer args,
                                 int32_t sender_id = 0);
 
   bool SendIPCMessageToFrame(bool internal,
@@ -236,6 +247,27 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // Send WebInputEvent to the page.
   void SendInputEvent(v8::Isolate* isolate, v8::Local<v8::Value> input_event);
 
+  // Declarative navigation rules, consulted synchronously before the
+  // will-navigate/will-redirect events leave C++.
+  void SetNavigationPolicyRules(std::vector<NavigationPolicyRules::Rule> rules);
+  const NavigationPolicyRules& navigation_policy_rules() const {
+    return navigation_policy_rules_;
+  }
+
+  // Declarative popup rules, consulted before a window.open() creates a
+  // guest WebContents or emits the new-window events.
+  void SetWindowOpenPolicyRules(std::vector<WindowOpenPolicy::Rule> rules);
+  // Used by guest-window-manager to apply the same rules on the routed
+  // (non-native) window.open() path. Returns null when no rule matches.
+  v8::Local<v8::Value> EvaluateWindowOpenPolicy(v8::Isolate* isolate,
+                                                const GURL& url);
+
+  // Send a batch of WebInputEvents to the page in one call. All events are
+  // converted before any is forwarded, and runs of mouse-move events reuse
+  // the previous converted event, re-reading only the position fields.
+  void SendInputEvents(v8::Isolate* isolate,
+                       const std::vector<v8::Local<v8::Value>>& input_events);
+
   // Subscribe to the frame updates.
   void BeginFrameSubscription(gin_helper::Arguments* args);
   void EndFrameSubscription();
@@ -261,8 +293,13 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   void StartPainting();
   void StopPainting();
   bool IsPainting() const;
-  void SetFrameRate(int frame_rate);
+  // Accepts either a fixed rate (Integer) or {minimum, maximum} bounds for
+  // the adaptive governor.
+  void SetFrameRate(v8::Local<v8::Value> value);
   int GetFrameRate() const;
+  void SetPaintDirtyOnly(bool dirty_only);
+  bool IsPaintDirtyOnly() const;
+  v8::Local<v8::Value> GetPaintMetrics();
 #endif
   void Invalidate();
   gfx::Size GetSizeForNewRenderView(content::WebContents*) override;
@@ -303,7 +340,14 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // the specified URL.
   void GrantOriginAccess(const GURL& url);
 
-  v8::Local<v8::Promise> TakeHeapSnapshot(const base::FilePath& file_path);
+  v8::Local<v8::Promise> TakeHeapSnapshot(const base::FilePath& file_path,
+                                          gin_helper::Arguments* args);
+  v8::Local<v8::Promise> ExecuteJavaScriptInAllFrames(
+      const base::string16& code);
+
+  // Sampling CPU profiler in this contents' renderer process.
+  void StartCpuProfiling(gin_helper::Arguments* args);
+  v8::Local<v8::Promise> StopCpuProfiling(v8::Isolate* isolate);
 
   // Properties.
   int32_t ID() const;
@@ -447,6 +491,7 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   void WebContentsDestroyed() override;
   void NavigationEntryCommitted(
       const content::LoadCommittedDetails& load_details) override;
+  void OnVisibilityChanged(content::Visibility visibility) override;
   void TitleWasSet(content::NavigationEntry* entry) override;
   void DidUpdateFaviconURL(
       const std::vector<content::FaviconURL>& urls) override;
@@ -492,23 +537,29 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // mojom::ElectronBrowser
   void Message(bool internal,
                const std::string& channel,
-               blink::CloneableMessage arguments) override;
+               mojo_base::BigBuffer arguments) override;
+  void MessageBatch(std::vector<mojom::IpcMessagePtr> messages) override;
   void Invoke(bool internal,
               const std::string& channel,
-              blink::CloneableMessage arguments,
+              mojo_base::BigBuffer arguments,
               InvokeCallback callback) override;
   void MessageSync(bool internal,
                    const std::string& channel,
-                   blink::CloneableMessage arguments,
+                   mojo_base::BigBuffer arguments,
                    MessageSyncCallback callback) override;
   void MessageTo(bool internal,
                  bool send_to_all,
                  int32_t web_contents_id,
                  const std::string& channel,
-                 blink::CloneableMessage arguments) override;
+                 mojo_base::BigBuffer arguments) override;
   void MessageHost(const std::string& channel,
-                   blink::CloneableMessage arguments) override;
+                   mojo_base::BigBuffer arguments) override;
+  void CreateDirectChannel(int32_t web_contents_id,
+                           mojom::ElectronPeerRequest peer,
+                           CreateDirectChannelCallback callback) override;
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
+  void DereferenceRemoteJSObjects(
+      std::vector<mojom::RemoteObjectReleasePtr> releases) override;
   void DereferenceRemoteJSObject(const std::string& context_id,
                                  int object_id,
                                  int ref_count) override;
@@ -517,6 +568,11 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
       std::vector<mojom::DraggableRegionPtr> regions) override;
   void SetTemporaryZoomLevel(double level) override;
   void DoGetZoomLevel(DoGetZoomLevelCallback callback) override;
+  void GetAsarHeader(const base::FilePath& archive_path,
+                     GetAsarHeaderCallback callback) override;
+  void HeapNearLimit(uint64_t used_heap_size, uint64_t heap_limit) override;
+  void TakeSharedImage(const std::string& image_id,
+                       TakeSharedImageCallback callback) override;
 
   // Called when we receive a CursorChange message from chromium.
   void OnCursorChange(const content::WebCursor& cursor);
@@ -549,9 +605,34 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // Request id used for findInPage request.
   uint32_t request_id_ = 0;
 
+  // How deeply this WebContents is throttled while hidden. kThrottle is
+  // Chromium's default backgrounding (requestAnimationFrame stops, timers
+  // fire at most once per second); kSuspend additionally freezes the page so
+  // timers stop running entirely.
+  enum class BackgroundPolicy { kNone, kThrottle, kSuspend };
+
+  static BackgroundPolicy ParseBackgroundPolicy(const std::string& policy);
+
+  // Freezes or unfreezes the page according to |background_policy_| and the
+  // given visibility.
+  void ApplyBackgroundPolicy(content::Visibility visibility);
+
+  // Whether any JS listener is subscribed to |event|. Only consulted for
+  // high-frequency events whose emission is gated; everything else is
+  // emitted unconditionally.
+  bool IsListening(const std::string& event) const;
+
   // Whether background throttling is disabled.
   bool background_throttling_ = true;
 
+  BackgroundPolicy background_policy_ = BackgroundPolicy::kThrottle;
+
+  // Whether the page is currently frozen by the kSuspend policy.
+  bool page_frozen_ = false;
+
+  // Events reported by SetEventListened() as currently having JS listeners.
+  std::set<std::string> listened_events_;
+
   // Whether to enable devtools.
   bool enable_devtools_ = true;
 
@@ -562,6 +643,9 @@ class WebContents : public gin_helper::TrackableObject<WebContents>,
   // -1 means no speculative RVH has been committed yet.
   int currently_committed_process_id_ = -1;
 
+  // Declarative allow/deny rules for navigations.
+  NavigationPolicyRules navigation_policy_rules_;
+
   service_manager::BinderRegistryWithArgs<content::RenderFrameHost*> registry_;
   mojo::BindingSet<mojom::ElectronBrowser, content::RenderFrameHost*> bindings_;
   std::map<content::RenderFrameHost*, std::vector<mojo::BindingId>>
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/stl_util.h"
 #include "base/values.h"
@@ -21,6 +22,7 @@
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_converters/std_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/node_includes.h"
 
 namespace gin {
 
@@ -247,6 +249,8 @@ gin::ObjectTemplateBuilder WebRequest::GetObjectTemplateBuilder(
                  &WebRequest::SetResponseListener<kOnBeforeSendHeaders>)
       .SetMethod("onHeadersReceived",
                  &WebRequest::SetResponseListener<kOnHeadersReceived>)
+      .SetMethod("onResponseData",
+                 &WebRequest::SetResponseListener<kOnResponseData>)
       .SetMethod("onSendHeaders",
                  &WebRequest::SetSimpleListener<kOnSendHeaders>)
       .SetMethod("onBeforeRedirect",
@@ -266,6 +270,16 @@ bool WebRequest::HasListener() const {
   return !(simple_listeners_.empty() && response_listeners_.empty());
 }
 
+bool WebRequest::HasListenerForURL(const GURL& url) const {
+  return url_matcher_.MightMatch(url);
+}
+
+bool WebRequest::HasCancellingListener() const {
+  return response_listeners_.count(kOnBeforeRequest) > 0 ||
+         response_listeners_.count(kOnBeforeSendHeaders) > 0 ||
+         response_listeners_.count(kOnHeadersReceived) > 0;
+}
+
 int WebRequest::OnBeforeRequest(extensions::WebRequestInfo* info,
                                 const network::ResourceRequest& request,
                                 net::CompletionOnceCallback callback,
@@ -332,6 +346,58 @@ void WebRequest::OnCompleted(extensions::WebRequestInfo* info,
   HandleSimpleEvent(kOnCompleted, info, request, net_error);
 }
 
+bool WebRequest::HasResponseDataListener(extensions::WebRequestInfo* info) {
+  const auto iter = response_listeners_.find(kOnResponseData);
+  if (iter == std::end(response_listeners_))
+    return false;
+  return MatchesFilterCondition(info, iter->second.url_patterns);
+}
+
+void WebRequest::OnResponseData(extensions::WebRequestInfo* info,
+                                const network::ResourceRequest& request,
+                                std::vector<char> data,
+                                bool end_of_stream,
+                                ResponseDataCallback callback) {
+  const auto iter = response_listeners_.find(kOnResponseData);
+  if (iter == std::end(response_listeners_) ||
+      !MatchesFilterCondition(info, iter->second.url_patterns)) {
+    // The listener went away while the response was streaming; pass the
+    // bytes through untouched.
+    std::move(callback).Run(std::move(data));
+    return;
+  }
+
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  gin::Dictionary details(isolate, v8::Object::New(isolate));
+  FillDetails(&details, info, request);
+  details.Set(
+      "data",
+      node::Buffer::Copy(isolate, data.data(), data.size()).ToLocalChecked());
+  details.Set("endOfStream", end_of_stream);
+
+  ResponseCallback response =
+      base::BindOnce(&WebRequest::OnDataListenerResult, base::Unretained(this),
+                     std::move(callback), std::move(data));
+  iter->second.listener.Run(gin::ConvertToV8(isolate, details),
+                            std::move(response));
+}
+
+void WebRequest::OnDataListenerResult(ResponseDataCallback callback,
+                                      std::vector<char> original,
+                                      v8::Local<v8::Value> response) {
+  std::vector<char> data = std::move(original);
+  if (node::Buffer::HasInstance(response)) {
+    const char* buf = node::Buffer::Data(response);
+    data.assign(buf, buf + node::Buffer::Length(response));
+  }
+
+  // The ProxyingURLLoaderFactory expects the callback to be executed
+  // asynchronously, matching the other listener callbacks.
+  base::SequencedTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(std::move(callback), std::move(data)));
+}
+
 template <WebRequest::SimpleEvent event>
 void WebRequest::SetSimpleListener(gin::Arguments* args) {
   SetListener<SimpleListener>(event, &simple_listeners_, args);
@@ -390,6 +456,16 @@ void WebRequest::SetListener(Event event,
     listeners->erase(event);
   else
     (*listeners)[event] = {std::move(patterns), std::move(listener)};
+
+  RebuildURLMatcher();
+}
+
+void WebRequest::RebuildURLMatcher() {
+  url_matcher_.Clear();
+  for (const auto& it : simple_listeners_)
+    url_matcher_.AddPatterns(it.second.url_patterns);
+  for (const auto& it : response_listeners_)
+    url_matcher_.AddPatterns(it.second.url_patterns);
 }
 
 template <typename... Args>
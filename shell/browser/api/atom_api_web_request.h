@@ -7,6 +7,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "base/values.h"
 #include "extensions/common/url_pattern.h"
@@ -14,6 +15,7 @@
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "shell/browser/net/proxying_url_loader_factory.h"
+#include "shell/browser/net/web_request_url_matcher.h"
 
 namespace content {
 class BrowserContext;
@@ -55,6 +57,8 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
 
   // WebRequestAPI:
   bool HasListener() const override;
+  bool HasListenerForURL(const GURL& url) const override;
+  bool HasCancellingListener() const override;
   int OnBeforeRequest(extensions::WebRequestInfo* info,
                       const network::ResourceRequest& request,
                       net::CompletionOnceCallback callback,
@@ -84,6 +88,12 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
   void OnCompleted(extensions::WebRequestInfo* info,
                    const network::ResourceRequest& request,
                    int net_error) override;
+  bool HasResponseDataListener(extensions::WebRequestInfo* info) override;
+  void OnResponseData(extensions::WebRequestInfo* info,
+                      const network::ResourceRequest& request,
+                      std::vector<char> data,
+                      bool end_of_stream,
+                      ResponseDataCallback callback) override;
 
   enum SimpleEvent {
     kOnSendHeaders,
@@ -96,6 +106,7 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
     kOnBeforeRequest,
     kOnBeforeSendHeaders,
     kOnHeadersReceived,
+    kOnResponseData,
   };
 
   using SimpleListener = base::RepeatingCallback<void(v8::Local<v8::Value>)>;
@@ -110,6 +121,10 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
   template <typename Listener, typename Listeners, typename Event>
   void SetListener(Event event, Listeners* listeners, gin::Arguments* args);
 
+  // Recompiles |url_matcher_| from every listener's pattern set; must be
+  // called whenever a listener is added or removed.
+  void RebuildURLMatcher();
+
   template <typename... Args>
   void HandleSimpleEvent(SimpleEvent event,
                          extensions::WebRequestInfo* info,
@@ -124,6 +139,12 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
   template <typename T>
   void OnListenerResult(uint64_t id, T out, v8::Local<v8::Value> response);
 
+  // Result of an onResponseData listener: a Buffer replaces the chunk,
+  // anything else passes the original bytes through.
+  void OnDataListenerResult(ResponseDataCallback callback,
+                            std::vector<char> original,
+                            v8::Local<v8::Value> response);
+
   struct SimpleListenerInfo {
     std::set<URLPattern> url_patterns;
     SimpleListener listener;
@@ -146,6 +167,9 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
   std::map<ResponseEvent, ResponseListenerInfo> response_listeners_;
   std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
 
+  // Fast-reject index over all listeners' URL patterns.
+  WebRequestURLMatcher url_matcher_;
+
   // Weak-ref, it manages us.
   content::BrowserContext* browser_context_;
 };
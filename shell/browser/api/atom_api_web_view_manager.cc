@@ -41,6 +41,12 @@ void RemoveGuest(content::WebContents* embedder, int guest_instance_id) {
     manager->RemoveGuest(guest_instance_id);
 }
 
+void RemoveEmbedderGuests(content::WebContents* embedder) {
+  auto* manager = electron::WebViewManager::GetWebViewManager(embedder);
+  if (manager)
+    manager->RemoveEmbedderGuests(embedder);
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -48,6 +54,7 @@ void Initialize(v8::Local<v8::Object> exports,
   gin_helper::Dictionary dict(context->GetIsolate(), exports);
   dict.SetMethod("addGuest", &AddGuest);
   dict.SetMethod("removeGuest", &RemoveGuest);
+  dict.SetMethod("removeEmbedderGuests", &RemoveEmbedderGuests);
 }
 
 }  // namespace
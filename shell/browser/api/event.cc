@@ -33,7 +33,7 @@ bool Event::SendReply(v8::Isolate* isolate, v8::Local<v8::Value> result) {
   if (!callback_)
     return false;
 
-  blink::CloneableMessage message;
+  mojo_base::BigBuffer message;
   if (!gin::ConvertFromV8(isolate, result, &message)) {
     return false;
   }
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/frame_subscriber.h"
 
+#include <memory>
 #include <utility>
 
 #include "content/public/browser/render_view_host.h"
@@ -11,9 +12,15 @@
 #include "content/public/browser/render_widget_host_view.h"
 #include "media/capture/mojom/video_capture_types.mojom.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/locker.h"
 #include "ui/gfx/geometry/size_conversions.h"
-#include "ui/gfx/image/image.h"
-#include "ui/gfx/skbitmap_operations.h"
+
+#if BUILDFLAG(ENABLE_OSR)
+#include "shell/browser/osr/osr_paint_metrics.h"
+#include "shell/browser/osr/osr_render_widget_host_view.h"
+#endif
 
 namespace electron {
 
@@ -21,12 +28,37 @@ namespace api {
 
 constexpr static int kMaxFrameRate = 30;
 
-FrameSubscriber::FrameSubscriber(content::WebContents* web_contents,
+namespace {
+
+// Unpins a delivered frame: detaches the ArrayBuffer so JS can no longer
+// touch the memory, then drops the SkBitmap whose pixel ref keeps the shared
+// memory mapped and the capturer's buffer out of its pool. Bound as a
+// one-shot function, so it also runs when the release function is collected
+// without ever being called.
+void ReleaseFrame(std::unique_ptr<SkBitmap> pinned,
+                  v8::Global<v8::ArrayBuffer> array_buffer) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  if (isolate && !array_buffer.IsEmpty()) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::ArrayBuffer> buffer = array_buffer.Get(isolate);
+    if (buffer->IsDetachable())
+      buffer->Detach();
+  }
+  array_buffer.Reset();
+}
+
+}  // namespace
+
+FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
+                                 content::WebContents* web_contents,
                                  const FrameCaptureCallback& callback,
-                                 bool only_dirty)
+                                 bool only_dirty,
+                                 bool offscreen)
     : content::WebContentsObserver(web_contents),
+      isolate_(isolate),
       callback_(callback),
       only_dirty_(only_dirty),
+      offscreen_(offscreen),
       weak_ptr_factory_(this) {
   content::RenderViewHost* rvh = web_contents->GetRenderViewHost();
   if (rvh)
@@ -43,6 +75,19 @@ void FrameSubscriber::AttachToHost(content::RenderWidgetHost* host) {
   if (!host_->GetView())
     return;
 
+#if BUILDFLAG(ENABLE_OSR)
+  // Offscreen views already run a capture pipeline for painting; join its
+  // fan-out instead of starting a second capturer. Frames arrive as bitmaps
+  // sharing the captured pixels, so this adds no copies.
+  if (offscreen_) {
+    auto* view =
+        static_cast<OffScreenRenderWidgetHostView*>(host_->GetView());
+    capture_subscription_ = view->AddCaptureCallback(base::BindRepeating(
+        &FrameSubscriber::Done, weak_ptr_factory_.GetWeakPtr()));
+    return;
+  }
+#endif
+
   // Create and configure the video capturer.
   gfx::Size size = GetRenderViewSize();
   video_capturer_ = host_->GetView()->CreateVideoCapturer();
@@ -59,6 +104,9 @@ void FrameSubscriber::AttachToHost(content::RenderWidgetHost* host) {
 void FrameSubscriber::DetachFromHost() {
   if (!host_)
     return;
+#if BUILDFLAG(ENABLE_OSR)
+  capture_subscription_.reset();
+#endif
   video_capturer_.reset();
   host_ = nullptr;
 }
@@ -149,23 +197,49 @@ void FrameSubscriber::Done(const gfx::Rect& damage, const SkBitmap& frame) {
   if (frame.drawsNothing())
     return;
 
-  const SkBitmap& bitmap = only_dirty_ ? SkBitmapOperations::CreateTiledBitmap(
-                                             frame, damage.x(), damage.y(),
-                                             damage.width(), damage.height())
-                                       : frame;
-
-  // Copying SkBitmap does not copy the internal pixels, we have to manually
-  // allocate and write pixels otherwise crash may happen when the original
-  // frame is modified.
-  SkBitmap copy;
-  copy.allocPixels(SkImageInfo::Make(bitmap.width(), bitmap.height(),
-                                     kRGBA_8888_SkColorType,
-                                     kPremul_SkAlphaType));
-  SkPixmap pixmap;
-  bool success = bitmap.peekPixels(&pixmap) && copy.writePixels(pixmap, 0, 0);
-  CHECK(success);
-
-  callback_.Run(gfx::Image::CreateFrom1xBitmap(copy), damage);
+  gin_helper::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+
+  // Expose the mapped frame memory to JS directly instead of copying it into
+  // a NativeImage. The ArrayBuffer is external: a copy of |frame| pins the
+  // shared memory mapping (and the capturer's buffer) until release() runs,
+  // after which the capturer recycles the buffer into its pool.
+  auto pinned = std::make_unique<SkBitmap>(frame);
+  v8::Local<v8::ArrayBuffer> array_buffer = v8::ArrayBuffer::New(
+      isolate_, frame.getPixels(), frame.computeByteSize());
+
+  // In dirty-only mode deliver a view onto the damaged rows; the stride still
+  // spans the full frame, so no pixels are copied either way.
+  gfx::Rect rect = gfx::Rect(frame.width(), frame.height());
+  if (only_dirty_ && !damage.IsEmpty()) {
+    rect = damage;
+    rect.Intersect(gfx::Rect(frame.width(), frame.height()));
+  }
+  const size_t bpp = frame.info().bytesPerPixel();
+  const size_t offset = rect.y() * frame.rowBytes() + rect.x() * bpp;
+  const size_t length =
+      rect.IsEmpty() ? 0
+                     : (rect.height() - 1) * frame.rowBytes() +
+                           rect.width() * bpp;
+  v8::Local<v8::Uint8Array> pixels =
+      v8::Uint8Array::New(array_buffer, offset, length);
+
+  gin_helper::Dictionary frame_dict =
+      gin::Dictionary::CreateEmpty(isolate_);
+  frame_dict.Set("buffer", pixels);
+  frame_dict.Set("width", rect.width());
+  frame_dict.Set("height", rect.height());
+  frame_dict.Set("bytesPerRow", static_cast<uint32_t>(frame.rowBytes()));
+  frame_dict.Set("release",
+                 base::BindOnce(&ReleaseFrame, std::move(pinned),
+                                v8::Global<v8::ArrayBuffer>(isolate_,
+                                                            array_buffer)));
+
+#if BUILDFLAG(ENABLE_OSR)
+  OffScreenPaintMetrics::Get()->RecordSubscriberFrame();
+#endif
+
+  callback_.Run(gin::ConvertToV8(isolate_, frame_dict), damage);
 }
 
 gfx::Size FrameSubscriber::GetRenderViewSize() const {
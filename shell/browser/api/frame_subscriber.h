@@ -8,17 +8,15 @@
 #include <memory>
 
 #include "base/callback.h"
+#include "base/callback_list.h"
 #include "base/memory/weak_ptr.h"
 #include "components/viz/host/client_frame_sink_video_capturer.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_observer.h"
+#include "electron/buildflags/buildflags.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "v8/include/v8.h"
 
-namespace gfx {
-class Image;
-}
-
 namespace electron {
 
 namespace api {
@@ -28,12 +26,18 @@ class WebContents;
 class FrameSubscriber : public content::WebContentsObserver,
                         public viz::mojom::FrameSinkVideoConsumer {
  public:
+  // Receives a frame object wrapping the captured pixels and the dirty rect.
   using FrameCaptureCallback =
-      base::RepeatingCallback<void(const gfx::Image&, const gfx::Rect&)>;
+      base::RepeatingCallback<void(v8::Local<v8::Value>, const gfx::Rect&)>;
 
-  FrameSubscriber(content::WebContents* web_contents,
+  // For offscreen WebContents the subscriber joins the view's capture hub
+  // instead of starting a second capture pipeline, so recording and painting
+  // the same contents costs one capture.
+  FrameSubscriber(v8::Isolate* isolate,
+                  content::WebContents* web_contents,
                   const FrameCaptureCallback& callback,
-                  bool only_dirty);
+                  bool only_dirty,
+                  bool offscreen);
   ~FrameSubscriber() override;
 
  private:
@@ -59,12 +63,20 @@ class FrameSubscriber : public content::WebContentsObserver,
   // Get the pixel size of render view.
   gfx::Size GetRenderViewSize() const;
 
+  v8::Isolate* isolate_;
   FrameCaptureCallback callback_;
   bool only_dirty_;
+  bool offscreen_;
 
   content::RenderWidgetHost* host_;
   std::unique_ptr<viz::ClientFrameSinkVideoCapturer> video_capturer_;
 
+#if BUILDFLAG(ENABLE_OSR)
+  std::unique_ptr<
+      base::CallbackList<void(const gfx::Rect&, const SkBitmap&)>::Subscription>
+      capture_subscription_;
+#endif
+
   base::WeakPtrFactory<FrameSubscriber> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(FrameSubscriber);
@@ -12,6 +12,7 @@
 #include "gpu/config/gpu_info_collector.h"
 #include "shell/browser/api/gpu_info_enumerator.h"
 #include "shell/common/gin_converters/value_converter.h"
+#include "ui/display/screen.h"
 
 namespace electron {
 
@@ -22,10 +23,14 @@ GPUInfoManager* GPUInfoManager::GetInstance() {
 GPUInfoManager::GPUInfoManager()
     : gpu_data_manager_(content::GpuDataManagerImpl::GetInstance()) {
   gpu_data_manager_->AddObserver(this);
+  if (display::Screen::GetScreen())
+    display::Screen::GetScreen()->AddObserver(this);
 }
 
 GPUInfoManager::~GPUInfoManager() {
   content::GpuDataManagerImpl::GetInstance()->RemoveObserver(this);
+  if (display::Screen::GetScreen())
+    display::Screen::GetScreen()->RemoveObserver(this);
 }
 
 // Based on
@@ -43,16 +48,20 @@ bool GPUInfoManager::NeedsCompleteGpuInfoCollection() const {
 
 // Should be posted to the task runner
 void GPUInfoManager::ProcessCompleteInfo() {
-  const auto result = EnumerateGPUInfo(gpu_data_manager_->GetGPUInfo());
+  if (!complete_info_cache_)
+    complete_info_cache_ = EnumerateGPUInfo(gpu_data_manager_->GetGPUInfo());
   // We have received the complete information, resolve all promises that
   // were waiting for this info.
   for (auto& promise : complete_info_promise_set_) {
-    promise.ResolveWithGin(*result);
+    promise.ResolveWithGin(*complete_info_cache_);
   }
   complete_info_promise_set_.clear();
 }
 
 void GPUInfoManager::OnGpuInfoUpdate() {
+  // New info from the GPU process (including after a restart) makes the
+  // enumerated dictionaries stale.
+  InvalidateCache();
   // Ignore if called when not asked for complete GPUInfo
   if (NeedsCompleteGpuInfoCollection())
     return;
@@ -61,6 +70,24 @@ void GPUInfoManager::OnGpuInfoUpdate() {
                                 base::Unretained(this)));
 }
 
+void GPUInfoManager::OnDisplayAdded(const display::Display& new_display) {
+  InvalidateCache();
+}
+
+void GPUInfoManager::OnDisplayRemoved(const display::Display& old_display) {
+  InvalidateCache();
+}
+
+void GPUInfoManager::OnDisplayMetricsChanged(const display::Display& display,
+                                             uint32_t changed_metrics) {
+  InvalidateCache();
+}
+
+void GPUInfoManager::InvalidateCache() {
+  basic_info_cache_.reset();
+  complete_info_cache_.reset();
+}
+
 // Should be posted to the task runner
 void GPUInfoManager::CompleteInfoFetcher(
     util::Promise<base::DictionaryValue> promise) {
@@ -76,6 +103,13 @@ void GPUInfoManager::CompleteInfoFetcher(
 
 void GPUInfoManager::FetchCompleteInfo(
     util::Promise<base::DictionaryValue> promise) {
+  // Serve repeat callers from the cache; concurrent callers that arrive
+  // before the first collection finishes all land in
+  // |complete_info_promise_set_| and share the single in-flight request.
+  if (complete_info_cache_) {
+    promise.ResolveWithGin(*complete_info_cache_);
+    return;
+  }
   base::ThreadTaskRunnerHandle::Get()->PostTask(
       FROM_HERE, base::BindOnce(&GPUInfoManager::CompleteInfoFetcher,
                                 base::Unretained(this), std::move(promise)));
@@ -85,9 +119,12 @@ void GPUInfoManager::FetchCompleteInfo(
 // There cannot be multiple promises as they are resolved synchronously.
 void GPUInfoManager::FetchBasicInfo(
     util::Promise<base::DictionaryValue> promise) {
-  gpu::GPUInfo gpu_info;
-  CollectBasicGraphicsInfo(&gpu_info);
-  promise.ResolveWithGin(*EnumerateGPUInfo(gpu_info));
+  if (!basic_info_cache_) {
+    gpu::GPUInfo gpu_info;
+    CollectBasicGraphicsInfo(&gpu_info);
+    basic_info_cache_ = EnumerateGPUInfo(gpu_info);
+  }
+  promise.ResolveWithGin(*basic_info_cache_);
 }
 
 std::unique_ptr<base::DictionaryValue> GPUInfoManager::EnumerateGPUInfo(
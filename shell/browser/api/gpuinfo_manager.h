@@ -13,11 +13,13 @@
 #include "content/public/browser/gpu_data_manager.h"
 #include "content/public/browser/gpu_data_manager_observer.h"
 #include "shell/common/promise_util.h"
+#include "ui/display/display_observer.h"
 
 namespace electron {
 
 // GPUInfoManager is a singleton used to manage and fetch GPUInfo
-class GPUInfoManager : public content::GpuDataManagerObserver {
+class GPUInfoManager : public content::GpuDataManagerObserver,
+                       public display::DisplayObserver {
  public:
   static GPUInfoManager* GetInstance();
 
@@ -28,10 +30,20 @@ class GPUInfoManager : public content::GpuDataManagerObserver {
   void FetchBasicInfo(util::Promise<base::DictionaryValue> promise);
   void OnGpuInfoUpdate() override;
 
+  // display::DisplayObserver:
+  void OnDisplayAdded(const display::Display& new_display) override;
+  void OnDisplayRemoved(const display::Display& old_display) override;
+  void OnDisplayMetricsChanged(const display::Display& display,
+                               uint32_t changed_metrics) override;
+
  private:
   std::unique_ptr<base::DictionaryValue> EnumerateGPUInfo(
       gpu::GPUInfo gpu_info) const;
 
+  // Drops the cached dictionaries; called when the GPU data manager reports
+  // new info (including after a GPU process restart) or displays change.
+  void InvalidateCache();
+
   // These should be posted to the task queue
   void CompleteInfoFetcher(util::Promise<base::DictionaryValue> promise);
   void ProcessCompleteInfo();
@@ -39,6 +51,12 @@ class GPUInfoManager : public content::GpuDataManagerObserver {
   // This set maintains all the promises that should be fulfilled
   // once we have the complete information data
   std::vector<util::Promise<base::DictionaryValue>> complete_info_promise_set_;
+
+  // Enumerated dictionaries served to repeat callers until invalidated, so
+  // dashboards can poll getGPUInfo() without re-running collection.
+  std::unique_ptr<base::DictionaryValue> basic_info_cache_;
+  std::unique_ptr<base::DictionaryValue> complete_info_cache_;
+
   content::GpuDataManager* gpu_data_manager_;
 
   DISALLOW_COPY_AND_ASSIGN(GPUInfoManager);
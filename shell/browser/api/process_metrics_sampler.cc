@@ -0,0 +1,168 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/process_metrics_sampler.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/containers/circular_deque.h"
+#include "base/memory/weak_ptr.h"
+#include "base/process/process_metrics.h"
+#include "base/system/sys_info.h"
+#include "base/task/post_task.h"
+#include "base/task_runner_util.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "content/public/common/process_type.h"
+#include "shell/browser/api/process_metric.h"
+
+namespace electron {
+
+// All members live on the sampler's task runner.
+class ProcessMetricsSampler::Core {
+ public:
+  Core(base::TimeDelta interval, size_t max_samples)
+      : interval_(interval), max_samples_(max_samples), weak_factory_(this) {}
+  ~Core() = default;
+
+  void Start() { ScheduleNextSample(); }
+
+  void Stop() {
+    // Cancels the pending Sample() task.
+    weak_factory_.InvalidateWeakPtrs();
+  }
+
+  void AddProcess(std::unique_ptr<ProcessMetric> metric) {
+    base::ProcessId pid = metric->process.Pid();
+    // Prime the CPU counter so the first sample reports usage over one
+    // interval instead of since process creation.
+    metric->metrics->GetPlatformIndependentCPUUsage();
+    processes_[pid] = std::move(metric);
+  }
+
+  void RemoveProcess(base::ProcessId pid) { processes_.erase(pid); }
+
+  base::Value SnapshotHistory() {
+    std::vector<base::Value> list;
+    list.reserve(samples_.size());
+    for (const auto& sample : samples_)
+      list.push_back(sample.Clone());
+    return base::Value(std::move(list));
+  }
+
+ private:
+  void ScheduleNextSample() {
+    base::SequencedTaskRunnerHandle::Get()->PostDelayedTask(
+        FROM_HERE, base::BindOnce(&Core::Sample, weak_factory_.GetWeakPtr()),
+        interval_);
+  }
+
+  void Sample() {
+    int processor_count = base::SysInfo::NumberOfProcessors();
+
+    std::vector<base::Value> metrics;
+    metrics.reserve(processes_.size());
+    for (const auto& entry : processes_) {
+      const ProcessMetric* metric = entry.second.get();
+      base::Value dict(base::Value::Type::DICTIONARY);
+      dict.SetIntKey("pid", static_cast<int>(entry.first));
+      dict.SetStringKey("type",
+                        content::GetProcessTypeNameInEnglish(metric->type));
+      dict.SetDoubleKey(
+          "percentCPUUsage",
+          metric->metrics->GetPlatformIndependentCPUUsage() / processor_count);
+#if !defined(OS_WIN)
+      dict.SetIntKey("idleWakeupsPerSecond",
+                     metric->metrics->GetIdleWakeupsPerSecond());
+#else
+      // Not implemented on Windows, see App::GetAppMetrics.
+      dict.SetIntKey("idleWakeupsPerSecond", 0);
+#endif
+#if !defined(OS_LINUX)
+      auto memory_info = metric->GetMemoryInfo();
+      dict.SetDoubleKey("workingSetSize",
+                        static_cast<double>(memory_info.working_set_size >> 10));
+#endif
+      metrics.push_back(std::move(dict));
+    }
+
+    base::Value sample(base::Value::Type::DICTIONARY);
+    sample.SetDoubleKey("timestamp", base::Time::Now().ToJsTime());
+    sample.SetKey("metrics", base::Value(std::move(metrics)));
+    samples_.push_back(std::move(sample));
+    while (samples_.size() > max_samples_)
+      samples_.pop_front();
+
+    ScheduleNextSample();
+  }
+
+  const base::TimeDelta interval_;
+  const size_t max_samples_;
+  std::unordered_map<base::ProcessId, std::unique_ptr<ProcessMetric>>
+      processes_;
+  base::circular_deque<base::Value> samples_;
+  base::WeakPtrFactory<Core> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(Core);
+};
+
+ProcessMetricsSampler::ProcessMetricsSampler()
+    : task_runner_(base::CreateSequencedTaskRunner(
+          {base::ThreadPool(), base::MayBlock(),
+           base::TaskPriority::BEST_EFFORT})) {}
+
+ProcessMetricsSampler::~ProcessMetricsSampler() {
+  if (core_)
+    task_runner_->DeleteSoon(FROM_HERE, core_);
+}
+
+void ProcessMetricsSampler::Start(base::TimeDelta interval,
+                                  size_t max_samples) {
+  if (core_)
+    task_runner_->DeleteSoon(FROM_HERE, core_);
+  core_ = new Core(interval, max_samples);
+  running_ = true;
+  task_runner_->PostTask(FROM_HERE,
+                         base::BindOnce(&Core::Start, base::Unretained(core_)));
+}
+
+void ProcessMetricsSampler::Stop() {
+  if (!running_)
+    return;
+  running_ = false;
+  task_runner_->PostTask(FROM_HERE,
+                         base::BindOnce(&Core::Stop, base::Unretained(core_)));
+}
+
+void ProcessMetricsSampler::AddProcess(std::unique_ptr<ProcessMetric> metric) {
+  if (!core_)
+    return;
+  task_runner_->PostTask(
+      FROM_HERE, base::BindOnce(&Core::AddProcess, base::Unretained(core_),
+                                std::move(metric)));
+}
+
+void ProcessMetricsSampler::RemoveProcess(base::ProcessId pid) {
+  if (!core_)
+    return;
+  task_runner_->PostTask(FROM_HERE, base::BindOnce(&Core::RemoveProcess,
+                                                   base::Unretained(core_),
+                                                   pid));
+}
+
+void ProcessMetricsSampler::GetHistory(
+    base::OnceCallback<void(base::Value)> callback) {
+  if (!core_) {
+    std::move(callback).Run(base::Value(base::Value::Type::LIST));
+    return;
+  }
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&Core::SnapshotHistory, base::Unretained(core_)),
+      std::move(callback));
+}
+
+}  // namespace electron
@@ -0,0 +1,68 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+#define SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+
+#include <memory>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/process/process_handle.h"
+#include "base/sequenced_task_runner.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace electron {
+
+struct ProcessMetric;
+
+// Samples CPU and memory of every tracked process on a blocking background
+// sequence at a fixed cadence and keeps the most recent samples in a ring.
+// Telemetry that polls app.getAppMetrics() pays for a synchronous OS
+// snapshot of every process on the UI thread per call; reading this ring
+// instead costs one cross-sequence hop and no OS calls.
+//
+// The sampler owns its own base::ProcessMetrics instances: CPU usage is
+// reported as the delta since the previous query, so sharing instances with
+// getAppMetrics() would corrupt the deltas of both readers.
+class ProcessMetricsSampler {
+ public:
+  ProcessMetricsSampler();
+  ~ProcessMetricsSampler();
+
+  bool IsRunning() const { return running_; }
+
+  // Starts (or restarts) sampling, discarding any earlier history.
+  void Start(base::TimeDelta interval, size_t max_samples);
+
+  // Stops sampling; the collected history stays readable until the next
+  // Start().
+  void Stop();
+
+  // Tracks |metric| in future samples. The metric's CPU counter is primed on
+  // the sampling sequence so the first sample covers one interval.
+  void AddProcess(std::unique_ptr<ProcessMetric> metric);
+  void RemoveProcess(base::ProcessId pid);
+
+  // Replies on the calling sequence with a list of samples, oldest first.
+  void GetHistory(base::OnceCallback<void(base::Value)> callback);
+
+ private:
+  class Core;
+
+  bool running_ = false;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  // Owned; lives and dies on |task_runner_|, so tasks bound with
+  // base::Unretained(core_) are sequenced before its deletion.
+  Core* core_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(ProcessMetricsSampler);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
@@ -10,6 +10,7 @@
 #include "base/callback.h"
 #include "base/files/file_path.h"
 #include "content/public/browser/web_contents.h"
+#include "shell/browser/api/atom_api_web_contents.h"
 #include "shell/browser/atom_browser_context.h"
 
 namespace electron {
@@ -58,6 +59,18 @@ void SavePageHandler::OnDownloadUpdated(download::DownloadItem* item) {
     else
       promise_.RejectWithErrorMessage("Failed to save the page.");
     Destroy(item);
+    return;
+  }
+  // The save package updates the item once per written resource; forward
+  // this to the page's WebContents instead of staying silent until the
+  // whole archive is done.
+  v8::Isolate* isolate = promise_.isolate();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  auto handle = WebContents::From(isolate, web_contents_);
+  if (!handle.IsEmpty()) {
+    handle->Emit("save-page-progress", item->GetReceivedBytes(),
+                 item->GetTotalBytes());
   }
 }
 
@@ -8,6 +8,7 @@
 #include <shlobj.h>
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -77,6 +78,7 @@
 #include "shell/browser/web_contents_permission_helper.h"
 #include "shell/browser/web_contents_preferences.h"
 #include "shell/browser/window_list.h"
+#include "shell/browser/window_open_policy.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/application_info.h"
 #include "shell/common/options_switches.h"
@@ -214,6 +216,12 @@ bool AtomBrowserClient::ShouldForceNewSiteInstance(
     // "javacript:" scheme should always use same SiteInstance
     return false;
 
+  if (process_per_site_ && !IsPinnedForIsolation(url))
+    // The consolidation policy wants same-site navigations to share
+    // renderer processes, so never force a fresh SiteInstance; the content
+    // layer groups them via ShouldUseProcessPerSite below.
+    return false;
+
   content::SiteInstance* current_instance = current_rfh->GetSiteInstance();
   content::SiteInstance* speculative_instance =
       speculative_rfh ? speculative_rfh->GetSiteInstance() : nullptr;
@@ -423,6 +431,38 @@ bool AtomBrowserClient::CanUseCustomSiteInstance() {
   return disable_process_restart_tricks_;
 }
 
+void AtomBrowserClient::SetRendererProcessPoolSize(int size) {
+  renderer_process_pool_size_ = std::max(size, 0);
+}
+
+void AtomBrowserClient::WarmupSpareRenderProcess(
+    content::BrowserContext* browser_context) {
+  if (renderer_process_pool_size_ <= 0)
+    return;
+  content::RenderProcessHost::WarmupSpareRenderProcessHost(browser_context);
+}
+
+void AtomBrowserClient::SetProcessConsolidationPolicy(
+    bool process_per_site,
+    std::vector<URLPattern> pinned_patterns) {
+  process_per_site_ = process_per_site;
+  consolidation_pinned_patterns_ = std::move(pinned_patterns);
+}
+
+bool AtomBrowserClient::IsPinnedForIsolation(const GURL& url) const {
+  for (const auto& pattern : consolidation_pinned_patterns_) {
+    if (pattern.MatchesURL(url))
+      return true;
+  }
+  return false;
+}
+
+bool AtomBrowserClient::ShouldUseProcessPerSite(
+    content::BrowserContext* browser_context,
+    const GURL& effective_url) {
+  return process_per_site_ && !IsPinnedForIsolation(effective_url);
+}
+
 content::ContentBrowserClient::SiteInstanceForNavigationType
 AtomBrowserClient::ShouldOverrideSiteInstanceForNavigation(
     content::RenderFrameHost* current_rfh,
@@ -565,6 +605,12 @@ void AtomBrowserClient::AppendExtraCommandLineSwitches(
         command_line->AppendSwitchNative(
             switches::kPreloadScripts,
             base::JoinString(preloads, kPathDelimiter));
+      std::string injections =
+          SessionPreferences::GetInjectionScriptsSwitchValue(
+              web_contents->GetBrowserContext());
+      if (!injections.empty())
+        command_line->AppendSwitchASCII(switches::kInjectionScripts,
+                                        injections);
       if (CanUseCustomSiteInstance()) {
         command_line->AppendSwitch(
             switches::kDisableElectronSiteInstanceOverrides);
@@ -660,6 +706,20 @@ bool AtomBrowserClient::CanCreateWindow(
     bool* no_javascript_access) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
+  // A declarative deny rule rejects the popup right here, inside the
+  // synchronous window.open() IPC: no guest WebContents is created and no
+  // JS event fires. Pages that spam popups pay one pattern match each.
+  content::WebContents* opener_contents =
+      content::WebContents::FromRenderFrameHost(opener);
+  if (opener_contents) {
+    auto* policy = WindowOpenPolicy::FromWebContents(opener_contents);
+    if (policy) {
+      const WindowOpenPolicy::Rule* rule = policy->Evaluate(target_url);
+      if (rule && rule->policy == WindowOpenPolicy::Policy::kDeny)
+        return false;
+    }
+  }
+
   int opener_render_process_id = opener->GetProcess()->GetID();
 
   if (RendererUsesNativeWindowOpen(opener_render_process_id)) {
@@ -804,6 +864,10 @@ void AtomBrowserClient::RenderProcessReady(content::RenderProcessHost* host) {
   if (delegate_) {
     static_cast<api::App*>(delegate_)->RenderProcessReady(host);
   }
+  // Replenish the spare process when a window claims it. Warming up is a
+  // no-op while an unclaimed spare exists, so this keeps exactly one
+  // pre-initialized renderer around.
+  WarmupSpareRenderProcess(host->GetBrowserContext());
 }
 
 void AtomBrowserClient::RenderProcessExited(
@@ -17,6 +17,7 @@
 #include "content/public/browser/render_process_host_observer.h"
 #include "content/public/browser/web_contents.h"
 #include "electron/buildflags/buildflags.h"
+#include "extensions/common/url_pattern.h"
 #include "net/ssl/client_cert_identity.h"
 
 namespace content {
@@ -73,6 +74,26 @@ class AtomBrowserClient : public content::ContentBrowserClient,
   void SetCanUseCustomSiteInstance(bool should_disable);
   bool CanUseCustomSiteInstance() override;
 
+  // Keeps a warm spare renderer process around so window creation can claim
+  // a pre-initialized process instead of paying the launch cost. The content
+  // layer maintains at most one spare per profile, so any positive size
+  // enables the single warm spare.
+  void SetRendererProcessPoolSize(int size);
+  int renderer_process_pool_size() const { return renderer_process_pool_size_; }
+
+  // Pre-launches a spare render process for |browser_context| if the pool is
+  // enabled. No-op when a spare already exists.
+  void WarmupSpareRenderProcess(content::BrowserContext* browser_context);
+
+  // Process-consolidation policy, trading renderer isolation for memory on
+  // constrained machines. When |process_per_site| is set, same-site
+  // navigations share one renderer process instead of each window getting
+  // its own; URLs matching one of |pinned_patterns| are exempt and keep the
+  // default isolation behavior.
+  void SetProcessConsolidationPolicy(bool process_per_site,
+                                     std::vector<URLPattern> pinned_patterns);
+  bool process_per_site() const { return process_per_site_; }
+
  protected:
   void RenderProcessWillLaunch(content::RenderProcessHost* host) override;
   content::SpeechRecognitionManagerDelegate*
@@ -80,6 +101,8 @@ class AtomBrowserClient : public content::ContentBrowserClient,
   content::TtsControllerDelegate* GetTtsControllerDelegate() override;
   void OverrideWebkitPrefs(content::RenderViewHost* render_view_host,
                            content::WebPreferences* prefs) override;
+  bool ShouldUseProcessPerSite(content::BrowserContext* browser_context,
+                               const GURL& effective_url) override;
   SiteInstanceForNavigationType ShouldOverrideSiteInstanceForNavigation(
       content::RenderFrameHost* current_rfh,
       content::RenderFrameHost* speculative_rfh,
@@ -253,6 +276,10 @@ class AtomBrowserClient : public content::ContentBrowserClient,
 
   bool IsRendererSubFrame(int process_id) const;
 
+  // Whether |url| matches a pinned pattern of the consolidation policy and
+  // should keep the default isolation behavior.
+  bool IsPinnedForIsolation(const GURL& url) const;
+
   // pending_render_process => web contents.
   std::map<int, content::WebContents*> pending_processes_;
 
@@ -274,6 +301,13 @@ class AtomBrowserClient : public content::ContentBrowserClient,
 
   bool disable_process_restart_tricks_ = false;
 
+  // Number of spare renderer processes to keep warm (0 disables pre-warming).
+  int renderer_process_pool_size_ = 0;
+
+  // Process-consolidation policy state, see SetProcessConsolidationPolicy.
+  bool process_per_site_ = false;
+  std::vector<URLPattern> consolidation_pinned_patterns_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomBrowserClient);
 };
 
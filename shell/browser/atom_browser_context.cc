@@ -4,7 +4,10 @@
 
 #include "shell/browser/atom_browser_context.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <utility>
 
@@ -22,6 +25,7 @@
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/pref_service_factory.h"
+#include "components/prefs/scoped_user_pref_update.h"
 #include "components/prefs/value_map_pref_store.h"
 #include "components/proxy_config/pref_proxy_config_tracker_impl.h"
 #include "components/proxy_config/proxy_config_pref_names.h"
@@ -29,6 +33,7 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "net/base/escape.h"
+#include "net/base/network_isolation_key.h"
 #include "services/network/public/cpp/features.h"
 #include "services/network/public/cpp/wrapper_shared_url_loader_factory.h"
 #include "services/network/public/mojom/network_context.mojom.h"
@@ -46,6 +51,7 @@
 #include "shell/browser/zoom_level_delegate.h"
 #include "shell/common/application_info.h"
 #include "shell/common/options_switches.h"
+#include "url/gurl.h"
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 #include "components/pref_registry/pref_registry_syncable.h"
@@ -74,6 +80,14 @@ std::string MakePartitionName(const std::string& input) {
   return net::EscapePath(base::ToLowerASCII(input));
 }
 
+// Dictionary pref mapping origin spec to how many committed main-frame
+// navigations hit it; backs the adaptive preconnect.
+const char kPreconnectOriginDemand[] = "electron.preconnect_origin_demand";
+
+// When more origins than this have been recorded, the least demanded half
+// is dropped.
+constexpr size_t kMaxTrackedPreconnectOrigins = 100;
+
 }  // namespace
 
 // static
@@ -97,6 +111,13 @@ AtomBrowserContext::AtomBrowserContext(const std::string& partition,
 
   base::StringToInt(command_line->GetSwitchValueASCII(switches::kDiskCacheSize),
                     &max_cache_size_);
+  options.GetInteger("cacheMaxSize", &max_cache_size_);
+
+  std::string cache_backend;
+  if (options.GetString("cacheBackend", &cache_backend))
+    in_memory_http_cache_ = cache_backend == "memory";
+
+  options.GetString("sharedCacheGroup", &shared_cache_group_);
 
   if (!base::PathService::Get(DIR_USER_DATA, &path_)) {
     base::PathService::Get(DIR_APP_DATA, &path_);
@@ -104,6 +125,12 @@ AtomBrowserContext::AtomBrowserContext(const std::string& partition,
     base::PathService::Override(DIR_USER_DATA, path_);
   }
 
+  if (!shared_cache_group_.empty() && !in_memory) {
+    shared_cache_path_ = path_.Append(FILE_PATH_LITERAL("SharedCache"))
+                             .Append(base::FilePath::FromUTF8Unsafe(
+                                 MakePartitionName(shared_cache_group_)));
+  }
+
   if (!in_memory && !partition.empty())
     path_ = path_.Append(FILE_PATH_LITERAL("Partitions"))
                 .Append(base::FilePath::FromUTF8Unsafe(
@@ -146,6 +173,11 @@ void AtomBrowserContext::InitPrefs() {
   auto prefs_path = GetPath().Append(FILE_PATH_LITERAL("Preferences"));
   base::ThreadRestrictions::ScopedAllowIO allow_io;
   PrefServiceFactory prefs_factory;
+  // JsonPrefStore is a write-behind store: mutations land in memory
+  // immediately and ImportantFileWriter persists them after a coalescing
+  // delay, with a synchronous flush on shutdown. Serialization still covers
+  // the whole file, so frequent writers (zoom levels, devtools prefs) batch
+  // their mutations before touching the store.
   scoped_refptr<JsonPrefStore> pref_store =
       base::MakeRefCounted<JsonPrefStore>(prefs_path);
   pref_store->ReadPrefs();  // Synchronous.
@@ -169,6 +201,7 @@ void AtomBrowserContext::InitPrefs() {
   registry->RegisterFilePathPref(prefs::kDownloadDefaultDirectory,
                                  download_dir);
   registry->RegisterDictionaryPref(prefs::kDevToolsFileSystemPaths);
+  registry->RegisterDictionaryPref(kPreconnectOriginDemand);
   InspectableWebContentsImpl::RegisterPrefs(registry.get());
   MediaDeviceIDSalt::RegisterPrefs(registry.get());
   ZoomLevelDelegate::RegisterPrefs(registry.get());
@@ -206,6 +239,10 @@ int AtomBrowserContext::GetMaxCacheSize() const {
   return max_cache_size_;
 }
 
+bool AtomBrowserContext::UseInMemoryHttpCache() const {
+  return in_memory_http_cache_;
+}
+
 content::ResourceContext* AtomBrowserContext::GetResourceContext() {
   if (!resource_context_)
     resource_context_ = std::make_unique<content::ResourceContext>();
@@ -266,6 +303,64 @@ predictors::PreconnectManager* AtomBrowserContext::GetPreconnectManager() {
   return preconnect_manager_.get();
 }
 
+void AtomBrowserContext::SetPreconnectLearning(bool enabled,
+                                               int max_origins,
+                                               int num_sockets) {
+  preconnect_learning_enabled_ = enabled;
+  preconnect_max_origins_ = max_origins;
+  preconnect_num_sockets_ = num_sockets;
+  if (enabled)
+    PreconnectTopOrigins();
+}
+
+void AtomBrowserContext::RecordPreconnectDemand(const GURL& url) {
+  if (!preconnect_learning_enabled_ || !url.SchemeIsHTTPOrHTTPS())
+    return;
+  DictionaryPrefUpdate update(prefs(), kPreconnectOriginDemand);
+  base::DictionaryValue* demand = update.Get();
+  const std::string origin = url.GetOrigin().spec();
+  int count = 0;
+  if (const base::Value* value = demand->FindKey(origin))
+    count = value->is_int() ? value->GetInt() : 0;
+  demand->SetKey(origin, base::Value(count + 1));
+
+  if (demand->DictSize() > kMaxTrackedPreconnectOrigins) {
+    std::vector<std::pair<int, std::string>> entries;
+    for (const auto& item : demand->DictItems()) {
+      entries.emplace_back(item.second.is_int() ? item.second.GetInt() : 0,
+                           item.first);
+    }
+    std::sort(entries.begin(), entries.end());
+    const size_t to_remove = entries.size() - kMaxTrackedPreconnectOrigins / 2;
+    for (size_t i = 0; i < to_remove; ++i)
+      demand->RemoveKey(entries[i].second);
+  }
+}
+
+void AtomBrowserContext::PreconnectTopOrigins() {
+  const base::DictionaryValue* demand =
+      prefs()->GetDictionary(kPreconnectOriginDemand);
+  if (!demand || demand->DictEmpty())
+    return;
+  std::vector<std::pair<int, std::string>> entries;
+  for (const auto& item : demand->DictItems()) {
+    entries.emplace_back(item.second.is_int() ? item.second.GetInt() : 0,
+                         item.first);
+  }
+  std::sort(entries.begin(), entries.end(),
+            std::greater<std::pair<int, std::string>>());
+  const size_t budget =
+      std::min(entries.size(), static_cast<size_t>(preconnect_max_origins_));
+  for (size_t i = 0; i < budget; ++i) {
+    GURL origin(entries[i].second);
+    if (!origin.is_valid())
+      continue;
+    std::vector<predictors::PreconnectRequest> requests = {
+        {origin, preconnect_num_sockets_, net::NetworkIsolationKey()}};
+    GetPreconnectManager()->Start(origin, requests);
+  }
+}
+
 scoped_refptr<network::SharedURLLoaderFactory>
 AtomBrowserContext::GetURLLoaderFactory() {
   if (url_loader_factory_)
@@ -20,6 +20,7 @@
 #include "services/network/public/mojom/url_loader_factory.mojom.h"
 #include "shell/browser/media/media_device_id_salt.h"
 
+class GURL;
 class PrefRegistrySimple;
 class PrefService;
 class ValueMapPrefStore;
@@ -89,8 +90,29 @@ class AtomBrowserContext
   std::string GetUserAgent() const;
   bool CanUseHttpCache() const;
   int GetMaxCacheSize() const;
+  // Whether the HTTP cache should live entirely in memory instead of on disk.
+  bool UseInMemoryHttpCache() const;
+  // Name of the cache-share group this partition opted into with the
+  // |sharedCacheGroup| option, or empty. Partitions in the same group mount
+  // a common disk cache; see NetworkContextService for the arbitration.
+  const std::string& shared_cache_group() const { return shared_cache_group_; }
+  // The disk cache directory shared by every partition in the group. Empty
+  // unless a group was configured.
+  const base::FilePath& shared_cache_path() const {
+    return shared_cache_path_;
+  }
   ResolveProxyHelper* GetResolveProxyHelper();
   predictors::PreconnectManager* GetPreconnectManager();
+
+  // Adaptive preconnect: when learning is enabled, per-origin connection
+  // demand is recorded from committed main-frame navigations (persisted in
+  // prefs) and the most demanded origins get their sockets warmed.
+  void SetPreconnectLearning(bool enabled, int max_origins, int num_sockets);
+  bool preconnect_learning_enabled() const {
+    return preconnect_learning_enabled_;
+  }
+  void RecordPreconnectDemand(const GURL& url);
+  void PreconnectTopOrigins();
   scoped_refptr<network::SharedURLLoaderFactory> GetURLLoaderFactory();
 
   // content::BrowserContext:
@@ -177,6 +199,13 @@ class AtomBrowserContext
   bool in_memory_ = false;
   bool use_cache_ = true;
   int max_cache_size_ = 0;
+  bool in_memory_http_cache_ = false;
+  std::string shared_cache_group_;
+  base::FilePath shared_cache_path_;
+
+  bool preconnect_learning_enabled_ = false;
+  int preconnect_max_origins_ = 5;
+  int preconnect_num_sockets_ = 1;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   // Owned by the KeyedService system.
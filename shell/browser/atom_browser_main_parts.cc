@@ -16,7 +16,10 @@
 #include "base/command_line.h"
 #include "base/feature_list.h"
 #include "base/message_loop/message_loop.h"
+#include "base/base_paths.h"
+#include "base/files/file_util.h"
 #include "base/path_service.h"
+#include "base/task/post_task.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "chrome/browser/icon_manager.h"
@@ -44,6 +47,7 @@
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/media/media_capture_devices_dispatcher.h"
 #include "shell/browser/node_debugger.h"
+#include "shell/browser/relauncher.h"
 #include "shell/browser/ui/devtools_manager_delegate.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/application_info.h"
@@ -51,6 +55,7 @@
 #include "shell/common/gin_helper/trackable_object.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/startup_metrics.h"
 #include "ui/base/idle/idle.h"
 #include "ui/base/material_design/material_design_controller.h"
 #include "ui/base/ui_base_switches.h"
@@ -207,6 +212,35 @@ int X11EmptyIOErrorHandler(Display* d) {
 }
 #endif
 
+// The thread-pool half of PostEarlyInitialization: warms startup state that
+// does not need the main thread while it builds the V8/Node environment.
+// Must only touch thread-safe state.
+void WarmupOnThreadPool() {
+#if defined(OS_LINUX)
+  // A warm relaunch hands us the parent's parsed asar headers over an
+  // inherited shared memory region; seed the header cache from it before
+  // any archive is opened.
+  relauncher::internal::ImportWarmHandoffIfPresent();
+#endif
+
+  base::FilePath exe_path;
+  if (!base::PathService::Get(base::FILE_EXE, &exe_path))
+    return;
+  base::FilePath resources_path =
+#if defined(OS_MACOSX)
+      exe_path.DirName().DirName().Append(FILE_PATH_LITERAL("Resources"));
+#else
+      exe_path.DirName().Append(FILE_PATH_LITERAL("resources"));
+#endif
+
+  // Opening the app archive parses its header and primes both asar's header
+  // cache and the OS page cache, so the main script's first require doesn't
+  // block on disk.
+  base::FilePath app_asar = resources_path.Append(FILE_PATH_LITERAL("app.asar"));
+  if (base::PathExists(app_asar))
+    asar::GetOrCreateAsarArchive(app_asar);
+}
+
 }  // namespace
 
 // static
@@ -266,6 +300,7 @@ void AtomBrowserMainParts::RegisterDestructionCallback(
 }
 
 int AtomBrowserMainParts::PreEarlyInitialization() {
+  StartupMetrics::Get()->Record("preEarlyInitialization");
   field_trial_list_ = std::make_unique<base::FieldTrialList>(nullptr);
 #if defined(USE_X11)
   views::LinuxUI::SetInstance(BuildGtkUi());
@@ -285,10 +320,24 @@ int AtomBrowserMainParts::PreEarlyInitialization() {
 }
 
 void AtomBrowserMainParts::PostEarlyInitialization() {
+  StartupMetrics::Get()->Record("postEarlyInitialization");
   // A workaround was previously needed because there was no ThreadTaskRunner
   // set.  If this check is failing we may need to re-add that workaround
   DCHECK(base::ThreadTaskRunnerHandle::IsSet());
 
+  // Run the I/O-bound half of initialization on the thread pool while this
+  // thread builds the V8/Node environment; joined below before the first JS
+  // runs.
+  base::PostTask(FROM_HERE,
+                 {base::ThreadPool(), base::MayBlock(),
+                  base::TaskPriority::USER_BLOCKING},
+                 base::BindOnce(
+                     [](base::WaitableEvent* done) {
+                       WarmupOnThreadPool();
+                       done->Signal();
+                     },
+                     base::Unretained(&startup_warmup_done_)));
+
   // The ProxyResolverV8 has setup a complete V8 environment, in order to
   // avoid conflicts we only initialize our V8 environment after that.
   js_env_ = std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
@@ -337,6 +386,11 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
   // Add Electron extended APIs.
   electron_bindings_->BindTo(js_env_->isolate(), env->process_object());
 
+  // Join the thread-pool warm-up before any JS runs. Blocking here is fine:
+  // browser threads don't exist yet and the pool half typically finishes
+  // well inside the V8/Node setup above.
+  startup_warmup_done_.Wait();
+
   // Load everything.
   node_bindings_->LoadEnvironment(env);
 
@@ -352,9 +406,12 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
 
   // Initialize after user script environment creation.
   fake_browser_process_->PostEarlyInitialization();
+
+  StartupMetrics::Get()->Record("postEarlyInitializationDone");
 }
 
 int AtomBrowserMainParts::PreCreateThreads() {
+  StartupMetrics::Get()->Record("preCreateThreads");
 #if defined(USE_AURA)
   display::Screen* screen = views::CreateDesktopScreen();
   display::Screen::SetScreenInstance(screen);
@@ -425,6 +482,7 @@ void AtomBrowserMainParts::ToolkitInitialized() {
 }
 
 void AtomBrowserMainParts::PreMainMessageLoopRun() {
+  StartupMetrics::Get()->Record("preMainMessageLoopRun");
   // Run user's main script before most things get initialized, so we can have
   // a chance to setup everything.
   node_bindings_->PrepareMessageLoop();
@@ -470,6 +528,8 @@ void AtomBrowserMainParts::PreMainMessageLoopRun() {
 
   // Notify observers that main thread message loop was initialized.
   Browser::Get()->PreMainMessageLoopRun();
+
+  StartupMetrics::Get()->Record("preMainMessageLoopRunDone");
 }
 
 bool AtomBrowserMainParts::MainMessageLoopRun(int* result_code) {
@@ -11,6 +11,7 @@
 
 #include "base/callback.h"
 #include "base/metrics/field_trial.h"
+#include "base/synchronization/waitable_event.h"
 #include "base/timer/timer.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_main_parts.h"
@@ -127,6 +128,10 @@ class AtomBrowserMainParts : public content::BrowserMainParts {
   // Pointer to exit code.
   int* exit_code_ = nullptr;
 
+  // Signaled when the thread-pool half of early initialization (resource and
+  // asar warm-up) is done; joined before the first JS runs.
+  base::WaitableEvent startup_warmup_done_;
+
   std::unique_ptr<Browser> browser_;
   std::unique_ptr<JavascriptEnvironment> js_env_;
   std::unique_ptr<NodeBindings> node_bindings_;
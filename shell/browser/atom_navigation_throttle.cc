@@ -35,6 +35,16 @@ AtomNavigationThrottle::WillRedirectRequest() {
     return PROCEED;
   }
 
+  // Declarative rules decide the common case without deferring into JS.
+  switch (api_contents->navigation_policy_rules().Evaluate(handle->GetURL())) {
+    case NavigationPolicyRules::Policy::kAllow:
+      return PROCEED;
+    case NavigationPolicyRules::Policy::kDeny:
+      return CANCEL;
+    case NavigationPolicyRules::Policy::kDeferToJS:
+      break;
+  }
+
   if (api_contents->EmitNavigationEvent("will-redirect", handle)) {
     return CANCEL;
   }
@@ -5,6 +5,7 @@
 #include "shell/browser/atom_permission_manager.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -38,6 +39,48 @@ void PermissionRequestResponseCallbackWrapper(
   std::move(callback).Run(vector[0]);
 }
 
+// Applies the process-level side effects of a granted permission. Shared
+// between fresh grants and grants served from the decision cache, since
+// the grant may be scoped to a renderer process that did not exist when
+// the decision was first made.
+void ApplyGrantSideEffects(content::PermissionType permission,
+                           int render_process_id) {
+  if (permission == content::PermissionType::MIDI_SYSEX) {
+    content::ChildProcessSecurityPolicy::GetInstance()
+        ->GrantSendMidiSysExMessage(render_process_id);
+  } else if (permission == content::PermissionType::GEOLOCATION) {
+    AtomBrowserMainParts::Get()
+        ->GetGeolocationControl()
+        ->UserDidOptIntoLocationServices();
+  }
+}
+
+// Builds the details component of a DecisionKey. Handlers decide on the
+// request details as well as the origin — openExternal carries the
+// target URL and media requests carry the requested device types — so
+// those fields must distinguish cache entries.
+std::string DetailsCacheDiscriminator(const base::DictionaryValue* details) {
+  if (!details)
+    return std::string();
+  std::string discriminator;
+  if (const std::string* external_url = details->FindStringKey("externalURL"))
+    discriminator += *external_url;
+  if (const base::Value* media_types = details->FindListKey("mediaTypes")) {
+    for (const auto& media_type : media_types->GetList()) {
+      if (media_type.is_string()) {
+        discriminator += '|';
+        discriminator += media_type.GetString();
+      }
+    }
+  }
+  return discriminator;
+}
+
+// Bounds how many settled decisions are retained; the cache is rebuilt
+// from handler responses after a clear, so overflow just costs a few
+// extra JS round-trips.
+constexpr size_t kMaxCachedDecisions = 1024;
+
 }  // namespace
 
 class AtomPermissionManager::PendingRequest {
@@ -55,17 +98,8 @@ class AtomPermissionManager::PendingRequest {
                            blink::mojom::PermissionStatus status) {
     DCHECK(!IsComplete());
 
-    if (status == blink::mojom::PermissionStatus::GRANTED) {
-      const auto permission = permissions_[permission_id];
-      if (permission == content::PermissionType::MIDI_SYSEX) {
-        content::ChildProcessSecurityPolicy::GetInstance()
-            ->GrantSendMidiSysExMessage(render_process_id_);
-      } else if (permission == content::PermissionType::GEOLOCATION) {
-        AtomBrowserMainParts::Get()
-            ->GetGeolocationControl()
-            ->UserDidOptIntoLocationServices();
-      }
-    }
+    if (status == blink::mojom::PermissionStatus::GRANTED)
+      ApplyGrantSideEffects(permissions_[permission_id], render_process_id_);
 
     results_[permission_id] = status;
     --remaining_results_;
@@ -104,6 +138,9 @@ void AtomPermissionManager::SetPermissionRequestHandler(
     }
     pending_requests_.Clear();
   }
+  // A new handler may decide differently, so cached decisions from the
+  // old one no longer apply.
+  decision_cache_.clear();
   request_handler_ = handler;
 }
 
@@ -160,24 +197,46 @@ int AtomPermissionManager::RequestPermissionsWithDetails(
     return content::PermissionController::kNoPendingOperation;
   }
 
+  const int render_process_id = render_frame_host->GetProcess()->GetID();
+
   if (request_handler_.is_null()) {
     std::vector<blink::mojom::PermissionStatus> statuses;
     for (auto permission : permissions) {
-      if (permission == content::PermissionType::MIDI_SYSEX) {
-        content::ChildProcessSecurityPolicy::GetInstance()
-            ->GrantSendMidiSysExMessage(
-                render_frame_host->GetProcess()->GetID());
-      } else if (permission == content::PermissionType::GEOLOCATION) {
-        AtomBrowserMainParts::Get()
-            ->GetGeolocationControl()
-            ->UserDidOptIntoLocationServices();
-      }
+      ApplyGrantSideEffects(permission, render_process_id);
       statuses.push_back(blink::mojom::PermissionStatus::GRANTED);
     }
     std::move(response_callback).Run(statuses);
     return content::PermissionController::kNoPendingOperation;
   }
 
+  const std::string details_discriminator =
+      DetailsCacheDiscriminator(details);
+  std::vector<DecisionKey> keys;
+  keys.reserve(permissions.size());
+  for (auto permission : permissions) {
+    keys.emplace_back(render_process_id, render_frame_host->GetRoutingID(),
+                      permission, requesting_origin.GetOrigin().spec(),
+                      details_discriminator);
+  }
+
+  // If every permission in the batch has a cached decision, respond
+  // without bouncing through the JS handler again.
+  std::vector<blink::mojom::PermissionStatus> cached_statuses;
+  for (const auto& key : keys) {
+    auto iter = decision_cache_.find(key);
+    if (iter == decision_cache_.end())
+      break;
+    cached_statuses.push_back(iter->second);
+  }
+  if (cached_statuses.size() == permissions.size()) {
+    for (size_t i = 0; i < permissions.size(); ++i) {
+      if (cached_statuses[i] == blink::mojom::PermissionStatus::GRANTED)
+        ApplyGrantSideEffects(permissions[i], render_process_id);
+    }
+    std::move(response_callback).Run(cached_statuses);
+    return content::PermissionController::kNoPendingOperation;
+  }
+
   auto* web_contents =
       content::WebContents::FromRenderFrameHost(render_frame_host);
   int request_id = pending_requests_.Add(std::make_unique<PendingRequest>(
@@ -187,7 +246,7 @@ int AtomPermissionManager::RequestPermissionsWithDetails(
     auto permission = permissions[i];
     const auto callback =
         base::BindRepeating(&AtomPermissionManager::OnPermissionResponse,
-                            base::Unretained(this), request_id, i);
+                            base::Unretained(this), request_id, i, keys[i]);
     auto mutable_details =
         details == nullptr ? base::DictionaryValue() : details->Clone();
     mutable_details.SetStringKey(
@@ -203,7 +262,14 @@ int AtomPermissionManager::RequestPermissionsWithDetails(
 void AtomPermissionManager::OnPermissionResponse(
     int request_id,
     int permission_id,
+    const DecisionKey& key,
     blink::mojom::PermissionStatus status) {
+  if (status != blink::mojom::PermissionStatus::ASK) {
+    if (decision_cache_.size() >= kMaxCachedDecisions)
+      decision_cache_.clear();
+    decision_cache_[key] = status;
+  }
+
   auto* pending_request = pending_requests_.Lookup(request_id);
   if (!pending_request)
     return;
@@ -217,7 +283,19 @@ void AtomPermissionManager::OnPermissionResponse(
 
 void AtomPermissionManager::ResetPermission(content::PermissionType permission,
                                             const GURL& requesting_origin,
-                                            const GURL& embedding_origin) {}
+                                            const GURL& embedding_origin) {
+  // Drop cached decisions for this (permission, origin) in every frame so
+  // the next request consults the handler again.
+  const std::string origin = requesting_origin.GetOrigin().spec();
+  for (auto iter = decision_cache_.begin(); iter != decision_cache_.end();) {
+    if (std::get<2>(iter->first) == permission &&
+        std::get<3>(iter->first) == origin) {
+      iter = decision_cache_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
 
 blink::mojom::PermissionStatus AtomPermissionManager::GetPermissionStatus(
     content::PermissionType permission,
@@ -7,6 +7,8 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "base/callback.h"
@@ -78,8 +80,17 @@ class AtomPermissionManager : public content::PermissionControllerDelegate {
                                   const base::DictionaryValue* details) const;
 
  protected:
+  // Identifies a handler decision: (process id, frame routing id,
+  // permission type, requesting origin, details discriminator). The last
+  // component folds in the request details that handlers decide on —
+  // e.g. openExternal's target URL — so a decision for one detail set is
+  // never replayed for another.
+  using DecisionKey =
+      std::tuple<int, int, content::PermissionType, std::string, std::string>;
+
   void OnPermissionResponse(int request_id,
                             int permission_id,
+                            const DecisionKey& key,
                             blink::mojom::PermissionStatus status);
 
   // content::PermissionControllerDelegate:
@@ -107,6 +118,12 @@ class AtomPermissionManager : public content::PermissionControllerDelegate {
 
   PendingRequestsMap pending_requests_;
 
+  // Settled handler decisions, so steady-state re-requests of the same
+  // (frame, permission, origin) resolve without a JS round-trip. Cleared
+  // when the app replaces the request handler and pruned by
+  // ResetPermission().
+  std::map<DecisionKey, blink::mojom::PermissionStatus> decision_cache_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomPermissionManager);
 };
 
@@ -209,6 +209,8 @@ class Browser : public WindowListObserver {
     UserTask();
     UserTask(const UserTask&);
     ~UserTask();
+
+    bool operator==(const UserTask& other) const;
   };
 
   // Add a custom task to jump list.
@@ -312,6 +314,12 @@ class Browser : public WindowListObserver {
   base::DictionaryValue about_panel_options_;
 #endif
 
+#if defined(OS_WIN)
+  // The user tasks last committed to the jump list, used to skip no-op
+  // rebuilds when the same list is set again.
+  std::vector<UserTask> last_user_tasks_;
+#endif
+
   DISALLOW_COPY_AND_ASSIGN(Browser);
 };
 
@@ -101,6 +101,13 @@ Browser::UserTask::UserTask() = default;
 Browser::UserTask::UserTask(const UserTask&) = default;
 Browser::UserTask::~UserTask() = default;
 
+bool Browser::UserTask::operator==(const UserTask& other) const {
+  return program == other.program && arguments == other.arguments &&
+         title == other.title && description == other.description &&
+         working_dir == other.working_dir && icon_path == other.icon_path &&
+         icon_index == other.icon_index;
+}
+
 void Browser::Focus() {
   // On Windows we just focus on the first window found for this process.
   DWORD pid = GetCurrentProcessId();
@@ -128,6 +135,11 @@ void Browser::SetAppUserModelID(const base::string16& name) {
 }
 
 bool Browser::SetUserTasks(const std::vector<UserTask>& tasks) {
+  // Rebuilding the jump list goes through several COM calls, skip it
+  // entirely when the requested tasks match what is already committed.
+  if (tasks == last_user_tasks_)
+    return true;
+
   JumpList jump_list(GetAppUserModelID());
   if (!jump_list.Begin())
     return false;
@@ -149,7 +161,10 @@ bool Browser::SetUserTasks(const std::vector<UserTask>& tasks) {
   }
 
   jump_list.AppendCategory(category);
-  return jump_list.Commit();
+  const bool committed = jump_list.Commit();
+  if (committed)
+    last_user_tasks_ = tasks;
+  return committed;
 }
 
 bool Browser::RemoveAsDefaultProtocolClient(const std::string& protocol,
@@ -4,17 +4,27 @@
 
 #include "shell/browser/extensions/atom_extension_loader.h"
 
+#include <map>
+#include <string>
+#include <utility>
+
 #include "base/auto_reset.h"
 #include "base/bind.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/sequenced_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/task/post_task.h"
+#include "base/task/task_traits.h"
 #include "base/task_runner_util.h"
 #include "base/threading/thread_restrictions.h"
+#include "crypto/sha2.h"
 #include "extensions/browser/extension_file_task_runner.h"
 #include "extensions/browser/extension_prefs.h"
 #include "extensions/browser/extension_registry.h"
+#include "extensions/common/constants.h"
 #include "extensions/common/file_util.h"
 
 namespace extensions {
@@ -55,6 +65,46 @@ scoped_refptr<const Extension> LoadUnpacked(
   return extension;
 }
 
+// Process-wide cache of parsed extensions keyed by directory plus
+// manifest content hash, so sideloading the same unchanged extension
+// into several sessions (or reloading it) parses the manifest once.
+struct ParseCache {
+  base::Lock lock;
+  std::map<std::string, scoped_refptr<const Extension>> entries;
+};
+
+ParseCache& GetParseCache() {
+  static base::NoDestructor<ParseCache> cache;
+  return *cache;
+}
+
+std::string ComputeParseCacheKey(const base::FilePath& extension_dir) {
+  std::string manifest;
+  if (!base::ReadFileToString(extension_dir.Append(kManifestFilename),
+                              &manifest))
+    return std::string();
+  return extension_dir.AsUTF8Unsafe() + ":" +
+         crypto::SHA256HashString(manifest);
+}
+
+scoped_refptr<const Extension> LoadUnpackedCached(
+    const base::FilePath& extension_dir) {
+  std::string key = ComputeParseCacheKey(extension_dir);
+  if (!key.empty()) {
+    base::AutoLock lock(GetParseCache().lock);
+    auto iter = GetParseCache().entries.find(key);
+    if (iter != GetParseCache().entries.end())
+      return iter->second;
+  }
+
+  scoped_refptr<const Extension> extension = LoadUnpacked(extension_dir);
+  if (extension && !key.empty()) {
+    base::AutoLock lock(GetParseCache().lock);
+    GetParseCache().entries.emplace(std::move(key), extension);
+  }
+  return extension;
+}
+
 }  // namespace
 
 AtomExtensionLoader::AtomExtensionLoader(
@@ -67,16 +117,35 @@ AtomExtensionLoader::~AtomExtensionLoader() = default;
 
 const Extension* AtomExtensionLoader::LoadExtension(
     const base::FilePath& extension_dir) {
-  // TODO(nornagon): load extensions asynchronously on
-  // GetExtensionFileTaskRunner()
   base::ScopedAllowBlockingForTesting allow_blocking;
-  scoped_refptr<const Extension> extension = LoadUnpacked(extension_dir);
+  scoped_refptr<const Extension> extension = LoadUnpackedCached(extension_dir);
   if (extension)
     extension_registrar_.AddExtension(extension);
 
   return extension.get();
 }
 
+void AtomExtensionLoader::LoadExtensionAsync(
+    const base::FilePath& extension_dir) {
+  // Each load is an independent thread-pool task, so a batch of
+  // sideloaded extensions parses in parallel and each one registers —
+  // firing its readiness events — as soon as it finishes, instead of
+  // gating on the slowest load.
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(),
+       base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&LoadUnpackedCached, extension_dir),
+      base::BindOnce(&AtomExtensionLoader::FinishExtensionLoad,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void AtomExtensionLoader::FinishExtensionLoad(
+    scoped_refptr<const Extension> extension) {
+  if (extension)
+    extension_registrar_.AddExtension(extension);
+}
+
 void AtomExtensionLoader::ReloadExtension(ExtensionId extension_id) {
   const Extension* extension = ExtensionRegistry::Get(browser_context_)
                                    ->GetInstalledExtension(extension_id);
@@ -36,6 +36,10 @@ class AtomExtensionLoader : public ExtensionRegistrar::Delegate {
   // extension on success, or nullptr otherwise.
   const Extension* LoadExtension(const base::FilePath& extension_dir);
 
+  // Loads an unpacked extension on the thread pool and registers it when
+  // parsing finishes. Concurrent calls load in parallel.
+  void LoadExtensionAsync(const base::FilePath& extension_dir);
+
   // Starts reloading the extension. A keep-alive is maintained until the
   // reload succeeds/fails. If the extension is an app, it will be launched upon
   // reloading.
@@ -49,6 +53,9 @@ class AtomExtensionLoader : public ExtensionRegistrar::Delegate {
   void FinishExtensionReload(const ExtensionId old_extension_id,
                              scoped_refptr<const Extension> extension);
 
+  // Registers an extension loaded by LoadExtensionAsync.
+  void FinishExtensionLoad(scoped_refptr<const Extension> extension);
+
   // ExtensionRegistrar::Delegate:
   void PreAddExtension(const Extension* extension,
                        const Extension* old_extension) override;
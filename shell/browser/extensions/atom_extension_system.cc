@@ -48,6 +48,11 @@ const Extension* AtomExtensionSystem::LoadExtension(
   return extension_loader_->LoadExtension(extension_dir);
 }
 
+void AtomExtensionSystem::LoadExtensionAsync(
+    const base::FilePath& extension_dir) {
+  extension_loader_->LoadExtensionAsync(extension_dir);
+}
+
 const Extension* AtomExtensionSystem::LoadApp(const base::FilePath& app_dir) {
   CHECK(false);  // Should never call LoadApp
   return nullptr;
@@ -41,6 +41,10 @@ class AtomExtensionSystem : public ExtensionSystem {
   // success, or nullptr otherwise.
   const Extension* LoadExtension(const base::FilePath& extension_dir);
 
+  // Loads an unpacked extension off the UI thread; the extension
+  // registers and fires its readiness events when parsing finishes.
+  void LoadExtensionAsync(const base::FilePath& extension_dir);
+
   // Loads an unpacked platform app from a directory. Returns the extension on
   // success, or nullptr otherwise.
   // Currently this just calls LoadExtension, as apps are not loaded differently
@@ -5,8 +5,8 @@
 #include "shell/browser/font_defaults.h"
 
 #include <string>
-#include <unordered_map>
 
+#include "base/no_destructor.h"
 #include "base/stl_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
@@ -118,65 +118,60 @@ std::string GetDefaultFontForPref(const char* pref_name) {
   return std::string();
 }
 
-// Map from script to font.
-// Key comparison uses pointer equality.
-using ScriptFontMap = std::unordered_map<const char*, base::string16>;
-
-// Map from font family to ScriptFontMap.
-// Key comparison uses pointer equality.
-using FontFamilyMap = std::unordered_map<const char*, ScriptFontMap>;
-
-// A lookup table mapping (font-family, script) -> font-name
-// e.g. ("sans-serif", "Zyyy") -> "Arial"
-FontFamilyMap g_font_cache;
-
-base::string16 FetchFont(const char* script, const char* map_name) {
-  FontFamilyMap::const_iterator it = g_font_cache.find(map_name);
-  if (it != g_font_cache.end()) {
-    ScriptFontMap::const_iterator it2 = it->second.find(script);
-    if (it2 != it->second.end())
-      return it2->second;
-  }
-
-  std::string pref_name = base::StringPrintf("%s.%s", map_name, script);
-  std::string font = GetDefaultFontForPref(pref_name.c_str());
-  base::string16 font16 = base::UTF8ToUTF16(font);
-
-  ScriptFontMap& map = g_font_cache[map_name];
-  map[script] = font16;
-  return font16;
-}
-
 void FillFontFamilyMap(const char* map_name,
                        content::ScriptFontFamilyMap* map) {
   for (size_t i = 0; i < prefs::kWebKitScriptsForFontFamilyMapsLength; ++i) {
     const char* script = prefs::kWebKitScriptsForFontFamilyMaps[i];
-    base::string16 result = FetchFont(script, map_name);
-    if (!result.empty()) {
-      (*map)[script] = result;
+    std::string pref_name = base::StringPrintf("%s.%s", map_name, script);
+    std::string font = GetDefaultFontForPref(pref_name.c_str());
+    if (!font.empty()) {
+      (*map)[script] = base::UTF8ToUTF16(font);
     }
   }
 }
 
+// The complete set of per-script font maps. The localized defaults never
+// change at runtime, so the maps are built once and then copied into each
+// new WebPreferences struct; any per-window font overrides are applied to
+// that copy afterwards.
+struct DefaultFontFamilies {
+  DefaultFontFamilies() {
+    FillFontFamilyMap(prefs::kWebKitStandardFontFamilyMap, &standard);
+    FillFontFamilyMap(prefs::kWebKitFixedFontFamilyMap, &fixed);
+    FillFontFamilyMap(prefs::kWebKitSerifFontFamilyMap, &serif);
+    FillFontFamilyMap(prefs::kWebKitSansSerifFontFamilyMap, &sans_serif);
+    FillFontFamilyMap(prefs::kWebKitCursiveFontFamilyMap, &cursive);
+    FillFontFamilyMap(prefs::kWebKitFantasyFontFamilyMap, &fantasy);
+    FillFontFamilyMap(prefs::kWebKitPictographFontFamilyMap, &pictograph);
+  }
+
+  content::ScriptFontFamilyMap standard;
+  content::ScriptFontFamilyMap fixed;
+  content::ScriptFontFamilyMap serif;
+  content::ScriptFontFamilyMap sans_serif;
+  content::ScriptFontFamilyMap cursive;
+  content::ScriptFontFamilyMap fantasy;
+  content::ScriptFontFamilyMap pictograph;
+};
+
+const DefaultFontFamilies& GetDefaultFontFamilies() {
+  static const base::NoDestructor<DefaultFontFamilies> families;
+  return *families;
+}
+
 }  // namespace
 
 namespace electron {
 
 void SetFontDefaults(content::WebPreferences* prefs) {
-  FillFontFamilyMap(prefs::kWebKitStandardFontFamilyMap,
-                    &prefs->standard_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitFixedFontFamilyMap,
-                    &prefs->fixed_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitSerifFontFamilyMap,
-                    &prefs->serif_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitSansSerifFontFamilyMap,
-                    &prefs->sans_serif_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitCursiveFontFamilyMap,
-                    &prefs->cursive_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitFantasyFontFamilyMap,
-                    &prefs->fantasy_font_family_map);
-  FillFontFamilyMap(prefs::kWebKitPictographFontFamilyMap,
-                    &prefs->pictograph_font_family_map);
+  const DefaultFontFamilies& families = GetDefaultFontFamilies();
+  prefs->standard_font_family_map = families.standard;
+  prefs->fixed_font_family_map = families.fixed;
+  prefs->serif_font_family_map = families.serif;
+  prefs->sans_serif_font_family_map = families.sans_serif;
+  prefs->cursive_font_family_map = families.cursive;
+  prefs->fantasy_font_family_map = families.fantasy;
+  prefs->pictograph_font_family_map = families.pictograph;
 }
 
 }  // namespace electron
@@ -8,19 +8,80 @@
 
 #include <string>
 
+#include <algorithm>
+
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/message_loop/message_loop_current.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
 #include "base/task/thread_pool/initialization_util.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "content/public/common/content_switches.h"
+#include "electron/buildflags/buildflags.h"
 #include "gin/array_buffer.h"
 #include "gin/v8_initializer.h"
 #include "shell/browser/microtasks_runner.h"
+#include "shell/browser/responsiveness_watchdog.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/options_switches.h"
+#include "shell/common/pooled_array_buffer_allocator.h"
+#include "shell/common/startup_metrics.h"
 #include "tracing/trace_event.h"
 
+#if BUILDFLAG(ENABLE_BOOTSTRAP_SNAPSHOT)
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/no_destructor.h"
+#include "base/path_service.h"
+#endif
+
 namespace electron {
 
+namespace {
+
+// Cadence of idle GC probes, how long the message loop must have been quiet
+// before V8 is offered idle time, and how much time it is offered.
+constexpr base::TimeDelta kIdleNotificationInterval =
+    base::TimeDelta::FromSeconds(1);
+constexpr base::TimeDelta kIdleQuietThreshold =
+    base::TimeDelta::FromMilliseconds(500);
+constexpr double kIdleDeadlineSeconds = 0.01;
+
+// Sanity cap for --node-worker-pool-size; more threads than this only adds
+// contention.
+constexpr int kMaxNodeWorkerPoolSize = 128;
+
+// Worker count the Node/V8 platform pool was created with, kept around for
+// app.getThreadPoolMetrics().
+int g_node_worker_pool_size = 0;
+
+#if BUILDFLAG(ENABLE_BOOTSTRAP_SNAPSHOT)
+// Points V8 at the custom startup snapshot generated at build time, which
+// has the JS bootstrap pre-executed. Must be called before the isolate is
+// created; silently falls back to the stock snapshot when the blob is not
+// shipped next to the binary.
+void LoadBootstrapSnapshot() {
+  base::FilePath module_dir;
+  if (!base::PathService::Get(base::DIR_MODULE, &module_dir))
+    return;
+  // The blob has to outlive every isolate created from it.
+  static base::NoDestructor<std::string> snapshot;
+  if (!base::ReadFileToString(
+          module_dir.Append(FILE_PATH_LITERAL("electron_bootstrap_snapshot.bin")),
+          snapshot.get()) ||
+      snapshot->empty()) {
+    return;
+  }
+  static v8::StartupData startup_data;
+  startup_data.data = snapshot->data();
+  startup_data.raw_size = snapshot->size();
+  v8::V8::SetSnapshotDataBlob(&startup_data);
+}
+#endif
+
+}  // namespace
+
 JavascriptEnvironment::JavascriptEnvironment(uv_loop_t* event_loop)
     : isolate_(Initialize(event_loop)),
       isolate_holder_(base::ThreadTaskRunnerHandle::Get(),
@@ -37,11 +98,17 @@ JavascriptEnvironment::JavascriptEnvironment(uv_loop_t* event_loop)
 
 JavascriptEnvironment::~JavascriptEnvironment() = default;
 
+// static
+int JavascriptEnvironment::GetNodeWorkerPoolSize() {
+  return g_node_worker_pool_size;
+}
+
 v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
+  StartupMetrics::Get()->Record("javascriptEnvironment");
   auto* cmd = base::CommandLine::ForCurrentProcess();
 
   // --js-flags.
-  std::string js_flags = cmd->GetSwitchValueASCII(switches::kJavaScriptFlags);
+  std::string js_flags = cmd->GetSwitchValueASCII(::switches::kJavaScriptFlags);
   if (!js_flags.empty())
     v8::V8::SetFlagsFromString(js_flags.c_str(), js_flags.size());
 
@@ -50,19 +117,36 @@ v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   auto* tracing_agent = node::CreateAgent();
   auto* tracing_controller = tracing_agent->GetTracingController();
   node::tracing::TraceEventHelper::SetAgent(tracing_agent);
-  platform_ = node::CreatePlatform(
-      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0),
-      tracing_controller);
+  // --node-worker-pool-size overrides the core-derived default, letting
+  // small machines shrink the pool and large ones grow it.
+  int pool_size =
+      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0);
+  int requested = 0;
+  if (base::StringToInt(
+          cmd->GetSwitchValueASCII(switches::kNodeWorkerPoolSize),
+          &requested) &&
+      requested > 0) {
+    pool_size = std::min(requested, kMaxNodeWorkerPoolSize);
+  }
+  g_node_worker_pool_size = pool_size;
+  platform_ = node::CreatePlatform(pool_size, tracing_controller);
 
   v8::V8::InitializePlatform(platform_);
+#if BUILDFLAG(ENABLE_BOOTSTRAP_SNAPSHOT)
+  LoadBootstrapSnapshot();
+#endif
+  // Use the pooling allocator instead of gin's default one: the streaming
+  // paths allocate Buffers at a rate where per-allocation malloc cost and
+  // fragmentation show up in profiles.
   gin::IsolateHolder::Initialize(gin::IsolateHolder::kNonStrictMode,
-                                 gin::ArrayBufferAllocator::SharedInstance(),
+                                 PooledArrayBufferAllocator::SharedInstance(),
                                  nullptr /* external_reference_table */,
                                  false /* create_v8_platform */);
 
   v8::Isolate* isolate = v8::Isolate::Allocate();
   platform_->RegisterIsolate(isolate, event_loop);
 
+  StartupMetrics::Get()->Record("javascriptEnvironmentDone");
   return isolate;
 }
 
@@ -70,15 +154,51 @@ void JavascriptEnvironment::OnMessageLoopCreated() {
   DCHECK(!microtasks_runner_);
   microtasks_runner_ = std::make_unique<MicrotasksRunner>(isolate());
   base::MessageLoopCurrent::Get()->AddTaskObserver(microtasks_runner_.get());
+  // Now that a task runner exists the allocator can trim its freelists on
+  // memory pressure.
+  PooledArrayBufferAllocator::SharedInstance()->StartTrimming();
+
+  pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      base::BindRepeating(&JavascriptEnvironment::OnMemoryPressure,
+                          base::Unretained(this)));
+  idle_notification_timer_.Start(
+      FROM_HERE, kIdleNotificationInterval,
+      base::BindRepeating(&JavascriptEnvironment::OnIdleNotification,
+                          base::Unretained(this)));
+  ResponsivenessWatchdog::GetInstance()->Start(isolate_);
 }
 
 void JavascriptEnvironment::OnMessageLoopDestroying() {
   DCHECK(microtasks_runner_);
+  ResponsivenessWatchdog::GetInstance()->Stop();
+  idle_notification_timer_.Stop();
+  pressure_listener_.reset();
   base::MessageLoopCurrent::Get()->RemoveTaskObserver(microtasks_runner_.get());
   platform_->DrainTasks(isolate_);
   platform_->UnregisterIsolate(isolate_);
 }
 
+void JavascriptEnvironment::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE)
+    return;
+  isolate_->MemoryPressureNotification(
+      level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
+          ? v8::MemoryPressureLevel::kCritical
+          : v8::MemoryPressureLevel::kModerate);
+}
+
+void JavascriptEnvironment::OnIdleNotification() {
+  // Skip the probe while the loop is busy; idle GC steps must not compete
+  // with real tasks. The timer task itself only updates the timestamp after
+  // this callback has run, so an otherwise quiet loop still qualifies.
+  if (base::TimeTicks::Now() - microtasks_runner_->last_task_time() <
+      kIdleQuietThreshold)
+    return;
+  isolate_->IdleNotificationDeadline(platform_->MonotonicallyIncreasingTime() +
+                                     kIdleDeadlineSeconds);
+}
+
 NodeEnvironment::NodeEnvironment(node::Environment* env) : env_(env) {}
 
 NodeEnvironment::~NodeEnvironment() {
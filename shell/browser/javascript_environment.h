@@ -8,6 +8,8 @@
 #include <memory>
 
 #include "base/macros.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/timer/timer.h"
 #include "gin/public/isolate_holder.h"
 #include "uv.h"  // NOLINT(build/include)
 
@@ -25,6 +27,10 @@ class JavascriptEnvironment {
   explicit JavascriptEnvironment(uv_loop_t* event_loop);
   ~JavascriptEnvironment();
 
+  // Worker count the Node/V8 platform pool was created with; 0 before the
+  // environment exists.
+  static int GetNodeWorkerPoolSize();
+
   void OnMessageLoopCreated();
   void OnMessageLoopDestroying();
 
@@ -36,6 +42,16 @@ class JavascriptEnvironment {
 
  private:
   v8::Isolate* Initialize(uv_loop_t* event_loop);
+
+  // Forwards system memory pressure to the isolate so V8 can shrink its
+  // heap while the browser process is under pressure.
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
+  // Gives the isolate a short idle deadline when the message loop has been
+  // quiet, letting V8 run incremental GC steps outside of real work.
+  void OnIdleNotification();
+
   // Leaked on exit.
   node::MultiIsolatePlatform* platform_;
 
@@ -49,6 +65,9 @@ class JavascriptEnvironment {
 
   std::unique_ptr<MicrotasksRunner> microtasks_runner_;
 
+  std::unique_ptr<base::MemoryPressureListener> pressure_listener_;
+  base::RepeatingTimer idle_notification_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(JavascriptEnvironment);
 };
 
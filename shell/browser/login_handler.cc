@@ -4,11 +4,13 @@
 
 #include "shell/browser/login_handler.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/no_destructor.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -78,6 +80,30 @@ void FillRequestDetails(base::DictionaryValue* details,
   details->Set("headers", std::move(headers_value));
 }
 
+std::string MakeChallengeKey(const net::AuthChallengeInfo& auth_info) {
+  std::string key = auth_info.challenger.Serialize() + '|' +
+                    auth_info.scheme + '|' + auth_info.realm;
+  if (auth_info.is_proxy)
+    key += "|proxy";
+  return key;
+}
+
+// Challenges currently waiting on a JS answer, keyed by challenge. Only
+// the first handler for a key raises a login event; the rest attach to
+// it as followers. IO thread only.
+std::map<std::string, LoginHandler*>& GetInFlightHandlers() {
+  static base::NoDestructor<std::map<std::string, LoginHandler*>> handlers;
+  return *handlers;
+}
+
+// Credentials the app asked to remember, keyed by challenge. Answers
+// later identical challenges without leaving the IO thread. IO thread
+// only.
+std::map<std::string, net::AuthCredentials>& GetCredentialCache() {
+  static base::NoDestructor<std::map<std::string, net::AuthCredentials>> cache;
+  return *cache;
+}
+
 }  // namespace
 
 LoginHandler::LoginHandler(net::URLRequest* request,
@@ -90,6 +116,27 @@ LoginHandler::LoginHandler(net::URLRequest* request,
       weak_factory_(this) {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
 
+  challenge_key_ = MakeChallengeKey(*auth_info_);
+
+  // Remembered credentials answer the challenge synchronously, with no
+  // JS round-trip and no prompt.
+  auto cached = GetCredentialCache().find(challenge_key_);
+  if (cached != GetCredentialCache().end()) {
+    DoLogin(cached->second.username(), cached->second.password(), false);
+    return;
+  }
+
+  // When an identical challenge is already waiting on JS, ride along
+  // with it instead of raising another login event; a re-challenging
+  // proxy turns dozens of parallel requests into one prompt.
+  auto& in_flight = GetInFlightHandlers();
+  auto leader = in_flight.find(challenge_key_);
+  if (leader != in_flight.end()) {
+    leader->second->followers_.push_back(base::WrapRefCounted(this));
+    return;
+  }
+  in_flight[challenge_key_] = this;
+
   std::unique_ptr<base::DictionaryValue> request_details(
       new base::DictionaryValue);
   // TODO(zcbenz): Use the converters from net_converter.
@@ -110,13 +157,14 @@ LoginHandler::LoginHandler(net::URLRequest* request,
 LoginHandler::~LoginHandler() = default;
 
 void LoginHandler::Login(const base::string16& username,
-                         const base::string16& password) {
+                         const base::string16& password,
+                         bool remember) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
   base::PostTask(
       FROM_HERE, {BrowserThread::IO},
       base::BindOnce(&LoginHandler::DoLogin, weak_factory_.GetWeakPtr(),
-                     username, password));
+                     username, password, remember));
 }
 
 void LoginHandler::CancelAuth() {
@@ -128,6 +176,13 @@ void LoginHandler::CancelAuth() {
 }
 
 void LoginHandler::NotifyRequestDestroyed() {
+  RemoveFromInFlight();
+  // If this handler was leading a coalesced challenge, its followers
+  // will never get an answer; fall back to the default of cancelling.
+  for (const auto& follower : followers_)
+    follower->DoCancelAuth();
+  followers_.clear();
+
   // auth_callback_.Reset();
   credentials_ = nullptr;
   weak_factory_.InvalidateWeakPtrs();
@@ -143,6 +198,10 @@ content::WebContents* LoginHandler::GetWebContents() const {
 
 void LoginHandler::DoCancelAuth() {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  RemoveFromInFlight();
+  for (const auto& follower : followers_)
+    follower->DoCancelAuth();
+  followers_.clear();
   /*
   if (!auth_callback_.is_null())
     std::move(auth_callback_)
@@ -151,8 +210,16 @@ void LoginHandler::DoCancelAuth() {
 }
 
 void LoginHandler::DoLogin(const base::string16& username,
-                           const base::string16& password) {
+                           const base::string16& password,
+                           bool remember) {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  if (remember)
+    GetCredentialCache()[challenge_key_] =
+        net::AuthCredentials(username, password);
+  RemoveFromInFlight();
+  for (const auto& follower : followers_)
+    follower->DoLogin(username, password, false);
+  followers_.clear();
   /*
   if (!auth_callback_.is_null()) {
     credentials_->Set(username, password);
@@ -162,4 +229,12 @@ void LoginHandler::DoLogin(const base::string16& username,
   */
 }
 
+void LoginHandler::RemoveFromInFlight() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  auto& in_flight = GetInFlightHandlers();
+  auto iter = in_flight.find(challenge_key_);
+  if (iter != in_flight.end() && iter->second == this)
+    in_flight.erase(iter);
+}
+
 }  // namespace electron
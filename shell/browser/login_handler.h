@@ -6,6 +6,8 @@
 #define SHELL_BROWSER_LOGIN_HANDLER_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/memory/ref_counted.h"
@@ -36,7 +38,12 @@ class LoginHandler : public base::RefCountedThreadSafe<LoginHandler> {
   void NotifyRequestDestroyed();
 
   // Login with |username| and |password|, must be called on UI thread.
-  void Login(const base::string16& username, const base::string16& password);
+  // When |remember| is true the credentials are cached for the challenge's
+  // (origin, realm) so later identical challenges are answered on the IO
+  // thread without raising another login event.
+  void Login(const base::string16& username,
+             const base::string16& password,
+             bool remember = false);
 
   // Returns the WebContents associated with the request, must be called on UI
   // thread.
@@ -52,11 +59,25 @@ class LoginHandler : public base::RefCountedThreadSafe<LoginHandler> {
 
   // Must be called on IO thread.
   void DoCancelAuth();
-  void DoLogin(const base::string16& username, const base::string16& password);
+  void DoLogin(const base::string16& username,
+               const base::string16& password,
+               bool remember);
+
+  // Removes this handler from the in-flight challenge map if it is the
+  // leader for its challenge key. Must be called on IO thread.
+  void RemoveFromInFlight();
 
   // Credentials to be used for the auth.
   net::AuthCredentials* credentials_;
 
+  // Identifies the challenge: challenger origin, scheme, realm and
+  // whether it came from a proxy.
+  std::string challenge_key_;
+
+  // Concurrent handlers for the same challenge, coalesced behind this
+  // one; they are resolved with whatever answer this handler receives.
+  std::vector<scoped_refptr<LoginHandler>> followers_;
+
   // Who/where/what asked for the authentication.
   std::unique_ptr<const net::AuthChallengeInfo> auth_info_;
 
@@ -20,7 +20,10 @@ class MediaCaptureDevicesDispatcher : public content::MediaObserver {
  public:
   static MediaCaptureDevicesDispatcher* GetInstance();
 
-  // Methods for observers. Called on UI thread.
+  // Methods for observers. Called on UI thread. These return references into
+  // the lists cached by content::MediaCaptureDevices, which the media stream
+  // manager refreshes on OS device-change notifications — calling them does
+  // not trigger a new enumeration.
   const blink::MediaStreamDevices& GetAudioCaptureDevices();
   const blink::MediaStreamDevices& GetVideoCaptureDevices();
 
@@ -4,6 +4,7 @@
 
 #include "shell/browser/media/media_device_id_salt.h"
 
+#include "base/bind.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_context.h"
@@ -22,11 +23,15 @@ const char kMediaDeviceIdSalt[] = "electron.media.device_id_salt";
 MediaDeviceIDSalt::MediaDeviceIDSalt(PrefService* pref_service) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  media_device_id_salt_.Init(kMediaDeviceIdSalt, pref_service);
+  media_device_id_salt_.Init(
+      kMediaDeviceIdSalt, pref_service,
+      base::BindRepeating(&MediaDeviceIDSalt::OnSaltChanged,
+                          base::Unretained(this)));
   if (media_device_id_salt_.GetValue().empty()) {
     media_device_id_salt_.SetValue(
         content::BrowserContext::CreateRandomMediaDeviceIDSalt());
   }
+  cached_salt_ = media_device_id_salt_.GetValue();
 }
 
 MediaDeviceIDSalt::~MediaDeviceIDSalt() {
@@ -34,9 +39,14 @@ MediaDeviceIDSalt::~MediaDeviceIDSalt() {
   media_device_id_salt_.Destroy();
 }
 
-std::string MediaDeviceIDSalt::GetSalt() {
+const std::string& MediaDeviceIDSalt::GetSalt() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  return media_device_id_salt_.GetValue();
+  return cached_salt_;
+}
+
+void MediaDeviceIDSalt::OnSaltChanged(const std::string& pref_name) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  cached_salt_ = media_device_id_salt_.GetValue();
 }
 
 // static
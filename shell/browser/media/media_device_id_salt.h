@@ -23,14 +23,21 @@ class MediaDeviceIDSalt {
   explicit MediaDeviceIDSalt(PrefService* pref_service);
   ~MediaDeviceIDSalt();
 
-  std::string GetSalt();
+  const std::string& GetSalt();
 
   static void RegisterPrefs(PrefRegistrySimple* pref_registry);
   static void Reset(PrefService* pref_service);
 
  private:
+  // Re-fills |cached_salt_| when the backing pref changes (Reset()).
+  void OnSaltChanged(const std::string& pref_name);
+
   StringPrefMember media_device_id_salt_;
 
+  // Media requests ask for the salt on every device-ID hash; serve them from
+  // this copy so steady-state queries never touch the pref member.
+  std::string cached_salt_;
+
   DISALLOW_COPY_AND_ASSIGN(MediaDeviceIDSalt);
 };
 
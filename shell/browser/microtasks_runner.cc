@@ -1,20 +1,77 @@
-
 // Copyright (c) 2018 GitHub, Inc.
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
 #include "shell/browser/microtasks_runner.h"
+
+#include "base/bind.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "v8/include/v8.h"
 
 namespace electron {
 
+namespace {
+
+// Only touched from the browser main thread, where the single
+// MicrotasksRunner instance lives.
+MicrotasksRunner::Metrics g_metrics;
+base::TimeDelta g_checkpoint_budget;
+
+}  // namespace
+
 MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate) : isolate_(isolate) {}
 
+MicrotasksRunner::~MicrotasksRunner() = default;
+
+// static
+void MicrotasksRunner::SetCheckpointBudget(base::TimeDelta budget) {
+  g_checkpoint_budget = budget;
+}
+
+// static
+const MicrotasksRunner::Metrics& MicrotasksRunner::GetMetrics() {
+  return g_metrics;
+}
+
 void MicrotasksRunner::WillProcessTask(const base::PendingTask& pending_task) {}
 
 void MicrotasksRunner::DidProcessTask(const base::PendingTask& pending_task) {
-  v8::Isolate::Scope scope(isolate_);
-  v8::MicrotasksScope::PerformCheckpoint(isolate_);
+  last_task_time_ = base::TimeTicks::Now();
+  // When a checkpoint went over budget, its continuation task flushes the
+  // queue instead; skipping the inline checkpoint here coalesces the
+  // microtasks of intermediate tasks into that flush.
+  if (checkpoint_deferred_pending_)
+    return;
+  RunCheckpoint();
+}
+
+void MicrotasksRunner::RunCheckpoint() {
+  base::TimeTicks start = base::TimeTicks::Now();
+  {
+    v8::Isolate::Scope scope(isolate_);
+    v8::MicrotasksScope::PerformCheckpoint(isolate_);
+  }
+  base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+
+  g_metrics.checkpoint_count++;
+  g_metrics.total_time += elapsed;
+  if (elapsed > g_metrics.max_time)
+    g_metrics.max_time = elapsed;
+
+  if (g_checkpoint_budget.is_zero() || elapsed <= g_checkpoint_budget)
+    return;
+
+  g_metrics.over_budget_count++;
+  g_metrics.deferred_count++;
+  checkpoint_deferred_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&MicrotasksRunner::RunDeferredCheckpoint,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void MicrotasksRunner::RunDeferredCheckpoint() {
+  checkpoint_deferred_pending_ = false;
+  RunCheckpoint();
 }
 
 }  // namespace electron
@@ -5,7 +5,11 @@
 #ifndef SHELL_BROWSER_MICROTASKS_RUNNER_H_
 #define SHELL_BROWSER_MICROTASKS_RUNNER_H_
 
+#include <cstdint>
+
+#include "base/memory/weak_ptr.h"
 #include "base/task/task_observer.h"
+#include "base/time/time.h"
 
 namespace v8 {
 class Isolate;
@@ -21,14 +25,49 @@ namespace electron {
 // microtasks.
 class MicrotasksRunner : public base::TaskObserver {
  public:
+  // Accumulated checkpoint statistics for the browser process, readable from
+  // the main thread via app.getMicrotaskMetrics().
+  struct Metrics {
+    uint64_t checkpoint_count = 0;
+    base::TimeDelta total_time;
+    base::TimeDelta max_time;
+    uint64_t over_budget_count = 0;
+    uint64_t deferred_count = 0;
+  };
+
   explicit MicrotasksRunner(v8::Isolate* isolate);
+  ~MicrotasksRunner() override;
+
+  // Sets the time a single checkpoint may take before further checkpoints
+  // are deferred to a posted continuation task, letting the message pump
+  // service pending native work (input, painting) between flushes. Zero (the
+  // default) disables deferral. V8 drains the whole queue once a checkpoint
+  // starts, so enforcement kicks in from the next checkpoint on.
+  static void SetCheckpointBudget(base::TimeDelta budget);
+
+  static const Metrics& GetMetrics();
+
+  // When the last main-thread task finished; used by JavascriptEnvironment
+  // to detect quiet phases of the message loop.
+  base::TimeTicks last_task_time() const { return last_task_time_; }
 
   // base::TaskObserver
   void WillProcessTask(const base::PendingTask& pending_task) override;
   void DidProcessTask(const base::PendingTask& pending_task) override;
 
  private:
+  void RunCheckpoint();
+  void RunDeferredCheckpoint();
+
   v8::Isolate* isolate_;
+
+  // Whether a continuation task that will run the next checkpoint is already
+  // queued; inline end-of-task checkpoints are skipped while it is pending.
+  bool checkpoint_deferred_pending_ = false;
+
+  base::TimeTicks last_task_time_;
+
+  base::WeakPtrFactory<MicrotasksRunner> weak_factory_{this};
 };
 
 }  // namespace electron
@@ -46,6 +46,12 @@ class NativeBrowserView {
   virtual gfx::Rect GetBounds() = 0;
   virtual void SetBackgroundColor(SkColor color) = 0;
 
+  // Shows or hides the view while keeping it attached to the window, so
+  // hiding does not tear down the view hierarchy and showing again does not
+  // force a re-layout and re-raster like a remove/add cycle does.
+  virtual void SetVisible(bool visible) = 0;
+  virtual bool IsVisible() = 0;
+
   // Called when the window needs to update its draggable region.
   virtual void UpdateDraggableRegions(
       const std::vector<gfx::Rect>& system_drag_exclude_areas) {}
@@ -23,6 +23,8 @@ class NativeBrowserViewMac : public NativeBrowserView {
   void SetBounds(const gfx::Rect& bounds) override;
   gfx::Rect GetBounds() override;
   void SetBackgroundColor(SkColor color) override;
+  void SetVisible(bool visible) override;
+  bool IsVisible() override;
 
   void UpdateDraggableRegions(
       const std::vector<gfx::Rect>& system_drag_exclude_areas) override;
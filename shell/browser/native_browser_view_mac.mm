@@ -212,6 +212,18 @@ gfx::Rect NativeBrowserViewMac::GetBounds() {
       view.frame.size.width, view.frame.size.height);
 }
 
+void NativeBrowserViewMac::SetVisible(bool visible) {
+  NSView* view =
+      GetInspectableWebContentsView()->GetNativeView().GetNativeNSView();
+  [view setHidden:!visible];
+}
+
+bool NativeBrowserViewMac::IsVisible() {
+  NSView* view =
+      GetInspectableWebContentsView()->GetNativeView().GetNativeNSView();
+  return ![view isHidden];
+}
+
 void NativeBrowserViewMac::SetBackgroundColor(SkColor color) {
   auto* view =
       GetInspectableWebContentsView()->GetNativeView().GetNativeNSView();
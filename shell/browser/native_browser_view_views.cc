@@ -101,6 +101,14 @@ gfx::Rect NativeBrowserViewViews::GetBounds() {
   return GetInspectableWebContentsView()->GetView()->bounds();
 }
 
+void NativeBrowserViewViews::SetVisible(bool visible) {
+  GetInspectableWebContentsView()->GetView()->SetVisible(visible);
+}
+
+bool NativeBrowserViewViews::IsVisible() {
+  return GetInspectableWebContentsView()->GetView()->GetVisible();
+}
+
 void NativeBrowserViewViews::SetBackgroundColor(SkColor color) {
   auto* view = GetInspectableWebContentsView()->GetView();
   view->SetBackground(views::CreateSolidBackground(color));
@@ -26,6 +26,8 @@ class NativeBrowserViewViews : public NativeBrowserView {
   void SetBounds(const gfx::Rect& bounds) override;
   gfx::Rect GetBounds() override;
   void SetBackgroundColor(SkColor color) override;
+  void SetVisible(bool visible) override;
+  bool IsVisible() override;
 
  private:
   void ResetAutoResizeProportions();
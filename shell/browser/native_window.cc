@@ -20,6 +20,8 @@
 #include "ui/views/widget/widget.h"
 
 #if defined(OS_WIN)
+#include <windows.h>
+
 #include "ui/base/win/shell.h"
 #include "ui/display/win/screen_win.h"
 #endif
@@ -601,6 +603,68 @@ std::string NativeWindow::GetAccessibleTitle() {
   return base::UTF16ToUTF8(accessible_title_);
 }
 
+namespace {
+
+NativeWindowGeometryBatch* g_geometry_batch = nullptr;
+
+}  // namespace
+
+NativeWindowGeometryBatch::NativeWindowGeometryBatch() {
+  DCHECK(!g_geometry_batch) << "Geometry batches can not be nested";
+  g_geometry_batch = this;
+}
+
+NativeWindowGeometryBatch::~NativeWindowGeometryBatch() {
+  // Clear the active batch first so the SetBounds calls below are applied
+  // instead of being recorded again.
+  g_geometry_batch = nullptr;
+
+#if defined(OS_WIN)
+  // Move all windows in one DeferWindowPos transaction, so the system only
+  // runs a single layout pass. Non-resizable windows pin their minimum and
+  // maximum size to the bounds and must go through the regular path.
+  HDWP hdwp = BeginDeferWindowPos(static_cast<int>(pending_.size()));
+  for (const auto& entry : pending_) {
+    NativeWindow* window = entry.first.get();
+    if (!window)
+      continue;
+    if (hdwp && window->IsResizable()) {
+      gfx::Rect screen_rect = display::win::ScreenWin::DIPToScreenRect(
+          window->GetAcceleratedWidget(), entry.second);
+      hdwp = DeferWindowPos(hdwp, window->GetAcceleratedWidget(), nullptr,
+                            screen_rect.x(), screen_rect.y(),
+                            screen_rect.width(), screen_rect.height(),
+                            SWP_NOZORDER | SWP_NOACTIVATE);
+    } else {
+      window->SetBounds(entry.second);
+    }
+  }
+  if (hdwp)
+    EndDeferWindowPos(hdwp);
+#else
+  for (const auto& entry : pending_) {
+    if (entry.first)
+      entry.first->SetBounds(entry.second);
+  }
+#endif
+}
+
+// static
+NativeWindowGeometryBatch* NativeWindowGeometryBatch::current() {
+  return g_geometry_batch;
+}
+
+void NativeWindowGeometryBatch::SetPendingBounds(NativeWindow* window,
+                                                 const gfx::Rect& bounds) {
+  for (auto& entry : pending_) {
+    if (entry.first.get() == window) {
+      entry.second = bounds;
+      return;
+    }
+  }
+  pending_.emplace_back(window->GetWeakPtr(), bounds);
+}
+
 // static
 void NativeWindowRelay::CreateForWebContents(
     content::WebContents* web_contents,
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
@@ -371,6 +372,28 @@ class NativeWindow : public base::SupportsUserData,
   DISALLOW_COPY_AND_ASSIGN(NativeWindow);
 };
 
+// Collects SetBounds calls made while an instance is in scope and applies
+// them all when the scope closes — in a single DeferWindowPos transaction on
+// Windows, sequentially elsewhere. This avoids intermediate layout passes
+// when rearranging several windows at once.
+class NativeWindowGeometryBatch {
+ public:
+  NativeWindowGeometryBatch();
+  ~NativeWindowGeometryBatch();
+
+  // The active batch, or nullptr when bounds should be applied directly.
+  static NativeWindowGeometryBatch* current();
+
+  // Records |bounds| as the pending geometry for |window|, replacing any
+  // earlier pending bounds for the same window.
+  void SetPendingBounds(NativeWindow* window, const gfx::Rect& bounds);
+
+ private:
+  std::vector<std::pair<base::WeakPtr<NativeWindow>, gfx::Rect>> pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(NativeWindowGeometryBatch);
+};
+
 // This class provides a hook to get a NativeWindow from a WebContents.
 class NativeWindowRelay
     : public content::WebContentsUserData<NativeWindowRelay> {
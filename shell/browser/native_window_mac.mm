@@ -707,6 +707,12 @@ bool NativeWindowMac::IsFullscreen() const {
 }
 
 void NativeWindowMac::SetBounds(const gfx::Rect& bounds, bool animate) {
+  NativeWindowGeometryBatch* batch = NativeWindowGeometryBatch::current();
+  if (batch && !animate) {
+    batch->SetPendingBounds(this, bounds);
+    return;
+  }
+
   // Do nothing if in fullscreen mode.
   if (IsFullscreen())
     return;
@@ -585,6 +585,12 @@ bool NativeWindowViews::IsFullscreen() const {
 }
 
 void NativeWindowViews::SetBounds(const gfx::Rect& bounds, bool animate) {
+  NativeWindowGeometryBatch* batch = NativeWindowGeometryBatch::current();
+  if (batch && !animate) {
+    batch->SetPendingBounds(this, bounds);
+    return;
+  }
+
 #if defined(OS_WIN) || defined(USE_X11)
   // On Linux and Windows the minimum and maximum size should be updated with
   // window size when window is not resizable.
@@ -1252,6 +1258,28 @@ gfx::Rect NativeWindowViews::WindowBoundsToContentBounds(
 void NativeWindowViews::UpdateDraggableRegions(
     std::unique_ptr<SkRegion> region) {
   draggable_region_ = std::move(region);
+  last_draggable_hit_rect_ = SkIRect::MakeEmpty();
+}
+
+bool NativeWindowViews::IsPointInDraggableRegion(
+    const gfx::Point& point) const {
+  if (!draggable_region_)
+    return false;
+  // Continuous mouse moves usually stay within the rectangle hit last time,
+  // answering from it avoids walking the region's spans for every event.
+  if (last_draggable_hit_rect_.contains(point.x(), point.y()))
+    return true;
+  if (!draggable_region_->contains(point.x(), point.y())) {
+    last_draggable_hit_rect_ = SkIRect::MakeEmpty();
+    return false;
+  }
+  for (SkRegion::Iterator it(*draggable_region_); !it.done(); it.next()) {
+    if (it.rect().contains(point.x(), point.y())) {
+      last_draggable_hit_rect_ = it.rect();
+      break;
+    }
+  }
+  return true;
 }
 
 #if defined(OS_WIN)
@@ -1368,8 +1396,7 @@ bool NativeWindowViews::ShouldDescendIntoChildForEventHandling(
     gfx::NativeView child,
     const gfx::Point& location) {
   // App window should claim mouse events that fall within the draggable region.
-  if (draggable_region() &&
-      draggable_region()->contains(location.x(), location.y()))
+  if (IsPointInDraggableRegion(location))
     return false;
 
   // And the events on border for dragging resizable frameless window.
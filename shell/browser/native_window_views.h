@@ -12,6 +12,7 @@
 #include <string>
 #include <tuple>
 
+#include "third_party/skia/include/core/SkRect.h"
 #include "ui/views/widget/widget_observer.h"
 
 #if defined(OS_WIN)
@@ -155,7 +156,9 @@ class NativeWindowViews : public NativeWindow,
   void SetIcon(const gfx::ImageSkia& icon);
 #endif
 
-  SkRegion* draggable_region() const { return draggable_region_.get(); }
+  // Whether |point| falls inside the draggable region. Caches the last hit
+  // rectangle so continuous mouse moves within one region short-circuit.
+  bool IsPointInDraggableRegion(const gfx::Point& point) const;
 
 #if defined(OS_WIN)
   TaskbarHost& taskbar_host() { return taskbar_host_; }
@@ -282,6 +285,10 @@ class NativeWindowViews : public NativeWindow,
   // has to been explicitly provided.
   std::unique_ptr<SkRegion> draggable_region_;  // used in custom drag.
 
+  // The rectangle of |draggable_region_| that contained the last hit tested
+  // point, empty when the last point missed the region.
+  mutable SkIRect last_draggable_hit_rect_ = SkIRect::MakeEmpty();
+
   // Whether the window should be enabled based on user calls to SetEnabled()
   bool is_enabled_ = true;
   // How many modal children this window has;
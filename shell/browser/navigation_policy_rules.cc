@@ -0,0 +1,30 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/navigation_policy_rules.h"
+
+#include <utility>
+
+#include "url/gurl.h"
+
+namespace electron {
+
+NavigationPolicyRules::NavigationPolicyRules() = default;
+
+NavigationPolicyRules::~NavigationPolicyRules() = default;
+
+void NavigationPolicyRules::SetRules(std::vector<Rule> rules) {
+  rules_ = std::move(rules);
+}
+
+NavigationPolicyRules::Policy NavigationPolicyRules::Evaluate(
+    const GURL& url) const {
+  for (const Rule& rule : rules_) {
+    if (rule.pattern.MatchesURL(url))
+      return rule.policy;
+  }
+  return Policy::kDeferToJS;
+}
+
+}  // namespace electron
@@ -0,0 +1,54 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_NAVIGATION_POLICY_RULES_H_
+#define SHELL_BROWSER_NAVIGATION_POLICY_RULES_H_
+
+#include <vector>
+
+#include "base/macros.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace electron {
+
+// Declarative navigation rules for a WebContents, evaluated synchronously
+// before the will-navigate/will-redirect events are emitted. When an app's
+// handler is a static allow/deny list, expressing it as rules keeps the
+// common case from deferring the navigation into JS at all.
+class NavigationPolicyRules {
+ public:
+  enum class Policy {
+    kAllow,      // Let the navigation proceed, skipping the JS event.
+    kDeny,       // Cancel the navigation, skipping the JS event.
+    kDeferToJS,  // Fall through to the usual JS event.
+  };
+
+  struct Rule {
+    URLPattern pattern;
+    Policy policy;
+  };
+
+  NavigationPolicyRules();
+  ~NavigationPolicyRules();
+
+  // Replaces the rule set; an empty vector removes all rules.
+  void SetRules(std::vector<Rule> rules);
+
+  bool empty() const { return rules_.empty(); }
+
+  // Returns the policy of the first rule matching |url|, or kDeferToJS
+  // when nothing matches.
+  Policy Evaluate(const GURL& url) const;
+
+ private:
+  std::vector<Rule> rules_;
+
+  DISALLOW_COPY_AND_ASSIGN(NavigationPolicyRules);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_NAVIGATION_POLICY_RULES_H_
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/memory_mapped_file.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/post_task.h"
 #include "content/public/browser/file_url_loader.h"
@@ -47,6 +48,95 @@ net::Error ConvertMojoResultToNetError(MojoResult result) {
 
 constexpr size_t kDefaultFileUrlPipeSize = 65536;
 
+// Serves content that was decompressed into memory up front (compressed
+// asar entries), with the same range semantics as the other sources.
+class InMemoryDataSource : public mojo::DataPipeProducer::DataSource {
+ public:
+  explicit InMemoryDataSource(std::string data)
+      : data_(std::move(data)), end_offset_(data_.size()) {}
+  ~InMemoryDataSource() override = default;
+
+  void SetRange(uint64_t start, uint64_t end) {
+    start_offset_ = start;
+    end_offset_ = end;
+  }
+
+  // mojo::DataPipeProducer::DataSource:
+  uint64_t GetLength() const override { return end_offset_ - start_offset_; }
+
+  ReadResult Read(uint64_t offset, base::span<char> buffer) override {
+    ReadResult result;
+    uint64_t readable_size = GetLength();
+    if (offset > readable_size) {
+      result.result = MOJO_RESULT_OUT_OF_RANGE;
+      return result;
+    }
+    size_t copyable_size = static_cast<size_t>(std::min(
+        readable_size - offset, static_cast<uint64_t>(buffer.size())));
+    memcpy(buffer.data(), data_.data() + start_offset_ + offset,
+           copyable_size);
+    result.bytes_read = copyable_size;
+    return result;
+  }
+
+ private:
+  std::string data_;
+  uint64_t start_offset_ = 0;
+  uint64_t end_offset_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(InMemoryDataSource);
+};
+
+// Serves a packed file straight out of a memory mapping of the archive, so
+// chunks go from the page cache into the data pipe's shared buffer with no
+// read() syscalls or intermediate copy loops. Follows the same range
+// semantics as |mojo::FileDataSource|: offsets passed to Read() are
+// relative to the start of the configured range.
+class MemoryMappedDataSource : public mojo::DataPipeProducer::DataSource {
+ public:
+  MemoryMappedDataSource(base::File file, uint64_t offset, uint64_t size) {
+    valid_ = mapping_.Initialize(
+        std::move(file),
+        {static_cast<int64_t>(offset), static_cast<size_t>(size)});
+    if (valid_)
+      end_offset_ = size;
+  }
+  ~MemoryMappedDataSource() override = default;
+
+  bool IsValid() const { return valid_; }
+
+  void SetRange(uint64_t start, uint64_t end) {
+    start_offset_ = start;
+    end_offset_ = end;
+  }
+
+  // mojo::DataPipeProducer::DataSource:
+  uint64_t GetLength() const override { return end_offset_ - start_offset_; }
+
+  ReadResult Read(uint64_t offset, base::span<char> buffer) override {
+    ReadResult result;
+    uint64_t readable_size = GetLength();
+    if (offset > readable_size) {
+      result.result = MOJO_RESULT_OUT_OF_RANGE;
+      return result;
+    }
+    size_t copyable_size = static_cast<size_t>(std::min(
+        readable_size - offset, static_cast<uint64_t>(buffer.size())));
+    memcpy(buffer.data(), mapping_.data() + start_offset_ + offset,
+           copyable_size);
+    result.bytes_read = copyable_size;
+    return result;
+  }
+
+ private:
+  base::MemoryMappedFile mapping_;
+  bool valid_ = false;
+  uint64_t start_offset_ = 0;
+  uint64_t end_offset_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(MemoryMappedDataSource);
+};
+
 // Because this makes things simpler.
 static_assert(kDefaultFileUrlPipeSize >= net::kMaxBytesToSniff,
               "Default file data pipe size must be at least as large as a MIME-"
@@ -138,13 +228,48 @@ class AsarURLLoader : public network::mojom::URLLoader {
     // requests at the same time.
     base::File file(info.unpacked ? real_path : archive->path(),
                     base::File::FLAG_OPEN | base::File::FLAG_READ);
-    auto file_data_source =
-        std::make_unique<mojo::FileDataSource>(std::move(file));
-    mojo::DataPipeProducer::DataSource* data_source = file_data_source.get();
+
+    // For packed files serve from a mapping of the archive region instead of
+    // a read loop; fall back to file reads if the mapping fails. Since the
+    // mapping covers exactly the file's region, offsets into it are relative
+    // rather than absolute archive offsets.
+    std::unique_ptr<mojo::FileDataSource> file_data_source;
+    std::unique_ptr<MemoryMappedDataSource> mmap_data_source;
+    std::unique_ptr<InMemoryDataSource> memory_data_source;
+    uint64_t source_offset = info.offset;
+    if (info.compressed) {
+      // Compressed entries are decompressed up front and served from
+      // memory; |info.size| already holds the uncompressed size that the
+      // rest of this method works with.
+      std::string contents;
+      if (!archive->DecompressToString(info, &contents)) {
+        OnClientComplete(net::ERR_FILE_NOT_FOUND);
+        return;
+      }
+      memory_data_source = std::make_unique<InMemoryDataSource>(
+          std::move(contents));
+      source_offset = 0;
+    } else if (!info.unpacked) {
+      auto source = std::make_unique<MemoryMappedDataSource>(
+          file.Duplicate(), info.offset, info.size);
+      if (source->IsValid()) {
+        mmap_data_source = std::move(source);
+        source_offset = 0;
+      }
+    }
+    if (!mmap_data_source && !memory_data_source)
+      file_data_source = std::make_unique<mojo::FileDataSource>(std::move(file));
+    mojo::DataPipeProducer::DataSource* data_source;
+    if (memory_data_source)
+      data_source = memory_data_source.get();
+    else if (mmap_data_source)
+      data_source = mmap_data_source.get();
+    else
+      data_source = file_data_source.get();
 
     std::vector<char> initial_read_buffer(net::kMaxBytesToSniff);
     auto read_result =
-        data_source->Read(info.offset, base::span<char>(initial_read_buffer));
+        data_source->Read(source_offset, base::span<char>(initial_read_buffer));
     if (read_result.result != MOJO_RESULT_OK) {
       OnClientComplete(ConvertMojoResultToNetError(read_result.result));
       return;
@@ -233,14 +358,27 @@ class AsarURLLoader : public network::mojom::URLLoader {
     // (i.e., no range request) this Seek is effectively a no-op.
     //
     // Note that in Electron we also need to add file offset.
-    file_data_source->SetRange(
-        first_byte_to_send + info.offset,
-        first_byte_to_send + info.offset + total_bytes_to_send);
+    std::unique_ptr<mojo::DataPipeProducer::DataSource> readable_data_source;
+    if (memory_data_source) {
+      memory_data_source->SetRange(
+          first_byte_to_send, first_byte_to_send + total_bytes_to_send);
+      readable_data_source = std::move(memory_data_source);
+    } else if (mmap_data_source) {
+      mmap_data_source->SetRange(first_byte_to_send + source_offset,
+                                 first_byte_to_send + source_offset +
+                                     total_bytes_to_send);
+      readable_data_source = std::move(mmap_data_source);
+    } else {
+      file_data_source->SetRange(
+          first_byte_to_send + source_offset,
+          first_byte_to_send + source_offset + total_bytes_to_send);
+      readable_data_source = std::move(file_data_source);
+    }
 
     data_producer_ = std::make_unique<mojo::DataPipeProducer>(
         std::move(pipe.producer_handle));
     data_producer_->Write(
-        std::move(file_data_source),
+        std::move(readable_data_source),
         base::BindOnce(&AsarURLLoader::OnFileWritten, base::Unretained(this)));
   }
 
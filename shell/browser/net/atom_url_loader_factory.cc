@@ -4,18 +4,24 @@
 
 #include "shell/browser/net/atom_url_loader_factory.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "base/files/file_util.h"
 #include "base/guid.h"
+#include "base/task/post_task.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/binding.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
 #include "mojo/public/cpp/system/string_data_source.h"
+#include "net/base/escape.h"
 #include "net/base/filename_util.h"
+#include "net/http/http_request_headers.h"
 #include "net/http/http_status_code.h"
+#include "net/http/http_util.h"
 #include "services/network/public/cpp/url_loader_completion_status.h"
 #include "services/network/public/mojom/url_loader_factory.mojom.h"
 #include "shell/browser/api/atom_api_session.h"
@@ -139,6 +145,24 @@ network::ResourceResponseHead ToResponseHead(
   return head;
 }
 
+// Creates a response body pipe sized for |capacity_hint| bytes, so responses
+// that fit complete in a single write without producer stalls. The mojo
+// default of 64 KB is kept as a floor and 2 MB as a ceiling.
+MojoResult CreateSizedDataPipe(size_t capacity_hint,
+                               mojo::ScopedDataPipeProducerHandle* producer,
+                               mojo::ScopedDataPipeConsumerHandle* consumer) {
+  constexpr size_t kMinCapacity = 64 * 1024;
+  constexpr size_t kMaxCapacity = 2 * 1024 * 1024;
+
+  MojoCreateDataPipeOptions options;
+  options.struct_size = sizeof(options);
+  options.flags = MOJO_CREATE_DATA_PIPE_FLAG_NONE;
+  options.element_num_bytes = 1;
+  options.capacity_num_bytes = static_cast<uint32_t>(
+      std::min(std::max(capacity_hint, kMinCapacity), kMaxCapacity));
+  return mojo::CreateDataPipe(&options, producer, consumer);
+}
+
 // Helper to write string to pipe.
 struct WriteData {
   network::mojom::URLLoaderClientPtr client;
@@ -146,6 +170,39 @@ struct WriteData {
   std::unique_ptr<mojo::DataPipeProducer> producer;
 };
 
+// Maximum number of files whose modification time is remembered per static
+// directory factory.
+constexpr size_t kMaxStaticStatCacheSize = 1024;
+
+// How long a cached modification time may answer revalidations before the
+// file is stat'ed again, bounding how long an edited file keeps getting
+// 304s with its old Last-Modified.
+constexpr base::TimeDelta kStaticStatCacheTTL =
+    base::TimeDelta::FromSeconds(5);
+
+// Resolves the path of |url| against |root|, returning an empty path for
+// requests that escape the root directory.
+base::FilePath ResolveStaticPath(const base::FilePath& root, const GURL& url) {
+  std::string path = net::UnescapeBinaryURLComponent(url.path_piece());
+  while (!path.empty() && path.front() == '/')
+    path.erase(0, 1);
+  // Serve the directory index for requests ending with a slash.
+  if (path.empty() || path.back() == '/')
+    path += "index.html";
+  base::FilePath relative_path = base::FilePath::FromUTF8Unsafe(path);
+  if (relative_path.IsAbsolute() || relative_path.ReferencesParent())
+    return base::FilePath();
+  return root.Append(relative_path);
+}
+
+// Reads the modification time of |path|, run off the UI thread.
+base::Time GetFileLastModified(const base::FilePath& path) {
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info))
+    return base::Time();
+  return info.last_modified;
+}
+
 void OnWrite(std::unique_ptr<WriteData> write_data, MojoResult result) {
   if (result != MOJO_RESULT_OK) {
     network::URLLoaderCompletionStatus status(net::ERR_FAILED);
@@ -165,6 +222,9 @@ AtomURLLoaderFactory::AtomURLLoaderFactory(ProtocolType type,
                                            const ProtocolHandler& handler)
     : type_(type), handler_(handler) {}
 
+AtomURLLoaderFactory::AtomURLLoaderFactory(const base::FilePath& static_root)
+    : type_(ProtocolType::kFile), static_root_(static_root) {}
+
 AtomURLLoaderFactory::~AtomURLLoaderFactory() = default;
 
 void AtomURLLoaderFactory::CreateLoaderAndStart(
@@ -176,6 +236,10 @@ void AtomURLLoaderFactory::CreateLoaderAndStart(
     network::mojom::URLLoaderClientPtr client,
     const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!static_root_.empty()) {
+    StartLoadingStaticFile(std::move(loader), request, std::move(client));
+    return;
+  }
   handler_.Run(
       request,
       base::BindOnce(&AtomURLLoaderFactory::StartLoading, std::move(loader),
@@ -188,6 +252,86 @@ void AtomURLLoaderFactory::Clone(
   receivers_.Add(this, std::move(receiver));
 }
 
+void AtomURLLoaderFactory::StartLoadingStaticFile(
+    network::mojom::URLLoaderRequest loader,
+    const network::ResourceRequest& request,
+    network::mojom::URLLoaderClientPtr client) {
+  base::FilePath path = ResolveStaticPath(static_root_, request.url);
+  if (path.empty()) {
+    client->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_FILE_NOT_FOUND));
+    return;
+  }
+
+  // Record (or refresh) the file's modification time off the UI thread.
+  // The stat_time stamp dedupes concurrent stats, and entries past the
+  // TTL are stat'ed again so an edited file stops revalidating with its
+  // old Last-Modified within a few seconds; the stale time keeps serving
+  // until the fresh stat lands.
+  const base::TimeTicks now = base::TimeTicks::Now();
+  auto cached = static_stat_cache_.find(path);
+  if (cached == static_stat_cache_.end()) {
+    if (static_stat_cache_.size() >= kMaxStaticStatCacheSize)
+      static_stat_cache_.clear();
+    cached = static_stat_cache_.emplace(path, StatCacheEntry()).first;
+  }
+  if (cached->second.stat_time.is_null() ||
+      now - cached->second.stat_time >= kStaticStatCacheTTL) {
+    cached->second.stat_time = now;
+    base::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::ThreadPool(), base::MayBlock()},
+        base::BindOnce(&GetFileLastModified, path),
+        base::BindOnce(&AtomURLLoaderFactory::OnStaticFileStat,
+                       weak_factory_.GetWeakPtr(), path));
+  }
+
+  // Answer revalidations from the stat cache so unchanged resources don't
+  // hit the disk on every request. Files inside asar archives fail the
+  // stat, keep a null time and never get a conditional answer.
+  const base::Time last_modified = cached->second.last_modified;
+  std::string if_modified_since;
+  if (!last_modified.is_null() &&
+      request.headers.GetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                                &if_modified_since)) {
+    base::Time threshold;
+    // HTTP dates only carry second resolution, truncate the cached time
+    // before comparing.
+    if (base::Time::FromString(if_modified_since.c_str(), &threshold) &&
+        base::Time::FromTimeT(last_modified.ToTimeT()) <= threshold) {
+      network::ResourceResponseHead head;
+      head.headers =
+          new net::HttpResponseHeaders("HTTP/1.1 304 Not Modified");
+      head.headers->AddHeader(kCORSHeader);
+      client->OnReceiveResponse(head);
+      client->OnComplete(network::URLLoaderCompletionStatus(net::OK));
+      return;
+    }
+  }
+
+  network::ResourceRequest file_request = request;
+  file_request.url = net::FilePathToFileURL(path);
+
+  scoped_refptr<net::HttpResponseHeaders> headers =
+      new net::HttpResponseHeaders("HTTP/1.1 200 OK");
+  headers->AddHeader(kCORSHeader);
+  if (!last_modified.is_null()) {
+    headers->AddHeader("last-modified: " +
+                       net::HttpUtil::TimeFormatHTTP(last_modified));
+  }
+
+  // The asar loader serves both regular files and asar contents, handles
+  // Range requests and determines the MIME type from the file name.
+  asar::CreateAsarURLLoader(file_request, std::move(loader), std::move(client),
+                            headers);
+}
+
+void AtomURLLoaderFactory::OnStaticFileStat(const base::FilePath& path,
+                                            base::Time last_modified) {
+  auto it = static_stat_cache_.find(path);
+  if (it != static_stat_cache_.end())
+    it->second.last_modified = last_modified;
+}
+
 // static
 void AtomURLLoaderFactory::StartLoading(
     network::mojom::URLLoaderRequest loader,
@@ -445,8 +589,16 @@ void AtomURLLoaderFactory::StartLoadingStream(
     return;
   }
 
+  // An explicit pipeCapacity lets protocols that serve large payloads size
+  // the body pipe big enough to keep the producer from stalling.
+  int pipe_capacity = 0;
+  dict.Get("pipeCapacity", &pipe_capacity);
+  if (pipe_capacity < 0)
+    pipe_capacity = 0;
+
   new NodeStreamLoader(std::move(head), std::move(loader), std::move(client),
-                       data.isolate(), data.GetHandle());
+                       data.isolate(), data.GetHandle(),
+                       static_cast<size_t>(pipe_capacity));
 }
 
 // static
@@ -460,7 +612,8 @@ void AtomURLLoaderFactory::SendContents(
   // Code bellow follows the pattern of data_url_loader_factory.cc.
   mojo::ScopedDataPipeProducerHandle producer;
   mojo::ScopedDataPipeConsumerHandle consumer;
-  if (mojo::CreateDataPipe(nullptr, &producer, &consumer) != MOJO_RESULT_OK) {
+  if (CreateSizedDataPipe(data.size(), &producer, &consumer) !=
+      MOJO_RESULT_OK) {
     client->OnComplete(
         network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
     return;
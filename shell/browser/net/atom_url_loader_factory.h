@@ -9,6 +9,9 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
 #include "net/url_request/url_request_job_factory.h"
@@ -40,6 +43,9 @@ using HandlersMap =
 class AtomURLLoaderFactory : public network::mojom::URLLoaderFactory {
  public:
   AtomURLLoaderFactory(ProtocolType type, const ProtocolHandler& handler);
+  // Creates a factory serving files under |static_root| entirely in C++,
+  // without calling back into any JS handler.
+  explicit AtomURLLoaderFactory(const base::FilePath& static_root);
   ~AtomURLLoaderFactory() override;
 
   // network::mojom::URLLoaderFactory:
@@ -67,6 +73,12 @@ class AtomURLLoaderFactory : public network::mojom::URLLoaderFactory {
       gin::Arguments* args);
 
  private:
+  // Serves a request mapped onto |static_root_| without invoking JS.
+  void StartLoadingStaticFile(network::mojom::URLLoaderRequest loader,
+                              const network::ResourceRequest& request,
+                              network::mojom::URLLoaderClientPtr client);
+  void OnStaticFileStat(const base::FilePath& path, base::Time last_modified);
+
   static void StartLoadingBuffer(network::mojom::URLLoaderClientPtr client,
                                  network::ResourceResponseHead head,
                                  const gin_helper::Dictionary& dict);
@@ -106,6 +118,24 @@ class AtomURLLoaderFactory : public network::mojom::URLLoaderFactory {
   ProtocolType type_;
   ProtocolHandler handler_;
 
+  // Root directory for the static mode, empty for handler based factories.
+  base::FilePath static_root_;
+
+  struct StatCacheEntry {
+    // Null while the stat is still pending or when it failed (e.g. files
+    // inside asar archives), in which case no conditional answer is given.
+    base::Time last_modified;
+    // When the stat was last started; entries are re-stat'ed once this
+    // is older than the cache TTL so edits to a served file are noticed.
+    base::TimeTicks stat_time;
+  };
+
+  // Modification times of files already served from |static_root_|, used to
+  // answer If-Modified-Since revalidations with 304 without touching disk.
+  std::map<base::FilePath, StatCacheEntry> static_stat_cache_;
+
+  base::WeakPtrFactory<AtomURLLoaderFactory> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(AtomURLLoaderFactory);
 };
 
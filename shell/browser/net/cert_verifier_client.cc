@@ -6,8 +6,31 @@
 
 #include "shell/browser/net/cert_verifier_client.h"
 
+#include "base/strings/string_number_conversions.h"
+
 namespace electron {
 
+namespace {
+
+// How long a handler verdict stays valid. Long enough to take the JS
+// handler out of the handshake path under connection churn, short enough
+// that a revoked certificate is re-checked promptly.
+constexpr base::TimeDelta kVerdictTTL = base::TimeDelta::FromMinutes(10);
+
+// Bounds the cache; it is rebuilt from handler responses after a clear.
+constexpr size_t kMaxCachedVerdicts = 1024;
+
+std::string MakeCacheKey(const scoped_refptr<net::X509Certificate>& certificate,
+                         const std::string& hostname,
+                         int default_error) {
+  const net::SHA256HashValue chain_hash =
+      certificate->CalculateChainFingerprint256();
+  return base::HexEncode(chain_hash.data, sizeof(chain_hash.data)) + "|" +
+         hostname + "|" + base::NumberToString(default_error);
+}
+
+}  // namespace
+
 VerifyRequestParams::VerifyRequestParams() = default;
 
 VerifyRequestParams::~VerifyRequestParams() = default;
@@ -27,17 +50,37 @@ void CertVerifierClient::Verify(
     int flags,
     const base::Optional<std::string>& ocsp_response,
     VerifyCallback callback) {
+  const std::string cache_key =
+      MakeCacheKey(certificate, hostname, default_error);
+  auto iter = verdict_cache_.find(cache_key);
+  if (iter != verdict_cache_.end()) {
+    if (base::TimeTicks::Now() < iter->second.expiry) {
+      std::move(callback).Run(iter->second.error, default_result);
+      return;
+    }
+    verdict_cache_.erase(iter);
+  }
+
   VerifyRequestParams params;
   params.hostname = hostname;
   params.default_result = net::ErrorToString(default_error);
   params.error_code = default_error;
   params.certificate = certificate;
   cert_verify_proc_.Run(
-      params,
-      base::AdaptCallbackForRepeating(base::BindOnce(
-          [](VerifyCallback callback, const net::CertVerifyResult& result,
-             int err) { std::move(callback).Run(err, result); },
-          std::move(callback), default_result)));
+      params, base::AdaptCallbackForRepeating(base::BindOnce(
+                  &CertVerifierClient::OnVerifyResponse,
+                  weak_factory_.GetWeakPtr(), cache_key, std::move(callback),
+                  default_result)));
+}
+
+void CertVerifierClient::OnVerifyResponse(const std::string& cache_key,
+                                          VerifyCallback callback,
+                                          const net::CertVerifyResult& result,
+                                          int error) {
+  if (verdict_cache_.size() >= kMaxCachedVerdicts)
+    verdict_cache_.clear();
+  verdict_cache_[cache_key] = {base::TimeTicks::Now() + kVerdictTTL, error};
+  std::move(callback).Run(error, result);
 }
 
 }  // namespace electron
@@ -5,8 +5,11 @@
 #ifndef SHELL_BROWSER_NET_CERT_VERIFIER_CLIENT_H_
 #define SHELL_BROWSER_NET_CERT_VERIFIER_CLIENT_H_
 
+#include <map>
 #include <string>
 
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "net/cert/x509_certificate.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 
@@ -42,7 +45,26 @@ class CertVerifierClient : public network::mojom::CertVerifierClient {
               VerifyCallback callback) override;
 
  private:
+  // A verdict from the JS handler, kept until |expiry| so that repeat
+  // verifications of the same chain and hostname skip the JS round-trip.
+  struct CachedVerdict {
+    base::TimeTicks expiry;
+    int error;
+  };
+
+  void OnVerifyResponse(const std::string& cache_key,
+                        VerifyCallback callback,
+                        const net::CertVerifyResult& result,
+                        int error);
+
   CertVerifyProc cert_verify_proc_;
+
+  // Keyed by chain fingerprint, hostname and the default verification
+  // error. Discarded wholesale when the app replaces the verify proc,
+  // since that tears down this client.
+  std::map<std::string, CachedVerdict> verdict_cache_;
+
+  base::WeakPtrFactory<CertVerifierClient> weak_factory_{this};
 };
 
 }  // namespace electron
@@ -4,6 +4,10 @@
 
 #include "shell/browser/net/network_context_service.h"
 
+#include <map>
+#include <string>
+
+#include "base/no_destructor.h"
 #include "chrome/common/chrome_constants.h"
 #include "content/public/browser/network_service_instance.h"
 #include "services/network/network_service.h"
@@ -13,11 +17,29 @@
 
 namespace electron {
 
+namespace {
+
+// A disk cache backend is exclusive to one network context, so only one
+// context per cache-share group may mount the group's directory at a time.
+// Maps group name to the service currently owning its backend; an entry is
+// cleared when the owning service is destroyed, letting the next partition
+// that (re)creates its context take the group over.
+std::map<std::string, NetworkContextService*>& GetSharedCacheOwners() {
+  static base::NoDestructor<std::map<std::string, NetworkContextService*>>
+      owners;
+  return *owners;
+}
+
+}  // namespace
+
 NetworkContextService::NetworkContextService(content::BrowserContext* context)
     : browser_context_(static_cast<AtomBrowserContext*>(context)),
       proxy_config_monitor_(browser_context_->prefs()) {}
 
-NetworkContextService::~NetworkContextService() = default;
+NetworkContextService::~NetworkContextService() {
+  if (owns_shared_cache_)
+    GetSharedCacheOwners().erase(browser_context_->shared_cache_group());
+}
 
 mojo::Remote<network::mojom::NetworkContext>
 NetworkContextService::CreateNetworkContext() {
@@ -53,9 +75,12 @@ NetworkContextService::CreateNetworkContextParams(bool in_memory,
 
   // Configure on-disk storage for persistent sessions.
   if (!in_memory) {
-    // Configure the HTTP cache path and size.
-    network_context_params->http_cache_path =
-        path.Append(chrome::kCacheDirname);
+    // Configure the HTTP cache path and size. When the session asked for an
+    // in-memory cache backend, the path is left unset so the network service
+    // falls back to the memory backend.
+    if (!browser_context_->UseInMemoryHttpCache()) {
+      network_context_params->http_cache_path = GetHttpCachePath(path);
+    }
     network_context_params->http_cache_max_size =
         browser_context_->GetMaxCacheSize();
 
@@ -88,4 +113,23 @@ NetworkContextService::CreateNetworkContextParams(bool in_memory,
   return network_context_params;
 }
 
+base::FilePath NetworkContextService::GetHttpCachePath(
+    const base::FilePath& path) {
+  const std::string& group = browser_context_->shared_cache_group();
+  if (!group.empty()) {
+    auto& owners = GetSharedCacheOwners();
+    auto iter = owners.find(group);
+    if (iter == owners.end() || iter->second == this) {
+      owners[group] = this;
+      owns_shared_cache_ = true;
+      return browser_context_->shared_cache_path();
+    }
+    // Another live partition already owns the group's backend. Mounting a
+    // second backend over the same files would corrupt them, so fall back
+    // to this partition's private cache; it gets the shared one once the
+    // owner goes away and its context is recreated.
+  }
+  return path.Append(chrome::kCacheDirname);
+}
+
 }  // namespace electron
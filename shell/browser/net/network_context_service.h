@@ -33,8 +33,16 @@ class NetworkContextService : public KeyedService {
       bool in_memory,
       const base::FilePath& path);
 
+  // Returns the disk cache directory for this context: the cache-share
+  // group's common directory when this context owns the group, otherwise
+  // the partition's private one under |path|.
+  base::FilePath GetHttpCachePath(const base::FilePath& path);
+
   AtomBrowserContext* browser_context_;
   ProxyConfigMonitor proxy_config_monitor_;
+
+  // Whether this service currently owns its cache-share group's backend.
+  bool owns_shared_cache_ = false;
 };
 
 }  // namespace electron
@@ -12,11 +12,26 @@
 
 namespace electron {
 
+namespace {
+
+// How many bytes of chunks may be buffered ahead of the mojo pipe. Reads
+// from the stream stop once this much data is waiting to be written and
+// resume when the writer drains below it.
+constexpr size_t kMaxBufferedBytes = 256 * 1024;
+
+// Default capacity of the response body pipe. Streams routinely carry large
+// payloads (e.g. video), where the 64 KB mojo default forces a producer
+// stall per pipe-full of data.
+constexpr size_t kDefaultPipeCapacity = 2 * 1024 * 1024;
+
+}  // namespace
+
 NodeStreamLoader::NodeStreamLoader(network::ResourceResponseHead head,
                                    network::mojom::URLLoaderRequest loader,
                                    network::mojom::URLLoaderClientPtr client,
                                    v8::Isolate* isolate,
-                                   v8::Local<v8::Object> emitter)
+                                   v8::Local<v8::Object> emitter,
+                                   size_t pipe_capacity)
     : binding_(this, std::move(loader)),
       client_(std::move(client)),
       isolate_(isolate),
@@ -28,8 +43,9 @@ NodeStreamLoader::NodeStreamLoader(network::ResourceResponseHead head,
 
   // PostTask since it might destruct.
   base::SequencedTaskRunnerHandle::Get()->PostTask(
-      FROM_HERE, base::BindOnce(&NodeStreamLoader::Start,
-                                weak_factory_.GetWeakPtr(), std::move(head)));
+      FROM_HERE,
+      base::BindOnce(&NodeStreamLoader::Start, weak_factory_.GetWeakPtr(),
+                     std::move(head), pipe_capacity));
 }
 
 NodeStreamLoader::~NodeStreamLoader() {
@@ -48,12 +64,21 @@ NodeStreamLoader::~NodeStreamLoader() {
   // Release references.
   emitter_.Reset();
   buffer_.Reset();
+  pending_buffers_.clear();
 }
 
-void NodeStreamLoader::Start(network::ResourceResponseHead head) {
+void NodeStreamLoader::Start(network::ResourceResponseHead head,
+                             size_t pipe_capacity) {
+  MojoCreateDataPipeOptions options;
+  options.struct_size = sizeof(options);
+  options.flags = MOJO_CREATE_DATA_PIPE_FLAG_NONE;
+  options.element_num_bytes = 1;
+  options.capacity_num_bytes = static_cast<uint32_t>(
+      pipe_capacity > 0 ? pipe_capacity : kDefaultPipeCapacity);
+
   mojo::ScopedDataPipeProducerHandle producer;
   mojo::ScopedDataPipeConsumerHandle consumer;
-  MojoResult rv = mojo::CreateDataPipe(nullptr, &producer, &consumer);
+  MojoResult rv = mojo::CreateDataPipe(&options, &producer, &consumer);
   if (rv != MOJO_RESULT_OK) {
     NotifyComplete(net::ERR_INSUFFICIENT_RESOURCES);
     return;
@@ -79,8 +104,8 @@ void NodeStreamLoader::NotifyReadable() {
 }
 
 void NodeStreamLoader::NotifyComplete(int result) {
-  // Wait until write finishes or fails.
-  if (is_reading_ || is_writing_) {
+  // Wait until buffered chunks are flushed and the write finishes or fails.
+  if (is_reading_ || is_writing_ || !pending_buffers_.empty()) {
     ended_ = true;
     result_ = result;
     return;
@@ -99,45 +124,82 @@ void NodeStreamLoader::ReadMore() {
   }
   is_reading_ = true;
   auto weak = weak_factory_.GetWeakPtr();
-  // buffer = emitter.read()
-  v8::MaybeLocal<v8::Value> ret = node::MakeCallback(
-      isolate_, emitter_.Get(isolate_), "read", 0, nullptr, {0, 0});
-  DCHECK(weak) << "We shouldn't have been destroyed when calling read()";
-
-  // If there is no buffer read, wait until |readable| is emitted again.
-  v8::Local<v8::Value> buffer;
-  if (!ret.ToLocal(&buffer) || !node::Buffer::HasInstance(buffer)) {
-    readable_ = false;
-    is_reading_ = false;
+
+  v8::Locker locker(isolate_);
+  v8::Isolate::Scope isolate_scope(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+
+  // Eagerly pull chunks out of the stream until it runs dry or the high
+  // watermark of buffered bytes is reached, so the stream keeps producing
+  // while earlier chunks are still being written to the pipe.
+  while (pending_bytes_ < kMaxBufferedBytes) {
+    // buffer = emitter.read()
+    v8::MaybeLocal<v8::Value> ret = node::MakeCallback(
+        isolate_, emitter_.Get(isolate_), "read", 0, nullptr, {0, 0});
+    DCHECK(weak) << "We shouldn't have been destroyed when calling read()";
+
+    // If there is no buffer read, wait until |readable| is emitted again.
+    v8::Local<v8::Value> buffer;
+    if (!ret.ToLocal(&buffer) || !node::Buffer::HasInstance(buffer)) {
+      readable_ = false;
+      break;
+    }
+
+    // Hold the buffer until its write is done.
+    pending_bytes_ += node::Buffer::Length(buffer);
+    pending_buffers_.emplace_back(isolate_, buffer);
+  }
+
+  is_reading_ = false;
+  if (!is_writing_)
+    WriteNext();
+}
+
+void NodeStreamLoader::WriteNext() {
+  if (pending_buffers_.empty()) {
+    if (ended_)
+      NotifyComplete(result_);
     return;
   }
 
-  // Hold the buffer until the write is done.
-  buffer_.Reset(isolate_, buffer);
+  v8::Locker locker(isolate_);
+  v8::Isolate::Scope isolate_scope(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+
+  buffer_ = std::move(pending_buffers_.front());
+  pending_buffers_.pop_front();
+  v8::Local<v8::Value> buffer = buffer_.Get(isolate_);
+  size_t length = node::Buffer::Length(buffer);
+  pending_bytes_ -= length;
 
   // Write buffer to mojo pipe asyncronously.
-  is_reading_ = false;
   is_writing_ = true;
-  producer_->Write(std::make_unique<mojo::StringDataSource>(
-                       base::StringPiece(node::Buffer::Data(buffer),
-                                         node::Buffer::Length(buffer)),
-                       mojo::StringDataSource::AsyncWritingMode::
-                           STRING_STAYS_VALID_UNTIL_COMPLETION),
-                   base::BindOnce(&NodeStreamLoader::DidWrite, weak));
+  producer_->Write(
+      std::make_unique<mojo::StringDataSource>(
+          base::StringPiece(node::Buffer::Data(buffer), length),
+          mojo::StringDataSource::AsyncWritingMode::
+              STRING_STAYS_VALID_UNTIL_COMPLETION),
+      base::BindOnce(&NodeStreamLoader::DidWrite, weak_factory_.GetWeakPtr()));
 }
 
 void NodeStreamLoader::DidWrite(MojoResult result) {
   is_writing_ = false;
-  // We were told to end streaming.
-  if (ended_) {
+  if (result != MOJO_RESULT_OK) {
+    NotifyComplete(net::ERR_FAILED);
+    return;
+  }
+
+  // Flush buffered chunks first, then refill from the stream now that the
+  // amount in flight dropped below the watermark.
+  if (!pending_buffers_.empty()) {
+    WriteNext();
+  } else if (ended_) {
     NotifyComplete(result_);
     return;
   }
 
-  if (result == MOJO_RESULT_OK && readable_)
+  if (readable_ && !ended_ && pending_bytes_ < kMaxBufferedBytes)
     ReadMore();
-  else
-    NotifyComplete(net::ERR_FAILED);
 }
 
 void NodeStreamLoader::On(const char* event, EventCallback callback) {
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/circular_deque.h"
 #include "mojo/public/cpp/bindings/strong_binding.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
 #include "services/network/public/cpp/resource_response.h"
@@ -28,21 +29,25 @@ namespace electron {
 // the passed |Buffer| is alive while writing data to pipe.
 class NodeStreamLoader : public network::mojom::URLLoader {
  public:
+  // |pipe_capacity| is the size in bytes of the response body data pipe; 0
+  // uses the default streaming capacity.
   NodeStreamLoader(network::ResourceResponseHead head,
                    network::mojom::URLLoaderRequest loader,
                    network::mojom::URLLoaderClientPtr client,
                    v8::Isolate* isolate,
-                   v8::Local<v8::Object> emitter);
+                   v8::Local<v8::Object> emitter,
+                   size_t pipe_capacity);
 
  private:
   ~NodeStreamLoader() override;
 
   using EventCallback = base::RepeatingCallback<void()>;
 
-  void Start(network::ResourceResponseHead head);
+  void Start(network::ResourceResponseHead head, size_t pipe_capacity);
   void NotifyReadable();
   void NotifyComplete(int result);
   void ReadMore();
+  void WriteNext();
   void DidWrite(MojoResult result);
 
   // Subscribe to events of |emitter|.
@@ -64,6 +69,13 @@ class NodeStreamLoader : public network::mojom::URLLoader {
   v8::Global<v8::Object> emitter_;
   v8::Global<v8::Value> buffer_;
 
+  // Chunks read from the stream but not yet written to the pipe. Instead of
+  // strictly alternating one read and one write, we keep pulling chunks out
+  // of the stream while a write is in flight, up to a high watermark of
+  // buffered bytes.
+  base::circular_deque<v8::Global<v8::Value>> pending_buffers_;
+  size_t pending_bytes_ = 0;
+
   // Mojo data pipe where the data that is being read is written to.
   std::unique_ptr<mojo::DataPipeProducer> producer_;
 
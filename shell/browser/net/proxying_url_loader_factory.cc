@@ -6,6 +6,7 @@
 
 #include <utility>
 
+#include "base/strings/string_piece.h"
 #include "content/public/browser/browser_context.h"
 #include "extensions/browser/extension_navigation_ui_data.h"
 #include "mojo/public/cpp/bindings/binding.h"
@@ -250,9 +251,119 @@ void ProxyingURLLoaderFactory::InProgressRequest::OnTransferSizeUpdated(
 
 void ProxyingURLLoaderFactory::InProgressRequest::OnStartLoadingResponseBody(
     mojo::ScopedDataPipeConsumerHandle body) {
+  if (factory_->web_request_api()->HasResponseDataListener(&info_.value())) {
+    mojo::ScopedDataPipeProducerHandle producer;
+    mojo::ScopedDataPipeConsumerHandle consumer;
+    if (mojo::CreateDataPipe(nullptr, &producer, &consumer) ==
+        MOJO_RESULT_OK) {
+      filter_source_ = std::move(body);
+      filter_sink_ = std::move(producer);
+      filter_source_watcher_ = std::make_unique<mojo::SimpleWatcher>(
+          FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::MANUAL);
+      filter_source_watcher_->Watch(
+          filter_source_.get(),
+          MOJO_HANDLE_SIGNAL_READABLE | MOJO_HANDLE_SIGNAL_PEER_CLOSED,
+          base::BindRepeating(&InProgressRequest::OnFilterSourceReadable,
+                              base::Unretained(this)));
+      filter_sink_watcher_ = std::make_unique<mojo::SimpleWatcher>(
+          FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::MANUAL);
+      filter_sink_watcher_->Watch(
+          filter_sink_.get(), MOJO_HANDLE_SIGNAL_WRITABLE,
+          base::BindRepeating(&InProgressRequest::OnFilterSinkWritable,
+                              base::Unretained(this)));
+      target_client_->OnStartLoadingResponseBody(std::move(consumer));
+      filter_source_watcher_->ArmOrNotify();
+      return;
+    }
+  }
   target_client_->OnStartLoadingResponseBody(std::move(body));
 }
 
+void ProxyingURLLoaderFactory::InProgressRequest::OnFilterSourceReadable(
+    MojoResult result) {
+  const void* buffer = nullptr;
+  uint32_t num_bytes = 0;
+  MojoResult read_result = filter_source_->BeginReadData(
+      &buffer, &num_bytes, MOJO_READ_DATA_FLAG_NONE);
+  if (read_result == MOJO_RESULT_SHOULD_WAIT) {
+    filter_source_watcher_->ArmOrNotify();
+    return;
+  }
+  if (read_result == MOJO_RESULT_FAILED_PRECONDITION) {
+    // Upstream finished; give the listener a final empty chunk so it can
+    // flush any buffered output.
+    filter_end_of_stream_ = true;
+    filter_source_watcher_.reset();
+    filter_source_.reset();
+    factory_->web_request_api()->OnResponseData(
+        &info_.value(), request_, std::vector<char>(),
+        true /* end_of_stream */,
+        base::BindOnce(&InProgressRequest::OnFilterChunkTransformed,
+                       weak_factory_.GetWeakPtr()));
+    return;
+  }
+  if (read_result != MOJO_RESULT_OK) {
+    OnRequestError(network::URLLoaderCompletionStatus(net::ERR_FAILED));
+    return;
+  }
+
+  std::vector<char> chunk(static_cast<const char*>(buffer),
+                          static_cast<const char*>(buffer) + num_bytes);
+  filter_source_->EndReadData(num_bytes);
+  factory_->web_request_api()->OnResponseData(
+      &info_.value(), request_, std::move(chunk), false /* end_of_stream */,
+      base::BindOnce(&InProgressRequest::OnFilterChunkTransformed,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void ProxyingURLLoaderFactory::InProgressRequest::OnFilterSinkWritable(
+    MojoResult result) {
+  WriteFilteredData();
+}
+
+void ProxyingURLLoaderFactory::InProgressRequest::OnFilterChunkTransformed(
+    std::vector<char> data) {
+  filter_write_buffer_ = std::move(data);
+  filter_write_offset_ = 0;
+  WriteFilteredData();
+}
+
+void ProxyingURLLoaderFactory::InProgressRequest::WriteFilteredData() {
+  while (filter_write_offset_ < filter_write_buffer_.size()) {
+    uint32_t size = static_cast<uint32_t>(filter_write_buffer_.size() -
+                                          filter_write_offset_);
+    MojoResult result = filter_sink_->WriteData(
+        filter_write_buffer_.data() + filter_write_offset_, &size,
+        MOJO_WRITE_DATA_FLAG_NONE);
+    if (result == MOJO_RESULT_SHOULD_WAIT) {
+      filter_sink_watcher_->ArmOrNotify();
+      return;
+    }
+    if (result != MOJO_RESULT_OK) {
+      OnRequestError(network::URLLoaderCompletionStatus(net::ERR_FAILED));
+      return;
+    }
+    filter_write_offset_ += size;
+  }
+
+  filter_write_buffer_.clear();
+  filter_write_offset_ = 0;
+  if (filter_end_of_stream_)
+    FinishResponseFilter();
+  else
+    filter_source_watcher_->ArmOrNotify();
+}
+
+void ProxyingURLLoaderFactory::InProgressRequest::FinishResponseFilter() {
+  filter_sink_watcher_.reset();
+  filter_sink_.reset();
+  if (pending_completion_status_) {
+    network::URLLoaderCompletionStatus status = *pending_completion_status_;
+    pending_completion_status_.reset();
+    OnComplete(status);
+  }
+}
+
 void ProxyingURLLoaderFactory::InProgressRequest::OnComplete(
     const network::URLLoaderCompletionStatus& status) {
   if (status.error_code != net::OK) {
@@ -260,6 +371,13 @@ void ProxyingURLLoaderFactory::InProgressRequest::OnComplete(
     return;
   }
 
+  if (filter_sink_.is_valid()) {
+    // The response filter is still draining; forward the completion once
+    // the filtered body has been fully written.
+    pending_completion_status_ = status;
+    return;
+  }
+
   target_client_->OnComplete(status);
   factory_->web_request_api()->OnCompleted(&info_.value(), request_,
                                            status.error_code);
@@ -689,16 +807,24 @@ void ProxyingURLLoaderFactory::CreateLoaderAndStart(
     const network::ResourceRequest& request,
     network::mojom::URLLoaderClientPtr client,
     const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
-  // Check if user has intercepted this scheme.
-  auto it = intercepted_handlers_.find(request.url.scheme());
-  if (it != intercepted_handlers_.end()) {
-    // <scheme, <type, handler>>
-    it->second.second.Run(
-        request, base::BindOnce(&AtomURLLoaderFactory::StartLoading,
-                                std::move(loader), routing_id, request_id,
-                                options, request, std::move(client),
-                                traffic_annotation, this, it->second.first));
-    return;
+  // Check if user has intercepted this scheme. In the common case, where
+  // nothing is intercepted, this costs a single emptiness test; otherwise
+  // the map holds one entry per intercepted scheme, and a linear probe on
+  // string pieces avoids allocating a scheme string per request.
+  if (!intercepted_handlers_.empty()) {
+    base::StringPiece scheme = request.url.scheme_piece();
+    for (const auto& handler : intercepted_handlers_) {
+      if (scheme != handler.first)
+        continue;
+      // <scheme, <type, handler>>
+      handler.second.second.Run(
+          request, base::BindOnce(&AtomURLLoaderFactory::StartLoading,
+                                  std::move(loader), routing_id, request_id,
+                                  options, request, std::move(client),
+                                  traffic_annotation, this,
+                                  handler.second.first));
+      return;
+    }
   }
 
   // Intercept file:// protocol to support asar archives.
@@ -708,7 +834,17 @@ void ProxyingURLLoaderFactory::CreateLoaderAndStart(
     return;
   }
 
-  if (!web_request_api()->HasListener()) {
+  // Requests whose URL no listener's filter can possibly match skip the
+  // interception pipeline entirely; the compiled matcher costs a host lookup
+  // here instead of per-event pattern evaluation and a JS round-trip. The
+  // matcher only sees the request's initial URL, so the bypass is limited to
+  // purely observational listeners: a blocking listener (onBeforeRequest,
+  // onBeforeSendHeaders, onHeadersReceived) must get a chance to cancel
+  // every redirect leg, including redirects from an unfiltered URL into a
+  // filtered one.
+  if (!web_request_api()->HasListener() ||
+      (!web_request_api()->HasCancellingListener() &&
+       !web_request_api()->HasListenerForURL(request.url))) {
     // Pass-through to the original factory.
     target_factory_->CreateLoaderAndStart(
         std::move(loader), routing_id, request_id, options, request,
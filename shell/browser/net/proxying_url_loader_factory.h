@@ -19,6 +19,8 @@
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
@@ -36,8 +38,18 @@ class WebRequestAPI {
       base::OnceCallback<void(const std::set<std::string>& removed_headers,
                               const std::set<std::string>& set_headers,
                               int error_code)>;
+  using ResponseDataCallback = base::OnceCallback<void(std::vector<char>)>;
 
   virtual bool HasListener() const = 0;
+  // Returns true if any listener's URL patterns could match |url|. A false
+  // answer lets the factory hand the request straight to the target factory
+  // without proxying it at all.
+  virtual bool HasListenerForURL(const GURL& url) const = 0;
+  // Returns true if any listener can cancel or rewrite requests
+  // (onBeforeRequest, onBeforeSendHeaders, onHeadersReceived). Such
+  // listeners must see every redirect leg, so their presence disables the
+  // initial-URL bypass above.
+  virtual bool HasCancellingListener() const = 0;
   virtual int OnBeforeRequest(extensions::WebRequestInfo* info,
                               const network::ResourceRequest& request,
                               net::CompletionOnceCallback callback,
@@ -67,6 +79,18 @@ class WebRequestAPI {
   virtual void OnCompleted(extensions::WebRequestInfo* info,
                            const network::ResourceRequest& request,
                            int net_error) = 0;
+  // Returns true when a response-data listener wants to transform the body
+  // of this request, in which case the factory splices a filter stage
+  // between the network pipe and the renderer pipe.
+  virtual bool HasResponseDataListener(extensions::WebRequestInfo* info) = 0;
+  // Hands one body chunk to the listener; |callback| receives the bytes to
+  // forward in its place. The final flush is signalled by an empty chunk
+  // with |end_of_stream| set.
+  virtual void OnResponseData(extensions::WebRequestInfo* info,
+                              const network::ResourceRequest& request,
+                              std::vector<char> data,
+                              bool end_of_stream,
+                              ResponseDataCallback callback) = 0;
 };
 
 // This class is responsible for following tasks when NetworkService is enabled:
@@ -148,6 +172,17 @@ class ProxyingURLLoaderFactory
         net::CompletionOnceCallback continuation);
     void OnRequestError(const network::URLLoaderCompletionStatus& status);
 
+    // Streaming response-body filter, spliced between the network pipe and
+    // the renderer pipe by OnStartLoadingResponseBody(). Only one chunk is
+    // in flight at a time: the next chunk is not read until the previous
+    // one has been transformed and fully written, which bounds memory use
+    // and propagates renderer backpressure to the network.
+    void OnFilterSourceReadable(MojoResult result);
+    void OnFilterSinkWritable(MojoResult result);
+    void OnFilterChunkTransformed(std::vector<char> data);
+    void WriteFilteredData();
+    void FinishResponseFilter();
+
     ProxyingURLLoaderFactory* factory_;
     network::ResourceRequest request_;
     const base::Optional<url::Origin> original_initiator_;
@@ -198,6 +233,20 @@ class ProxyingURLLoaderFactory
     };
     std::unique_ptr<FollowRedirectParams> pending_follow_redirect_params_;
 
+    // Response-body filter state; the handles are only valid while a
+    // filter is active on this request.
+    mojo::ScopedDataPipeConsumerHandle filter_source_;
+    mojo::ScopedDataPipeProducerHandle filter_sink_;
+    std::unique_ptr<mojo::SimpleWatcher> filter_source_watcher_;
+    std::unique_ptr<mojo::SimpleWatcher> filter_sink_watcher_;
+    std::vector<char> filter_write_buffer_;
+    size_t filter_write_offset_ = 0;
+    bool filter_end_of_stream_ = false;
+    // Completion received from the network while the filter was still
+    // draining; forwarded once the filtered body has been written out.
+    base::Optional<network::URLLoaderCompletionStatus>
+        pending_completion_status_;
+
     base::WeakPtrFactory<InProgressRequest> weak_factory_{this};
 
     DISALLOW_COPY_AND_ASSIGN(InProgressRequest);
@@ -5,11 +5,13 @@
 #include "shell/browser/net/resolve_proxy_helper.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/receiver.h"
 #include "net/proxy_resolution/proxy_info.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 #include "shell/browser/atom_browser_context.h"
@@ -18,83 +20,141 @@ using content::BrowserThread;
 
 namespace electron {
 
+namespace {
+
+// Maximum number of cached lookup results and how long each stays valid.
+constexpr size_t kMaxCacheSize = 64;
+constexpr base::TimeDelta kCacheTTL = base::TimeDelta::FromMinutes(5);
+
+}  // namespace
+
+// An in-flight proxy lookup. Each request owns its own client pipe, so any
+// number of lookups for distinct URLs can be outstanding at once; callbacks
+// for the same key accumulate here while the lookup is in flight.
+class ResolveProxyHelper::LookupRequest
+    : public network::mojom::ProxyLookupClient {
+ public:
+  LookupRequest(ResolveProxyHelper* helper, std::string key, const GURL& url)
+      : helper_(helper), key_(std::move(key)), url_(url) {}
+  ~LookupRequest() override = default;
+
+  void Start(network::mojom::NetworkContext* network_context) {
+    mojo::PendingRemote<network::mojom::ProxyLookupClient>
+        proxy_lookup_client = receiver_.BindNewPipeAndPassRemote();
+    receiver_.set_disconnect_handler(
+        base::BindOnce(&LookupRequest::OnProxyLookupComplete,
+                       base::Unretained(this), net::ERR_ABORTED,
+                       base::nullopt));
+    network_context->LookUpProxyForURL(url_, std::move(proxy_lookup_client));
+  }
+
+  void AddCallback(ResolveProxyCallback callback) {
+    callbacks_.push_back(std::move(callback));
+  }
+
+  std::vector<ResolveProxyCallback> TakeCallbacks() {
+    return std::move(callbacks_);
+  }
+
+  const std::string& key() const { return key_; }
+
+ private:
+  // network::mojom::ProxyLookupClient implementation.
+  void OnProxyLookupComplete(
+      int32_t net_error,
+      const base::Optional<net::ProxyInfo>& proxy_info) override {
+    receiver_.reset();
+
+    std::string proxy;
+    if (proxy_info)
+      proxy = proxy_info->ToPacString();
+
+    // Deletes |this|.
+    helper_->OnLookupComplete(this, proxy, proxy_info.has_value());
+  }
+
+  ResolveProxyHelper* helper_;
+  const std::string key_;
+  const GURL url_;
+  std::vector<ResolveProxyCallback> callbacks_;
+  mojo::Receiver<network::mojom::ProxyLookupClient> receiver_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(LookupRequest);
+};
+
 ResolveProxyHelper::ResolveProxyHelper(AtomBrowserContext* browser_context)
-    : browser_context_(browser_context) {}
+    : cache_(kMaxCacheSize), browser_context_(browser_context) {}
 
 ResolveProxyHelper::~ResolveProxyHelper() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!owned_self_);
-  DCHECK(!receiver_.is_bound());
-  // Clear all pending requests if the ProxyService is still alive.
-  pending_requests_.clear();
+  // Drop all in-flight requests; their receivers are reset with them, so no
+  // completion can arrive afterwards.
+  inflight_.clear();
+}
+
+// static
+std::string ResolveProxyHelper::CacheKey(const GURL& url) {
+  return url.scheme() + "://" + url.host();
 }
 
 void ResolveProxyHelper::ResolveProxy(const GURL& url,
                                       ResolveProxyCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  // Enqueue the pending request.
-  pending_requests_.emplace_back(url, std::move(callback));
 
-  // If nothing is in progress, start.
-  if (!receiver_.is_bound()) {
-    DCHECK_EQ(1u, pending_requests_.size());
-    StartPendingRequest();
+  const std::string key = CacheKey(url);
+
+  // Steady state: answer from the cache without touching the network service.
+  auto cached = cache_.Get(key);
+  if (cached != cache_.end()) {
+    if (base::TimeTicks::Now() < cached->second.expiry) {
+      std::move(callback).Run(cached->second.proxy);
+      return;
+    }
+    cache_.Erase(cached);
+  }
+
+  // Piggyback on an in-flight lookup for the same key.
+  auto inflight = inflight_.find(key);
+  if (inflight != inflight_.end()) {
+    inflight->second->AddCallback(std::move(callback));
+    return;
   }
+
+  auto request = std::make_unique<LookupRequest>(this, key, url);
+  request->AddCallback(std::move(callback));
+  LookupRequest* request_ptr = request.get();
+  inflight_.emplace(key, std::move(request));
+  request_ptr->Start(
+      content::BrowserContext::GetDefaultStoragePartition(browser_context_)
+          ->GetNetworkContext());
 }
 
-void ResolveProxyHelper::StartPendingRequest() {
+void ResolveProxyHelper::InvalidateCache() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!receiver_.is_bound());
-  DCHECK(!pending_requests_.empty());
-
-  // Start the request.
-  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client =
-      receiver_.BindNewPipeAndPassRemote();
-  receiver_.set_disconnect_handler(
-      base::BindOnce(&ResolveProxyHelper::OnProxyLookupComplete,
-                     base::Unretained(this), net::ERR_ABORTED, base::nullopt));
-  content::BrowserContext::GetDefaultStoragePartition(browser_context_)
-      ->GetNetworkContext()
-      ->LookUpProxyForURL(pending_requests_.front().url,
-                          std::move(proxy_lookup_client));
+  cache_.Clear();
 }
 
-void ResolveProxyHelper::OnProxyLookupComplete(
-    int32_t net_error,
-    const base::Optional<net::ProxyInfo>& proxy_info) {
+void ResolveProxyHelper::OnLookupComplete(LookupRequest* request,
+                                          const std::string& proxy,
+                                          bool cacheable) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!pending_requests_.empty());
-
-  receiver_.reset();
-
-  // Clear the current (completed) request.
-  PendingRequest completed_request = std::move(pending_requests_.front());
-  pending_requests_.pop_front();
 
-  std::string proxy;
-  if (proxy_info)
-    proxy = proxy_info->ToPacString();
+  auto it = inflight_.find(request->key());
+  DCHECK(it != inflight_.end() && it->second.get() == request);
+  std::unique_ptr<LookupRequest> owned_request = std::move(it->second);
+  inflight_.erase(it);
 
-  if (!completed_request.callback.is_null())
-    std::move(completed_request.callback).Run(proxy);
+  // Only successful lookups are cached; failures are retried on the next
+  // call.
+  if (cacheable) {
+    cache_.Put(request->key(),
+               CacheEntry{proxy, base::TimeTicks::Now() + kCacheTTL});
+  }
 
-  // Start the next request.
-  if (!pending_requests_.empty())
-    StartPendingRequest();
+  for (auto& callback : owned_request->TakeCallbacks()) {
+    if (!callback.is_null())
+      std::move(callback).Run(proxy);
+  }
 }
 
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    const GURL& url,
-    ResolveProxyCallback callback)
-    : url(url), callback(std::move(callback)) {}
-
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    ResolveProxyHelper::PendingRequest&& pending_request) = default;
-
-ResolveProxyHelper::PendingRequest::~PendingRequest() noexcept = default;
-
-ResolveProxyHelper::PendingRequest& ResolveProxyHelper::PendingRequest::
-operator=(ResolveProxyHelper::PendingRequest&& pending_request) noexcept =
-    default;
-
 }  // namespace electron
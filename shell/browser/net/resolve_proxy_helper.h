@@ -5,13 +5,14 @@
 #ifndef SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 #define SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 
-#include <deque>
+#include <map>
+#include <memory>
 #include <string>
 
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
 #include "base/memory/ref_counted.h"
-#include "base/optional.h"
-#include "mojo/public/cpp/bindings/receiver.h"
-#include "services/network/public/mojom/proxy_lookup_client.mojom.h"
+#include "base/time/time.h"
 #include "url/gurl.h"
 
 namespace electron {
@@ -19,8 +20,7 @@ namespace electron {
 class AtomBrowserContext;
 
 class ResolveProxyHelper
-    : public base::RefCountedThreadSafe<ResolveProxyHelper>,
-      network::mojom::ProxyLookupClient {
+    : public base::RefCountedThreadSafe<ResolveProxyHelper> {
  public:
   using ResolveProxyCallback = base::OnceCallback<void(std::string)>;
 
@@ -28,41 +28,39 @@ class ResolveProxyHelper
 
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
 
+  // Drops all cached results. Called when the session's proxy configuration
+  // changes, since cached results reflect the old configuration.
+  void InvalidateCache();
+
  protected:
-  ~ResolveProxyHelper() override;
+  virtual ~ResolveProxyHelper();
 
  private:
   friend class base::RefCountedThreadSafe<ResolveProxyHelper>;
-  // A PendingRequest is a resolve request that is in progress, or queued.
-  struct PendingRequest {
-   public:
-    PendingRequest(const GURL& url, ResolveProxyCallback callback);
-    PendingRequest(PendingRequest&& pending_request) noexcept;
-    ~PendingRequest();
-
-    PendingRequest& operator=(PendingRequest&& pending_request) noexcept;
 
-    GURL url;
-    ResolveProxyCallback callback;
+  // An in-flight lookup with its own mojo client pipe, so lookups for
+  // distinct URLs can run concurrently. Callbacks for the same cache key
+  // piggyback on the existing lookup instead of starting another one.
+  class LookupRequest;
 
-   private:
-    DISALLOW_COPY_AND_ASSIGN(PendingRequest);
+  struct CacheEntry {
+    std::string proxy;
+    base::TimeTicks expiry;
   };
 
-  // Starts the first pending request.
-  void StartPendingRequest();
-
-  // network::mojom::ProxyLookupClient implementation.
-  void OnProxyLookupComplete(
-      int32_t net_error,
-      const base::Optional<net::ProxyInfo>& proxy_info) override;
+  // Results are keyed by scheme+host; the path is intentionally ignored.
+  static std::string CacheKey(const GURL& url);
 
-  // Self-reference. Owned as long as there's an outstanding proxy lookup.
-  scoped_refptr<ResolveProxyHelper> owned_self_;
+  // Called by LookupRequest when its lookup finishes. Deletes |request|.
+  void OnLookupComplete(LookupRequest* request,
+                        const std::string& proxy,
+                        bool cacheable);
 
-  std::deque<PendingRequest> pending_requests_;
-  // Receiver for the currently in-progress request, if any.
-  mojo::Receiver<network::mojom::ProxyLookupClient> receiver_{this};
+  // Most recent lookup results, bounded in size; entries also carry an
+  // expiry to limit staleness from config changes we cannot observe (e.g. a
+  // PAC script changing its mind).
+  base::MRUCache<std::string, CacheEntry> cache_;
+  std::map<std::string, std::unique_ptr<LookupRequest>> inflight_;
 
   // Weak Ref
   AtomBrowserContext* browser_context_;
@@ -4,6 +4,7 @@
 
 #include "shell/browser/net/system_network_context_manager.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -16,7 +17,10 @@
 #include "content/public/common/service_names.mojom.h"
 #include "mojo/public/cpp/bindings/associated_interface_ptr.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "base/strings/string_number_conversions.h"
+#include "net/http/http_network_session.h"
 #include "net/net_buildflags.h"
+#include "net/socket/client_socket_pool_manager.h"
 #include "services/network/network_service.h"
 #include "services/network/public/cpp/cross_thread_shared_url_loader_factory_info.h"
 #include "services/network/public/cpp/features.h"
@@ -56,6 +60,39 @@ network::mojom::HttpAuthDynamicParamsPtr CreateHttpAuthDynamicParams() {
   return auth_dynamic_params;
 }
 
+// Bounds for the socket limit switches; values outside this range are most
+// likely typos and would either disable loading or exhaust descriptors.
+constexpr int kMinSocketLimit = 1;
+constexpr int kMaxSocketLimit = 255;
+
+// Reads an integer socket limit switch, returning 0 when absent or invalid.
+int GetSocketLimitSwitch(const char* switch_name) {
+  const std::string value =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(switch_name);
+  int limit = 0;
+  if (value.empty() || !base::StringToInt(value, &limit))
+    return 0;
+  return std::min(std::max(limit, kMinSocketLimit), kMaxSocketLimit);
+}
+
+// Applies the socket limit switches to the network service. The per-host
+// limit is set through the socket pool statics, which is valid because the
+// network service runs in the browser process; it takes effect for network
+// contexts created afterwards.
+void ApplySocketLimits(network::mojom::NetworkService* network_service) {
+  int max_per_host =
+      GetSocketLimitSwitch(electron::switches::kMaxSocketsPerHost);
+  if (max_per_host > 0) {
+    net::ClientSocketPoolManager::set_max_sockets_per_group(
+        net::HttpNetworkSession::NORMAL_SOCKET_POOL, max_per_host);
+  }
+
+  int max_per_proxy =
+      GetSocketLimitSwitch(electron::switches::kMaxConnectionsPerProxy);
+  if (max_per_proxy > 0)
+    network_service->SetMaxConnectionsPerProxy(max_per_proxy);
+}
+
 }  // namespace
 
 // SharedURLLoaderFactory backed by a SystemNetworkContextManager and its
@@ -202,6 +239,10 @@ void SystemNetworkContextManager::OnNetworkServiceCreated(
   network_service->SetUpHttpAuth(CreateHttpAuthStaticParams());
   network_service->ConfigureHttpAuthPrefs(CreateHttpAuthDynamicParams());
 
+  // Must be applied before any network context exists so every context's
+  // socket pools are created with the tuned limits.
+  ApplySocketLimits(network_service);
+
   // The system NetworkContext must be created first, since it sets
   // |primary_network_context| to true.
   network_context_.reset();
@@ -6,7 +6,8 @@
 
 #include <utility>
 
-#include "mojo/public/cpp/system/string_data_source.h"
+#include "net/http/http_request_headers.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 
 namespace electron {
@@ -20,6 +21,7 @@ URLPipeLoader::URLPipeLoader(
     base::DictionaryValue upload_data)
     : binding_(this, std::move(loader)),
       client_(std::move(client)),
+      upstream_client_binding_(this),
       weak_factory_(this) {
   binding_.set_connection_error_handler(base::BindOnce(
       &URLPipeLoader::NotifyComplete, base::Unretained(this), net::ERR_FAILED));
@@ -38,18 +40,30 @@ void URLPipeLoader::Start(
     std::unique_ptr<network::ResourceRequest> request,
     const net::NetworkTrafficAnnotationTag& annotation,
     base::DictionaryValue upload_data) {
-  loader_ = network::SimpleURLLoader::Create(std::move(request), annotation);
-  loader_->SetOnResponseStartedCallback(base::Bind(
-      &URLPipeLoader::OnResponseStarted, weak_factory_.GetWeakPtr()));
-
   // TODO(zcbenz): The old protocol API only supports string as upload data,
   // we should seek to support more types in future.
   std::string content_type, data;
   if (upload_data.GetString("contentType", &content_type) &&
-      upload_data.GetString("data", &data))
-    loader_->AttachStringForUpload(data, content_type);
+      upload_data.GetString("data", &data)) {
+    request->headers.SetHeader(net::HttpRequestHeaders::kContentType,
+                               content_type);
+    request->request_body =
+        network::ResourceRequestBody::CreateFromBytes(data.data(), data.size());
+  }
 
-  loader_->DownloadAsStream(factory.get(), this);
+  // Bind ourselves as the upstream client so the response body pipe can be
+  // handed to |client_| as-is instead of being pumped through an
+  // intermediate pipe.
+  network::mojom::URLLoaderClientPtr upstream_client;
+  upstream_client_binding_.Bind(mojo::MakeRequest(&upstream_client));
+  upstream_client_binding_.set_connection_error_handler(
+      base::BindOnce(&URLPipeLoader::NotifyComplete, base::Unretained(this),
+                     net::ERR_FAILED));
+
+  factory->CreateLoaderAndStart(
+      mojo::MakeRequest(&upstream_loader_), 0, 0, 0, *request,
+      std::move(upstream_client),
+      net::MutableNetworkTrafficAnnotationTag(annotation));
 }
 
 void URLPipeLoader::NotifyComplete(int result) {
@@ -57,46 +71,42 @@ void URLPipeLoader::NotifyComplete(int result) {
   delete this;
 }
 
-void URLPipeLoader::OnResponseStarted(
-    const GURL& final_url,
-    const network::mojom::URLResponseHead& response_head) {
-  mojo::ScopedDataPipeProducerHandle producer;
-  mojo::ScopedDataPipeConsumerHandle consumer;
-  MojoResult rv = mojo::CreateDataPipe(nullptr, &producer, &consumer);
-  if (rv != MOJO_RESULT_OK) {
-    NotifyComplete(net::ERR_INSUFFICIENT_RESOURCES);
-    return;
-  }
+void URLPipeLoader::OnReceiveResponse(
+    network::mojom::URLResponseHeadPtr head) {
+  client_->OnReceiveResponse(std::move(head));
+}
 
-  producer_ = std::make_unique<mojo::DataPipeProducer>(std::move(producer));
+void URLPipeLoader::OnReceiveRedirect(const net::RedirectInfo& redirect_info,
+                                      network::mojom::URLResponseHeadPtr head) {
+  // Follow redirects transparently, matching the behavior of the
+  // SimpleURLLoader-based implementation this replaced.
+  upstream_loader_->FollowRedirect({}, {}, base::nullopt);
+}
 
-  client_->OnReceiveResponse(response_head.Clone());
-  client_->OnStartLoadingResponseBody(std::move(consumer));
+void URLPipeLoader::OnUploadProgress(int64_t current_position,
+                                     int64_t total_size,
+                                     OnUploadProgressCallback callback) {
+  client_->OnUploadProgress(current_position, total_size, std::move(callback));
 }
 
-void URLPipeLoader::OnWrite(base::OnceClosure resume, MojoResult result) {
-  if (result == MOJO_RESULT_OK)
-    std::move(resume).Run();
-  else
-    NotifyComplete(net::ERR_FAILED);
+void URLPipeLoader::OnReceiveCachedMetadata(mojo_base::BigBuffer data) {
+  client_->OnReceiveCachedMetadata(std::move(data));
 }
 
-void URLPipeLoader::OnDataReceived(base::StringPiece string_piece,
-                                   base::OnceClosure resume) {
-  producer_->Write(
-      std::make_unique<mojo::StringDataSource>(
-          string_piece, mojo::StringDataSource::AsyncWritingMode::
-                            STRING_STAYS_VALID_UNTIL_COMPLETION),
-      base::BindOnce(&URLPipeLoader::OnWrite, weak_factory_.GetWeakPtr(),
-                     std::move(resume)));
+void URLPipeLoader::OnTransferSizeUpdated(int32_t transfer_size_diff) {
+  client_->OnTransferSizeUpdated(transfer_size_diff);
 }
 
-void URLPipeLoader::OnRetry(base::OnceClosure start_retry) {
-  NOTREACHED();
+void URLPipeLoader::OnStartLoadingResponseBody(
+    mojo::ScopedDataPipeConsumerHandle body) {
+  // The splice: the client reads directly from the upstream body pipe.
+  client_->OnStartLoadingResponseBody(std::move(body));
 }
 
-void URLPipeLoader::OnComplete(bool success) {
-  NotifyComplete(loader_->NetError());
+void URLPipeLoader::OnComplete(
+    const network::URLLoaderCompletionStatus& status) {
+  client_->OnComplete(status);
+  delete this;
 }
 
 }  // namespace electron
@@ -9,10 +9,11 @@
 #include <string>
 #include <vector>
 
-#include "mojo/public/cpp/bindings/strong_binding.h"
-#include "mojo/public/cpp/system/data_pipe_producer.h"
-#include "services/network/public/cpp/simple_url_loader.h"
-#include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
+#include "base/memory/weak_ptr.h"
+#include "base/values.h"
+#include "mojo/public/cpp/bindings/binding.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
 
 namespace network {
@@ -26,10 +27,13 @@ namespace electron {
 // Different from creating a new loader for the URL directly, protocol handlers
 // using this loader can work around CORS restrictions.
 //
+// The upstream response body pipe is spliced straight through to the client,
+// so the body bytes are never copied in the browser process.
+//
 // This class manages its own lifetime and should delete itself when the
 // connection is lost or finished.
 class URLPipeLoader : public network::mojom::URLLoader,
-                      public network::SimpleURLLoaderStreamConsumer {
+                      public network::mojom::URLLoaderClient {
  public:
   URLPipeLoader(scoped_refptr<network::SharedURLLoaderFactory> factory,
                 std::unique_ptr<network::ResourceRequest> request,
@@ -46,15 +50,19 @@ class URLPipeLoader : public network::mojom::URLLoader,
              const net::NetworkTrafficAnnotationTag& annotation,
              base::DictionaryValue upload_data);
   void NotifyComplete(int result);
-  void OnResponseStarted(const GURL& final_url,
-                         const network::mojom::URLResponseHead& response_head);
-  void OnWrite(base::OnceClosure resume, MojoResult result);
 
-  // SimpleURLLoaderStreamConsumer:
-  void OnDataReceived(base::StringPiece string_piece,
-                      base::OnceClosure resume) override;
-  void OnComplete(bool success) override;
-  void OnRetry(base::OnceClosure start_retry) override;
+  // network::mojom::URLLoaderClient:
+  void OnReceiveResponse(network::mojom::URLResponseHeadPtr head) override;
+  void OnReceiveRedirect(const net::RedirectInfo& redirect_info,
+                         network::mojom::URLResponseHeadPtr head) override;
+  void OnUploadProgress(int64_t current_position,
+                        int64_t total_size,
+                        OnUploadProgressCallback callback) override;
+  void OnReceiveCachedMetadata(mojo_base::BigBuffer data) override;
+  void OnTransferSizeUpdated(int32_t transfer_size_diff) override;
+  void OnStartLoadingResponseBody(
+      mojo::ScopedDataPipeConsumerHandle body) override;
+  void OnComplete(const network::URLLoaderCompletionStatus& status) override;
 
   // URLLoader:
   void FollowRedirect(const std::vector<std::string>& removed_headers,
@@ -68,8 +76,9 @@ class URLPipeLoader : public network::mojom::URLLoader,
   mojo::Binding<network::mojom::URLLoader> binding_;
   network::mojom::URLLoaderClientPtr client_;
 
-  std::unique_ptr<mojo::DataPipeProducer> producer_;
-  std::unique_ptr<network::SimpleURLLoader> loader_;
+  // The upstream request whose response is being spliced to |client_|.
+  network::mojom::URLLoaderPtr upstream_loader_;
+  mojo::Binding<network::mojom::URLLoaderClient> upstream_client_binding_;
 
   base::WeakPtrFactory<URLPipeLoader> weak_factory_;
 
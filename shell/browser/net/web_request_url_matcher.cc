@@ -0,0 +1,64 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/web_request_url_matcher.h"
+
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+
+namespace electron {
+
+WebRequestURLMatcher::WebRequestURLMatcher() = default;
+
+WebRequestURLMatcher::~WebRequestURLMatcher() = default;
+
+void WebRequestURLMatcher::Clear() {
+  match_all_ = false;
+  exact_hosts_.clear();
+  host_suffixes_.clear();
+}
+
+void WebRequestURLMatcher::AddPatterns(const std::set<URLPattern>& patterns) {
+  if (patterns.empty()) {
+    match_all_ = true;
+    return;
+  }
+
+  for (const URLPattern& pattern : patterns) {
+    const std::string& host = pattern.host();
+    // Patterns like "<all_urls>", "*://*/*" or hosts with embedded wildcards
+    // can not be reduced to a host lookup; let them match everything rather
+    // than risk a false reject.
+    if (pattern.match_all_urls() || host.empty() ||
+        host.find('*') != std::string::npos) {
+      match_all_ = true;
+      return;
+    }
+    if (pattern.match_subdomains())
+      host_suffixes_.push_back(host);
+    else
+      exact_hosts_.insert(host);
+  }
+}
+
+bool WebRequestURLMatcher::MightMatch(const GURL& url) const {
+  if (match_all_)
+    return true;
+
+  const std::string host = url.host();
+  if (host.empty())
+    return false;
+
+  if (exact_hosts_.count(host) > 0)
+    return true;
+
+  for (const std::string& suffix : host_suffixes_) {
+    if (host == suffix ||
+        base::EndsWith(host, "." + suffix, base::CompareCase::SENSITIVE))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace electron
@@ -0,0 +1,53 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_NET_WEB_REQUEST_URL_MATCHER_H_
+#define SHELL_BROWSER_NET_WEB_REQUEST_URL_MATCHER_H_
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace electron {
+
+// Fast-reject index compiled from the URL patterns of all registered
+// webRequest listeners. Plain host patterns are indexed by exact host and
+// subdomain suffix; anything the index can not express precisely makes the
+// matcher accept every URL, so a negative answer is always authoritative.
+// This lets the proxying loader factory skip the whole interception pipeline
+// for requests no listener could possibly care about, at the cost of a host
+// lookup instead of per-event URLPattern evaluation.
+class WebRequestURLMatcher {
+ public:
+  WebRequestURLMatcher();
+  ~WebRequestURLMatcher();
+
+  void Clear();
+
+  // Adds one listener's pattern set to the index. An empty set means the
+  // listener wants every request.
+  void AddPatterns(const std::set<URLPattern>& patterns);
+
+  // Returns false only when no registered pattern can possibly match |url|.
+  bool MightMatch(const GURL& url) const;
+
+ private:
+  // Set when any listener has no filter, or a pattern the host index can not
+  // represent exactly.
+  bool match_all_ = false;
+
+  std::set<std::string> exact_hosts_;
+  std::vector<std::string> host_suffixes_;
+
+  DISALLOW_COPY_AND_ASSIGN(WebRequestURLMatcher);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_NET_WEB_REQUEST_URL_MATCHER_H_
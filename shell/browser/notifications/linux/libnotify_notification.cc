@@ -85,6 +85,14 @@ LibnotifyNotification::~LibnotifyNotification() {
 }
 
 void LibnotifyNotification::Show(const NotificationOptions& options) {
+  // When called again for an update, drop the previous object; the server
+  // replaces the displayed notification by id (set from the tag below), so
+  // this presents in place instead of stacking a second bubble.
+  if (notification_) {
+    g_signal_handlers_disconnect_by_data(notification_, this);
+    g_object_unref(notification_);
+  }
+
   notification_ = libnotify_loader_.notify_notification_new(
       base::UTF16ToUTF8(options.title).c_str(),
       base::UTF16ToUTF8(options.msg).c_str(), nullptr);
@@ -24,6 +24,7 @@ class CocoaNotification : public Notification {
 
   // Notification:
   void Show(const NotificationOptions& options) override;
+  void Update(const NotificationOptions& options) override;
   void Dismiss() override;
 
   void NotificationDisplayed();
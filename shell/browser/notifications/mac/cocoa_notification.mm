@@ -26,6 +26,15 @@ CocoaNotification::~CocoaNotification() {
         removeDeliveredNotification:notification_];
 }
 
+void CocoaNotification::Update(const NotificationOptions& options) {
+  // Take the delivered notification down first or the re-show below would
+  // stack a second banner in Notification Center.
+  if (notification_)
+    [NSUserNotificationCenter.defaultUserNotificationCenter
+        removeDeliveredNotification:notification_];
+  Show(options);
+}
+
 void CocoaNotification::Show(const NotificationOptions& options) {
   notification_.reset([[NSUserNotification alloc] init]);
 
@@ -21,6 +21,10 @@ Notification::~Notification() {
     delegate()->NotificationDestroyed();
 }
 
+void Notification::Update(const NotificationOptions& options) {
+  Show(options);
+}
+
 void Notification::NotificationClicked() {
   if (delegate())
     delegate()->NotificationClick();
@@ -49,6 +49,10 @@ class Notification {
 
   // Shows the notification.
   virtual void Show(const NotificationOptions& options) = 0;
+  // Updates an already-shown notification in place instead of presenting a
+  // new toast. The default implementation just shows again; platforms whose
+  // Show would leave the previous toast behind override this.
+  virtual void Update(const NotificationOptions& options);
   // Closes the notification, this instance will be destroyed after the
   // notification gets closed.
   virtual void Dismiss() = 0;
@@ -138,6 +138,17 @@ void WindowsToastNotification::Show(const NotificationOptions& options) {
     delegate()->NotificationDisplayed();
 }
 
+void WindowsToastNotification::Update(const NotificationOptions& options) {
+  // Hide the current toast before showing the replacement. The callbacks are
+  // removed first so hiding does not look like a user dismissal and destroy
+  // this object.
+  if (toast_notification_) {
+    RemoveCallbacks(toast_notification_.Get());
+    toast_notifier_->Hide(toast_notification_.Get());
+  }
+  Show(options);
+}
+
 void WindowsToastNotification::Dismiss() {
   if (IsDebuggingNotifications())
     LOG(INFO) << "Hiding notification";
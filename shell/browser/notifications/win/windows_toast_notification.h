@@ -52,6 +52,7 @@ class WindowsToastNotification : public Notification {
  protected:
   // Notification:
   void Show(const NotificationOptions& options) override;
+  void Update(const NotificationOptions& options) override;
   void Dismiss() override;
 
  private:
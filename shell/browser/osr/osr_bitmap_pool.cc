@@ -0,0 +1,134 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/osr/osr_bitmap_pool.h"
+
+#include <stdlib.h>
+
+#include "base/bind.h"
+#include "base/bits.h"
+#include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "shell/browser/osr/osr_paint_metrics.h"
+
+namespace electron {
+
+OffScreenBitmapPool::OffScreenBitmapPool() = default;
+
+OffScreenBitmapPool::~OffScreenBitmapPool() {
+  Trim();
+}
+
+// static
+OffScreenBitmapPool* OffScreenBitmapPool::GetInstance() {
+  static base::NoDestructor<OffScreenBitmapPool> instance;
+  return instance.get();
+}
+
+// static
+int OffScreenBitmapPool::ClassIndex(size_t length, size_t* rounded) {
+  if (length == 0 || length > kMaxPooledSize)
+    return -1;
+  int log = base::bits::Log2Ceiling(static_cast<uint32_t>(length));
+  constexpr int kMinLog = 16;  // log2(kMinPooledSize)
+  if (log < kMinLog)
+    log = kMinLog;
+  *rounded = static_cast<size_t>(1) << log;
+  return log - kMinLog;
+}
+
+// static
+void OffScreenBitmapPool::ReleasePixels(void* addr, void* context) {
+  size_t rounded = reinterpret_cast<uintptr_t>(context);
+  if (rounded == 0) {
+    free(addr);
+    return;
+  }
+  // The pool is a leaky singleton, so it always outlives the pixels.
+  GetInstance()->Release(addr, rounded);
+}
+
+SkBitmap OffScreenBitmapPool::Allocate(const SkImageInfo& info) {
+  EnsurePressureListener();
+
+  size_t byte_size = info.computeMinByteSize();
+  size_t rounded = 0;
+  int index = ClassIndex(byte_size, &rounded);
+
+  void* data = nullptr;
+  if (index >= 0) {
+    base::AutoLock auto_lock(lock_);
+    std::vector<void*>& buffers = free_buffers_[index];
+    if (!buffers.empty()) {
+      data = buffers.back();
+      buffers.pop_back();
+    }
+  }
+  OffScreenPaintMetrics::Get()->RecordPoolAllocation(data != nullptr);
+  if (!data)
+    data = malloc(index >= 0 ? rounded : byte_size);
+  CHECK(data);
+
+  SkBitmap bitmap;
+  bitmap.installPixels(info, data, info.minRowBytes(), &ReleasePixels,
+                       reinterpret_cast<void*>(static_cast<uintptr_t>(
+                           index >= 0 ? rounded : 0)));
+  return bitmap;
+}
+
+void OffScreenBitmapPool::Release(void* data, size_t rounded) {
+  size_t ignored;
+  int index = ClassIndex(rounded, &ignored);
+  DCHECK_GE(index, 0);
+  {
+    base::AutoLock auto_lock(lock_);
+    std::vector<void*>& buffers = free_buffers_[index];
+    if (buffers.size() < kMaxBuffersPerClass) {
+      buffers.push_back(data);
+      return;
+    }
+  }
+  free(data);
+}
+
+void OffScreenBitmapPool::Trim() {
+  std::vector<void*> doomed;
+  {
+    base::AutoLock auto_lock(lock_);
+    for (std::vector<void*>& buffers : free_buffers_) {
+      doomed.insert(doomed.end(), buffers.begin(), buffers.end());
+      buffers.clear();
+    }
+  }
+  for (void* data : doomed)
+    free(data);
+}
+
+size_t OffScreenBitmapPool::pooled_bytes() const {
+  base::AutoLock auto_lock(lock_);
+  size_t total = 0;
+  for (int i = 0; i < kNumClasses; ++i)
+    total += free_buffers_[i].size() * (kMinPooledSize << i);
+  return total;
+}
+
+void OffScreenBitmapPool::EnsurePressureListener() {
+  // Allocate is first called from the UI thread once the compositor is
+  // running, so a task runner is available by then.
+  if (pressure_listener_ || !base::ThreadTaskRunnerHandle::IsSet())
+    return;
+  pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      base::BindRepeating(&OffScreenBitmapPool::OnMemoryPressure,
+                          base::Unretained(this)));
+}
+
+void OffScreenBitmapPool::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  if (level != base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    Trim();
+  }
+}
+
+}  // namespace electron
@@ -0,0 +1,80 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_OSR_OSR_BITMAP_POOL_H_
+#define SHELL_BROWSER_OSR_OSR_BITMAP_POOL_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/synchronization/lock.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace base {
+template <typename T>
+class NoDestructor;
+}
+
+namespace electron {
+
+// Browser-process-wide pool of pixel buffers backing OSR bitmaps. Interactive
+// resizing reallocates multi-MB backing stores dozens of times per second;
+// the pool recycles freed buffers through power-of-two size-class freelists
+// shared across all offscreen views, so resize and multi-view churn reuse
+// memory instead of hammering the allocator. Pooled buffers are released on
+// memory pressure.
+class OffScreenBitmapPool {
+ public:
+  static OffScreenBitmapPool* GetInstance();
+
+  // Returns a bitmap whose pixels come from the pool when a buffer of a
+  // matching size class is free, falling back to a fresh allocation. The
+  // buffer returns to the pool when the last reference to the bitmap's
+  // pixels drops. Pixel contents are undefined; callers overwrite them.
+  SkBitmap Allocate(const SkImageInfo& info);
+
+  // Releases every pooled buffer back to the system allocator.
+  void Trim();
+
+  size_t pooled_bytes() const;
+
+ private:
+  friend class base::NoDestructor<OffScreenBitmapPool>;
+
+  // Size classes are powers of two from kMinPooledSize to kMaxPooledSize;
+  // buffers outside that range are not pooled.
+  static constexpr size_t kMinPooledSize = 1 << 16;   // 64 KiB
+  static constexpr size_t kMaxPooledSize = 1 << 27;   // 128 MiB
+  static constexpr int kNumClasses = 12;
+  static constexpr size_t kMaxBuffersPerClass = 3;
+
+  OffScreenBitmapPool();
+  ~OffScreenBitmapPool();
+
+  // Returns the class index for |length| and writes the rounded-up buffer
+  // size to |rounded|, or returns -1 when |length| is not pooled.
+  static int ClassIndex(size_t length, size_t* rounded);
+
+  // Skia release proc for pooled pixels; |context| encodes the size class.
+  static void ReleasePixels(void* addr, void* context);
+
+  void Release(void* data, size_t rounded);
+  void EnsurePressureListener();
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
+  mutable base::Lock lock_;
+  std::vector<void*> free_buffers_[kNumClasses];
+  std::unique_ptr<base::MemoryPressureListener> pressure_listener_;
+
+  DISALLOW_COPY_AND_ASSIGN(OffScreenBitmapPool);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_OSR_OSR_BITMAP_POOL_H_
@@ -7,9 +7,12 @@
 #include <utility>
 
 #include "base/memory/shared_memory.h"
+#include "base/time/time.h"
 #include "components/viz/common/resources/resource_format.h"
 #include "components/viz/common/resources/resource_sizes.h"
 #include "mojo/public/cpp/system/platform_handle.h"
+#include "shell/browser/osr/osr_bitmap_pool.h"
+#include "shell/browser/osr/osr_paint_metrics.h"
 #include "skia/ext/platform_canvas.h"
 #include "third_party/skia/include/core/SkColor.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -70,14 +73,63 @@ void LayeredWindowUpdater::Draw(const gfx::Rect& damage_rect,
   SkPixmap pixmap;
   SkBitmap bitmap;
 
-  if (active_ && canvas_->peekPixels(&pixmap)) {
-    bitmap.installPixels(pixmap);
-    callback_.Run(damage_rect, bitmap);
+  if (active_ && canvas_ && canvas_->peekPixels(&pixmap)) {
+    const base::TimeTicks copy_start = base::TimeTicks::Now();
+    if (SnapshotToPool(pixmap, damage_rect, &bitmap)) {
+      OffScreenPaintMetrics::Get()->RecordCopy(base::TimeTicks::Now() -
+                                               copy_start);
+      callback_.Run(damage_rect, bitmap);
+    } else {
+      OffScreenPaintMetrics::Get()->RecordDroppedFrame();
+    }
   }
 
+  // Acknowledge immediately so the compositor can start the next frame
+  // without waiting on the consumer.
   std::move(draw_callback).Run();
 }
 
+bool LayeredWindowUpdater::SnapshotToPool(const SkPixmap& pixmap,
+                                          const gfx::Rect& damage_rect,
+                                          SkBitmap* out) {
+  // Every slot except the one drawn below falls further behind the canvas.
+  for (SwapchainSlot& slot : slots_)
+    slot.stale.Union(damage_rect);
+
+  for (int i = 0; i < kNumSwapchainSlots; ++i) {
+    const int index = (next_slot_ + i) % kNumSwapchainSlots;
+    SwapchainSlot& slot = slots_[index];
+
+    // We hold the only long-lived reference; any extra one belongs to a
+    // consumer that is still using the slot.
+    if (!slot.bitmap.isNull() && !slot.bitmap.pixelRef()->unique())
+      continue;
+
+    gfx::Rect copy_rect = slot.stale;
+    if (slot.bitmap.isNull() || slot.bitmap.width() != pixmap.width() ||
+        slot.bitmap.height() != pixmap.height()) {
+      slot.bitmap = OffScreenBitmapPool::GetInstance()->Allocate(pixmap.info());
+      copy_rect = gfx::Rect(pixmap.width(), pixmap.height());
+    }
+    copy_rect.Intersect(gfx::Rect(pixmap.width(), pixmap.height()));
+
+    SkPixmap src;
+    if (!copy_rect.IsEmpty() &&
+        pixmap.extractSubset(&src, gfx::RectToSkIRect(copy_rect))) {
+      slot.bitmap.writePixels(src, copy_rect.x(), copy_rect.y());
+    }
+
+    slot.stale = gfx::Rect();
+    next_slot_ = (index + 1) % kNumSwapchainSlots;
+    *out = slot.bitmap;
+    return true;
+  }
+
+  // The consumer is holding every slot; drop this frame instead of stalling
+  // the compositor or tearing a buffer that is in use.
+  return false;
+}
+
 OffScreenHostDisplayClient::OffScreenHostDisplayClient(
     gfx::AcceleratedWidget widget,
     OnPaintCallback callback)
@@ -13,6 +13,7 @@
 #include "services/viz/privileged/mojom/compositing/layered_window_updater.mojom.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkCanvas.h"
+#include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/native_widget_types.h"
 
 namespace electron {
@@ -33,9 +34,33 @@ class LayeredWindowUpdater : public viz::mojom::LayeredWindowUpdater {
   void Draw(const gfx::Rect& damage_rect, DrawCallback draw_callback) override;
 
  private:
+  // Copies the current canvas contents into a pooled swapchain slot and
+  // returns the slot's bitmap, or false when every slot is still held by the
+  // consumer. Only the area that changed since the slot was last used is
+  // copied.
+  bool SnapshotToPool(const SkPixmap& pixmap,
+                      const gfx::Rect& damage_rect,
+                      SkBitmap* out);
+
+  static constexpr int kNumSwapchainSlots = 3;
+
+  // The compositor reuses the shared-memory canvas as soon as Draw() is
+  // acknowledged, so frames handed to the consumer are snapshotted into this
+  // small swapchain. A slot is recycled once the consumer drops its reference
+  // to the bitmap, letting capture and consumption proceed concurrently
+  // without tearing or stalling the compositor.
+  struct SwapchainSlot {
+    SkBitmap bitmap;
+    // Part of the canvas that is newer than this slot's contents; the next
+    // draw into the slot copies this union along with the new damage.
+    gfx::Rect stale;
+  };
+
   OnPaintCallback callback_;
   mojo::Binding<viz::mojom::LayeredWindowUpdater> binding_;
   std::unique_ptr<SkCanvas> canvas_;
+  SwapchainSlot slots_[kNumSwapchainSlots];
+  int next_slot_ = 0;
   bool active_ = false;
 
 #if !defined(WIN32)
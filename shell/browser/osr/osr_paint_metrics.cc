@@ -0,0 +1,50 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/osr/osr_paint_metrics.h"
+
+#include "base/no_destructor.h"
+
+namespace electron {
+
+OffScreenPaintMetrics::OffScreenPaintMetrics() = default;
+
+OffScreenPaintMetrics::~OffScreenPaintMetrics() = default;
+
+// static
+OffScreenPaintMetrics* OffScreenPaintMetrics::Get() {
+  static base::NoDestructor<OffScreenPaintMetrics> instance;
+  return instance.get();
+}
+
+void OffScreenPaintMetrics::RecordCapture(base::TimeDelta latency) {
+  ++frames_captured_;
+  total_capture_latency_ += latency;
+  if (latency > max_capture_latency_)
+    max_capture_latency_ = latency;
+}
+
+void OffScreenPaintMetrics::RecordCopy(base::TimeDelta copy_time) {
+  ++copy_count_;
+  total_copy_time_ += copy_time;
+  if (copy_time > max_copy_time_)
+    max_copy_time_ = copy_time;
+}
+
+void OffScreenPaintMetrics::RecordDroppedFrame() {
+  ++frames_dropped_;
+}
+
+void OffScreenPaintMetrics::RecordSubscriberFrame() {
+  ++subscriber_frames_;
+}
+
+void OffScreenPaintMetrics::RecordPoolAllocation(bool hit) {
+  if (hit)
+    ++pool_hits_;
+  else
+    ++pool_misses_;
+}
+
+}  // namespace electron
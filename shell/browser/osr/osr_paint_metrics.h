@@ -0,0 +1,72 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_OSR_OSR_PAINT_METRICS_H_
+#define SHELL_BROWSER_OSR_OSR_PAINT_METRICS_H_
+
+#include "base/macros.h"
+#include "base/time/time.h"
+
+namespace electron {
+
+// Cheap counters for the offscreen rendering pipeline: captured and dropped
+// frames, capture latency, copy time and buffer-pool hit rate. Every OSR
+// stage runs on the UI thread, so recording is plain arithmetic with no
+// locking.
+class OffScreenPaintMetrics {
+ public:
+  // Returns the process-wide instance, created on first use.
+  static OffScreenPaintMetrics* Get();
+
+  // A captured frame arrived; |latency| is the time from capture begin to
+  // delivery, or zero when the capturer did not report it.
+  void RecordCapture(base::TimeDelta latency);
+
+  // A frame's pixels were copied (backing store or swapchain slot).
+  void RecordCopy(base::TimeDelta copy_time);
+
+  // A frame was dropped because every swapchain slot was held.
+  void RecordDroppedFrame();
+
+  // A frame was delivered to a beginFrameSubscription subscriber.
+  void RecordSubscriberFrame();
+
+  // The bitmap pool served an allocation from a recycled buffer (|hit|) or
+  // had to fall back to the system allocator.
+  void RecordPoolAllocation(bool hit);
+
+  uint64_t frames_captured() const { return frames_captured_; }
+  uint64_t frames_dropped() const { return frames_dropped_; }
+  uint64_t subscriber_frames() const { return subscriber_frames_; }
+  uint64_t copy_count() const { return copy_count_; }
+  uint64_t pool_hits() const { return pool_hits_; }
+  uint64_t pool_misses() const { return pool_misses_; }
+  base::TimeDelta total_capture_latency() const {
+    return total_capture_latency_;
+  }
+  base::TimeDelta max_capture_latency() const { return max_capture_latency_; }
+  base::TimeDelta total_copy_time() const { return total_copy_time_; }
+  base::TimeDelta max_copy_time() const { return max_copy_time_; }
+
+ private:
+  OffScreenPaintMetrics();
+  ~OffScreenPaintMetrics();
+
+  uint64_t frames_captured_ = 0;
+  uint64_t frames_dropped_ = 0;
+  uint64_t subscriber_frames_ = 0;
+  uint64_t copy_count_ = 0;
+  uint64_t pool_hits_ = 0;
+  uint64_t pool_misses_ = 0;
+  base::TimeDelta total_capture_latency_;
+  base::TimeDelta max_capture_latency_;
+  base::TimeDelta total_copy_time_;
+  base::TimeDelta max_copy_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(OffScreenPaintMetrics);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_OSR_OSR_PAINT_METRICS_H_
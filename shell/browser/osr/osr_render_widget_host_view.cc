@@ -32,6 +32,8 @@
 #include "content/public/browser/gpu_data_manager.h"
 #include "content/public/browser/render_process_host.h"
 #include "media/base/video_frame.h"
+#include "shell/browser/osr/osr_bitmap_pool.h"
+#include "shell/browser/osr/osr_paint_metrics.h"
 #include "third_party/blink/public/platform/web_input_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "ui/compositor/compositor.h"
@@ -749,11 +751,27 @@ bool OffScreenRenderWidgetHostView::UpdateNSViewAndDisplay() {
 }
 #endif
 
+std::unique_ptr<
+    base::CallbackList<void(const gfx::Rect&, const SkBitmap&)>::Subscription>
+OffScreenRenderWidgetHostView::AddCaptureCallback(
+    const OnPaintCallback& callback) {
+  return capture_callbacks_.Add(callback);
+}
+
 void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
                                             const SkBitmap& bitmap) {
-  backing_ = std::make_unique<SkBitmap>();
-  backing_->allocN32Pixels(bitmap.width(), bitmap.height(), !transparent_);
+  // Fan the frame out to capture subscribers before compositing mutates any
+  // state; the bitmap they receive shares the captured pixels.
+  capture_callbacks_.Notify(damage_rect, bitmap);
+
+  const base::TimeTicks copy_start = base::TimeTicks::Now();
+  backing_ = std::make_unique<SkBitmap>(
+      OffScreenBitmapPool::GetInstance()->Allocate(SkImageInfo::MakeN32(
+          bitmap.width(), bitmap.height(),
+          transparent_ ? kPremul_SkAlphaType : kOpaque_SkAlphaType)));
   bitmap.readPixels(backing_->pixmap());
+  OffScreenPaintMetrics::Get()->RecordCopy(base::TimeTicks::Now() -
+                                           copy_start);
 
   if (IsPopupWidget() && parent_callback_) {
     parent_callback_.Run(this->popup_position_);
@@ -784,8 +802,9 @@ void OffScreenRenderWidgetHostView::CompositeFrame(
   if (proxy_views_.size() == 0 && !popup_host_view_) {
     frame = GetBacking();
   } else {
-    frame.allocN32Pixels(size_in_pixels.width(), size_in_pixels.height(),
-                         false);
+    frame = OffScreenBitmapPool::GetInstance()->Allocate(
+        SkImageInfo::MakeN32(size_in_pixels.width(), size_in_pixels.height(),
+                             kPremul_SkAlphaType));
     if (!GetBacking().drawsNothing()) {
       SkCanvas canvas(frame);
       canvas.writePixels(GetBacking(), 0, 0);
@@ -1028,6 +1047,34 @@ int OffScreenRenderWidgetHostView::GetFrameRate() const {
   return frame_rate_;
 }
 
+void OffScreenRenderWidgetHostView::SetAdaptiveFrameRate(int min_frame_rate,
+                                                         int max_frame_rate) {
+  min_frame_rate = std::min(std::max(min_frame_rate, 1), 240);
+  max_frame_rate = std::min(std::max(max_frame_rate, min_frame_rate), 240);
+
+  // Begin-frame scheduling follows the ceiling; the video consumer throttles
+  // the actual capture rate between the bounds.
+  frame_rate_ = max_frame_rate;
+  SetupFrameRate(true);
+
+  if (video_consumer_)
+    video_consumer_->SetAdaptiveFrameRate(min_frame_rate, max_frame_rate);
+
+  for (auto* guest_host_view : guest_host_views_)
+    guest_host_view->SetAdaptiveFrameRate(min_frame_rate, max_frame_rate);
+}
+
+void OffScreenRenderWidgetHostView::SetPaintDirtyOnly(bool dirty_only) {
+  paint_dirty_only_ = dirty_only;
+
+  for (auto* guest_host_view : guest_host_views_)
+    guest_host_view->SetPaintDirtyOnly(dirty_only);
+}
+
+bool OffScreenRenderWidgetHostView::IsPaintDirtyOnly() const {
+  return paint_dirty_only_;
+}
+
 ui::Compositor* OffScreenRenderWidgetHostView::GetCompositor() const {
   return compositor_.get();
 }
@@ -14,6 +14,7 @@
 #include <windows.h>
 #endif
 
+#include "base/callback_list.h"
 #include "base/process/kill.h"
 #include "base/threading/thread.h"
 #include "base/time/time.h"
@@ -179,6 +180,15 @@ class OffScreenRenderWidgetHostView : public content::RenderWidgetHostViewBase,
 
   void OnPaint(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
   void OnPopupPaint(const gfx::Rect& damage_rect);
+
+  // Capture hub: fans the view's single capture stream out to additional
+  // consumers without extra captures or copies. Every subscriber receives the
+  // same SkBitmap sharing the captured pixels; the backing memory is returned
+  // to the capturer when the last holder drops its reference. The returned
+  // subscription unsubscribes when destroyed.
+  std::unique_ptr<
+      base::CallbackList<void(const gfx::Rect&, const SkBitmap&)>::Subscription>
+  AddCaptureCallback(const OnPaintCallback& callback);
   void OnProxyViewPaint(const gfx::Rect& damage_rect) override;
 
   gfx::Size SizeInPixels();
@@ -203,6 +213,14 @@ class OffScreenRenderWidgetHostView : public content::RenderWidgetHostViewBase,
 
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  // Capture rate follows damage activity between the given bounds instead of
+  // staying fixed; calling SetFrameRate switches back to a fixed rate.
+  void SetAdaptiveFrameRate(int min_frame_rate, int max_frame_rate);
+
+  // When enabled, paint events for small damage deliver only the dirty
+  // sub-rectangle instead of the full framebuffer.
+  void SetPaintDirtyOnly(bool dirty_only);
+  bool IsPaintDirtyOnly() const;
 
   ui::Compositor* GetCompositor() const;
   ui::Layer* GetRootLayer() const;
@@ -247,10 +265,13 @@ class OffScreenRenderWidgetHostView : public content::RenderWidgetHostViewBase,
 
   const bool transparent_;
   OnPaintCallback callback_;
+  base::CallbackList<void(const gfx::Rect&, const SkBitmap&)>
+      capture_callbacks_;
   OnPopupPaintCallback parent_callback_;
 
   int frame_rate_ = 0;
   int frame_rate_threshold_us_ = 0;
+  bool paint_dirty_only_ = false;
 
   base::Time last_time_ = base::Time::Now();
 
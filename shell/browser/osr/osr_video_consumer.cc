@@ -4,10 +4,12 @@
 
 #include "shell/browser/osr/osr_video_consumer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "media/base/video_frame_metadata.h"
 #include "media/capture/mojom/video_capture_types.mojom.h"
+#include "shell/browser/osr/osr_paint_metrics.h"
 #include "shell/browser/osr/osr_render_widget_host_view.h"
 #include "ui/gfx/skbitmap_operations.h"
 
@@ -40,21 +42,80 @@ void OffScreenVideoConsumer::SetActive(bool active) {
 }
 
 void OffScreenVideoConsumer::SetFrameRate(int frame_rate) {
+  adaptive_ = false;
   video_capturer_->SetMinCapturePeriod(base::TimeDelta::FromSeconds(1) /
                                        frame_rate);
 }
 
+void OffScreenVideoConsumer::SetAdaptiveFrameRate(int min_frame_rate,
+                                                  int max_frame_rate) {
+  adaptive_ = true;
+  min_frame_rate_ = min_frame_rate;
+  max_frame_rate_ = max_frame_rate;
+  // Start at the ceiling so a burst of activity right after enabling is not
+  // throttled.
+  current_frame_rate_ = max_frame_rate;
+  window_start_ = base::TimeTicks();
+  frames_in_window_ = 0;
+  idle_windows_ = 0;
+  video_capturer_->SetMinCapturePeriod(base::TimeDelta::FromSeconds(1) /
+                                       current_frame_rate_);
+}
+
+void OffScreenVideoConsumer::UpdateAdaptiveFrameRate() {
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (window_start_.is_null())
+    window_start_ = now;
+  ++frames_in_window_;
+
+  base::TimeDelta elapsed = now - window_start_;
+  if (elapsed < base::TimeDelta::FromSeconds(1))
+    return;
+
+  // The capturer is damage driven, so the observed rate tracks how often the
+  // content actually changed within the current throttle.
+  int observed_fps = static_cast<int>(frames_in_window_ / elapsed.InSecondsF());
+  if (observed_fps >= current_frame_rate_ * 3 / 4) {
+    // Damage is saturating the current rate; ramp up quickly.
+    idle_windows_ = 0;
+    current_frame_rate_ = std::min(max_frame_rate_, current_frame_rate_ * 2);
+  } else if (observed_fps < current_frame_rate_ / 4) {
+    // Require two quiet windows before ramping down, so brief pauses in an
+    // animation do not cause the rate to flap.
+    if (++idle_windows_ >= 2) {
+      idle_windows_ = 0;
+      current_frame_rate_ = std::max(min_frame_rate_, current_frame_rate_ / 2);
+    }
+  } else {
+    idle_windows_ = 0;
+  }
+
+  video_capturer_->SetMinCapturePeriod(base::TimeDelta::FromSeconds(1) /
+                                       current_frame_rate_);
+  window_start_ = now;
+  frames_in_window_ = 0;
+}
+
 void OffScreenVideoConsumer::SizeChanged() {
   video_capturer_->SetResolutionConstraints(view_->SizeInPixels(),
                                             view_->SizeInPixels(), true);
   video_capturer_->RequestRefreshFrame();
 }
 
+// NOTE: FrameSinkVideoCapturer only delivers frames as shared memory; the
+// readback from the GPU happens inside the viz service before the frame
+// reaches this consumer. A zero-readback path exporting platform GPU handles
+// (DXGI/IOSurface/dmabuf) would need texture delivery support in the capturer
+// mojom itself. Everything below is already zero-copy: the SkBitmap wraps the
+// shared memory mapping and pins it until the consumer is done.
 void OffScreenVideoConsumer::OnFrameCaptured(
     base::ReadOnlySharedMemoryRegion data,
     ::media::mojom::VideoFrameInfoPtr info,
     const gfx::Rect& content_rect,
     viz::mojom::FrameSinkVideoConsumerFrameCallbacksPtr callbacks) {
+  if (adaptive_)
+    UpdateAdaptiveFrameRate();
+
   if (!CheckContentRect(content_rect)) {
     gfx::Size view_size = view_->SizeInPixels();
     video_capturer_->SetResolutionConstraints(view_size, view_size, true);
@@ -107,6 +168,14 @@ void OffScreenVideoConsumer::OnFrameCaptured(
 
   media::VideoFrameMetadata metadata;
   metadata.MergeInternalValuesFrom(info->metadata);
+
+  base::TimeTicks capture_begin;
+  OffScreenPaintMetrics::Get()->RecordCapture(
+      metadata.GetTimeTicks(media::VideoFrameMetadata::CAPTURE_BEGIN_TIME,
+                            &capture_begin)
+          ? base::TimeTicks::Now() - capture_begin
+          : base::TimeDelta());
+
   gfx::Rect damage_rect;
 
   auto UPDATE_RECT = media::VideoFrameMetadata::CAPTURE_UPDATE_RECT;
@@ -114,6 +183,22 @@ void OffScreenVideoConsumer::OnFrameCaptured(
     damage_rect = content_rect;
   }
 
+  // In dirty-only mode ship just the damaged sub-rectangle when the damage is
+  // small, so a blinking cursor does not deliver the whole framebuffer. The
+  // subset shares the captured frame's pixels, so no copy is made; frames
+  // where most of the content changed are still delivered whole.
+  if (view_->IsPaintDirtyOnly() && !damage_rect.IsEmpty() &&
+      damage_rect.size().GetArea() * 2 < content_rect.size().GetArea()) {
+    SkBitmap dirty_bitmap;
+    if (bitmap.extractSubset(
+            &dirty_bitmap,
+            SkIRect::MakeXYWH(damage_rect.x(), damage_rect.y(),
+                              damage_rect.width(), damage_rect.height()))) {
+      callback_.Run(damage_rect, dirty_bitmap);
+      return;
+    }
+  }
+
   callback_.Run(damage_rect, bitmap);
 }
 
@@ -9,6 +9,7 @@
 
 #include "base/callback.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/viz/host/client_frame_sink_video_capturer.h"
 
 namespace electron {
@@ -26,6 +27,10 @@ class OffScreenVideoConsumer : public viz::mojom::FrameSinkVideoConsumer {
 
   void SetActive(bool active);
   void SetFrameRate(int frame_rate);
+  // Lets the capture rate follow damage activity: it ramps up towards
+  // |max_frame_rate| while content is changing at the current rate and decays
+  // towards |min_frame_rate| when it goes quiet.
+  void SetAdaptiveFrameRate(int min_frame_rate, int max_frame_rate);
   void SizeChanged();
 
  private:
@@ -39,8 +44,21 @@ class OffScreenVideoConsumer : public viz::mojom::FrameSinkVideoConsumer {
 
   bool CheckContentRect(const gfx::Rect& content_rect);
 
+  // Evaluates the damage activity of the last window and adjusts the capture
+  // rate; called for every captured frame while adaptive mode is on.
+  void UpdateAdaptiveFrameRate();
+
   OnPaintCallback callback_;
 
+  // Adaptive frame rate state.
+  bool adaptive_ = false;
+  int min_frame_rate_ = 0;
+  int max_frame_rate_ = 0;
+  int current_frame_rate_ = 0;
+  base::TimeTicks window_start_;
+  int frames_in_window_ = 0;
+  int idle_windows_ = 0;
+
   OffScreenRenderWidgetHostView* view_;
   std::unique_ptr<viz::ClientFrameSinkVideoCapturer> video_capturer_;
 
@@ -120,9 +120,11 @@ OffScreenWebContentsView::CreateViewForWidget(
         render_widget_host->GetView());
   }
 
-  return new OffScreenRenderWidgetHostView(
+  auto* view = new OffScreenRenderWidgetHostView(
       transparent_, painting_, GetFrameRate(), callback_, render_widget_host,
       nullptr, GetSize());
+  view->SetPaintDirtyOnly(paint_dirty_only_);
+  return view;
 }
 
 content::RenderWidgetHostViewBase*
@@ -213,6 +215,32 @@ int OffScreenWebContentsView::GetFrameRate() const {
   }
 }
 
+void OffScreenWebContentsView::SetAdaptiveFrameRate(int min_frame_rate,
+                                                    int max_frame_rate) {
+  auto* view = GetView();
+  frame_rate_ = max_frame_rate;
+  if (view != nullptr) {
+    view->SetAdaptiveFrameRate(min_frame_rate, max_frame_rate);
+  }
+}
+
+void OffScreenWebContentsView::SetPaintDirtyOnly(bool dirty_only) {
+  auto* view = GetView();
+  paint_dirty_only_ = dirty_only;
+  if (view != nullptr) {
+    view->SetPaintDirtyOnly(dirty_only);
+  }
+}
+
+bool OffScreenWebContentsView::IsPaintDirtyOnly() const {
+  auto* view = GetView();
+  if (view != nullptr) {
+    return view->IsPaintDirtyOnly();
+  } else {
+    return paint_dirty_only_;
+  }
+}
+
 OffScreenRenderWidgetHostView* OffScreenWebContentsView::GetView() const {
   if (web_contents_) {
     return static_cast<OffScreenRenderWidgetHostView*>(
@@ -82,6 +82,9 @@ class OffScreenWebContentsView : public content::WebContentsView,
   bool IsPainting() const;
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  void SetAdaptiveFrameRate(int min_frame_rate, int max_frame_rate);
+  void SetPaintDirtyOnly(bool dirty_only);
+  bool IsPaintDirtyOnly() const;
 
  private:
 #if defined(OS_MACOSX)
@@ -96,6 +99,7 @@ class OffScreenWebContentsView : public content::WebContentsView,
   const bool transparent_;
   bool painting_ = true;
   int frame_rate_ = 60;
+  bool paint_dirty_only_ = false;
   OnPaintCallback callback_;
 
   // Weak refs.
@@ -4,10 +4,13 @@
 
 #include "shell/browser/printing/print_preview_message_handler.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "base/bind.h"
+#include "base/files/file.h"
 #include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/ref_counted_memory.h"
@@ -23,6 +26,8 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/web_contents.h"
+#include "gin/converter.h"
+#include "shell/browser/api/atom_api_web_contents.h"
 #include "shell/common/gin_helper/locker.h"
 
 #include "shell/common/node_includes.h"
@@ -47,6 +52,34 @@ void StopWorker(int document_cookie) {
   }
 }
 
+// Chunk size used when streaming a composited document to disk. The
+// document itself stays in the compositor's shared memory until each
+// chunk is written, so this bounds the browser-process heap cost.
+constexpr size_t kPdfStreamChunkSize = 1024 * 1024;
+
+bool StreamDataToFile(
+    scoped_refptr<base::RefCountedMemory> data,
+    const base::FilePath& path,
+    base::RepeatingCallback<void(int64_t, int64_t)> progress) {
+  base::File file(path,
+                  base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+  if (!file.IsValid())
+    return false;
+
+  const char* bytes = reinterpret_cast<const char*>(data->front());
+  const int64_t total = data->size();
+  int64_t written = 0;
+  while (written < total) {
+    int chunk = static_cast<int>(
+        std::min<int64_t>(kPdfStreamChunkSize, total - written));
+    if (file.WriteAtCurrentPos(bytes + written, chunk) != chunk)
+      return false;
+    written += chunk;
+    progress.Run(written, total);
+  }
+  return true;
+}
+
 }  // namespace
 
 PrintPreviewMessageHandler::PrintPreviewMessageHandler(
@@ -149,6 +182,13 @@ void PrintPreviewMessageHandler::PrintToPDF(
   options.GetInteger(printing::kPreviewRequestID, &request_id);
   promise_map_.emplace(request_id, std::move(promise));
 
+  std::string output_path;
+  if (options.GetString("outputPath", &output_path)) {
+    options.Remove("outputPath", nullptr);
+    path_map_.emplace(request_id,
+                      base::FilePath::FromUTF8Unsafe(output_path));
+  }
+
   auto* focused_frame = web_contents()->GetFocusedFrame();
   auto* rfh = focused_frame && focused_frame->HasSelection()
                   ? focused_frame
@@ -163,6 +203,7 @@ util::Promise<v8::Local<v8::Value>> PrintPreviewMessageHandler::GetPromise(
 
   util::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
   promise_map_.erase(it);
+  path_map_.erase(request_id);
 
   return promise;
 }
@@ -172,6 +213,33 @@ void PrintPreviewMessageHandler::ResolvePromise(
     scoped_refptr<base::RefCountedMemory> data_bytes) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
+  auto path_iter = path_map_.find(request_id);
+  if (path_iter != path_map_.end()) {
+    // Stream the document to disk on the thread pool instead of copying
+    // it into a JS Buffer; |data_bytes| is a mapping of the compositor's
+    // shared memory, so the UI thread never touches the payload.
+    base::FilePath path = path_iter->second;
+    path_map_.erase(path_iter);
+    auto progress = base::BindRepeating(
+        [](base::WeakPtr<PrintPreviewMessageHandler> handler, int64_t written,
+           int64_t total) {
+          base::PostTask(
+              FROM_HERE, {BrowserThread::UI},
+              base::BindOnce(&PrintPreviewMessageHandler::EmitStreamProgress,
+                             handler, written, total));
+        },
+        weak_ptr_factory_.GetWeakPtr());
+    base::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        {base::ThreadPool(), base::MayBlock(),
+         base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(&StreamDataToFile, std::move(data_bytes), path,
+                       std::move(progress)),
+        base::BindOnce(&PrintPreviewMessageHandler::OnPdfStreamedToFile,
+                       weak_ptr_factory_.GetWeakPtr(), request_id, path));
+    return;
+  }
+
   util::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
 
   v8::Isolate* isolate = promise.isolate();
@@ -189,6 +257,39 @@ void PrintPreviewMessageHandler::ResolvePromise(
   promise.Resolve(buffer);
 }
 
+void PrintPreviewMessageHandler::OnPdfStreamedToFile(
+    int request_id,
+    const base::FilePath& path,
+    bool success) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  util::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
+  if (!success) {
+    promise.RejectWithErrorMessage("Failed to write PDF to " +
+                                   path.AsUTF8Unsafe());
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  promise.Resolve(gin::StringToV8(isolate, path.AsUTF8Unsafe()));
+}
+
+void PrintPreviewMessageHandler::EmitStreamProgress(int64_t written,
+                                                    int64_t total) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  auto api_contents = api::WebContents::From(isolate, web_contents());
+  if (!api_contents.IsEmpty())
+    api_contents->Emit("print-to-pdf-progress", written, total);
+}
+
 void PrintPreviewMessageHandler::RejectPromise(int request_id) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
@@ -7,6 +7,7 @@
 
 #include <map>
 
+#include "base/files/file_path.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "components/services/pdf_compositor/public/mojom/pdf_compositor.mojom.h"
@@ -62,10 +63,21 @@ class PrintPreviewMessageHandler
                       scoped_refptr<base::RefCountedMemory> data_bytes);
   void RejectPromise(int request_id);
 
+  // Completion and progress for documents streamed to a file instead of
+  // returned as a Buffer.
+  void OnPdfStreamedToFile(int request_id,
+                           const base::FilePath& path,
+                           bool success);
+  void EmitStreamProgress(int64_t written, int64_t total);
+
   using PromiseMap =
       std::map<int, electron::util::Promise<v8::Local<v8::Value>>>;
   PromiseMap promise_map_;
 
+  // Requests whose output should be streamed to a file; the data never
+  // becomes a JS Buffer in that case.
+  std::map<int, base::FilePath> path_map_;
+
   base::WeakPtrFactory<PrintPreviewMessageHandler> weak_ptr_factory_;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
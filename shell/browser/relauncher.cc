@@ -21,6 +21,16 @@
 #include "base/posix/eintr_wrapper.h"
 #endif
 
+#if defined(OS_LINUX)
+#include <sys/stat.h>
+
+#include "base/files/scoped_file.h"
+#include "base/memory/platform_shared_memory_region.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/unguessable_token.h"
+#include "shell/common/asar/asar_util.h"
+#endif
+
 namespace relauncher {
 
 namespace internal {
@@ -29,11 +39,58 @@ namespace internal {
 const int kRelauncherSyncFD = STDERR_FILENO + 1;
 #endif
 
+#if defined(OS_LINUX)
+const int kWarmHandoffFD = kRelauncherSyncFD + 1;
+const CharType* kWarmHandoffArg = FILE_PATH_LITERAL("--warm-handoff");
+const char kWarmHandoffSwitch[] = "warm-relaunch-handoff";
+
+void ImportWarmHandoffIfPresent() {
+  const base::CommandLine* command_line =
+      base::CommandLine::ForCurrentProcess();
+  if (!command_line->HasSwitch(kWarmHandoffSwitch))
+    return;
+
+  base::ScopedFD fd(kWarmHandoffFD);
+  struct stat info;
+  if (fstat(fd.get(), &info) != 0 || info.st_size <= 0)
+    return;
+
+  base::subtle::PlatformSharedMemoryRegion platform =
+      base::subtle::PlatformSharedMemoryRegion::Take(
+          base::subtle::ScopedFDPair(std::move(fd), base::ScopedFD()),
+          base::subtle::PlatformSharedMemoryRegion::Mode::kReadOnly,
+          static_cast<size_t>(info.st_size), base::UnguessableToken::Create());
+  base::ReadOnlySharedMemoryRegion region =
+      base::ReadOnlySharedMemoryRegion::Deserialize(std::move(platform));
+  if (region.IsValid())
+    asar::ImportHeaderHandoffRegion(std::move(region));
+}
+#endif  // defined(OS_LINUX)
+
 const CharType* kRelauncherTypeArg = FILE_PATH_LITERAL("--type=relauncher");
 const CharType* kRelauncherArgSeparator = FILE_PATH_LITERAL("---");
 
 }  // namespace internal
 
+#if defined(OS_LINUX)
+namespace {
+
+// Packs the asar headers this process has parsed into a shared memory
+// region and returns its file descriptor, ready to be inherited across
+// the relauncher into the relaunched process.
+base::ScopedFD CreateWarmHandoffFD() {
+  base::ReadOnlySharedMemoryRegion region = asar::CreateHeaderHandoffRegion();
+  if (!region.IsValid())
+    return base::ScopedFD();
+  base::subtle::PlatformSharedMemoryRegion platform =
+      base::ReadOnlySharedMemoryRegion::TakeHandleForSerialization(
+          std::move(region));
+  return std::move(platform.PassPlatformHandle().fd);
+}
+
+}  // namespace
+#endif  // defined(OS_LINUX)
+
 bool RelaunchApp(const StringVector& argv) {
   // Use the currently-running application's helper process. The automatic
   // update feature is careful to leave the currently-running version alone,
@@ -61,10 +118,27 @@ bool RelaunchAppWithHelper(const base::FilePath& helper,
   relaunch_argv.insert(relaunch_argv.end(), relauncher_args.begin(),
                        relauncher_args.end());
 
+#if defined(OS_LINUX)
+  // Hand the asar headers this process already parsed to the relaunched
+  // process over inherited shared memory, so its first launch skips
+  // re-reading headers for archives an update didn't touch. The region
+  // stays alive while the relauncher holds the descriptor, even after
+  // this process exits.
+  base::ScopedFD warm_handoff_fd = CreateWarmHandoffFD();
+  if (warm_handoff_fd.is_valid())
+    relaunch_argv.push_back(internal::kWarmHandoffArg);
+#endif
+
   relaunch_argv.push_back(internal::kRelauncherArgSeparator);
 
   relaunch_argv.insert(relaunch_argv.end(), argv.begin(), argv.end());
 
+#if defined(OS_LINUX)
+  if (warm_handoff_fd.is_valid()) {
+    relaunch_argv.push_back(StringType("--") + internal::kWarmHandoffSwitch);
+  }
+#endif
+
 #if defined(OS_POSIX)
   int pipe_fds[2];
   if (HANDLE_EINTR(pipe(pipe_fds)) != 0) {
@@ -94,6 +168,12 @@ bool RelaunchAppWithHelper(const base::FilePath& helper,
 #if defined(OS_POSIX)
   options.fds_to_remap.push_back(
       std::make_pair(pipe_write_fd.get(), internal::kRelauncherSyncFD));
+#if defined(OS_LINUX)
+  if (warm_handoff_fd.is_valid()) {
+    options.fds_to_remap.push_back(
+        std::make_pair(warm_handoff_fd.get(), internal::kWarmHandoffFD));
+  }
+#endif
   base::Process process = base::LaunchProcess(relaunch_argv, options);
 #elif defined(OS_WIN)
   base::Process process = base::LaunchProcess(
@@ -86,6 +86,26 @@ namespace internal {
 extern const int kRelauncherSyncFD;
 #endif
 
+#if defined(OS_LINUX)
+// The file descriptor on which a warm-relaunch handoff region (the asar
+// headers the parent had parsed, packed by asar::CreateHeaderHandoffRegion)
+// is inherited first by the relauncher and then by the relaunched process.
+extern const int kWarmHandoffFD;
+
+// The relauncher argument requesting that kWarmHandoffFD be forwarded to
+// the relaunched process.
+extern const CharType* kWarmHandoffArg;
+
+// The switch (without leading dashes) appended to the relaunched process'
+// command line so it knows kWarmHandoffFD carries a handoff region.
+extern const char kWarmHandoffSwitch[];
+
+// In the relaunched process, adopts the handoff region inherited on
+// kWarmHandoffFD (when the switch is present) and seeds asar's shared
+// header cache from it. Safe to call on any thread that may do IO.
+void ImportWarmHandoffIfPresent();
+#endif
+
 // The "type" argument identifying a relauncher process ("--type=relauncher").
 extern const CharType* kRelauncherTypeArg;
 
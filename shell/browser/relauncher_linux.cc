@@ -12,6 +12,7 @@
 #include "base/files/file_util.h"
 #include "base/files/scoped_file.h"
 #include "base/logging.h"
+#include "base/stl_util.h"
 #include "base/process/launch.h"
 #include "base/synchronization/waitable_event.h"
 
@@ -64,6 +65,10 @@ int LaunchProgram(const StringVector& relauncher_args,
   options.fds_to_remap.emplace_back(devnull.get(), STDERR_FILENO);
   options.fds_to_remap.emplace_back(devnull.get(), STDOUT_FILENO);
 
+  // Forward the warm-relaunch handoff region when the parent created one.
+  if (base::Contains(relauncher_args, kWarmHandoffArg))
+    options.fds_to_remap.emplace_back(kWarmHandoffFD, kWarmHandoffFD);
+
   base::Process process = base::LaunchProcess(argv, options);
   return process.IsValid() ? 0 : 1;
 }
@@ -29,6 +29,11 @@ const uint32_t kRenderFilteredMessageClasses[] = {
     NetworkHintsMsgStart,
 };
 
+// Window during which repeated preconnect hints for the same origin are
+// answered from the IO-thread cache instead of being re-emitted.
+constexpr base::TimeDelta kPreconnectDedupeWindow =
+    base::TimeDelta::FromSeconds(10);
+
 void EmitPreconnect(content::BrowserContext* browser_context,
                     const GURL& url,
                     bool allow_credentials) {
@@ -76,11 +81,40 @@ void ElectronRenderMessageFilter::OnPreconnect(int render_frame_id,
     return;
   }
 
+  if (!ShouldEmitPreconnect(url, allow_credentials))
+    return;
+
   base::PostTask(FROM_HERE, {BrowserThread::UI},
                  base::BindOnce(&EmitPreconnect, browser_context_, url,
                                 allow_credentials));
 }
 
+bool ElectronRenderMessageFilter::ShouldEmitPreconnect(
+    const GURL& url,
+    bool allow_credentials) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  std::string key = url.GetOrigin().spec() + (allow_credentials ? "|c" : "|n");
+
+  auto it = recent_preconnects_.find(key);
+  if (it != recent_preconnects_.end() &&
+      now - it->second < kPreconnectDedupeWindow) {
+    return false;
+  }
+
+  // Drop expired entries so the cache stays bounded by the number of
+  // distinct origins hinted within the window.
+  for (auto iter = recent_preconnects_.begin();
+       iter != recent_preconnects_.end();) {
+    if (now - iter->second >= kPreconnectDedupeWindow)
+      iter = recent_preconnects_.erase(iter);
+    else
+      ++iter;
+  }
+
+  recent_preconnects_[key] = now;
+  return true;
+}
+
 namespace predictors {
 
 PreconnectRequest::PreconnectRequest(
@@ -5,9 +5,11 @@
 #ifndef SHELL_BROWSER_RENDERER_HOST_ELECTRON_RENDER_MESSAGE_FILTER_H_
 #define SHELL_BROWSER_RENDERER_HOST_ELECTRON_RENDER_MESSAGE_FILTER_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/time/time.h"
 #include "content/public/browser/browser_message_filter.h"
 
 class GURL;
@@ -38,8 +40,16 @@ class ElectronRenderMessageFilter : public content::BrowserMessageFilter {
                     bool allow_credentials,
                     int count);
 
+  // Answers repeated preconnect hints directly on the IO thread; only
+  // origins not seen recently bounce to the UI thread.
+  bool ShouldEmitPreconnect(const GURL& url, bool allow_credentials);
+
   content::BrowserContext* browser_context_;
 
+  // Recently emitted preconnect origins, keyed by origin plus the
+  // credentials flag. Accessed only on the IO thread.
+  std::map<std::string, base::TimeTicks> recent_preconnects_;
+
   DISALLOW_COPY_AND_ASSIGN(ElectronRenderMessageFilter);
 };
 
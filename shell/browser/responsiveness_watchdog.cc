@@ -0,0 +1,175 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/responsiveness_watchdog.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "gin/converter.h"
+
+namespace electron {
+
+namespace {
+
+// How often the main loop is probed, and how long a heartbeat may go
+// unacknowledged before the loop counts as stalled.
+constexpr base::TimeDelta kHeartbeatInterval =
+    base::TimeDelta::FromMilliseconds(500);
+constexpr base::TimeDelta kStallThreshold =
+    base::TimeDelta::FromMilliseconds(1000);
+
+// At most this many interrupts are queued against a stalled isolate; V8
+// coalesces pending interrupts, more would only add bookkeeping.
+constexpr int kMaxPendingInterrupts = 2;
+
+constexpr int kMaxStackFrames = 8;
+
+// Bucket for stalls where no JS sample arrived, i.e. the main thread was
+// blocked in native code or the stall ended before V8 serviced the
+// interrupt.
+constexpr char kNoJsStackBucket[] = "<no js stack>";
+
+int64_t NowUs() {
+  return base::TimeTicks::Now().since_origin().InMicroseconds();
+}
+
+}  // namespace
+
+// static
+ResponsivenessWatchdog* ResponsivenessWatchdog::GetInstance() {
+  static base::NoDestructor<ResponsivenessWatchdog> instance;
+  return instance.get();
+}
+
+ResponsivenessWatchdog::ResponsivenessWatchdog() = default;
+ResponsivenessWatchdog::~ResponsivenessWatchdog() = default;
+
+void ResponsivenessWatchdog::Start(v8::Isolate* isolate) {
+  if (running_)
+    return;
+  isolate_ = isolate;
+  main_task_runner_ = base::ThreadTaskRunnerHandle::Get();
+  last_ack_us_ = NowUs();
+  running_ = true;
+
+  watchdog_thread_ =
+      std::make_unique<base::Thread>("ElectronResponsivenessWatchdog");
+  watchdog_thread_->Start();
+  watchdog_thread_->task_runner()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&ResponsivenessWatchdog::OnWatchdogTick,
+                     base::Unretained(this)),
+      kHeartbeatInterval);
+}
+
+void ResponsivenessWatchdog::Stop() {
+  if (!running_)
+    return;
+  running_ = false;
+  // Joining the thread flushes any in-flight tick, after which no more
+  // heartbeats or interrupts are issued.
+  watchdog_thread_.reset();
+  isolate_ = nullptr;
+  main_task_runner_ = nullptr;
+}
+
+void ResponsivenessWatchdog::OnWatchdogTick() {
+  if (!running_)
+    return;
+
+  base::TimeTicks last_ack =
+      base::TimeTicks() + base::TimeDelta::FromMicroseconds(last_ack_us_);
+  base::TimeDelta since_ack = base::TimeTicks::Now() - last_ack;
+
+  if (since_ack > kStallThreshold) {
+    if (!in_stall_) {
+      in_stall_ = true;
+      stall_start_ = last_ack;
+      base::AutoLock lock(report_lock_);
+      samples_this_stall_ = 0;
+    }
+    // Sample the stalled main thread. The interrupt is serviced by V8
+    // mid-execution when the stall is long-running JS; otherwise it fires
+    // on recovery and is discarded there.
+    if (pending_interrupts_.load() < kMaxPendingInterrupts) {
+      ++pending_interrupts_;
+      isolate_->RequestInterrupt(&ResponsivenessWatchdog::OnInterrupt, this);
+    }
+  } else if (in_stall_) {
+    in_stall_ = false;
+    RecordStall(last_ack - stall_start_);
+  }
+
+  main_task_runner_->PostTask(
+      FROM_HERE, base::BindOnce(&ResponsivenessWatchdog::OnHeartbeatAck,
+                                base::Unretained(this)));
+  watchdog_thread_->task_runner()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&ResponsivenessWatchdog::OnWatchdogTick,
+                     base::Unretained(this)),
+      kHeartbeatInterval);
+}
+
+void ResponsivenessWatchdog::OnHeartbeatAck() {
+  last_ack_us_ = NowUs();
+}
+
+// static
+void ResponsivenessWatchdog::OnInterrupt(v8::Isolate* isolate, void* data) {
+  auto* self = static_cast<ResponsivenessWatchdog*>(data);
+  --self->pending_interrupts_;
+
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::StackTrace> trace = v8::StackTrace::CurrentStackTrace(
+      isolate, kMaxStackFrames, v8::StackTrace::kDetailed);
+
+  std::string signature;
+  for (int i = 0; i < trace->GetFrameCount(); ++i) {
+    v8::Local<v8::StackFrame> frame = trace->GetFrame(isolate, i);
+    std::string function = gin::V8ToString(isolate, frame->GetFunctionName());
+    if (function.empty())
+      function = "<anonymous>";
+    std::string script = gin::V8ToString(isolate, frame->GetScriptName());
+    if (!signature.empty())
+      signature += " < ";
+    signature += function + " (" + script + ":" +
+                 base::NumberToString(frame->GetLineNumber()) + ")";
+  }
+  // An empty trace means the interrupt was serviced between scripts, most
+  // likely on recovery from a native-code stall; nothing to attribute.
+  if (signature.empty())
+    return;
+
+  base::AutoLock lock(self->report_lock_);
+  self->profiles_[signature]++;
+  self->samples_this_stall_++;
+}
+
+void ResponsivenessWatchdog::RecordStall(base::TimeDelta duration) {
+  base::AutoLock lock(report_lock_);
+  stall_count_++;
+  total_stall_time_ += duration;
+  if (duration > longest_stall_)
+    longest_stall_ = duration;
+  if (samples_this_stall_ == 0)
+    profiles_[kNoJsStackBucket]++;
+  samples_this_stall_ = 0;
+}
+
+ResponsivenessWatchdog::Report ResponsivenessWatchdog::GetReport() {
+  base::AutoLock lock(report_lock_);
+  Report report;
+  report.stall_count = stall_count_;
+  report.total_stall_time = total_stall_time_;
+  report.longest_stall = longest_stall_;
+  report.profiles.reserve(profiles_.size());
+  for (const auto& it : profiles_)
+    report.profiles.push_back({it.first, it.second});
+  return report;
+}
+
+}  // namespace electron
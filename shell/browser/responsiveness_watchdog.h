@@ -0,0 +1,102 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_RESPONSIVENESS_WATCHDOG_H_
+#define SHELL_BROWSER_RESPONSIVENESS_WATCHDOG_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/no_destructor.h"
+#include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/threading/thread.h"
+#include "base/time/time.h"
+#include "v8/include/v8.h"
+
+namespace electron {
+
+// Watches the browser main loop from a dedicated thread: heartbeat tasks
+// are posted to the main thread and an unacknowledged heartbeat counts as
+// a stall. While a stall lasts, JS stacks are sampled through isolate
+// interrupts, which V8 services mid-execution during long-running script;
+// stalls blocked in native code yield no sample and are aggregated under
+// a marker bucket. The cost while responsive is one cross-thread task per
+// heartbeat, cheap enough to stay always-on.
+class ResponsivenessWatchdog {
+ public:
+  // One aggregated stall signature: the sampled JS stack (innermost frame
+  // first) and how often it was seen.
+  struct StallProfile {
+    std::string stack;
+    int sample_count;
+  };
+
+  struct Report {
+    int stall_count = 0;
+    base::TimeDelta total_stall_time;
+    base::TimeDelta longest_stall;
+    std::vector<StallProfile> profiles;
+  };
+
+  static ResponsivenessWatchdog* GetInstance();
+
+  // Both must be called on the browser main thread; Start() captures the
+  // current thread's task runner as the watched loop.
+  void Start(v8::Isolate* isolate);
+  void Stop();
+
+  // Snapshot of everything recorded since startup. Thread-safe.
+  Report GetReport();
+
+ private:
+  friend class base::NoDestructor<ResponsivenessWatchdog>;
+
+  ResponsivenessWatchdog();
+  ~ResponsivenessWatchdog();
+
+  // Runs on the watchdog thread on every heartbeat interval.
+  void OnWatchdogTick();
+
+  // Runs on the main thread; acknowledges the posted heartbeat.
+  void OnHeartbeatAck();
+
+  // Runs on the main thread whenever V8 services the requested interrupt.
+  static void OnInterrupt(v8::Isolate* isolate, void* data);
+
+  // Folds a finished stall of |duration| into the aggregates.
+  void RecordStall(base::TimeDelta duration);
+
+  v8::Isolate* isolate_ = nullptr;
+  scoped_refptr<base::SingleThreadTaskRunner> main_task_runner_;
+  std::unique_ptr<base::Thread> watchdog_thread_;
+
+  std::atomic<bool> running_{false};
+  std::atomic<int64_t> last_ack_us_{0};
+  // Bounds the interrupts queued against a stalled isolate.
+  std::atomic<int> pending_interrupts_{0};
+
+  // Watchdog-thread-only stall tracking state.
+  bool in_stall_ = false;
+  base::TimeTicks stall_start_;
+
+  base::Lock report_lock_;
+  int stall_count_ = 0;
+  base::TimeDelta total_stall_time_;
+  base::TimeDelta longest_stall_;
+  // Number of interrupt samples captured during the current stall, used
+  // to attribute sampleless (native-blocked) stalls to the marker bucket.
+  int samples_this_stall_ = 0;
+  std::map<std::string, int> profiles_;
+
+  DISALLOW_COPY_AND_ASSIGN(ResponsivenessWatchdog);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_RESPONSIVENESS_WATCHDOG_H_
@@ -4,7 +4,11 @@
 
 #include "shell/browser/session_preferences.h"
 
+#include <utility>
+
+#include "base/json/json_writer.h"
 #include "base/memory/ptr_util.h"
+#include "base/values.h"
 
 namespace electron {
 
@@ -41,4 +45,31 @@ std::vector<base::FilePath::StringType> SessionPreferences::GetValidPreloads(
   return result;
 }
 
+// static
+std::string SessionPreferences::GetInjectionScriptsSwitchValue(
+    content::BrowserContext* context) {
+  auto* self = FromBrowserContext(context);
+  if (!self || self->injection_scripts().empty())
+    return std::string();
+
+  base::Value entries(base::Value::Type::LIST);
+  for (const auto& entry : self->injection_scripts()) {
+    if (!entry.script.IsAbsolute()) {
+      LOG(ERROR) << "injection script must have absolute path: "
+                 << entry.script.value();
+      continue;
+    }
+    base::Value dict(base::Value::Type::DICTIONARY);
+    dict.SetStringKey("urlPattern", entry.url_pattern);
+    dict.SetStringKey("file", entry.script.AsUTF8Unsafe());
+    entries.GetList().push_back(std::move(dict));
+  }
+  if (entries.GetList().empty())
+    return std::string();
+
+  std::string json;
+  base::JSONWriter::Write(entries, &json);
+  return json;
+}
+
 }  // namespace electron
@@ -5,6 +5,7 @@
 #ifndef SHELL_BROWSER_SESSION_PREFERENCES_H_
 #define SHELL_BROWSER_SESSION_PREFERENCES_H_
 
+#include <string>
 #include <vector>
 
 #include "base/files/file_path.h"
@@ -13,12 +14,25 @@
 
 namespace electron {
 
+// One entry of the per-session script-injection registry: |script| runs in
+// every frame whose document URL matches |url_pattern| (a wildcard pattern
+// as understood by base::MatchPattern). Matching happens locally in the
+// renderer, so registering entries adds no per-navigation browser hop.
+struct InjectionScript {
+  std::string url_pattern;
+  base::FilePath script;
+};
+
 class SessionPreferences : public base::SupportsUserData::Data {
  public:
   static SessionPreferences* FromBrowserContext(
       content::BrowserContext* context);
   static std::vector<base::FilePath::StringType> GetValidPreloads(
       content::BrowserContext* context);
+  // Serializes the injection registry as JSON for the renderer command
+  // line; returns the empty string when no valid entries are registered.
+  static std::string GetInjectionScriptsSwitchValue(
+      content::BrowserContext* context);
 
   explicit SessionPreferences(content::BrowserContext* context);
   ~SessionPreferences() override;
@@ -30,11 +44,19 @@ class SessionPreferences : public base::SupportsUserData::Data {
     return preloads_;
   }
 
+  void set_injection_scripts(const std::vector<InjectionScript>& scripts) {
+    injection_scripts_ = scripts;
+  }
+  const std::vector<InjectionScript>& injection_scripts() const {
+    return injection_scripts_;
+  }
+
  private:
   // The user data key.
   static int kLocatorKey;
 
   std::vector<base::FilePath::StringType> preloads_;
+  std::vector<InjectionScript> injection_scripts_;
 };
 
 }  // namespace electron
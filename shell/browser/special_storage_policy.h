@@ -9,6 +9,10 @@
 
 namespace electron {
 
+// Grants every origin protected, unlimited and durable storage. All checks
+// return compile-time constants, so this policy adds no per-operation cost
+// to the quota system; keep it that way if per-origin rules are ever added
+// (the checks run once per storage operation).
 class SpecialStoragePolicy : public storage::SpecialStoragePolicy {
  public:
   SpecialStoragePolicy();
@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
+#include "base/no_destructor.h"
 #include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
@@ -17,8 +19,27 @@
 
 namespace accelerator_util {
 
+namespace {
+
+// Menus re-parse the same accelerator strings on every rebuild, so keep the
+// parsed results around. Only consulted on the UI thread, hence no locking.
+base::MRUCache<std::string, ui::Accelerator>& GetParseCache() {
+  static base::NoDestructor<base::MRUCache<std::string, ui::Accelerator>>
+      cache(256);
+  return *cache;
+}
+
+}  // namespace
+
 bool StringToAccelerator(const std::string& shortcut,
                          ui::Accelerator* accelerator) {
+  auto& cache = GetParseCache();
+  auto cached = cache.Get(shortcut);
+  if (cached != cache.end()) {
+    *accelerator = cached->second;
+    return true;
+  }
+
   if (!base::IsStringASCII(shortcut)) {
     LOG(ERROR) << "The accelerator string can only contain ASCII characters";
     return false;
@@ -64,6 +85,7 @@ bool StringToAccelerator(const std::string& shortcut,
   }
 
   *accelerator = ui::Accelerator(key, modifiers);
+  cache.Put(shortcut, *accelerator);
   return true;
 }
 
@@ -0,0 +1,44 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/ui/accelerator_util.h"
+
+#include <string>
+
+#include "base/stl_util.h"
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+
+namespace accelerator_util {
+
+namespace {
+
+const int kIterations = 100000;
+
+}  // namespace
+
+// Menu construction parses every accelerator string on each rebuild, so
+// parsing speed shows up directly in app startup traces.
+TEST(AcceleratorUtilPerfTest, StringToAccelerator) {
+  const std::string descriptions[] = {
+      "CmdOrCtrl+Shift+Z", "Alt+Tab",  "Super+Esc",
+      "Ctrl+Space",        "Shift+F1", "CommandOrControl+Plus",
+  };
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kIterations; ++i) {
+    for (const auto& description : descriptions) {
+      ui::Accelerator out = ui::Accelerator(ui::VKEY_UNKNOWN, ui::EF_NONE);
+      StringToAccelerator(description, &out);
+    }
+  }
+  base::TimeDelta elapsed = timer.Elapsed();
+
+  size_t parses = kIterations * base::size(descriptions);
+  perf_test::PrintResult("accelerator_util", "", "string_to_accelerator",
+                         elapsed.InMicrosecondsF() / parses, "us/parse", true);
+}
+
+}  // namespace accelerator_util
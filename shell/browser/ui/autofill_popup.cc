@@ -8,7 +8,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/i18n/rtl.h"
+#include "base/time/time.h"
 #include "chrome/browser/ui/autofill/popup_view_common.h"
 #include "electron/buildflags/buildflags.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -31,6 +33,15 @@
 
 namespace electron {
 
+namespace {
+
+// Minimum delay between two relayouts of the popup widget; updates arriving
+// faster than this are folded into a single deferred relayout.
+constexpr base::TimeDelta kBoundsUpdateInterval =
+    base::TimeDelta::FromMilliseconds(16);
+
+}  // namespace
+
 class PopupViewCommon : public autofill::PopupViewCommon {
  public:
   explicit PopupViewCommon(const gfx::Rect& window_bounds)
@@ -92,6 +103,7 @@ void AutofillPopup::CreateView(content::RenderFrameHost* frame_host,
 }
 
 void AutofillPopup::Hide() {
+  bounds_update_timer_.Stop();
   if (parent_) {
     parent_->RemoveObserver(this);
     parent_ = nullptr;
@@ -107,10 +119,33 @@ void AutofillPopup::SetItems(const std::vector<base::string16>& values,
   DCHECK(view_);
   values_ = values;
   labels_ = labels;
+  row_widths_valid_ = false;
+  ScheduleUpdateBoundsAndRedraw();
+}
+
+void AutofillPopup::ScheduleUpdateBoundsAndRedraw() {
+  if (bounds_update_timer_.IsRunning())
+    return;  // The queued flush will pick up the latest items when it fires.
+
+  base::TimeDelta elapsed = base::TimeTicks::Now() - last_bounds_update_time_;
+  if (elapsed >= kBoundsUpdateInterval) {
+    UpdateBoundsAndRedraw();
+  } else {
+    bounds_update_timer_.Start(
+        FROM_HERE, kBoundsUpdateInterval - elapsed,
+        base::BindOnce(&AutofillPopup::UpdateBoundsAndRedraw,
+                       base::Unretained(this)));
+  }
+}
+
+void AutofillPopup::UpdateBoundsAndRedraw() {
+  last_bounds_update_time_ = base::TimeTicks::Now();
+  if (!view_)
+    return;
+
   UpdatePopupBounds();
+  // Rebuilds the child views and applies the new bounds to the widget.
   view_->OnSuggestionsChanged();
-  if (view_)  // could be hidden after the change
-    view_->DoUpdateBoundsAndRedrawPopup();
 }
 
 void AutofillPopup::AcceptSuggestion(int index) {
@@ -154,19 +189,25 @@ int AutofillPopup::GetDesiredPopupHeight() {
 }
 
 int AutofillPopup::GetDesiredPopupWidth() {
-  int popup_width = element_bounds_.width();
-
-  for (size_t i = 0; i < values_.size(); ++i) {
-    int row_size =
-        kEndPadding + 2 * kPopupBorderThickness +
-        gfx::GetStringWidth(GetValueAt(i), GetValueFontListForRow(i)) +
-        gfx::GetStringWidth(GetLabelAt(i), GetLabelFontListForRow(i));
-    if (GetLabelAt(i).length() > 0)
-      row_size += kNamePadding + kEndPadding;
-
-    popup_width = std::max(popup_width, row_size);
+  if (!row_widths_valid_) {
+    row_widths_.resize(values_.size());
+    for (size_t i = 0; i < values_.size(); ++i) {
+      int row_size =
+          kEndPadding + 2 * kPopupBorderThickness +
+          gfx::GetStringWidth(GetValueAt(i), GetValueFontListForRow(i)) +
+          gfx::GetStringWidth(GetLabelAt(i), GetLabelFontListForRow(i));
+      if (GetLabelAt(i).length() > 0)
+        row_size += kNamePadding + kEndPadding;
+
+      row_widths_[i] = row_size;
+    }
+    row_widths_valid_ = true;
   }
 
+  int popup_width = element_bounds_.width();
+  for (int row_width : row_widths_)
+    popup_width = std::max(popup_width, row_width);
+
   return popup_width;
 }
 
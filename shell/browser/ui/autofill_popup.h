@@ -7,6 +7,8 @@
 
 #include <vector>
 
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "content/public/browser/render_frame_host.h"
 #include "shell/browser/ui/views/autofill_popup_view.h"
 #include "ui/gfx/font_list.h"
@@ -45,6 +47,11 @@ class AutofillPopup : public views::ViewObserver {
 
   void AcceptSuggestion(int index);
 
+  // Coalesces the relayout triggered by SetItems, which is called for every
+  // keystroke in the bound text field, to roughly once per frame.
+  void ScheduleUpdateBoundsAndRedraw();
+  void UpdateBoundsAndRedraw();
+
   int GetDesiredPopupHeight();
   int GetDesiredPopupWidth();
   gfx::Rect GetRowBounds(int i);
@@ -69,6 +76,16 @@ class AutofillPopup : public views::ViewObserver {
   std::vector<base::string16> values_;
   std::vector<base::string16> labels_;
 
+  // Measured width of each row, invalidated when the suggestions change. The
+  // fonts are derived once in the constructor, so data changes are the only
+  // thing that can stale the measurements.
+  std::vector<int> row_widths_;
+  bool row_widths_valid_ = false;
+
+  // Timer and timestamp backing ScheduleUpdateBoundsAndRedraw().
+  base::OneShotTimer bounds_update_timer_;
+  base::TimeTicks last_bounds_update_time_;
+
   // Font lists for the suggestions
   gfx::FontList smaller_font_list_;
   gfx::FontList bold_font_list_;
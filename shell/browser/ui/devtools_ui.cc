@@ -91,6 +91,9 @@ class BundledDataSource : public content::URLDataSource {
   void StartBundledDataRequest(const std::string& path,
                                const GotDataCallback& callback) {
     std::string filename = PathWithoutParams(path);
+    // The returned StringPiece points directly into the memory mapped
+    // resource pak, and RefCountedStaticMemory below hands those bytes to
+    // the URL data pipeline without copying them.
     base::StringPiece resource =
         content::DevToolsFrontendHost::GetFrontendResource(filename);
 
@@ -76,6 +76,12 @@ const char kTitleFormat[] = "Developer Tools - %s";
 
 const size_t kMaxMessageChunkSize = IPC::Channel::kMaximumMessageSize / 4;
 
+// The frontend changes preferences in bursts (e.g. while docking or
+// resizing); wait this long after the last mutation before serializing
+// them to the pref store.
+constexpr base::TimeDelta kPrefCommitDelay =
+    base::TimeDelta::FromMilliseconds(500);
+
 // Stores all instances of InspectableWebContentsImpl.
 InspectableWebContentsImpl::List g_web_contents_instances_;
 
@@ -284,6 +290,12 @@ InspectableWebContentsImpl::InspectableWebContentsImpl(
 }
 
 InspectableWebContentsImpl::~InspectableWebContentsImpl() {
+  // Write out anything still waiting on a debounce timer.
+  CommitPendingPrefChanges();
+  if (bounds_save_timer_.IsRunning()) {
+    bounds_save_timer_.Stop();
+    CommitDevToolsBounds();
+  }
   g_web_contents_instances_.remove(this);
   // Unsubscribe from devtools and Clean up resources.
   if (GetDevToolsWebContents()) {
@@ -450,8 +462,15 @@ gfx::Rect InspectableWebContentsImpl::GetDevToolsBounds() const {
 }
 
 void InspectableWebContentsImpl::SaveDevToolsBounds(const gfx::Rect& bounds) {
-  pref_service_->Set(kDevToolsBoundsPref, RectToDictionary(bounds));
   devtools_bounds_ = bounds;
+  bounds_save_timer_.Start(
+      FROM_HERE, kPrefCommitDelay,
+      base::BindOnce(&InspectableWebContentsImpl::CommitDevToolsBounds,
+                     base::Unretained(this)));
+}
+
+void InspectableWebContentsImpl::CommitDevToolsBounds() {
+  pref_service_->Set(kDevToolsBoundsPref, RectToDictionary(devtools_bounds_));
 }
 
 double InspectableWebContentsImpl::GetDevToolsZoomLevel() const {
@@ -481,6 +500,7 @@ void InspectableWebContentsImpl::LoadCompleted() {
     SetIsDocked(DispatchCallback(), false);
   } else {
     if (dock_state_.empty()) {
+      CommitPendingPrefChanges();
       const base::DictionaryValue* prefs =
           pref_service_->GetDictionary(kDevToolsPreferences);
       std::string current_dock_state;
@@ -685,6 +705,8 @@ void InspectableWebContentsImpl::SendJsonRequest(
 
 void InspectableWebContentsImpl::GetPreferences(
     const DispatchCallback& callback) {
+  // Make any buffered mutations visible before handing the dictionary out.
+  CommitPendingPrefChanges();
   const base::DictionaryValue* prefs =
       pref_service_->GetDictionary(kDevToolsPreferences);
   callback.Run(prefs);
@@ -692,20 +714,42 @@ void InspectableWebContentsImpl::GetPreferences(
 
 void InspectableWebContentsImpl::SetPreference(const std::string& name,
                                                const std::string& value) {
-  DictionaryPrefUpdate update(pref_service_, kDevToolsPreferences);
-  update.Get()->SetKey(name, base::Value(value));
+  pending_pref_changes_[name] = value;
+  pref_commit_timer_.Start(
+      FROM_HERE, kPrefCommitDelay,
+      base::BindOnce(&InspectableWebContentsImpl::CommitPendingPrefChanges,
+                     base::Unretained(this)));
 }
 
 void InspectableWebContentsImpl::RemovePreference(const std::string& name) {
-  DictionaryPrefUpdate update(pref_service_, kDevToolsPreferences);
-  update.Get()->RemoveWithoutPathExpansion(name, nullptr);
+  pending_pref_changes_[name] = base::nullopt;
+  pref_commit_timer_.Start(
+      FROM_HERE, kPrefCommitDelay,
+      base::BindOnce(&InspectableWebContentsImpl::CommitPendingPrefChanges,
+                     base::Unretained(this)));
 }
 
 void InspectableWebContentsImpl::ClearPreferences() {
+  pref_commit_timer_.Stop();
+  pending_pref_changes_.clear();
   DictionaryPrefUpdate update(pref_service_, kDevToolsPreferences);
   update.Get()->Clear();
 }
 
+void InspectableWebContentsImpl::CommitPendingPrefChanges() {
+  pref_commit_timer_.Stop();
+  if (pending_pref_changes_.empty())
+    return;
+  DictionaryPrefUpdate update(pref_service_, kDevToolsPreferences);
+  for (const auto& change : pending_pref_changes_) {
+    if (change.second)
+      update.Get()->SetKey(change.first, base::Value(*change.second));
+    else
+      update.Get()->RemoveWithoutPathExpansion(change.first, nullptr);
+  }
+  pending_pref_changes_.clear();
+}
+
 void InspectableWebContentsImpl::ConnectionReady() {}
 
 void InspectableWebContentsImpl::RegisterExtensionsAPI(
@@ -15,6 +15,8 @@
 
 #include "base/containers/unique_ptr_adapters.h"
 #include "base/memory/weak_ptr.h"
+#include "base/optional.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/devtools/devtools_contents_resizing_strategy.h"
 #include "chrome/browser/devtools/devtools_embedder_message_dispatcher.h"
 #include "content/public/browser/devtools_agent_host.h"
@@ -79,6 +81,12 @@ class InspectableWebContentsImpl
   void UpdateDevToolsZoomLevel(double level);
 
  private:
+  // Writes all buffered preference mutations to the pref store in one update.
+  void CommitPendingPrefChanges();
+
+  // Writes |devtools_bounds_| to the pref store.
+  void CommitDevToolsBounds();
+
   // DevToolsEmbedderMessageDispacher::Delegate
   void ActivateWindow() override;
   void CloseWindow() override;
@@ -227,6 +235,15 @@ class InspectableWebContentsImpl
   using ExtensionsAPIs = std::map<std::string, std::string>;
   ExtensionsAPIs extensions_api_;
 
+  // The frontend sends setPreference in bursts while docking and resizing;
+  // mutations are buffered here (base::nullopt marks a removal) and flushed
+  // to the pref store in one update once the burst ends.
+  std::map<std::string, base::Optional<std::string>> pending_pref_changes_;
+  base::OneShotTimer pref_commit_timer_;
+
+  // Same treatment for the bounds pref, which changes on every drag step.
+  base::OneShotTimer bounds_save_timer_;
+
   base::WeakPtrFactory<InspectableWebContentsImpl> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(InspectableWebContentsImpl);
@@ -70,8 +70,7 @@ int FramelessView::NonClientHitTest(const gfx::Point& cursor) {
 
   // Check for possible draggable region in the client area for the frameless
   // window.
-  SkRegion* draggable_region = window_->draggable_region();
-  if (draggable_region && draggable_region->contains(cursor.x(), cursor.y()))
+  if (window_->IsPointInDraggableRegion(cursor))
     return HTCAPTION;
 
   // Support resizing frameless window by dragging the border.
@@ -7,6 +7,7 @@
 #include <dlfcn.h>
 #include <glib-object.h>
 
+#include "base/bind.h"
 #include "base/logging.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
@@ -89,6 +90,11 @@ const char kToggleRadio[] = "radio";
 const char kTypeSeparator[] = "separator";
 const char kDisplaySubmenu[] = "submenu";
 
+// Menu rebuilds arriving within this interval are coalesced so that a
+// burst of updates exports only one layout over DBus.
+constexpr base::TimeDelta kMenuRebuildInterval =
+    base::TimeDelta::FromMilliseconds(100);
+
 void EnsureMethodsLoaded() {
   static bool attempted_load = false;
   if (attempted_load)
@@ -196,6 +202,38 @@ void GlobalMenuBarX11::SetMenu(AtomMenuModel* menu_model) {
   if (!IsServerStarted())
     return;
 
+  // The first update in an interval is exported immediately; the newest of
+  // any updates following within the interval is flushed when it expires.
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (!menu_rebuild_timer_.IsRunning() &&
+      now - last_menu_rebuild_time_ >= kMenuRebuildInterval) {
+    last_menu_rebuild_time_ = now;
+    RebuildMenu(menu_model);
+    return;
+  }
+
+  pending_menu_model_ = menu_model;
+  menu_rebuild_pending_ = true;
+  if (!menu_rebuild_timer_.IsRunning()) {
+    menu_rebuild_timer_.Start(
+        FROM_HERE, kMenuRebuildInterval,
+        base::BindOnce(&GlobalMenuBarX11::FlushPendingMenu,
+                       base::Unretained(this)));
+  }
+}
+
+void GlobalMenuBarX11::RebuildMenu(AtomMenuModel* menu_model) {
+  // Skip the rebuild when the exported layout would not change; submenus
+  // are built lazily and diffed separately in OnSubMenuShow.
+  std::string status =
+      menu_model != nullptr ? GetMenuModelStatus(menu_model) : std::string();
+  if (menu_model == last_menu_model_ && status == last_menu_status_)
+    return;
+  last_menu_model_ = menu_model;
+  last_menu_status_ = status;
+
+  // Replacing the root exports the whole layout to the menu registrar as a
+  // single dbusmenu layout update instead of one message per mutation.
   DbusmenuMenuitem* root_item = menuitem_new();
   menuitem_property_set(root_item, kPropertyLabel, "Root");
   menuitem_property_set_bool(root_item, kPropertyVisible, true);
@@ -207,6 +245,15 @@ void GlobalMenuBarX11::SetMenu(AtomMenuModel* menu_model) {
   g_object_unref(root_item);
 }
 
+void GlobalMenuBarX11::FlushPendingMenu() {
+  if (!menu_rebuild_pending_)
+    return;
+  menu_rebuild_pending_ = false;
+  last_menu_rebuild_time_ = base::TimeTicks::Now();
+  RebuildMenu(pending_menu_model_);
+  pending_menu_model_ = nullptr;
+}
+
 bool GlobalMenuBarX11::IsServerStarted() const {
   return server_;
 }
@@ -9,6 +9,8 @@
 
 #include "base/compiler_specific.h"
 #include "base/macros.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "shell/browser/ui/atom_menu_model.h"
 #include "ui/base/glib/glib_signal.h"
 #include "ui/gfx/native_widget_types.h"
@@ -54,6 +56,13 @@ class GlobalMenuBarX11 {
   // Creates a DbusmenuServer.
   void InitServer(gfx::AcceleratedWidget xid);
 
+  // Exports |menu_model| as the new root layout unless it matches the
+  // layout that was last exported.
+  void RebuildMenu(AtomMenuModel* menu_model);
+
+  // Applies the newest menu model of a coalesced burst of SetMenu calls.
+  void FlushPendingMenu();
+
   // Create a menu from menu model.
   void BuildMenuFromModel(AtomMenuModel* model, DbusmenuMenuitem* parent);
 
@@ -73,6 +82,17 @@ class GlobalMenuBarX11 {
 
   DbusmenuServer* server_ = nullptr;
 
+  // The model and status of the last exported layout, used to skip
+  // rebuilds that would export an identical layout.
+  AtomMenuModel* last_menu_model_ = nullptr;
+  std::string last_menu_status_;
+
+  // Coalescing state for rapid successive SetMenu calls.
+  base::TimeTicks last_menu_rebuild_time_;
+  base::OneShotTimer menu_rebuild_timer_;
+  AtomMenuModel* pending_menu_model_ = nullptr;
+  bool menu_rebuild_pending_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(GlobalMenuBarX11);
 };
 
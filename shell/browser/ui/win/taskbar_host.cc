@@ -7,6 +7,7 @@
 #include <objbase.h>
 #include <string>
 
+#include "base/bind.h"
 #include "base/stl_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/win/scoped_gdi_object.h"
@@ -27,6 +28,11 @@ const size_t kMaxButtonsCount = 7;
 // The base id of Thumbar button.
 const int kButtonIdBase = 40001;
 
+// Minimum interval between taskbar progress value updates. Download style
+// per-tick updates arrive much faster than the taskbar can usefully show.
+constexpr base::TimeDelta kProgressUpdateInterval =
+    base::TimeDelta::FromMilliseconds(100);
+
 bool GetThumbarButtonFlags(const std::vector<std::string>& flags,
                            THUMBBUTTONFLAGS* out) {
   THUMBBUTTONFLAGS result = THBF_ENABLED;  // THBF_ENABLED == 0
@@ -135,36 +141,86 @@ void TaskbarHost::RestoreThumbarButtons(HWND window) {
 bool TaskbarHost::SetProgressBar(HWND window,
                                  double value,
                                  const NativeWindow::ProgressState state) {
+  // Only regular in-progress value updates are worth coalescing; state
+  // changes and completion must reach the taskbar immediately.
+  const bool is_value_update =
+      state == NativeWindow::ProgressState::kNormal && value >= 0 &&
+      value < 1.0;
+  if (!is_value_update) {
+    progress_timer_.Stop();
+    last_progress_time_ = base::TimeTicks::Now();
+    return ApplyProgressBar(window, value, state);
+  }
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  if (now - last_progress_time_ >= kProgressUpdateInterval) {
+    progress_timer_.Stop();
+    last_progress_time_ = now;
+    return ApplyProgressBar(window, value, state);
+  }
+
+  // Too soon after the last update, remember the latest value and flush a
+  // single trailing update so the taskbar still converges on it.
+  pending_progress_window_ = window;
+  pending_progress_value_ = value;
+  pending_progress_state_ = state;
+  if (!progress_timer_.IsRunning()) {
+    progress_timer_.Start(
+        FROM_HERE, kProgressUpdateInterval - (now - last_progress_time_),
+        base::BindOnce(&TaskbarHost::FlushPendingProgress,
+                       base::Unretained(this)));
+  }
+  return true;
+}
+
+bool TaskbarHost::ApplyProgressBar(HWND window,
+                                   double value,
+                                   NativeWindow::ProgressState state) {
   if (!InitializeTaskbar())
     return false;
 
-  bool success;
+  TBPFLAG flag;
+  int percent = -1;
   if (value > 1.0 || state == NativeWindow::ProgressState::kIndeterminate) {
-    success = SUCCEEDED(taskbar_->SetProgressState(window, TBPF_INDETERMINATE));
+    flag = TBPF_INDETERMINATE;
   } else if (value < 0 || state == NativeWindow::ProgressState::kNone) {
-    success = SUCCEEDED(taskbar_->SetProgressState(window, TBPF_NOPROGRESS));
+    flag = TBPF_NOPROGRESS;
   } else {
     // Unless SetProgressState set a blocking state (TBPF_ERROR, TBPF_PAUSED)
     // for the window, a call to SetProgressValue assumes the TBPF_NORMAL
     // state even if it is not explicitly set.
     // SetProgressValue overrides and clears the TBPF_INDETERMINATE state.
-    if (state == NativeWindow::ProgressState::kError) {
-      success = SUCCEEDED(taskbar_->SetProgressState(window, TBPF_ERROR));
-    } else if (state == NativeWindow::ProgressState::kPaused) {
-      success = SUCCEEDED(taskbar_->SetProgressState(window, TBPF_PAUSED));
-    } else {
-      success = SUCCEEDED(taskbar_->SetProgressState(window, TBPF_NORMAL));
-    }
-
-    if (success) {
-      int val = static_cast<int>(value * 100);
-      success = SUCCEEDED(taskbar_->SetProgressValue(window, val, 100));
-    }
+    if (state == NativeWindow::ProgressState::kError)
+      flag = TBPF_ERROR;
+    else if (state == NativeWindow::ProgressState::kPaused)
+      flag = TBPF_PAUSED;
+    else
+      flag = TBPF_NORMAL;
+    percent = static_cast<int>(value * 100);
   }
 
+  // Skip the COM calls when nothing changed.
+  if (static_cast<int>(flag) == last_progress_flag_ &&
+      percent == last_progress_percent_)
+    return true;
+
+  bool success = SUCCEEDED(taskbar_->SetProgressState(window, flag));
+  if (success && percent >= 0)
+    success = SUCCEEDED(taskbar_->SetProgressValue(window, percent, 100));
+
+  if (success) {
+    last_progress_flag_ = static_cast<int>(flag);
+    last_progress_percent_ = percent;
+  }
   return success;
 }
 
+void TaskbarHost::FlushPendingProgress() {
+  last_progress_time_ = base::TimeTicks::Now();
+  ApplyProgressBar(pending_progress_window_, pending_progress_value_,
+                   pending_progress_state_);
+}
+
 bool TaskbarHost::SetOverlayIcon(HWND window,
                                  const gfx::Image& overlay,
                                  const std::string& text) {
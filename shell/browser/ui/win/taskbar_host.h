@@ -13,6 +13,8 @@
 #include <vector>
 
 #include "base/callback.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "shell/browser/native_window.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/image/image.h"
@@ -41,7 +43,8 @@ class TaskbarHost {
 
   void RestoreThumbarButtons(HWND window);
 
-  // Set the progress state in taskbar.
+  // Set the progress state in taskbar. Per-tick value updates are coalesced
+  // to a fixed cadence, state changes and completion apply immediately.
   bool SetProgressBar(HWND window,
                       double value,
                       const NativeWindow::ProgressState state);
@@ -64,6 +67,12 @@ class TaskbarHost {
   // Initialize the taskbar object.
   bool InitializeTaskbar();
 
+  // Applies a progress update to the taskbar, skipping no-op updates.
+  bool ApplyProgressBar(HWND window,
+                        double value,
+                        NativeWindow::ProgressState state);
+  void FlushPendingProgress();
+
   using CallbackMap = std::map<int, base::Closure>;
   CallbackMap callback_map_;
 
@@ -75,6 +84,18 @@ class TaskbarHost {
   // Whether we have already added the buttons to thumbar.
   bool thumbar_buttons_added_ = false;
 
+  // The progress last applied to the taskbar, used to drop duplicates.
+  int last_progress_flag_ = -1;
+  int last_progress_percent_ = -1;
+
+  // Coalescing of per-tick progress value updates.
+  base::TimeTicks last_progress_time_;
+  base::OneShotTimer progress_timer_;
+  HWND pending_progress_window_ = nullptr;
+  double pending_progress_value_ = 0;
+  NativeWindow::ProgressState pending_progress_state_ =
+      NativeWindow::ProgressState::kNone;
+
   DISALLOW_COPY_AND_ASSIGN(TaskbarHost);
 };
 
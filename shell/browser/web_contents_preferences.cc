@@ -12,6 +12,7 @@
 #include "base/command_line.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "cc/base/switches.h"
 #include "content/public/browser/render_frame_host.h"
@@ -120,8 +121,12 @@ WebContentsPreferences::WebContentsPreferences(
   SetDefaultBoolIfUndefined(options::kExperimentalFeatures, false);
   SetDefaultBoolIfUndefined(options::kNodeIntegration, false);
   SetDefaultBoolIfUndefined(options::kNodeIntegrationInSubFrames, false);
+  SetDefaultBoolIfUndefined(options::kDisablePreloadInSameOriginSubFrames,
+                            false);
   SetDefaultBoolIfUndefined(options::kNodeIntegrationInWorker, false);
+  SetDefaultBoolIfUndefined(options::kLightweightNodeInWorkers, false);
   SetDefaultBoolIfUndefined(options::kDisableHtmlFullscreenWindowResize, false);
+  SetDefaultBoolIfUndefined(options::kDisableBackgrounding, false);
   SetDefaultBoolIfUndefined(options::kWebviewTag, false);
   SetDefaultBoolIfUndefined(options::kSandbox, false);
   SetDefaultBoolIfUndefined(options::kNativeWindowOpen, false);
@@ -190,12 +195,14 @@ bool WebContentsPreferences::SetDefaultBoolIfUndefined(base::StringPiece key,
     return current_value->GetBool();
   } else {
     preference_.SetKey(key, base::Value(val));
+    cached_switches_.reset();
     return val;
   }
 }
 
 void WebContentsPreferences::SetBool(base::StringPiece key, bool value) {
   preference_.SetKey(key, base::Value(value));
+  cached_switches_.reset();
 }
 
 bool WebContentsPreferences::IsEnabled(base::StringPiece name,
@@ -210,6 +217,7 @@ bool WebContentsPreferences::IsEnabled(base::StringPiece name,
 void WebContentsPreferences::Merge(const base::DictionaryValue& extend) {
   if (preference_.is_dict())
     static_cast<base::DictionaryValue*>(&preference_)->MergeDictionary(&extend);
+  cached_switches_.reset();
 
   SetDefaults();
 }
@@ -217,6 +225,7 @@ void WebContentsPreferences::Merge(const base::DictionaryValue& extend) {
 void WebContentsPreferences::Clear() {
   if (preference_.is_dict())
     static_cast<base::DictionaryValue*>(&preference_)->Clear();
+  cached_switches_.reset();
 }
 
 bool WebContentsPreferences::GetPreference(base::StringPiece name,
@@ -267,9 +276,11 @@ WebContentsPreferences* WebContentsPreferences::From(
   return FromWebContents(web_contents);
 }
 
-void WebContentsPreferences::AppendCommandLineSwitches(
-    base::CommandLine* command_line,
-    bool is_subframe) {
+void WebContentsPreferences::RebuildCachedSwitches() {
+  cached_switches_ =
+      std::make_unique<base::CommandLine>(base::CommandLine::NO_PROGRAM);
+  base::CommandLine* command_line = cached_switches_.get();
+
   // Check if plugins are enabled.
   if (IsEnabled(options::kPlugins))
     command_line->AppendSwitch(switches::kEnablePlugins);
@@ -287,26 +298,13 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (IsEnabled(options::kNodeIntegrationInWorker))
     command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
 
+  if (IsEnabled(options::kLightweightNodeInWorkers))
+    command_line->AppendSwitch(switches::kLightweightNodeInWorkers);
+
   // Check if webview tag creation is enabled, default to nodeIntegration value.
   if (IsEnabled(options::kWebviewTag))
     command_line->AppendSwitch(switches::kWebviewTag);
 
-  // Sandbox can be enabled for renderer processes hosting cross-origin frames
-  // unless nodeIntegrationInSubFrames is enabled
-  bool can_sandbox_frame =
-      is_subframe && !IsEnabled(options::kNodeIntegrationInSubFrames);
-
-  // If the `sandbox` option was passed to the BrowserWindow's webPreferences,
-  // pass `--enable-sandbox` to the renderer so it won't have any node.js
-  // integration. Otherwise disable Chromium sandbox, unless app.enableSandbox()
-  // was called.
-  if (IsEnabled(options::kSandbox) || can_sandbox_frame) {
-    command_line->AppendSwitch(switches::kEnableSandbox);
-  } else if (!command_line->HasSwitch(switches::kEnableSandbox)) {
-    command_line->AppendSwitch(service_manager::switches::kNoSandbox);
-    command_line->AppendSwitch(::switches::kNoZygote);
-  }
-
   // Check if nativeWindowOpen is enabled.
   if (IsEnabled(options::kNativeWindowOpen))
     command_line->AppendSwitch(switches::kNativeWindowOpen);
@@ -336,6 +334,11 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (IsEnabled(options::kContextIsolation))
     command_line->AppendSwitch(switches::kContextIsolation);
 
+  // Keep this renderer at foreground priority even when its window is
+  // hidden, for contents doing latency-sensitive background work.
+  if (IsEnabled(options::kDisableBackgrounding))
+    command_line->AppendSwitch(::switches::kDisableRendererBackgrounding);
+
   // --background-color.
   std::string s;
   if (GetAsString(&preference_, options::kBackgroundColor, &s)) {
@@ -390,9 +393,68 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (GetAsString(&preference_, options::kDisableBlinkFeatures, &s))
     command_line->AppendSwitchASCII(::switches::kDisableBlinkFeatures, s);
 
-  if (guest_instance_id) {
+  if (IsEnabled(options::kNodeIntegrationInSubFrames))
+    command_line->AppendSwitch(switches::kNodeIntegrationInSubFrames);
+
+  if (IsEnabled(options::kDisablePreloadInSameOriginSubFrames))
+    command_line->AppendSwitch(switches::kDisablePreloadInSameOriginSubFrames);
+}
+
+void WebContentsPreferences::AppendCommandLineSwitches(
+    base::CommandLine* command_line,
+    bool is_subframe) {
+  if (!cached_switches_) {
+    RebuildCachedSwitches();
+
+    // We are appending args to a webContents so let's save the current state
+    // of our preferences object so that during the lifetime of the WebContents
+    // we can fetch the options used to initally configure the WebContents.
+    // |preference_| cannot have changed since the cache was built, so one
+    // clone per rebuild is enough.
+    last_preference_ = preference_.Clone();
+  }
+
+  // Copy the preference-derived switches computed in RebuildCachedSwitches.
+  command_line->AppendArguments(*cached_switches_, false /* include_program */);
+
+  // Sandbox can be enabled for renderer processes hosting cross-origin frames
+  // unless nodeIntegrationInSubFrames is enabled
+  bool can_sandbox_frame =
+      is_subframe && !IsEnabled(options::kNodeIntegrationInSubFrames);
+
+  // If the `sandbox` option was passed to the BrowserWindow's webPreferences,
+  // pass `--enable-sandbox` to the renderer so it won't have any node.js
+  // integration. Otherwise disable Chromium sandbox, unless app.enableSandbox()
+  // was called. This depends on flags the caller already appended, so it is
+  // not part of the cached switches.
+  if (IsEnabled(options::kSandbox) || can_sandbox_frame) {
+    command_line->AppendSwitch(switches::kEnableSandbox);
+  } else if (!command_line->HasSwitch(switches::kEnableSandbox)) {
+    command_line->AppendSwitch(service_manager::switches::kNoSandbox);
+    command_line->AppendSwitch(::switches::kNoZygote);
+  }
+
+  // Cap the renderer's V8 heap. The limit rides on --js-flags, and the
+  // caller may already have propagated app-wide flags on that switch, so
+  // merge with whatever is there rather than caching a fixed value.
+  int max_heap_size = 0;
+  if (GetAsInteger(&preference_, options::kMaxHeapSize, &max_heap_size) &&
+      max_heap_size > 0) {
+    std::string js_flags =
+        command_line->GetSwitchValueASCII(::switches::kJavaScriptFlags);
+    if (!js_flags.empty())
+      js_flags += " ";
+    js_flags += base::StringPrintf("--max-heap-size=%d", max_heap_size);
+    command_line->AppendSwitchASCII(::switches::kJavaScriptFlags, js_flags);
+  }
+
+  int guest_instance_id = 0;
+  if (GetAsInteger(&preference_, options::kGuestInstanceID,
+                   &guest_instance_id) &&
+      guest_instance_id) {
     // Webview `document.visibilityState` tracks window visibility so we need
-    // to let it know if the window happens to be hidden right now.
+    // to let it know if the window happens to be hidden right now. This is
+    // per-launch state, not a preference, so it is not cached either.
     auto* manager = WebViewManager::GetWebViewManager(web_contents_);
     if (manager) {
       auto* embedder = manager->GetEmbedder(guest_instance_id);
@@ -410,14 +472,6 @@ void WebContentsPreferences::AppendCommandLineSwitches(
       }
     }
   }
-
-  if (IsEnabled(options::kNodeIntegrationInSubFrames))
-    command_line->AppendSwitch(switches::kNodeIntegrationInSubFrames);
-
-  // We are appending args to a webContents so let's save the current state
-  // of our preferences object so that during the lifetime of the WebContents
-  // we can fetch the options used to initally configure the WebContents
-  last_preference_ = preference_.Clone();
 }
 
 void WebContentsPreferences::OverrideWebkitPrefs(
@@ -5,6 +5,7 @@
 #ifndef SHELL_BROWSER_WEB_CONTENTS_PREFERENCES_H_
 #define SHELL_BROWSER_WEB_CONTENTS_PREFERENCES_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,12 @@ class WebContentsPreferences
   // Set preference value to given bool
   void SetBool(base::StringPiece key, bool value);
 
+  // Rebuilds |cached_switches_| from |preference_|. Only the switches derived
+  // purely from the preference dictionary live here; parts that depend on
+  // per-launch state (sandbox inheritance, window visibility) are appended
+  // separately in AppendCommandLineSwitches.
+  void RebuildCachedSwitches();
+
   static std::vector<WebContentsPreferences*> instances_;
 
   content::WebContents* web_contents_;
@@ -85,6 +92,10 @@ class WebContentsPreferences
   base::Value preference_ = base::Value(base::Value::Type::DICTIONARY);
   base::Value last_preference_ = base::Value(base::Value::Type::DICTIONARY);
 
+  // Preference-derived switches, computed once per preference change instead
+  // of re-walking the dictionary on every renderer launch. Null when stale.
+  std::unique_ptr<base::CommandLine> cached_switches_;
+
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 
   DISALLOW_COPY_AND_ASSIGN(WebContentsPreferences);
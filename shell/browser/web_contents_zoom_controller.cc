@@ -4,6 +4,7 @@
 
 #include "shell/browser/web_contents_zoom_controller.h"
 
+#include "base/bind.h"
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/navigation_handle.h"
@@ -12,6 +13,8 @@
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/common/page_type.h"
+#include "electron/shell/common/api/api.mojom.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
 #include "net/base/url_util.h"
 #include "third_party/blink/public/common/page/page_zoom.h"
 
@@ -22,6 +25,9 @@ WebContentsZoomController::WebContentsZoomController(
     : content::WebContentsObserver(web_contents) {
   default_zoom_factor_ = kPageZoomEpsilon;
   host_zoom_map_ = content::HostZoomMap::GetForWebContents(web_contents);
+  zoom_subscription_ = host_zoom_map_->AddZoomLevelChangedCallback(
+      base::BindRepeating(&WebContentsZoomController::OnZoomLevelChangedInMap,
+                          base::Unretained(this)));
 }
 
 WebContentsZoomController::~WebContentsZoomController() = default;
@@ -57,6 +63,8 @@ void WebContentsZoomController::SetZoomLevel(double level) {
     for (Observer& observer : observers_)
       observer.OnZoomLevelChanged(web_contents(), level, true);
 
+    // Manual mode bypasses the HostZoomMap, so no map callback fires.
+    PushZoomLevelToRenderer();
     return;
   }
 
@@ -223,6 +231,10 @@ void WebContentsZoomController::DidFinishNavigation(
 
   ResetZoomModeOnNavigationIfNeeded(navigation_handle->GetURL());
   SetZoomFactorOnNavigationIfNeeded(navigation_handle->GetURL());
+
+  // The committed document starts with an empty renderer-side cache; prime
+  // it so the first webFrame.getZoomLevel() does not pay a sync IPC.
+  PushZoomLevelToRenderer();
 }
 
 void WebContentsZoomController::WebContentsDestroyed() {
@@ -243,6 +255,9 @@ void WebContentsZoomController::RenderFrameHostChanged(
     return;
 
   host_zoom_map_ = new_host_zoom_map;
+  zoom_subscription_ = host_zoom_map_->AddZoomLevelChangedCallback(
+      base::BindRepeating(&WebContentsZoomController::OnZoomLevelChangedInMap,
+                          base::Unretained(this)));
 }
 
 void WebContentsZoomController::SetZoomFactorOnNavigationIfNeeded(
@@ -278,6 +293,25 @@ void WebContentsZoomController::SetZoomFactorOnNavigationIfNeeded(
   SetZoomLevel(zoom_level);
 }
 
+void WebContentsZoomController::PushZoomLevelToRenderer() {
+  auto* frame_host = web_contents()->GetMainFrame();
+  if (!frame_host || !frame_host->IsRenderFrameLive())
+    return;
+
+  mojo::AssociatedRemote<mojom::ElectronRenderer> electron_renderer;
+  frame_host->GetRemoteAssociatedInterfaces()->GetInterface(
+      &electron_renderer);
+  electron_renderer->ZoomLevelChanged(GetZoomLevel());
+}
+
+void WebContentsZoomController::OnZoomLevelChangedInMap(
+    const content::HostZoomMap::ZoomLevelChange& change) {
+  // Zoom changes are rare; pushing the current level unconditionally is
+  // cheaper than working out whether the changed host matches this view,
+  // and also covers per-origin changes made through another tab.
+  PushZoomLevelToRenderer();
+}
+
 WEB_CONTENTS_USER_DATA_KEY_IMPL(WebContentsZoomController)
 
 }  // namespace electron
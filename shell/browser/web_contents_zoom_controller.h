@@ -6,6 +6,7 @@
 #define SHELL_BROWSER_WEB_CONTENTS_ZOOM_CONTROLLER_H_
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include "base/observer_list_types.h"
@@ -94,6 +95,16 @@ class WebContentsZoomController
   // Called after a navigation has committed to set default zoom factor.
   void SetZoomFactorOnNavigationIfNeeded(const GURL& url);
 
+  // Pushes the current zoom level to the renderer, which serves
+  // webFrame.getZoomLevel() from a local cache instead of a synchronous
+  // round-trip. Called on every change that can affect this view's zoom.
+  void PushZoomLevelToRenderer();
+
+  // Fired for any zoom change in the view's HostZoomMap, including
+  // per-origin changes made through another tab.
+  void OnZoomLevelChangedInMap(
+      const content::HostZoomMap::ZoomLevelChange& change);
+
   // The current zoom mode.
   ZoomMode zoom_mode_ = ZoomMode::DEFAULT;
 
@@ -114,6 +125,8 @@ class WebContentsZoomController
 
   content::HostZoomMap* host_zoom_map_;
 
+  std::unique_ptr<content::HostZoomMap::Subscription> zoom_subscription_;
+
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 
   DISALLOW_COPY_AND_ASSIGN(WebContentsZoomController);
@@ -14,6 +14,7 @@
 #include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/post_task.h"
 #include "chrome/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/file_select_listener.h"
@@ -88,17 +89,31 @@ class FileSelectHelper : public base::RefCounted<FileSelectHelper>,
     if (data.info.IsDirectory())
       return;
 
-    lister_paths_.push_back(data.path);
+    // Convert entries as they stream in instead of collecting the whole
+    // path vector and converting it at the end, so a large folder does
+    // not peak at two copies of the listing.
+    lister_file_info_.push_back(FileChooserFileInfo::NewNativeFile(
+        blink::mojom::NativeFileInfo::New(data.path, base::string16())));
   }
 
   // net::DirectoryLister::DirectoryListerDelegate
   void OnListDone(int error) override {
-    std::vector<FileChooserFileInfoPtr> file_info;
-    for (const auto& path : lister_paths_)
-      file_info.push_back(FileChooserFileInfo::NewNativeFile(
-          blink::mojom::NativeFileInfo::New(path, base::string16())));
+    lister_.reset();
+    OnFilesSelected(std::move(lister_file_info_), lister_base_dir_);
+    Release();
+  }
 
-    OnFilesSelected(std::move(file_info), lister_base_dir_);
+  // Stops an in-progress enumeration when the target frame goes away, so
+  // the lister does not keep walking a large tree for a listener that can
+  // no longer use the result.
+  void CancelEnumeration() {
+    if (!lister_)
+      return;
+    lister_->Cancel();
+    lister_.reset();
+    lister_file_info_.clear();
+    OnSelectionCancelled();
+    // Balances the AddRef() in EnumerateDirectory().
     Release();
   }
 
@@ -106,7 +121,7 @@ class FileSelectHelper : public base::RefCounted<FileSelectHelper>,
     // Ensure that this fn is only called once
     DCHECK(!lister_);
     DCHECK(!lister_base_dir_.empty());
-    DCHECK(lister_paths_.empty());
+    DCHECK(lister_file_info_.empty());
 
     lister_ = std::make_unique<net::DirectoryLister>(
         lister_base_dir_, net::DirectoryLister::NO_SORT_RECURSIVE, this);
@@ -200,18 +215,25 @@ class FileSelectHelper : public base::RefCounted<FileSelectHelper>,
   // content::WebContentsObserver:
   void RenderFrameHostChanged(content::RenderFrameHost* old_host,
                               content::RenderFrameHost* new_host) override {
-    if (old_host == render_frame_host_)
+    if (old_host == render_frame_host_) {
       render_frame_host_ = nullptr;
+      CancelEnumeration();
+    }
   }
 
   // content::WebContentsObserver:
   void RenderFrameDeleted(content::RenderFrameHost* deleted_host) override {
-    if (deleted_host == render_frame_host_)
+    if (deleted_host == render_frame_host_) {
       render_frame_host_ = nullptr;
+      CancelEnumeration();
+    }
   }
 
   // content::WebContentsObserver:
-  void WebContentsDestroyed() override { render_frame_host_ = nullptr; }
+  void WebContentsDestroyed() override {
+    render_frame_host_ = nullptr;
+    CancelEnumeration();
+  }
 
   content::RenderFrameHost* render_frame_host_;
   std::unique_ptr<content::FileSelectListener> listener_;
@@ -220,9 +242,34 @@ class FileSelectHelper : public base::RefCounted<FileSelectHelper>,
   // DirectoryLister-specific members
   std::unique_ptr<net::DirectoryLister> lister_;
   base::FilePath lister_base_dir_;
-  std::vector<base::FilePath> lister_paths_;
+  std::vector<FileChooserFileInfoPtr> lister_file_info_;
 };
 
+// Enumerates |dir| on the blocking pool, the UI thread must not touch the
+// disk for what can be a very large tree.
+std::vector<FileChooserFileInfoPtr> EnumerateDirectoryOnWorkerThread(
+    const base::FilePath& dir) {
+  int types = base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES |
+              base::FileEnumerator::INCLUDE_DOT_DOT;
+  base::FileEnumerator file_enum(dir, false, types);
+
+  base::FilePath path;
+  std::vector<FileChooserFileInfoPtr> file_info;
+  while (!(path = file_enum.Next()).empty()) {
+    file_info.push_back(FileChooserFileInfo::NewNativeFile(
+        blink::mojom::NativeFileInfo::New(path, base::string16())));
+  }
+  return file_info;
+}
+
+void OnDirectoryEnumerated(
+    std::unique_ptr<content::FileSelectListener> listener,
+    const base::FilePath& dir,
+    std::vector<FileChooserFileInfoPtr> file_info) {
+  listener->FileSelected(std::move(file_info), dir,
+                         FileChooserParams::Mode::kUploadFolder);
+}
+
 file_dialog::Filters GetFileTypesFromAcceptType(
     const std::vector<base::string16>& accept_types) {
   file_dialog::Filters filters;
@@ -344,19 +391,12 @@ void WebDialogHelper::EnumerateDirectory(
     content::WebContents* web_contents,
     std::unique_ptr<content::FileSelectListener> listener,
     const base::FilePath& dir) {
-  int types = base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES |
-              base::FileEnumerator::INCLUDE_DOT_DOT;
-  base::FileEnumerator file_enum(dir, false, types);
-
-  base::FilePath path;
-  std::vector<FileChooserFileInfoPtr> file_info;
-  while (!(path = file_enum.Next()).empty()) {
-    file_info.push_back(FileChooserFileInfo::NewNativeFile(
-        blink::mojom::NativeFileInfo::New(path, base::string16())));
-  }
-
-  listener->FileSelected(std::move(file_info), dir,
-                         FileChooserParams::Mode::kUploadFolder);
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(),
+       base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&EnumerateDirectoryOnWorkerThread, dir),
+      base::BindOnce(&OnDirectoryEnumerated, std::move(listener), dir));
 }
 
 }  // namespace electron
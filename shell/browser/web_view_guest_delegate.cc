@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "content/browser/renderer_host/render_widget_host_view_base.h"  // nogncheck
 #include "content/browser/web_contents/web_contents_impl.h"  // nogncheck
 #include "content/public/browser/navigation_handle.h"
 #include "content/public/browser/render_frame_host.h"
@@ -39,6 +40,16 @@ void WebViewGuestDelegate::AttachToIframe(
             content::WebContents::FromRenderFrameHost(embedder_frame));
 
   content::WebContents* guest_web_contents = api_web_contents_->web_contents();
+
+  // Attaching swaps the guest's widget view for a child-frame view embedded
+  // in the outer contents. Keep a weak handle on the outgoing view so its
+  // last rendered surface can be carried over.
+  base::WeakPtr<content::RenderWidgetHostViewBase> old_view;
+  if (auto* rwhv = static_cast<content::RenderWidgetHostViewBase*>(
+          guest_web_contents->GetRenderWidgetHostView())) {
+    old_view = rwhv->GetWeakPtr();
+  }
+
   // Attach this inner WebContents |guest_web_contents| to the outer
   // WebContents |embedder_web_contents|. The outer WebContents's
   // frame |embedder_frame| hosts the inner WebContents.
@@ -46,6 +57,14 @@ void WebViewGuestDelegate::AttachToIframe(
       base::WrapUnique<content::WebContents>(guest_web_contents),
       embedder_frame);
 
+  // Seed the new view with the old view's fallback surface so the guest
+  // keeps showing its last frame until the first post-attach frame arrives
+  // instead of flashing white; re-attaching a recently detached guest (tab
+  // switching) then never drops its rendered content.
+  auto* new_view = guest_web_contents->GetRenderWidgetHostView();
+  if (old_view && new_view && new_view != old_view.get())
+    new_view->TakeFallbackContentFrom(old_view.get());
+
   ResetZoomController();
 
   embedder_zoom_controller_ =
@@ -20,23 +20,53 @@ void WebViewManager::AddGuest(int guest_instance_id,
                               content::WebContents* embedder,
                               content::WebContents* web_contents) {
   web_contents_embedder_map_[guest_instance_id] = {web_contents, embedder};
+  embedder_to_guests_map_[embedder].insert(guest_instance_id);
 
   // Map the element in embedder to guest.
   int owner_process_id = embedder->GetMainFrame()->GetProcess()->GetID();
   ElementInstanceKey key(owner_process_id, element_instance_id);
   element_instance_id_to_guest_map_[key] = guest_instance_id;
+  guest_to_element_instance_map_.emplace(guest_instance_id, key);
 }
 
 void WebViewManager::RemoveGuest(int guest_instance_id) {
-  if (web_contents_embedder_map_.erase(guest_instance_id) == 0)
+  const auto iter = web_contents_embedder_map_.find(guest_instance_id);
+  if (iter == std::end(web_contents_embedder_map_))
     return;
 
+  const auto embedder_iter =
+      embedder_to_guests_map_.find(iter->second.embedder);
+  if (embedder_iter != std::end(embedder_to_guests_map_)) {
+    embedder_iter->second.erase(guest_instance_id);
+    if (embedder_iter->second.empty())
+      embedder_to_guests_map_.erase(embedder_iter);
+  }
+  web_contents_embedder_map_.erase(iter);
+
   // Remove the record of element in embedder too.
-  for (const auto& element : element_instance_id_to_guest_map_)
-    if (element.second == guest_instance_id) {
-      element_instance_id_to_guest_map_.erase(element.first);
-      break;
+  const auto element_iter =
+      guest_to_element_instance_map_.find(guest_instance_id);
+  if (element_iter != std::end(guest_to_element_instance_map_)) {
+    element_instance_id_to_guest_map_.erase(element_iter->second);
+    guest_to_element_instance_map_.erase(element_iter);
+  }
+}
+
+void WebViewManager::RemoveEmbedderGuests(content::WebContents* embedder) {
+  const auto embedder_iter = embedder_to_guests_map_.find(embedder);
+  if (embedder_iter == std::end(embedder_to_guests_map_))
+    return;
+
+  for (int guest_instance_id : embedder_iter->second) {
+    web_contents_embedder_map_.erase(guest_instance_id);
+    const auto element_iter =
+        guest_to_element_instance_map_.find(guest_instance_id);
+    if (element_iter != std::end(guest_to_element_instance_map_)) {
+      element_instance_id_to_guest_map_.erase(element_iter->second);
+      guest_to_element_instance_map_.erase(element_iter);
     }
+  }
+  embedder_to_guests_map_.erase(embedder_iter);
 }
 
 content::WebContents* WebViewManager::GetEmbedder(int guest_instance_id) {
@@ -62,10 +92,17 @@ content::WebContents* WebViewManager::GetGuestByInstanceID(
 
 bool WebViewManager::ForEachGuest(content::WebContents* embedder_web_contents,
                                   const GuestCallback& callback) {
-  for (auto& item : web_contents_embedder_map_)
-    if (item.second.embedder == embedder_web_contents &&
-        callback.Run(item.second.web_contents))
+  const auto embedder_iter =
+      embedder_to_guests_map_.find(embedder_web_contents);
+  if (embedder_iter == std::end(embedder_to_guests_map_))
+    return false;
+
+  for (int guest_instance_id : embedder_iter->second) {
+    const auto iter = web_contents_embedder_map_.find(guest_instance_id);
+    if (iter != std::end(web_contents_embedder_map_) &&
+        callback.Run(iter->second.web_contents))
       return true;
+  }
   return false;
 }
 
@@ -6,6 +6,7 @@
 #define SHELL_BROWSER_WEB_VIEW_MANAGER_H_
 
 #include <map>
+#include <set>
 
 #include "content/public/browser/browser_plugin_guest_manager.h"
 
@@ -23,6 +24,10 @@ class WebViewManager : public content::BrowserPluginGuestManager {
   void RemoveGuest(int guest_instance_id);
   content::WebContents* GetEmbedder(int guest_instance_id);
 
+  // Removes every guest belonging to |embedder| in one pass, instead of
+  // one RemoveGuest call per guest during embedder teardown.
+  void RemoveEmbedderGuests(content::WebContents* embedder);
+
   static WebViewManager* GetWebViewManager(content::WebContents* web_contents);
 
  protected:
@@ -62,6 +67,14 @@ class WebViewManager : public content::BrowserPluginGuestManager {
   // (embedder_process_id, element_instance_id) => guest_instance_id
   std::map<ElementInstanceKey, int> element_instance_id_to_guest_map_;
 
+  // Secondary indexes kept in sync with the maps above, so per-embedder
+  // queries do not scan every guest and removal does not scan the
+  // element map.
+  // embedder => guest_instance_ids
+  std::map<content::WebContents*, std::set<int>> embedder_to_guests_map_;
+  // guest_instance_id => (embedder_process_id, element_instance_id)
+  std::map<int, ElementInstanceKey> guest_to_element_instance_map_;
+
   DISALLOW_COPY_AND_ASSIGN(WebViewManager);
 };
 
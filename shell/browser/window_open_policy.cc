@@ -0,0 +1,40 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/window_open_policy.h"
+
+#include <utility>
+
+#include "url/gurl.h"
+
+namespace electron {
+
+WindowOpenPolicy::Rule::Rule() = default;
+
+WindowOpenPolicy::Rule::Rule(const Rule& other) = default;
+
+WindowOpenPolicy::Rule::Rule(Rule&& other) = default;
+
+WindowOpenPolicy::Rule::~Rule() = default;
+
+WindowOpenPolicy::WindowOpenPolicy(content::WebContents* web_contents) {}
+
+WindowOpenPolicy::~WindowOpenPolicy() = default;
+
+void WindowOpenPolicy::SetRules(std::vector<Rule> rules) {
+  rules_ = std::move(rules);
+}
+
+const WindowOpenPolicy::Rule* WindowOpenPolicy::Evaluate(
+    const GURL& url) const {
+  for (const Rule& rule : rules_) {
+    if (rule.pattern.MatchesURL(url))
+      return &rule;
+  }
+  return nullptr;
+}
+
+WEB_CONTENTS_USER_DATA_KEY_IMPL(WindowOpenPolicy)
+
+}  // namespace electron
@@ -0,0 +1,71 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_WINDOW_OPEN_POLICY_H_
+#define SHELL_BROWSER_WINDOW_OPEN_POLICY_H_
+
+#include <string>
+#include <vector>
+
+#include "content/public/browser/web_contents_user_data.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace electron {
+
+// Declarative window-open rules for a WebContents, the popup counterpart
+// of NavigationPolicyRules. Denied popups are rejected inside the
+// synchronous window.open() IPC, before any guest WebContents is created
+// and without entering JS, so a page spamming popups costs one pattern
+// match per attempt instead of the full interception machinery. Stored as
+// WebContentsUserData so AtomBrowserClient can consult the rules without
+// going through the JS wrapper.
+class WindowOpenPolicy : public content::WebContentsUserData<WindowOpenPolicy> {
+ public:
+  enum class Policy {
+    kAllow,      // Open through the default machinery, skipping no JS
+                 // event but merging the rule's extra features.
+    kDeny,       // Reject the popup; no guest is ever created.
+    kDeferToJS,  // Fall through to the usual events.
+  };
+
+  struct Rule {
+    Rule();
+    Rule(const Rule& other);
+    Rule(Rule&& other);
+    ~Rule();
+
+    URLPattern pattern;
+    Policy policy = Policy::kDeferToJS;
+    // Appended to the popup's feature list when |policy| is kAllow, so a
+    // rule can force e.g. "width=300" without a JS handler.
+    std::vector<std::string> features;
+  };
+
+  ~WindowOpenPolicy() override;
+
+  // Replaces the rule set; an empty vector removes all rules.
+  void SetRules(std::vector<Rule> rules);
+
+  bool empty() const { return rules_.empty(); }
+
+  // Returns the first rule matching |url|, or nullptr when nothing
+  // matches. The pointer is valid until the next SetRules() call.
+  const Rule* Evaluate(const GURL& url) const;
+
+ private:
+  explicit WindowOpenPolicy(content::WebContents* web_contents);
+  friend class content::WebContentsUserData<WindowOpenPolicy>;
+
+  std::vector<Rule> rules_;
+
+  WEB_CONTENTS_USER_DATA_KEY_DECL();
+
+  DISALLOW_COPY_AND_ASSIGN(WindowOpenPolicy);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_WINDOW_OPEN_POLICY_H_
@@ -30,6 +30,11 @@ const char kPartitionDefaultZoomLevel[] = "partition.default_zoom_level";
 // be displayed at the default zoom level.
 const char kPartitionPerHostZoomLevels[] = "partition.per_host_zoom_levels";
 
+// How long to wait after the last zoom change before committing the batched
+// per-host changes to the pref store.
+constexpr base::TimeDelta kCommitPendingChangesDelay =
+    base::TimeDelta::FromMilliseconds(500);
+
 std::string GetHash(const base::FilePath& partition_path) {
   size_t int_key = std::hash<base::FilePath>()(partition_path);
   return base::NumberToString(int_key);
@@ -50,7 +55,10 @@ ZoomLevelDelegate::ZoomLevelDelegate(PrefService* pref_service,
   partition_key_ = GetHash(partition_path);
 }
 
-ZoomLevelDelegate::~ZoomLevelDelegate() = default;
+ZoomLevelDelegate::~ZoomLevelDelegate() {
+  if (!pending_changes_.empty())
+    CommitPendingChanges();
+}
 
 void ZoomLevelDelegate::SetDefaultZoomLevelPref(double level) {
   if (blink::PageZoomValuesEqual(level, host_zoom_map_->GetDefaultZoomLevel()))
@@ -78,13 +86,28 @@ void ZoomLevelDelegate::OnZoomLevelChanged(
     return;
 
   double level = change.zoom_level;
+  bool modification_is_removal =
+      blink::PageZoomValuesEqual(level, host_zoom_map_->GetDefaultZoomLevel());
+
+  // Only record the latest value per host here; the pref store update (which
+  // notifies pref observers and re-serializes the dictionary) happens once in
+  // CommitPendingChanges after the zoom level settles.
+  pending_changes_[change.host] =
+      modification_is_removal ? base::nullopt : base::make_optional(level);
+  commit_timer_.Start(FROM_HERE, kCommitPendingChangesDelay,
+                      base::BindOnce(&ZoomLevelDelegate::CommitPendingChanges,
+                                     base::Unretained(this)));
+}
+
+void ZoomLevelDelegate::CommitPendingChanges() {
+  commit_timer_.Stop();
+  if (pending_changes_.empty())
+    return;
+
   DictionaryPrefUpdate update(pref_service_, kPartitionPerHostZoomLevels);
   base::DictionaryValue* host_zoom_dictionaries = update.Get();
   DCHECK(host_zoom_dictionaries);
 
-  bool modification_is_removal =
-      blink::PageZoomValuesEqual(level, host_zoom_map_->GetDefaultZoomLevel());
-
   base::DictionaryValue* host_zoom_dictionary = nullptr;
   if (!host_zoom_dictionaries->GetDictionary(partition_key_,
                                              &host_zoom_dictionary)) {
@@ -92,10 +115,13 @@ void ZoomLevelDelegate::OnZoomLevelChanged(
         partition_key_, std::make_unique<base::DictionaryValue>());
   }
 
-  if (modification_is_removal)
-    host_zoom_dictionary->RemoveWithoutPathExpansion(change.host, nullptr);
-  else
-    host_zoom_dictionary->SetKey(change.host, base::Value(level));
+  for (const auto& change : pending_changes_) {
+    if (change.second)
+      host_zoom_dictionary->SetKey(change.first, base::Value(*change.second));
+    else
+      host_zoom_dictionary->RemoveWithoutPathExpansion(change.first, nullptr);
+  }
+  pending_changes_.clear();
 }
 
 void ZoomLevelDelegate::ExtractPerHostZoomLevels(
@@ -5,11 +5,14 @@
 #ifndef SHELL_BROWSER_ZOOM_LEVEL_DELEGATE_H_
 #define SHELL_BROWSER_ZOOM_LEVEL_DELEGATE_H_
 
+#include <map>
 #include <memory>
 #include <string>
 
 #include "base/files/file_path.h"
 #include "base/macros.h"
+#include "base/optional.h"
+#include "base/timer/timer.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/host_zoom_map.h"
 #include "content/public/browser/zoom_level_delegate.h"
@@ -51,11 +54,21 @@ class ZoomLevelDelegate : public content::ZoomLevelDelegate {
   // zoom levels (if any) managed by this class (for its associated partition).
   void OnZoomLevelChanged(const content::HostZoomMap::ZoomLevelChange& change);
 
+  // Writes all pending per-host changes to the pref store in one update.
+  void CommitPendingChanges();
+
   PrefService* pref_service_;
   content::HostZoomMap* host_zoom_map_;
   std::unique_ptr<content::HostZoomMap::Subscription> zoom_subscription_;
   std::string partition_key_;
 
+  // Per-host changes that have not been written to the pref store yet,
+  // keyed by host; base::nullopt means the entry is to be removed. Ctrl-scroll
+  // zooming produces dozens of changes per second, so they are batched and
+  // committed once the zoom level settles.
+  std::map<std::string, base::Optional<double>> pending_changes_;
+  base::OneShotTimer commit_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(ZoomLevelDelegate);
 };
 
@@ -4,8 +4,11 @@
 
 #include <stddef.h>
 
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "base/task/post_task.h"
 #include "native_mate/wrappable.h"
 #include "shell/common/asar/archive.h"
 #include "shell/common/asar/asar_util.h"
@@ -15,8 +18,21 @@
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
+#include "shell/common/promise_util.h"
 namespace {
 
+// Runs on the thread pool; resolves the archive again there since cached
+// Archive objects are thread-local.
+base::FilePath CopyFileOutOnWorkerThread(const base::FilePath& archive_path,
+                                         const base::FilePath& path) {
+  std::shared_ptr<asar::Archive> archive =
+      asar::GetOrCreateAsarArchive(archive_path);
+  base::FilePath new_path;
+  if (!archive || !archive->CopyFileOut(path, &new_path))
+    return base::FilePath();
+  return new_path;
+}
+
 class Archive : public mate::Wrappable<Archive> {
  public:
   static v8::Local<v8::Value> Create(v8::Isolate* isolate,
@@ -34,9 +50,14 @@ class Archive : public mate::Wrappable<Archive> {
         .SetProperty("path", &Archive::GetPath)
         .SetMethod("getFileInfo", &Archive::GetFileInfo)
         .SetMethod("stat", &Archive::Stat)
+        .SetMethod("statMany", &Archive::StatMany)
+        .SetMethod("getStatsSnapshot", &Archive::GetStatsSnapshot)
         .SetMethod("readdir", &Archive::Readdir)
         .SetMethod("realpath", &Archive::Realpath)
         .SetMethod("copyFileOut", &Archive::CopyFileOut)
+        .SetMethod("copyFileOutAsync", &Archive::CopyFileOutAsync)
+        .SetMethod("setRecordAccessOrder", &Archive::SetRecordAccessOrder)
+        .SetMethod("getRecordedAccessOrder", &Archive::GetRecordedAccessOrder)
         .SetMethod("getFd", &Archive::GetFD);
   }
 
@@ -59,6 +80,9 @@ class Archive : public mate::Wrappable<Archive> {
     dict.Set("size", info.size);
     dict.Set("unpacked", info.unpacked);
     dict.Set("offset", info.offset);
+    // The bytes at |offset| are a gzip stream; JS readers must not consume
+    // them raw.
+    dict.Set("compressed", info.compressed);
     return dict.GetHandle();
   }
 
@@ -67,12 +91,35 @@ class Archive : public mate::Wrappable<Archive> {
     asar::Archive::Stats stats;
     if (!archive_ || !archive_->Stat(path, &stats))
       return v8::False(isolate);
+    return StatsToValue(isolate, stats);
+  }
+
+  // Stats many paths with a single C++ round-trip; entries for missing
+  // paths are false.
+  v8::Local<v8::Value> StatMany(v8::Isolate* isolate,
+                                const std::vector<base::FilePath>& paths) {
+    std::vector<v8::Local<v8::Value>> results;
+    results.reserve(paths.size());
+    for (const auto& path : paths) {
+      asar::Archive::Stats stats;
+      if (archive_ && archive_->Stat(path, &stats))
+        results.push_back(StatsToValue(isolate, stats));
+      else
+        results.push_back(v8::False(isolate));
+    }
+    return gin::ConvertToV8(isolate, results);
+  }
+
+  // Returns stats for every entry in the archive keyed by path, so the JS
+  // layer can resolve whole directory trees without further calls.
+  v8::Local<v8::Value> GetStatsSnapshot(v8::Isolate* isolate) {
     gin_helper::Dictionary dict(isolate, v8::Object::New(isolate));
-    dict.Set("size", stats.size);
-    dict.Set("offset", stats.offset);
-    dict.Set("isFile", stats.is_file);
-    dict.Set("isDirectory", stats.is_directory);
-    dict.Set("isLink", stats.is_link);
+    if (!archive_)
+      return dict.GetHandle();
+    std::vector<std::pair<base::FilePath, asar::Archive::Stats>> stats;
+    archive_->GetAllStats(&stats);
+    for (const auto& pair : stats)
+      dict.Set(pair.first.AsUTF8Unsafe(), StatsToValue(isolate, pair.second));
     return dict.GetHandle();
   }
 
@@ -103,6 +150,45 @@ class Archive : public mate::Wrappable<Archive> {
     return gin::ConvertToV8(isolate, new_path);
   }
 
+  // Like CopyFileOut, but extracts on the thread pool and returns a
+  // promise, so callers don't block the main thread on first access.
+  v8::Local<v8::Promise> CopyFileOutAsync(v8::Isolate* isolate,
+                                          const base::FilePath& path) {
+    electron::util::Promise<base::FilePath> promise(isolate);
+    v8::Local<v8::Promise> handle = promise.GetHandle();
+
+    base::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        {base::ThreadPool(), base::MayBlock(),
+         base::TaskPriority::USER_BLOCKING},
+        base::BindOnce(&CopyFileOutOnWorkerThread, archive_->path(), path),
+        base::BindOnce(
+            [](electron::util::Promise<base::FilePath> promise,
+               base::FilePath result) {
+              if (result.empty())
+                promise.RejectWithErrorMessage("Failed to copy file out");
+              else
+                promise.ResolveWithGin(result);
+            },
+            std::move(promise)));
+
+    return handle;
+  }
+
+  // Toggle recording of file lookup order, used to generate the header's
+  // "prefetch" section from production telemetry.
+  void SetRecordAccessOrder(bool record) {
+    if (archive_)
+      archive_->SetRecordAccessOrder(record);
+  }
+
+  // Returns (and clears) the recorded lookup order.
+  std::vector<std::string> GetRecordedAccessOrder() {
+    if (!archive_)
+      return std::vector<std::string>();
+    return archive_->TakeRecordedAccessOrder();
+  }
+
   // Return the file descriptor.
   int GetFD() const {
     if (!archive_)
@@ -111,6 +197,18 @@ class Archive : public mate::Wrappable<Archive> {
   }
 
  private:
+  static v8::Local<v8::Value> StatsToValue(
+      v8::Isolate* isolate,
+      const asar::Archive::Stats& stats) {
+    gin_helper::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("size", stats.size);
+    dict.Set("offset", stats.offset);
+    dict.Set("isFile", stats.is_file);
+    dict.Set("isDirectory", stats.is_directory);
+    dict.Set("isLink", stats.is_link);
+    return dict.GetHandle();
+  }
+
   std::unique_ptr<asar::Archive> archive_;
 
   DISALLOW_COPY_AND_ASSIGN(Archive);
@@ -4,6 +4,7 @@
 
 #include "shell/common/api/atom_api_clipboard.h"
 
+#include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
 #include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -18,6 +19,71 @@ namespace electron {
 
 namespace api {
 
+namespace {
+
+// Remembers the image most recently written to each clipboard buffer by this
+// process, keyed by the clipboard sequence number observed right after the
+// write. As long as the sequence number is unchanged the platform clipboard
+// still holds exactly that image, so in-process reads can return the cached
+// bitmap instead of round-tripping through the platform clipboard's encoded
+// representation. gfx::Image is refcounted, so keeping it here costs no
+// pixel copy. External apps keep reading the normally written image.
+struct WrittenImage {
+  bool valid = false;
+  uint64_t sequence_number = 0;
+  gfx::Image image;
+};
+
+WrittenImage& GetWrittenImage(ui::ClipboardBuffer buffer) {
+  static base::NoDestructor<WrittenImage> copy_paste;
+  static base::NoDestructor<WrittenImage> selection;
+  return buffer == ui::ClipboardBuffer::kSelection ? *selection : *copy_paste;
+}
+
+// Stages |image| on |writer| in the N32 layout the clipboard wants,
+// converting only when the backing bitmap has another layout. Returns false
+// when the pixels could not be converted.
+bool WriteImageTo(const gfx::Image& image, ui::ScopedClipboardWriter* writer) {
+  SkBitmap orig = image.AsBitmap();
+  if (orig.colorType() == kN32_SkColorType && orig.pixelRef()) {
+    // Already in the layout the clipboard wants; the writer copies the
+    // pixels into its own storage, so no defensive copy is needed.
+    writer->WriteImage(orig);
+    return true;
+  }
+
+  SkBitmap bmp;
+  if (!bmp.tryAllocPixels(orig.info()) ||
+      !orig.readPixels(bmp.info(), bmp.getPixels(), bmp.rowBytes(), 0, 0))
+    return false;
+  writer->WriteImage(bmp);
+  return true;
+}
+
+// Must only be called after the writer that staged |image| has been
+// destroyed: the sequence number reflects the write only once the data has
+// been committed.
+void CacheWrittenImage(const gfx::Image& image, ui::ClipboardBuffer buffer) {
+  WrittenImage& cache = GetWrittenImage(buffer);
+  cache.valid = true;
+  cache.sequence_number =
+      ui::Clipboard::GetForCurrentThread()->GetSequenceNumber(buffer);
+  cache.image = image;
+}
+
+void WriteImageToClipboard(const gfx::Image& image,
+                           ui::ClipboardBuffer buffer) {
+  bool wrote_image;
+  {
+    ui::ScopedClipboardWriter writer(buffer);
+    wrote_image = WriteImageTo(image, &writer);
+  }
+  if (wrote_image)
+    CacheWrittenImage(image, buffer);
+}
+
+}  // namespace
+
 ui::ClipboardBuffer Clipboard::GetClipboardBuffer(gin_helper::Arguments* args) {
   std::string type;
   if (args->GetNext(&type) && type == "selection")
@@ -80,27 +146,38 @@ void Clipboard::WriteBuffer(const std::string& format,
 
 void Clipboard::Write(const gin_helper::Dictionary& data,
                       gin_helper::Arguments* args) {
-  ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
+  ui::ClipboardBuffer buffer = GetClipboardBuffer(args);
   base::string16 text, html, bookmark;
   gfx::Image image;
+  bool wrote_image = false;
 
-  if (data.Get("text", &text)) {
-    writer.WriteText(text);
+  {
+    // A single writer stages every format and commits them in one platform
+    // clipboard transaction when it goes out of scope, so other apps see
+    // one ownership change instead of a notification per format.
+    ui::ScopedClipboardWriter writer(buffer);
 
-    if (data.Get("bookmark", &bookmark))
-      writer.WriteBookmark(bookmark, base::UTF16ToUTF8(text));
-  }
+    if (data.Get("text", &text)) {
+      writer.WriteText(text);
 
-  if (data.Get("rtf", &text)) {
-    std::string rtf = base::UTF16ToUTF8(text);
-    writer.WriteRTF(rtf);
-  }
+      if (data.Get("bookmark", &bookmark))
+        writer.WriteBookmark(bookmark, base::UTF16ToUTF8(text));
+    }
+
+    if (data.Get("rtf", &text)) {
+      std::string rtf = base::UTF16ToUTF8(text);
+      writer.WriteRTF(rtf);
+    }
+
+    if (data.Get("html", &html))
+      writer.WriteHTML(html, std::string());
 
-  if (data.Get("html", &html))
-    writer.WriteHTML(html, std::string());
+    if (data.Get("image", &image))
+      wrote_image = WriteImageTo(image, &writer);
+  }
 
-  if (data.Get("image", &image))
-    writer.WriteImage(image.AsBitmap());
+  if (wrote_image)
+    CacheWrittenImage(image, buffer);
 }
 
 base::string16 Clipboard::ReadText(gin_helper::Arguments* args) {
@@ -175,21 +252,23 @@ void Clipboard::WriteBookmark(const base::string16& title,
 }
 
 gfx::Image Clipboard::ReadImage(gin_helper::Arguments* args) {
+  ui::ClipboardBuffer buffer = GetClipboardBuffer(args);
   ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
-  SkBitmap bitmap = clipboard->ReadImage(GetClipboardBuffer(args));
+
+  // Fast path for images this process wrote: skip the platform read and the
+  // decode entirely and hand back the bitmap we still hold.
+  WrittenImage& cache = GetWrittenImage(buffer);
+  if (cache.valid &&
+      clipboard->GetSequenceNumber(buffer) == cache.sequence_number)
+    return cache.image;
+
+  SkBitmap bitmap = clipboard->ReadImage(buffer);
   return gfx::Image::CreateFrom1xBitmap(bitmap);
 }
 
 void Clipboard::WriteImage(const gfx::Image& image,
                            gin_helper::Arguments* args) {
-  ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
-  SkBitmap orig = image.AsBitmap();
-  SkBitmap bmp;
-
-  if (bmp.tryAllocPixels(orig.info()) &&
-      orig.readPixels(bmp.info(), bmp.getPixels(), bmp.rowBytes(), 0, 0)) {
-    writer.WriteImage(bmp);
-  }
+  WriteImageToClipboard(image, GetClipboardBuffer(args));
 }
 
 #if !defined(OS_MACOSX)
@@ -0,0 +1,53 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "shell/common/cpu_profiler.h"
+#include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/arguments.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/node_includes.h"
+
+namespace {
+
+// One sample per millisecond keeps the overhead around one percent.
+const int kDefaultSamplingIntervalUs = 1000;
+
+void StartProfiling(gin_helper::Arguments* args) {
+  int interval_us = kDefaultSamplingIntervalUs;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("samplingInterval", &interval_us);
+  if (interval_us < 1) {
+    args->ThrowError("samplingInterval must be a positive number");
+    return;
+  }
+
+  if (!electron::StartCpuProfiling(args->isolate(), interval_us))
+    args->ThrowError("CPU profiling is already in progress");
+}
+
+v8::Local<v8::Value> StopProfiling(gin_helper::Arguments* args) {
+  std::unique_ptr<base::Value> profile =
+      electron::StopCpuProfiling(args->isolate());
+  if (!profile) {
+    args->ThrowError("CPU profiling is not in progress");
+    return v8::Null(args->isolate());
+  }
+  return gin::ConvertToV8(args->isolate(), *profile);
+}
+
+void Initialize(v8::Local<v8::Object> exports,
+                v8::Local<v8::Value> unused,
+                v8::Local<v8::Context> context,
+                void* priv) {
+  gin_helper::Dictionary dict(context->GetIsolate(), exports);
+  dict.SetMethod("startProfiling", &StartProfiling);
+  dict.SetMethod("stopProfiling", &StopProfiling);
+}
+
+}  // namespace
+
+NODE_LINKED_MODULE_CONTEXT_AWARE(atom_common_cpu_profiler, Initialize)
@@ -10,6 +10,7 @@
 #include "shell/common/crash_reporter/crash_reporter.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 
 #include "shell/common/node_includes.h"
@@ -36,6 +37,10 @@ struct Converter<CrashReporter::UploadReportResult> {
 
 namespace {
 
+void SetBreadcrumb(int slot, const std::string& value) {
+  CrashReporter::GetInstance()->SetBreadcrumb(slot, value);
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -60,6 +65,13 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod(
       "getUploadToServer",
       base::BindRepeating(&CrashReporter::GetUploadToServer, reporter));
+  dict.SetMethod(
+      "getUploadQueueStats",
+      base::BindRepeating(&CrashReporter::GetUploadQueueStats, reporter));
+  dict.SetMethod(
+      "registerBreadcrumbKey",
+      base::BindRepeating(&CrashReporter::RegisterBreadcrumbKey, reporter));
+  dict.SetMethod("setBreadcrumb", base::BindRepeating(&SetBreadcrumb));
 }
 
 }  // namespace
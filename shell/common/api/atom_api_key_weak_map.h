@@ -5,6 +5,8 @@
 #ifndef SHELL_COMMON_API_ATOM_API_KEY_WEAK_MAP_H_
 #define SHELL_COMMON_API_ATOM_API_KEY_WEAK_MAP_H_
 
+#include <vector>
+
 #include "native_mate/handle.h"
 #include "native_mate/wrappable.h"
 #include "shell/common/gin_converters/std_converter.h"
@@ -29,7 +31,8 @@ class KeyWeakMap : public mate::Wrappable<KeyWeakMap<K>> {
         .SetMethod("set", &KeyWeakMap<K>::Set)
         .SetMethod("get", &KeyWeakMap<K>::Get)
         .SetMethod("has", &KeyWeakMap<K>::Has)
-        .SetMethod("remove", &KeyWeakMap<K>::Remove);
+        .SetMethod("remove", &KeyWeakMap<K>::Remove)
+        .SetMethod("removeMany", &KeyWeakMap<K>::RemoveMany);
   }
 
  protected:
@@ -52,6 +55,10 @@ class KeyWeakMap : public mate::Wrappable<KeyWeakMap<K>> {
 
   void Remove(const K& key) { key_weak_map_.Remove(key); }
 
+  void RemoveMany(const std::vector<K>& keys) {
+    key_weak_map_.RemoveMany(keys);
+  }
+
   electron::KeyWeakMap<K> key_weak_map_;
 
   DISALLOW_COPY_AND_ASSIGN(KeyWeakMap);
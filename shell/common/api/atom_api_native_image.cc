@@ -4,24 +4,33 @@
 
 #include "shell/common/api/atom_api_native_image.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/files/file_util.h"
+#include "base/no_destructor.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "base/synchronization/lock.h"
+#include "base/task/post_task.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
+#include "base/unguessable_token.h"
 #include "net/base/data_url.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gfx_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
+#include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/promise_util.h"
 #include "shell/common/skia_util.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
@@ -36,6 +45,10 @@
 #include "ui/gfx/image/image_util.h"
 
 #if defined(OS_WIN)
+#include <shlobj.h>
+#include <wrl/client.h>
+
+#include "base/win/scoped_com_initializer.h"
 #include "base/win/scoped_gdi_object.h"
 #include "shell/common/asar/archive.h"
 #include "ui/gfx/icon_util.h"
@@ -99,6 +112,247 @@ base::win::ScopedHICON ReadICOFromPath(int size, const base::FilePath& path) {
 
 void Noop(char*, void*) {}
 
+// An image queued for shared-memory transfer to another process. The ID is
+// an unguessable token so a compromised renderer cannot enumerate pending
+// transfers, and each entry records the WebContents it was exported for so
+// no other renderer can claim it.
+struct SharedTransfer {
+  std::string id;
+  int32_t target_web_contents_id;
+  gfx::Image image;
+};
+
+// Pending transfers in export order. Only touched from the main thread.
+// Entries are removed when claimed; the cap bounds what a renderer that
+// dies before claiming can strand here, dropping the oldest entry first.
+std::vector<SharedTransfer>& GetSharedTransfers() {
+  static base::NoDestructor<std::vector<SharedTransfer>> transfers;
+  return *transfers;
+}
+
+constexpr size_t kMaxPendingSharedTransfers = 64;
+
+// The SkBitmap copies below share their pixels with the image they were
+// taken from; the encoders only read them, so handing the copy to the
+// thread pool is safe.
+
+std::vector<unsigned char> EncodePNGOnWorkerThread(SkBitmap bitmap) {
+  std::vector<unsigned char> encoded;
+  gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
+  return encoded;
+}
+
+std::vector<unsigned char> EncodeJPEGOnWorkerThread(SkBitmap bitmap,
+                                                    int quality) {
+  std::vector<unsigned char> encoded;
+  gfx::JPEGCodec::Encode(bitmap, quality, &encoded);
+  return encoded;
+}
+
+std::vector<unsigned char> CopyBitmapOnWorkerThread(SkBitmap bitmap) {
+  std::vector<unsigned char> pixels;
+  SkPixelRef* ref = bitmap.pixelRef();
+  if (ref) {
+    const auto* data = static_cast<const unsigned char*>(ref->pixels());
+    pixels.assign(data, data + bitmap.computeByteSize());
+  }
+  return pixels;
+}
+
+// Runs on the thread the promise was created on, so resolving directly here
+// is fine for both the browser and renderer processes.
+void ResolveWithBuffer(util::Promise<v8::Local<v8::Value>> promise,
+                       std::vector<unsigned char> data) {
+  v8::HandleScope handle_scope(promise.isolate());
+  v8::Local<v8::Value> buffer =
+      node::Buffer::Copy(promise.isolate(),
+                         reinterpret_cast<const char*>(data.data()),
+                         data.size())
+          .ToLocalChecked();
+  promise.ResolveWithGin(buffer);
+}
+
+v8::Local<v8::Promise> PostEncodeTask(
+    v8::Isolate* isolate,
+    base::OnceCallback<std::vector<unsigned char>()> task) {
+  util::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      std::move(task), base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+// Process-wide cache of images decoded from disk, keyed by path and
+// invalidated by file modification time. Tray and menu code decodes the same
+// icons over and over; serving repeats from the cache skips both the file
+// read and the decode, and the cached entries share one bitmap instead of
+// duplicating it per NativeImage. All scale-factor representations of a path
+// are decoded together, so they live in one entry rather than being keyed
+// separately by scale.
+class DecodedImageCache {
+ public:
+  static DecodedImageCache* Get() {
+    static base::NoDestructor<DecodedImageCache> instance;
+    return instance.get();
+  }
+
+  bool Lookup(const base::FilePath& path,
+              base::Time mtime,
+              gfx::Image* image) {
+    base::AutoLock auto_lock(lock_);
+    auto it = cache_.Get(path);
+    if (it == cache_.end())
+      return false;
+    if (it->second.mtime != mtime) {
+      cache_.Erase(it);
+      return false;
+    }
+    *image = it->second.image;
+    return true;
+  }
+
+  void Store(const base::FilePath& path,
+             base::Time mtime,
+             const gfx::Image& image) {
+    base::AutoLock auto_lock(lock_);
+    cache_.Put(path, Entry{image, mtime});
+  }
+
+  void Clear() {
+    base::AutoLock auto_lock(lock_);
+    cache_.Clear();
+  }
+
+ private:
+  friend class base::NoDestructor<DecodedImageCache>;
+
+  struct Entry {
+    gfx::Image image;
+    base::Time mtime;
+  };
+
+  DecodedImageCache() : cache_(kMaxEntries) {}
+  ~DecodedImageCache() = default;
+
+  static constexpr size_t kMaxEntries = 64;
+
+  base::Lock lock_;
+  base::MRUCache<base::FilePath, Entry> cache_;
+
+  DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+#if !defined(OS_MACOSX)
+
+#if defined(OS_WIN)
+// Copies the pixels of the GDI bitmap the shell handed back into an N32
+// SkBitmap. GetDIBits drops the alpha channel, which is fine here: shell
+// thumbnails are rendered opaque.
+SkBitmap SkBitmapFromHBITMAP(HBITMAP bitmap_handle) {
+  BITMAP bitmap_info = {0};
+  if (!GetObject(bitmap_handle, sizeof(bitmap_info), &bitmap_info))
+    return SkBitmap();
+
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocN32Pixels(bitmap_info.bmWidth, bitmap_info.bmHeight))
+    return SkBitmap();
+
+  BITMAPINFO dib_info = {};
+  dib_info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+  dib_info.bmiHeader.biWidth = bitmap_info.bmWidth;
+  // A negative height asks for a top-down DIB, matching SkBitmap's layout.
+  dib_info.bmiHeader.biHeight = -bitmap_info.bmHeight;
+  dib_info.bmiHeader.biPlanes = 1;
+  dib_info.bmiHeader.biBitCount = 32;
+  dib_info.bmiHeader.biCompression = BI_RGB;
+
+  HDC dc = CreateCompatibleDC(nullptr);
+  int copied = GetDIBits(dc, bitmap_handle, 0, bitmap_info.bmHeight,
+                         bitmap.getPixels(), &dib_info, DIB_RGB_COLORS);
+  DeleteDC(dc);
+  if (copied != bitmap_info.bmHeight)
+    return SkBitmap();
+
+  bitmap.setAlphaType(kOpaque_SkAlphaType);
+  return bitmap;
+}
+
+// Asks the shell for a thumbnail; when the Windows thumbnail cache already
+// holds one for the file this returns in milliseconds without touching the
+// original.
+gfx::Image CreateThumbnailOnWorkerThread(const base::FilePath& path,
+                                         const gfx::Size& max_size) {
+  base::win::ScopedCOMInitializer com_initializer;
+
+  Microsoft::WRL::ComPtr<IShellItemImageFactory> factory;
+  if (FAILED(SHCreateItemFromParsingName(path.value().c_str(), nullptr,
+                                         IID_PPV_ARGS(&factory))))
+    return gfx::Image();
+
+  HBITMAP bitmap_handle = nullptr;
+  SIZE desired_size = {max_size.width(), max_size.height()};
+  if (FAILED(factory->GetImage(desired_size, SIIGBF_BIGGERSIZEOK,
+                               &bitmap_handle)))
+    return gfx::Image();
+
+  base::win::ScopedBitmap scoped_bitmap(bitmap_handle);
+  SkBitmap bitmap = SkBitmapFromHBITMAP(bitmap_handle);
+  if (bitmap.isNull())
+    return gfx::Image();
+  return gfx::Image::CreateFrom1xBitmap(bitmap);
+}
+#else
+// No platform thumbnail service here; decode the original off the main
+// thread and scale it down, which at least keeps the decode away from the
+// UI thread.
+gfx::Image CreateThumbnailOnWorkerThread(const base::FilePath& path,
+                                         const gfx::Size& max_size) {
+  gfx::ImageSkia image_skia;
+  electron::util::PopulateImageSkiaRepsFromPath(&image_skia, path);
+  if (image_skia.isNull())
+    return gfx::Image();
+
+  gfx::Size size = image_skia.size();
+  if (size.width() > max_size.width() || size.height() > max_size.height()) {
+    float scale =
+        std::min(static_cast<float>(max_size.width()) / size.width(),
+                 static_cast<float>(max_size.height()) / size.height());
+    image_skia = gfx::ImageSkiaOperations::CreateResizedImage(
+        image_skia, skia::ImageOperations::RESIZE_BEST,
+        gfx::ScaleToFlooredSize(size, scale));
+  }
+  return gfx::Image(image_skia);
+}
+#endif
+
+// Runs on the thread the promise was created on.
+void ResolveThumbnail(util::Promise<gfx::Image> promise, gfx::Image image) {
+  if (image.IsEmpty())
+    promise.RejectWithErrorMessage(
+        "Failed to create a thumbnail for the given path");
+  else
+    promise.ResolveWithGin(image);
+}
+
+#endif  // !defined(OS_MACOSX)
+
+// Modification time used to invalidate cached decodes; for files inside an
+// asar archive the archive's own mtime stands in, since archive contents
+// only change when the archive does.
+base::Time GetCacheMTime(const base::FilePath& path) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::FilePath stat_path = path;
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path))
+    stat_path = asar_path;
+  base::File::Info info;
+  if (!base::GetFileInfo(stat_path, &info))
+    return base::Time();
+  return info.last_modified;
+}
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -199,6 +453,48 @@ v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
       .ToLocalChecked();
 }
 
+v8::Local<v8::Promise> NativeImage::ToPNGAsync(gin::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  if (scale_factor == 1.0f) {
+    // Use raw 1x PNG bytes when available; nothing to encode then.
+    scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    if (png->size() > 0) {
+      util::Promise<v8::Local<v8::Value>> promise(args->isolate());
+      v8::Local<v8::Promise> handle = promise.GetHandle();
+      v8::Local<v8::Value> buffer =
+          node::Buffer::Copy(args->isolate(),
+                             reinterpret_cast<const char*>(png->front()),
+                             png->size())
+              .ToLocalChecked();
+      promise.ResolveWithGin(buffer);
+      return handle;
+    }
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  return PostEncodeTask(args->isolate(),
+                        base::BindOnce(&EncodePNGOnWorkerThread, bitmap));
+}
+
+v8::Local<v8::Promise> NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                                                int quality) {
+  const SkBitmap bitmap = image_.AsBitmap();
+  return PostEncodeTask(isolate,
+                        base::BindOnce(&EncodeJPEGOnWorkerThread, bitmap,
+                                       quality));
+}
+
+v8::Local<v8::Promise> NativeImage::ToBitmapAsync(gin::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  return PostEncodeTask(args->isolate(),
+                        base::BindOnce(&CopyBitmapOnWorkerThread, bitmap));
+}
+
 std::string NativeImage::ToDataURL(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
@@ -387,9 +683,15 @@ gin::Handle<NativeImage> NativeImage::CreateFromPath(
     return gin::CreateHandle(isolate, new NativeImage(isolate, image_path));
   }
 #endif
-  gfx::ImageSkia image_skia;
-  electron::util::PopulateImageSkiaRepsFromPath(&image_skia, image_path);
-  gfx::Image image(image_skia);
+  base::Time mtime = GetCacheMTime(image_path);
+  gfx::Image image;
+  if (!DecodedImageCache::Get()->Lookup(image_path, mtime, &image)) {
+    gfx::ImageSkia image_skia;
+    electron::util::PopulateImageSkiaRepsFromPath(&image_skia, image_path);
+    image = gfx::Image(image_skia);
+    if (!image.IsEmpty())
+      DecodedImageCache::Get()->Store(image_path, mtime, image);
+  }
   gin::Handle<NativeImage> handle = Create(isolate, image);
 #if defined(OS_MACOSX)
   if (IsTemplateFilename(image_path))
@@ -398,6 +700,35 @@ gin::Handle<NativeImage> NativeImage::CreateFromPath(
   return handle;
 }
 
+#if !defined(OS_MACOSX)
+// static
+v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
+    v8::Isolate* isolate,
+    const base::FilePath& path,
+    const gfx::Size& max_size) {
+  util::Promise<gfx::Image> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (max_size.IsEmpty()) {
+    promise.RejectWithErrorMessage("size must not be empty");
+    return handle;
+  }
+
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&CreateThumbnailOnWorkerThread, NormalizePath(path),
+                     max_size),
+      base::BindOnce(&ResolveThumbnail, std::move(promise)));
+  return handle;
+}
+#endif
+
+// static
+void NativeImage::ClearCache() {
+  DecodedImageCache::Get()->Clear();
+}
+
 // static
 gin::Handle<NativeImage> NativeImage::CreateFromBitmap(
     gin_helper::ErrorThrower thrower,
@@ -496,7 +827,35 @@ gin::Handle<NativeImage> NativeImage::CreateFromNamedImage(
 }
 #endif
 
+std::string NativeImage::ExportForSharedTransfer(
+    int32_t target_web_contents_id) {
+  auto& transfers = GetSharedTransfers();
+  if (transfers.size() >= kMaxPendingSharedTransfers)
+    transfers.erase(transfers.begin());
+  std::string id = base::UnguessableToken::Create().ToString();
+  transfers.push_back({id, target_web_contents_id, image_});
+  return id;
+}
+
 // static
+bool NativeImage::TakeSharedTransfer(const std::string& id,
+                                     int32_t web_contents_id,
+                                     gfx::Image* image) {
+  auto& transfers = GetSharedTransfers();
+  for (auto iter = transfers.begin(); iter != transfers.end(); ++iter) {
+    if (iter->id != id)
+      continue;
+    // Leave the entry in place on a mismatch so the intended recipient
+    // can still claim it.
+    if (iter->target_web_contents_id != web_contents_id)
+      return false;
+    *image = std::move(iter->image);
+    transfers.erase(iter);
+    return true;
+  }
+  return false;
+}
+
 void NativeImage::BuildPrototype(v8::Isolate* isolate,
                                  v8::Local<v8::FunctionTemplate> prototype) {
   prototype->SetClassName(gin::StringToV8(isolate, "NativeImage"));
@@ -504,11 +863,16 @@ void NativeImage::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("toPNG", &NativeImage::ToPNG)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
+      .SetMethod("toBitmapAsync", &NativeImage::ToBitmapAsync)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
       .SetMethod("toDataURL", &NativeImage::ToDataURL)
       .SetMethod("isEmpty", &NativeImage::IsEmpty)
       .SetMethod("getSize", &NativeImage::GetSize)
+      .SetMethod("_exportForSharedTransfer",
+                 &NativeImage::ExportForSharedTransfer)
       .SetMethod("_setTemplateImage", &NativeImage::SetTemplateImage)
       .SetMethod("_isTemplateImage", &NativeImage::IsTemplateImage)
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
@@ -572,11 +936,14 @@ void Initialize(v8::Local<v8::Object> exports,
 
   native_image.SetMethod("createEmpty", &NativeImage::CreateEmpty);
   native_image.SetMethod("createFromPath", &NativeImage::CreateFromPath);
+  native_image.SetMethod("createThumbnailFromPath",
+                         &NativeImage::CreateThumbnailFromPath);
   native_image.SetMethod("createFromBitmap", &NativeImage::CreateFromBitmap);
   native_image.SetMethod("createFromBuffer", &NativeImage::CreateFromBuffer);
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
+  native_image.SetMethod("clearCache", &NativeImage::ClearCache);
 }
 
 }  // namespace
@@ -51,6 +51,24 @@ class NativeImage : public mate::Wrappable<NativeImage> {
                                                  size_t length);
   static gin::Handle<NativeImage> CreateFromPath(v8::Isolate* isolate,
                                                  const base::FilePath& path);
+  // Asynchronously builds a thumbnail for the file at |path|, no larger
+  // than |max_size|. Prefers the platform thumbnail service (the Windows
+  // thumbnail cache, QuickLook on macOS) over decoding the original;
+  // elsewhere the original is decoded and scaled down on the thread pool.
+  static v8::Local<v8::Promise> CreateThumbnailFromPath(
+      v8::Isolate* isolate,
+      const base::FilePath& path,
+      const gfx::Size& max_size);
+  // Drops every decoded image cached by CreateFromPath.
+  static void ClearCache();
+
+  // Claims an image queued by _exportForSharedTransfer(), removing it from
+  // the queue. Returns false when |id| is unknown or the claim does not
+  // come from the WebContents the image was exported for. Called by the
+  // browser side of ElectronBrowser.TakeSharedImage.
+  static bool TakeSharedTransfer(const std::string& id,
+                                 int32_t web_contents_id,
+                                 gfx::Image* image);
   static gin::Handle<NativeImage> CreateFromBitmap(
       gin_helper::ErrorThrower thrower,
       v8::Local<v8::Value> buffer,
@@ -84,6 +102,9 @@ class NativeImage : public mate::Wrappable<NativeImage> {
   v8::Local<v8::Value> ToPNG(gin::Arguments* args);
   v8::Local<v8::Value> ToJPEG(v8::Isolate* isolate, int quality);
   v8::Local<v8::Value> ToBitmap(gin::Arguments* args);
+  v8::Local<v8::Promise> ToPNGAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ToJPEGAsync(v8::Isolate* isolate, int quality);
+  v8::Local<v8::Promise> ToBitmapAsync(gin::Arguments* args);
   v8::Local<v8::Value> GetBitmap(gin::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(gin_helper::ErrorThrower thrower);
   gin::Handle<NativeImage> Resize(v8::Isolate* isolate,
@@ -95,6 +116,11 @@ class NativeImage : public mate::Wrappable<NativeImage> {
   float GetAspectRatio();
   void AddRepresentation(const gin_helper::Dictionary& options);
 
+  // Queues the image for shared-memory transfer to the WebContents with
+  // |target_web_contents_id| and returns the unguessable ID that
+  // WebContents claims it with.
+  std::string ExportForSharedTransfer(int32_t target_web_contents_id);
+
   // Mark the image as template image.
   void SetTemplateImage(bool setAsTemplate);
   // Determine if the image is a template image.
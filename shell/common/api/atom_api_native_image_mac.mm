@@ -5,12 +5,21 @@
 #include "shell/common/api/atom_api_native_image.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #import <Cocoa/Cocoa.h>
+#import <QuickLook/QuickLook.h>
 
+#include "base/files/file_path.h"
+#include "base/mac/foundation_util.h"
+#include "base/mac/scoped_cftyperef.h"
 #include "base/strings/sys_string_conversions.h"
+#include "base/task/post_task.h"
+#include "shell/common/gin_converters/image_converter.h"
+#include "shell/common/promise_util.h"
 #include "ui/gfx/color_utils.h"
+#include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_operations.h"
@@ -19,6 +28,63 @@ namespace electron {
 
 namespace api {
 
+namespace {
+
+// Runs on the thread pool. QuickLook serves a cached thumbnail without
+// decoding the original when the OS already holds one for the file.
+gfx::Image CreateThumbnailFromQuickLook(const base::FilePath& path,
+                                        const gfx::Size& max_size) {
+  @autoreleasepool {
+    NSURL* url =
+        [NSURL fileURLWithPath:base::SysUTF8ToNSString(path.value())];
+    if (!url)
+      return gfx::Image();
+
+    CGSize size = CGSizeMake(max_size.width(), max_size.height());
+    base::ScopedCFTypeRef<CGImageRef> cg_image(QLThumbnailImageCreate(
+        kCFAllocatorDefault, base::mac::NSToCFCast(url), size, nullptr));
+    if (!cg_image)
+      return gfx::Image();
+
+    NSImage* image =
+        [[NSImage alloc] initWithCGImage:cg_image.get() size:NSZeroSize];
+    // gfx::Image takes ownership of |image|.
+    return gfx::Image(image);
+  }
+}
+
+// Runs on the thread the promise was created on.
+void ResolveThumbnail(util::Promise<gfx::Image> promise, gfx::Image image) {
+  if (image.IsEmpty())
+    promise.RejectWithErrorMessage(
+        "Failed to create a thumbnail for the given path");
+  else
+    promise.ResolveWithGin(image);
+}
+
+}  // namespace
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
+    v8::Isolate* isolate,
+    const base::FilePath& path,
+    const gfx::Size& max_size) {
+  util::Promise<gfx::Image> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (max_size.IsEmpty()) {
+    promise.RejectWithErrorMessage("size must not be empty");
+    return handle;
+  }
+
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&CreateThumbnailFromQuickLook, path, max_size),
+      base::BindOnce(&ResolveThumbnail, std::move(promise)));
+  return handle;
+}
+
 NSData* bufferFromNSImage(NSImage* image) {
   CGImageRef ref = [image CGImageForProposedRect:nil context:nil hints:nil];
   NSBitmapImageRep* rep = [[NSBitmapImageRep alloc] initWithCGImage:ref];
@@ -2,14 +2,20 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+#include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/hash/hash.h"
 #include "electron/buildflags/buildflags.h"
 #include "shell/common/gin_converters/content_converter.h"
+#include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/v8_code_cache.h"
 #include "shell/common/node_includes.h"
 #include "url/origin.h"
 #include "v8/include/v8-profiler.h"
@@ -102,6 +108,96 @@ void TakeHeapSnapshot(v8::Isolate* isolate) {
   isolate->GetHeapProfiler()->TakeHeapSnapshot();
 }
 
+// Number of uint32 fields in each flattened allocation-profile record:
+// name index, script-name index, line number, parent record index,
+// self size (low word, high word) and allocation count.
+const size_t kAllocationProfileFieldsPerNode = 7;
+
+void StartSamplingHeapProfiler(gin_helper::Arguments* args) {
+  // The defaults keep the profiler cheap enough to leave running in
+  // production; lower intervals trade overhead for resolution.
+  double sample_interval = 128 * 1024;
+  int stack_depth = 16;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("sampleInterval", &sample_interval);
+    options.Get("stackDepth", &stack_depth);
+  }
+  args->isolate()->GetHeapProfiler()->StartSamplingHeapProfiler(
+      static_cast<uint64_t>(sample_interval), stack_depth);
+}
+
+void StopSamplingHeapProfiler(v8::Isolate* isolate) {
+  isolate->GetHeapProfiler()->StopSamplingHeapProfiler();
+}
+
+// Returns the live sampled allocation profile flattened into a string
+// table plus one fixed-width record per stack node, so callers can ship
+// it between processes as a plain ArrayBuffer instead of walking a tree
+// of v8 objects.
+v8::Local<v8::Value> GetSampledAllocationProfile(v8::Isolate* isolate) {
+  std::unique_ptr<v8::AllocationProfile> profile(
+      isolate->GetHeapProfiler()->GetAllocationProfile());
+  if (!profile)
+    return v8::Null(isolate);
+
+  std::vector<std::string> strings;
+  std::map<std::string, uint32_t> string_index;
+  auto intern_string = [&](v8::Local<v8::String> str) {
+    std::string utf8 = gin::V8ToString(isolate, str);
+    auto iter = string_index.find(utf8);
+    if (iter != string_index.end())
+      return iter->second;
+    uint32_t index = static_cast<uint32_t>(strings.size());
+    string_index.emplace(utf8, index);
+    strings.push_back(std::move(utf8));
+    return index;
+  };
+
+  // Flatten the tree in pre-order so every record's parent has already
+  // been emitted and can be referenced by index.
+  std::vector<uint32_t> records;
+  std::vector<std::pair<v8::AllocationProfile::Node*, uint32_t>> stack;
+  stack.emplace_back(profile->GetRootNode(), 0);
+  while (!stack.empty()) {
+    v8::AllocationProfile::Node* node = stack.back().first;
+    uint32_t parent_index = stack.back().second;
+    stack.pop_back();
+
+    uint64_t self_size = 0;
+    uint64_t allocation_count = 0;
+    for (const auto& allocation : node->allocations) {
+      self_size += allocation.size * allocation.count;
+      allocation_count += allocation.count;
+    }
+
+    uint32_t index = static_cast<uint32_t>(
+        records.size() / kAllocationProfileFieldsPerNode);
+    records.push_back(intern_string(node->name));
+    records.push_back(intern_string(node->script_name));
+    records.push_back(static_cast<uint32_t>(node->line_number));
+    records.push_back(parent_index);
+    records.push_back(static_cast<uint32_t>(self_size));
+    records.push_back(static_cast<uint32_t>(self_size >> 32));
+    records.push_back(static_cast<uint32_t>(allocation_count));
+
+    for (v8::AllocationProfile::Node* child : node->children)
+      stack.emplace_back(child, index);
+  }
+
+  size_t byte_length = records.size() * sizeof(uint32_t);
+  v8::Local<v8::ArrayBuffer> buffer =
+      v8::ArrayBuffer::New(isolate, byte_length);
+  memcpy(buffer->GetContents().Data(), records.data(), byte_length);
+
+  gin_helper::Dictionary result = gin::Dictionary::CreateEmpty(isolate);
+  result.Set("fieldsPerNode",
+             static_cast<uint32_t>(kAllocationProfileFieldsPerNode));
+  result.Set("strings", strings);
+  result.Set("nodes", buffer);
+  return result.GetHandle();
+}
+
 void RequestGarbageCollectionForTesting(v8::Isolate* isolate) {
   isolate->RequestGarbageCollectionForTesting(
       v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
@@ -111,6 +207,21 @@ bool IsSameOrigin(const GURL& l, const GURL& r) {
   return url::Origin::Create(l).IsSameOriginWith(url::Origin::Create(r));
 }
 
+// Compiles and runs |source| with a persistent code cache stored next to
+// the asar archive it was loaded from, so later launches deserialize
+// instead of re-parsing.
+v8::Local<v8::Value> RunScriptWithCodeCache(v8::Isolate* isolate,
+                                            v8::Local<v8::String> source,
+                                            const base::FilePath& path) {
+  v8::Local<v8::Value> result;
+  if (!electron::util::RunScriptWithCodeCache(isolate->GetCurrentContext(),
+                                              source, path)
+           .ToLocal(&result)) {
+    return v8::Local<v8::Value>();
+  }
+  return result;
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -121,6 +232,10 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("deleteHiddenValue", &DeleteHiddenValue);
   dict.SetMethod("getObjectHash", &GetObjectHash);
   dict.SetMethod("takeHeapSnapshot", &TakeHeapSnapshot);
+  dict.SetMethod("startSamplingHeapProfiler", &StartSamplingHeapProfiler);
+  dict.SetMethod("stopSamplingHeapProfiler", &StopSamplingHeapProfiler);
+  dict.SetMethod("getSampledAllocationProfile",
+                 &GetSampledAllocationProfile);
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
   dict.SetMethod("setRemoteCallbackFreer",
                  &electron::RemoteCallbackFreer::BindTo);
@@ -135,6 +250,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("requestGarbageCollectionForTesting",
                  &RequestGarbageCollectionForTesting);
   dict.SetMethod("isSameOrigin", &IsSameOrigin);
+  dict.SetMethod("runScriptWithCodeCache", &RunScriptWithCodeCache);
 }
 
 }  // namespace
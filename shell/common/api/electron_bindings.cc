@@ -23,9 +23,11 @@
 #include "shell/browser/browser.h"
 #include "shell/common/application_info.h"
 #include "shell/common/gin_converters/file_path_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/locker.h"
 #include "shell/common/heap_snapshot.h"
+#include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/promise_util.h"
 #include "third_party/blink/renderer/platform/heap/process_heap.h"  // nogncheck
@@ -69,6 +71,12 @@ void ElectronBindings::BindProcess(v8::Isolate* isolate,
   process->SetMethod("getSystemVersion",
                      &base::SysInfo::OperatingSystemVersion);
   process->SetMethod("getIOCounters", &GetIOCounters);
+  process->SetMethod("getUvWakeupStats", &GetUvWakeupStats);
+  process->SetMethod("getUVMetrics", &NodeBindings::GetUVMetrics);
+  process->SetMethod("getModuleLoadMetrics",
+                     &NodeBindings::GetModuleLoadMetrics);
+  process->SetMethod("_recordModuleLoadMetric",
+                     &NodeBindings::RecordModuleLoadMetric);
   process->SetMethod("getCPUUsage",
                      base::BindRepeating(&ElectronBindings::GetCPUUsage,
                                          base::Unretained(metrics)));
@@ -343,6 +351,14 @@ v8::Local<v8::Value> ElectronBindings::GetIOCounters(v8::Isolate* isolate) {
   return dict.GetHandle();
 }
 
+// static
+v8::Local<v8::Value> ElectronBindings::GetUvWakeupStats(v8::Isolate* isolate) {
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.SetHidden("simple", true);
+  dict.Set("suppressedWakeups", NodeBindings::suppressed_wakeup_count());
+  return dict.GetHandle();
+}
+
 // static
 bool ElectronBindings::TakeHeapSnapshot(v8::Isolate* isolate,
                                         const base::FilePath& file_path) {
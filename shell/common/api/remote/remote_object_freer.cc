@@ -4,7 +4,14 @@
 
 #include "shell/common/api/remote/remote_object_freer.h"
 
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/values.h"
 #include "content/public/renderer/render_frame.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
@@ -25,6 +32,31 @@ content::RenderFrame* GetCurrentRenderFrame() {
   return content::RenderFrame::FromWebFrame(frame);
 }
 
+// Dereferences queued by RunDestructor() awaiting the flush task, keyed by
+// the routing ID of the frame whose browser interface they go out on.
+std::map<int, std::vector<mojom::RemoteObjectReleasePtr>>&
+GetPendingReleases() {
+  static base::NoDestructor<
+      std::map<int, std::vector<mojom::RemoteObjectReleasePtr>>>
+      releases;
+  return *releases;
+}
+
+void FlushPendingReleases() {
+  auto releases = std::move(GetPendingReleases());
+  GetPendingReleases().clear();
+  for (auto& pair : releases) {
+    content::RenderFrame* render_frame =
+        content::RenderFrame::FromRoutingID(pair.first);
+    if (!render_frame)
+      continue;
+    mojom::ElectronBrowserPtr electron_ptr;
+    render_frame->GetRemoteInterfaces()->GetInterface(
+        mojo::MakeRequest(&electron_ptr));
+    electron_ptr->DereferenceRemoteJSObjects(std::move(pair.second));
+  }
+}
+
 }  // namespace
 
 // static
@@ -80,10 +112,16 @@ void RemoteObjectFreer::RunDestructor() {
       ref_mapper_.erase(objects_it);
   }
 
-  mojom::ElectronBrowserPtr electron_ptr;
-  render_frame->GetRemoteInterfaces()->GetInterface(
-      mojo::MakeRequest(&electron_ptr));
-  electron_ptr->DereferenceRemoteJSObject(context_id_, object_id_, ref_count);
+  // Don't send one IPC per collected proxy: a GC sweep can release thousands
+  // of them at once. Queue the dereference and let a posted task batch the
+  // sweep's worth into a single DereferenceRemoteJSObjects() call per frame.
+  auto& pending = GetPendingReleases();
+  if (pending.empty()) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(&FlushPendingReleases));
+  }
+  pending[routing_id_].push_back(
+      mojom::RemoteObjectRelease::New(context_id_, object_id_, ref_count));
 }
 
 }  // namespace electron
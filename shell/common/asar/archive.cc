@@ -4,10 +4,12 @@
 
 #include "shell/common/asar/archive.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
@@ -17,12 +19,20 @@
 #include "base/task/post_task.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/values.h"
+#include "crypto/secure_hash.h"
+#include "crypto/sha2.h"
+#include "third_party/zlib/google/compression_utils.h"
+#include "shell/common/asar/archive_index.h"
 #include "shell/common/asar/scoped_temporary_file.h"
 
 #if defined(OS_WIN)
 #include <io.h>
 #endif
 
+#if defined(OS_POSIX)
+#include <fcntl.h>
+#endif
+
 namespace asar {
 
 namespace {
@@ -33,6 +43,8 @@ const char kSeparators[] = "\\/";
 const char kSeparators[] = "/";
 #endif
 
+const base::FilePath::CharType kIndexExtension[] = FILE_PATH_LITERAL("index");
+
 bool GetNodeFromPath(std::string path,
                      const base::DictionaryValue* root,
                      const base::DictionaryValue** out);
@@ -112,6 +124,179 @@ bool FillFileInfoWithNode(Archive::FileInfo* info,
 
   node->GetBoolean("executable", &info->executable);
 
+  // Optional per-file compression: the header records the stored
+  // (compressed) size next to the uncompressed |size|.
+  int compressed_size = 0;
+  if (node->GetInteger("compressedSize", &compressed_size)) {
+    info->compressed = true;
+    info->compressed_size = static_cast<uint32_t>(compressed_size);
+  }
+
+  return true;
+}
+
+// Advises the OS to read the listed extents of |archive_path| ahead of
+// use. Runs on the thread pool so archive initialization doesn't wait on
+// it.
+void PrefetchExtentsOnWorkerThread(
+    const base::FilePath& archive_path,
+    const std::vector<std::pair<uint64_t, uint32_t>>& extents) {
+  base::File file(archive_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return;
+
+  for (const auto& extent : extents) {
+#if defined(OS_LINUX)
+    posix_fadvise(file.GetPlatformFile(), extent.first, extent.second,
+                  POSIX_FADV_WILLNEED);
+#elif defined(OS_MACOSX)
+    struct radvisory advice;
+    advice.ra_offset = extent.first;
+    advice.ra_count = extent.second;
+    fcntl(file.GetPlatformFile(), F_RDADVISE, &advice);
+#else
+    // No readahead primitive; touching the range populates the system
+    // cache all the same.
+    std::vector<char> buf(std::min(extent.second, 1u << 20));
+    uint64_t offset = extent.first;
+    uint64_t remaining = extent.second;
+    while (remaining > 0) {
+      int chunk = static_cast<int>(
+          std::min(remaining, static_cast<uint64_t>(buf.size())));
+      if (file.Read(offset, buf.data(), chunk) != chunk)
+        break;
+      offset += chunk;
+      remaining -= chunk;
+    }
+#endif
+  }
+}
+
+// Recursively walks a "files" dictionary collecting stats for every
+// entry under |dir_path|.
+void CollectStats(
+    const base::DictionaryValue* files,
+    const base::FilePath& dir_path,
+    uint32_t header_size,
+    std::vector<std::pair<base::FilePath, Archive::Stats>>* stats) {
+  for (base::DictionaryValue::Iterator iter(*files); !iter.IsAtEnd();
+       iter.Advance()) {
+    const base::DictionaryValue* node = nullptr;
+    if (!iter.value().GetAsDictionary(&node))
+      continue;
+
+    base::FilePath path =
+        dir_path.Append(base::FilePath::FromUTF8Unsafe(iter.key()));
+    Archive::Stats stat;
+    if (node->FindKey("link")) {
+      stat.is_file = false;
+      stat.is_link = true;
+    } else if (node->FindKey("files")) {
+      stat.is_file = false;
+      stat.is_directory = true;
+    } else if (!FillFileInfoWithNode(&stat, header_size, node)) {
+      continue;
+    }
+    stats->emplace_back(path, stat);
+
+    const base::DictionaryValue* children = nullptr;
+    if (node->GetDictionaryWithoutPathExpansion("files", &children))
+      CollectStats(children, path, header_size, stats);
+  }
+}
+
+// Extracts the region described by |info| into a content-addressed cache
+// shared by all Archive instances and across launches: the destination
+// file is named after the SHA-256 of its content, so identical content -
+// whether extracted before by this process, another process, or a
+// previous run - is reused instead of copied again.
+bool ExtractToContentCache(base::File* src,
+                           const Archive::FileInfo& info,
+                           const base::FilePath::StringType& ext,
+                           base::FilePath* out) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  base::FilePath temp_dir;
+  if (!base::GetTempDir(&temp_dir))
+    return false;
+  base::FilePath cache_dir =
+      temp_dir.Append(FILE_PATH_LITERAL("electron-asar-cache"));
+  if (!base::CreateDirectory(cache_dir))
+    return false;
+
+  // First pass: hash the region, which usually comes straight from the
+  // page cache.
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  std::vector<char> buf(1 << 16);
+  uint64_t offset = info.offset;
+  uint64_t remaining = info.size;
+  while (remaining > 0) {
+    int chunk = static_cast<int>(
+        std::min(remaining, static_cast<uint64_t>(buf.size())));
+    if (src->Read(offset, buf.data(), chunk) != chunk)
+      return false;
+    hash->Update(buf.data(), chunk);
+    offset += chunk;
+    remaining -= chunk;
+  }
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+
+  base::FilePath target = cache_dir.Append(
+      base::FilePath::FromUTF8Unsafe(base::HexEncode(digest, sizeof(digest))));
+  if (!ext.empty())
+    target = target.AddExtension(ext.substr(1));
+
+  int64_t cached_size = 0;
+  if (base::GetFileSize(target, &cached_size) &&
+      cached_size == static_cast<int64_t>(info.size)) {
+    *out = target;
+    return true;
+  }
+
+  // Second pass: extract to a temporary file and move it into place, so a
+  // concurrent extraction of the same content never observes a partial
+  // file.
+  base::FilePath temp_path;
+  if (!base::CreateTemporaryFileInDir(cache_dir, &temp_path))
+    return false;
+  {
+    base::File dest(temp_path,
+                    base::File::FLAG_OPEN | base::File::FLAG_WRITE);
+    if (!dest.IsValid())
+      return false;
+    offset = info.offset;
+    remaining = info.size;
+    while (remaining > 0) {
+      int chunk = static_cast<int>(
+          std::min(remaining, static_cast<uint64_t>(buf.size())));
+      if (src->Read(offset, buf.data(), chunk) != chunk ||
+          dest.WriteAtCurrentPos(buf.data(), chunk) != chunk) {
+        base::DeleteFile(temp_path, false);
+        return false;
+      }
+      offset += chunk;
+      remaining -= chunk;
+    }
+  }
+
+#if defined(OS_POSIX)
+  if (info.executable) {
+    // chmod a+x temp_file;
+    base::SetPosixFilePermissions(temp_path, 0755);
+  }
+#endif
+
+  if (!base::ReplaceFile(temp_path, target, nullptr)) {
+    base::DeleteFile(temp_path, false);
+    // Somebody else may have won the race and put the file in place.
+    if (!(base::GetFileSize(target, &cached_size) &&
+          cached_size == static_cast<int64_t>(info.size)))
+      return false;
+  }
+
+  *out = target;
   return true;
 }
 
@@ -169,6 +354,15 @@ bool Archive::Init() {
     return false;
   }
 
+  header_size_ = 8 + size;
+
+  // A pre-built binary index next to the archive lets us skip reading and
+  // parsing the JSON header entirely; lookups are then served from the
+  // read-only mapping.
+  index_ = ArchiveIndex::Open(path_.AddExtension(kIndexExtension));
+  if (index_)
+    return true;
+
   buf.resize(size);
   {
     base::ThreadRestrictions::ScopedAllowIO allow_io;
@@ -186,19 +380,105 @@ bool Archive::Init() {
     return false;
   }
 
+  return ParseHeaderJson(header);
+}
+
+bool Archive::InitWithHeaderData(base::StringPiece data) {
+  if (!file_.IsValid())
+    return false;
+
+  if (data.size() < 8)
+    return false;
+
+  uint32_t size;
+  if (!base::PickleIterator(base::Pickle(data.data(), 8)).ReadUInt32(&size)) {
+    LOG(ERROR) << "Failed to parse shared header size for " << path_.value();
+    return false;
+  }
+  if (data.size() < 8 + static_cast<size_t>(size))
+    return false;
+
+  header_size_ = 8 + size;
+
+  index_ = ArchiveIndex::Open(path_.AddExtension(kIndexExtension));
+  if (index_)
+    return true;
+
+  std::string header;
+  if (!base::PickleIterator(base::Pickle(data.data() + 8, size))
+           .ReadString(&header)) {
+    LOG(ERROR) << "Failed to parse shared header for " << path_.value();
+    return false;
+  }
+
+  return ParseHeaderJson(header);
+}
+
+bool Archive::ParseHeaderJson(const std::string& header) {
   base::Optional<base::Value> value = base::JSONReader::Read(header);
   if (!value || !value->is_dict()) {
     LOG(ERROR) << "Failed to parse header";
     return false;
   }
 
-  header_size_ = 8 + size;
   header_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(std::move(*value)));
+  PrefetchHintedFiles();
   return true;
 }
 
+void Archive::PrefetchHintedFiles() {
+  const base::ListValue* prefetch = nullptr;
+  if (!header_->GetListWithoutPathExpansion("prefetch", &prefetch))
+    return;
+
+  std::vector<std::pair<uint64_t, uint32_t>> extents;
+  extents.reserve(prefetch->GetSize());
+  for (const auto& entry : prefetch->GetList()) {
+    if (!entry.is_string())
+      continue;
+    FileInfo info;
+    if (GetFileInfo(base::FilePath::FromUTF8Unsafe(entry.GetString()),
+                    &info) &&
+        !info.unpacked) {
+      extents.emplace_back(
+          info.offset, info.compressed ? info.compressed_size : info.size);
+    }
+  }
+  if (extents.empty())
+    return;
+
+  base::PostTask(FROM_HERE,
+                 {base::ThreadPool(), base::MayBlock(),
+                  base::TaskPriority::BEST_EFFORT},
+                 base::BindOnce(&PrefetchExtentsOnWorkerThread, path_,
+                                std::move(extents)));
+}
+
+void Archive::SetRecordAccessOrder(bool record) {
+  base::AutoLock lock(record_lock_);
+  record_access_order_ = record;
+  if (!record)
+    recorded_access_order_.clear();
+}
+
+std::vector<std::string> Archive::TakeRecordedAccessOrder() {
+  base::AutoLock lock(record_lock_);
+  return std::move(recorded_access_order_);
+}
+
 bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) {
+  // Relaxed is enough for the unlocked fast path: the lock is retaken
+  // (and the flag rechecked) before the order is actually recorded.
+  if (record_access_order_.load(std::memory_order_relaxed)) {
+    base::AutoLock lock(record_lock_);
+    if (record_access_order_.load(std::memory_order_relaxed))
+      recorded_access_order_.push_back(path.AsUTF8Unsafe());
+  }
+
+  if (index_)
+    return index_->GetFileInfo(path, header_size_, info);
+
   if (!header_)
     return false;
 
@@ -214,6 +494,9 @@ bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) {
 }
 
 bool Archive::Stat(const base::FilePath& path, Stats* stats) {
+  if (index_)
+    return index_->Stat(path, header_size_, stats);
+
   if (!header_)
     return false;
 
@@ -236,8 +519,26 @@ bool Archive::Stat(const base::FilePath& path, Stats* stats) {
   return FillFileInfoWithNode(stats, header_size_, node);
 }
 
+void Archive::GetAllStats(
+    std::vector<std::pair<base::FilePath, Stats>>* stats) {
+  if (index_) {
+    index_->GetAllStats(header_size_, stats);
+    return;
+  }
+
+  if (!header_)
+    return;
+
+  const base::DictionaryValue* files = nullptr;
+  if (header_->GetDictionaryWithoutPathExpansion("files", &files))
+    CollectStats(files, base::FilePath(), header_size_, stats);
+}
+
 bool Archive::Readdir(const base::FilePath& path,
                       std::vector<base::FilePath>* list) {
+  if (index_)
+    return index_->Readdir(path, list);
+
   if (!header_)
     return false;
 
@@ -258,6 +559,9 @@ bool Archive::Readdir(const base::FilePath& path,
 }
 
 bool Archive::Realpath(const base::FilePath& path, base::FilePath* realpath) {
+  if (index_)
+    return index_->Realpath(path, realpath);
+
   if (!header_)
     return false;
 
@@ -276,10 +580,20 @@ bool Archive::Realpath(const base::FilePath& path, base::FilePath* realpath) {
 }
 
 bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
-  auto it = external_files_.find(path.value());
-  if (it != external_files_.end()) {
-    *out = it->second->path();
-    return true;
+  {
+    base::AutoLock lock(external_files_lock_);
+
+    auto cached = content_cached_files_.find(path.value());
+    if (cached != content_cached_files_.end()) {
+      *out = cached->second;
+      return true;
+    }
+
+    auto it = external_files_.find(path.value());
+    if (it != external_files_.end()) {
+      *out = it->second->path();
+      return true;
+    }
   }
 
   FileInfo info;
@@ -291,8 +605,47 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
     return true;
   }
 
-  auto temp_file = std::make_unique<ScopedTemporaryFile>();
   base::FilePath::StringType ext = path.Extension();
+
+  // The extraction below runs without the lock so that concurrent
+  // first-time extractions of different files proceed in parallel; all
+  // reads of the archive file go through positional reads, which are safe
+  // on the shared handle. Publication re-checks the cache under the lock,
+  // so when two threads race on the same path one extraction wins and the
+  // loser's temporary file is discarded.
+
+  // Compressed entries are decompressed into a temporary file; the
+  // content-addressed cache only holds verbatim extractions.
+  if (info.compressed) {
+    std::string contents;
+    if (!DecompressToString(info, &contents))
+      return false;
+    auto temp_file = std::make_unique<ScopedTemporaryFile>();
+    if (!temp_file->InitFromData(contents, ext))
+      return false;
+#if defined(OS_POSIX)
+    if (info.executable)
+      base::SetPosixFilePermissions(temp_file->path(), 0755);
+#endif
+    base::AutoLock lock(external_files_lock_);
+    auto it = external_files_.find(path.value());
+    if (it == external_files_.end())
+      it = external_files_.emplace(path.value(), std::move(temp_file)).first;
+    *out = it->second->path();
+    return true;
+  }
+
+  // Prefer the shared content-addressed cache; identical content is only
+  // ever extracted once, even across processes and launches.
+  base::FilePath cache_path;
+  if (ExtractToContentCache(&file_, info, ext, &cache_path)) {
+    base::AutoLock lock(external_files_lock_);
+    content_cached_files_[path.value()] = cache_path;
+    *out = cache_path;
+    return true;
+  }
+
+  auto temp_file = std::make_unique<ScopedTemporaryFile>();
   if (!temp_file->InitFromFile(&file_, ext, info.offset, info.size))
     return false;
 
@@ -303,8 +656,32 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
   }
 #endif
 
-  *out = temp_file->path();
-  external_files_[path.value()] = std::move(temp_file);
+  base::AutoLock lock(external_files_lock_);
+  auto it = external_files_.find(path.value());
+  if (it == external_files_.end())
+    it = external_files_.emplace(path.value(), std::move(temp_file)).first;
+  *out = it->second->path();
+  return true;
+}
+
+bool Archive::DecompressToString(const FileInfo& info, std::string* out) {
+  if (!info.compressed)
+    return false;
+
+  std::string compressed;
+  compressed.resize(info.compressed_size);
+  {
+    base::ThreadRestrictions::ScopedAllowIO allow_io;
+    if (file_.Read(info.offset, &compressed[0], compressed.size()) !=
+        static_cast<int>(compressed.size()))
+      return false;
+  }
+
+  if (!compression::GzipUncompress(compressed, out) ||
+      out->size() != info.size) {
+    LOG(ERROR) << "Failed to decompress " << path_.value();
+    return false;
+  }
   return true;
 }
 
@@ -5,12 +5,17 @@
 #ifndef SHELL_COMMON_ASAR_ARCHIVE_H_
 #define SHELL_COMMON_ASAR_ARCHIVE_H_
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/files/file.h"
 #include "base/files/file_path.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/lock.h"
 
 namespace base {
 class DictionaryValue;
@@ -18,6 +23,7 @@ class DictionaryValue;
 
 namespace asar {
 
+class ArchiveIndex;
 class ScopedTemporaryFile;
 
 // This class represents an asar package, and provides methods to read
@@ -25,10 +31,20 @@ class ScopedTemporaryFile;
 class Archive {
  public:
   struct FileInfo {
-    FileInfo() : unpacked(false), executable(false), size(0), offset(0) {}
+    FileInfo()
+        : unpacked(false),
+          executable(false),
+          compressed(false),
+          size(0),
+          compressed_size(0),
+          offset(0) {}
     bool unpacked;
     bool executable;
+    // Whether the content is stored as a gzip stream. |size| is always the
+    // uncompressed size; |compressed_size| is the stored size on disk.
+    bool compressed;
     uint32_t size;
+    uint32_t compressed_size;
     uint64_t offset;
   };
 
@@ -45,12 +61,22 @@ class Archive {
   // Read and parse the header.
   bool Init();
 
+  // Parse the header from bytes already read from the archive file, e.g. a
+  // shared memory region published by the browser process. |data| holds the
+  // size pickle followed by the header pickle.
+  bool InitWithHeaderData(base::StringPiece data);
+
   // Get the info of a file.
   bool GetFileInfo(const base::FilePath& path, FileInfo* info);
 
   // Fs.stat(path).
   bool Stat(const base::FilePath& path, Stats* stats);
 
+  // Collects stats for every entry in the archive in a single pass, so
+  // callers resolving whole directory trees don't pay one header
+  // traversal per path.
+  void GetAllStats(std::vector<std::pair<base::FilePath, Stats>>* stats);
+
   // Fs.readdir(path).
   bool Readdir(const base::FilePath& path, std::vector<base::FilePath>* files);
 
@@ -61,6 +87,14 @@ class Archive {
   // For unpacked file, this method will return its real path.
   bool CopyFileOut(const base::FilePath& path, base::FilePath* out);
 
+  // Read a compressed entry and decompress it into |out|.
+  bool DecompressToString(const FileInfo& info, std::string* out);
+
+  // Begin or stop recording the order in which files are looked up, used
+  // to generate the header's "prefetch" section from real runs.
+  void SetRecordAccessOrder(bool record);
+  std::vector<std::string> TakeRecordedAccessOrder();
+
   // Returns the file's fd.
   int GetFD() const;
 
@@ -68,17 +102,49 @@ class Archive {
   base::DictionaryValue* header() const { return header_.get(); }
 
  private:
+  // Parse the JSON |header| and take ownership of the result.
+  bool ParseHeaderJson(const std::string& header);
+
+  // Issue readahead over the extents listed in the header's optional
+  // "prefetch" section, so the first reads at startup hit warm pages.
+  void PrefetchHintedFiles();
+
   base::FilePath path_;
   base::File file_;
   int fd_ = -1;
   uint32_t header_size_ = 0;
   std::unique_ptr<base::DictionaryValue> header_;
 
+  // Memory-mapped binary index, used instead of |header_| when a sidecar
+  // index file is present next to the archive.
+  std::unique_ptr<ArchiveIndex> index_;
+
+  // Archives are shared process-wide through the registry in asar_util,
+  // so the mutable extraction caches below are guarded for concurrent
+  // CopyFileOut() calls. The lock only covers cache lookups and
+  // publication; extraction IO runs outside it via positional reads on
+  // the shared handle. The header/index themselves are immutable after
+  // Init() and need no locking.
+  base::Lock external_files_lock_;
+
   // Cached external temporary files.
   std::unordered_map<base::FilePath::StringType,
                      std::unique_ptr<ScopedTemporaryFile>>
       external_files_;
 
+  // Files extracted into the shared content-addressed cache; unlike
+  // |external_files_| these outlive the Archive so later launches reuse
+  // them.
+  std::unordered_map<base::FilePath::StringType, base::FilePath>
+      content_cached_files_;
+
+  base::Lock record_lock_;
+  // Atomic so the fast-path check in GetFileInfo() can skip |record_lock_|;
+  // archives are shared process-wide, so lookups race with
+  // SetRecordAccessOrder() on other threads.
+  std::atomic<bool> record_access_order_{false};
+  std::vector<std::string> recorded_access_order_;
+
   DISALLOW_COPY_AND_ASSIGN(Archive);
 };
 
@@ -0,0 +1,240 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/asar/archive_index.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "base/logging.h"
+#include "base/threading/thread_restrictions.h"
+
+namespace asar {
+
+namespace {
+
+const char kIndexMagic[8] = {'A', 'S', 'A', 'R', 'I', 'D', 'X', '1'};
+
+const size_t kHeaderBytes = sizeof(kIndexMagic) + 2 * sizeof(uint32_t);
+
+// Links may reference links; cap the depth so a malformed index cannot
+// make us loop forever.
+const int kMaxLinkDepth = 8;
+
+// Normalizes a FilePath to the '/'-separated UTF-8 form stored in the
+// string table.
+std::string NormalizePath(const base::FilePath& path) {
+  std::string result = path.AsUTF8Unsafe();
+#if defined(OS_WIN)
+  std::replace(result.begin(), result.end(), '\\', '/');
+#endif
+  return result;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<ArchiveIndex> ArchiveIndex::Open(const base::FilePath& path) {
+  std::unique_ptr<ArchiveIndex> index(new ArchiveIndex);
+  if (!index->Load(path))
+    return nullptr;
+  return index;
+}
+
+ArchiveIndex::ArchiveIndex() = default;
+
+ArchiveIndex::~ArchiveIndex() = default;
+
+bool ArchiveIndex::Load(const base::FilePath& path) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  if (!mapping_.Initialize(path))
+    return false;
+
+  const uint8_t* data = mapping_.data();
+  size_t length = mapping_.length();
+  if (length < kHeaderBytes ||
+      memcmp(data, kIndexMagic, sizeof(kIndexMagic)) != 0)
+    return false;
+
+  uint32_t num_entries;
+  uint32_t string_table;
+  memcpy(&num_entries, data + sizeof(kIndexMagic), sizeof(num_entries));
+  memcpy(&string_table, data + sizeof(kIndexMagic) + sizeof(num_entries),
+         sizeof(string_table));
+
+  // The entry table must fit between the header and the string table, and
+  // the string table must lie inside the file.
+  uint64_t entries_end =
+      kHeaderBytes + static_cast<uint64_t>(num_entries) * sizeof(Entry);
+  if (entries_end > string_table || string_table > length) {
+    LOG(ERROR) << "Malformed asar index: " << path.value();
+    return false;
+  }
+
+  entries_ = reinterpret_cast<const Entry*>(data + kHeaderBytes);
+  num_entries_ = num_entries;
+  string_table_ = reinterpret_cast<const char*>(data) + string_table;
+  string_table_size_ = length - string_table;
+
+  // Validate string references up front so lookups don't have to.
+  for (uint32_t i = 0; i < num_entries_; ++i) {
+    const Entry& entry = entries_[i];
+    uint64_t path_end =
+        static_cast<uint64_t>(entry.path_offset) + entry.path_length;
+    if (path_end > string_table_size_)
+      return false;
+    if ((entry.flags & kFlagLink) &&
+        entry.offset + entry.size > string_table_size_)
+      return false;
+  }
+  return true;
+}
+
+base::StringPiece ArchiveIndex::PathOf(const Entry& entry) const {
+  return base::StringPiece(string_table_ + entry.path_offset,
+                           entry.path_length);
+}
+
+base::StringPiece ArchiveIndex::LinkTargetOf(const Entry& entry) const {
+  return base::StringPiece(string_table_ + entry.offset, entry.size);
+}
+
+const ArchiveIndex::Entry* ArchiveIndex::FindEntry(
+    base::StringPiece path) const {
+  const Entry* end = entries_ + num_entries_;
+  const Entry* it = std::lower_bound(
+      entries_, end, path, [this](const Entry& entry, base::StringPiece key) {
+        return PathOf(entry) < key;
+      });
+  if (it == end || PathOf(*it) != path)
+    return nullptr;
+  return it;
+}
+
+const ArchiveIndex::Entry* ArchiveIndex::ResolveLinks(
+    const Entry* entry) const {
+  for (int depth = 0; entry && (entry->flags & kFlagLink); ++depth) {
+    if (depth >= kMaxLinkDepth)
+      return nullptr;
+    entry = FindEntry(LinkTargetOf(*entry));
+  }
+  return entry;
+}
+
+bool ArchiveIndex::GetFileInfo(const base::FilePath& path,
+                               uint32_t header_size,
+                               Archive::FileInfo* info) const {
+  const Entry* entry = ResolveLinks(FindEntry(NormalizePath(path)));
+  if (!entry || (entry->flags & kFlagDirectory))
+    return false;
+
+  info->size = entry->size;
+  info->unpacked = (entry->flags & kFlagUnpacked) != 0;
+  info->executable = (entry->flags & kFlagExecutable) != 0;
+  info->compressed = (entry->flags & kFlagCompressed) != 0;
+  info->compressed_size = info->compressed ? entry->compressed_size : 0;
+  info->offset = info->unpacked ? 0 : entry->offset + header_size;
+  return true;
+}
+
+bool ArchiveIndex::Stat(const base::FilePath& path,
+                        uint32_t header_size,
+                        Archive::Stats* stats) const {
+  const Entry* entry = FindEntry(NormalizePath(path));
+  if (!entry)
+    return false;
+
+  if (entry->flags & kFlagLink) {
+    stats->is_file = false;
+    stats->is_link = true;
+    return true;
+  }
+
+  if (entry->flags & kFlagDirectory) {
+    stats->is_file = false;
+    stats->is_directory = true;
+    return true;
+  }
+
+  return GetFileInfo(path, header_size, stats);
+}
+
+bool ArchiveIndex::Readdir(const base::FilePath& path,
+                           std::vector<base::FilePath>* files) const {
+  std::string prefix = NormalizePath(path);
+  if (!prefix.empty()) {
+    const Entry* entry = ResolveLinks(FindEntry(prefix));
+    if (!entry || !(entry->flags & kFlagDirectory))
+      return false;
+    prefix = NormalizePath(base::FilePath::FromUTF8Unsafe(
+        std::string(PathOf(*entry))));
+    prefix += '/';
+  }
+
+  // Entries are sorted, so the direct children of |prefix| form a
+  // contiguous run of paths that start with it and contain no further
+  // separator.
+  const Entry* end = entries_ + num_entries_;
+  const Entry* it = std::lower_bound(
+      entries_, end, base::StringPiece(prefix),
+      [this](const Entry& entry, base::StringPiece key) {
+        return PathOf(entry) < key;
+      });
+  for (; it != end; ++it) {
+    base::StringPiece entry_path = PathOf(*it);
+    if (!entry_path.starts_with(prefix))
+      break;
+    base::StringPiece name = entry_path.substr(prefix.size());
+    if (name.empty() || name.find('/') != base::StringPiece::npos)
+      continue;
+    files->push_back(base::FilePath::FromUTF8Unsafe(std::string(name)));
+  }
+  return true;
+}
+
+void ArchiveIndex::GetAllStats(
+    uint32_t header_size,
+    std::vector<std::pair<base::FilePath, Archive::Stats>>* stats) const {
+  stats->reserve(stats->size() + num_entries_);
+  for (uint32_t i = 0; i < num_entries_; ++i) {
+    const Entry& entry = entries_[i];
+    Archive::Stats stat;
+    if (entry.flags & kFlagLink) {
+      stat.is_file = false;
+      stat.is_link = true;
+    } else if (entry.flags & kFlagDirectory) {
+      stat.is_file = false;
+      stat.is_directory = true;
+    } else {
+      stat.size = entry.size;
+      stat.unpacked = (entry.flags & kFlagUnpacked) != 0;
+      stat.executable = (entry.flags & kFlagExecutable) != 0;
+      stat.compressed = (entry.flags & kFlagCompressed) != 0;
+      stat.compressed_size = stat.compressed ? entry.compressed_size : 0;
+      stat.offset = stat.unpacked ? 0 : entry.offset + header_size;
+    }
+    stats->emplace_back(
+        base::FilePath::FromUTF8Unsafe(std::string(PathOf(entry))),
+        stat);
+  }
+}
+
+bool ArchiveIndex::Realpath(const base::FilePath& path,
+                            base::FilePath* realpath) const {
+  const Entry* entry = FindEntry(NormalizePath(path));
+  if (!entry)
+    return false;
+
+  if (entry->flags & kFlagLink) {
+    *realpath = base::FilePath::FromUTF8Unsafe(
+        std::string(LinkTargetOf(*entry)));
+    return true;
+  }
+
+  *realpath = path;
+  return true;
+}
+
+}  // namespace asar
@@ -0,0 +1,105 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_ASAR_ARCHIVE_INDEX_H_
+#define SHELL_COMMON_ASAR_ARCHIVE_INDEX_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/strings/string_piece.h"
+#include "shell/common/asar/archive.h"
+
+namespace asar {
+
+// A memory-mapped binary index over the contents of an asar archive.
+//
+// The index is a sidecar file ("app.asar.index") generated at build time
+// from the JSON header. It holds a flat table of entries sorted by path,
+// followed by a string table, so lookups are a binary search over the
+// mapping - no JSON parsing, no base::Value allocation, and the pages are
+// shared between processes mapping the same file.
+//
+// On-disk layout (all integers little-endian):
+//   char     magic[8]       "ASARIDX1"
+//   uint32_t num_entries
+//   uint32_t string_table   offset of the string table from file start
+//   Entry    entries[num_entries], sorted bytewise by path
+//   char     string_table[] UTF-8 paths with '/' separators, not terminated
+class ArchiveIndex {
+ public:
+  enum Flags : uint32_t {
+    kFlagDirectory = 1 << 0,
+    kFlagUnpacked = 1 << 1,
+    kFlagExecutable = 1 << 2,
+    kFlagLink = 1 << 3,
+    kFlagCompressed = 1 << 4,
+  };
+
+#pragma pack(push, 4)
+  struct Entry {
+    uint32_t path_offset;  // Into the string table.
+    uint32_t path_length;
+    uint32_t flags;
+    uint32_t size;  // Uncompressed size.
+    // Stored size on disk for compressed entries, 0 otherwise.
+    uint32_t compressed_size;
+    // Content offset relative to the end of the archive header, or, for
+    // links, the offset of the target path in the string table (with the
+    // target's length in |size|).
+    uint64_t offset;
+  };
+#pragma pack(pop)
+
+  // Maps |path| read-only and validates the layout. Returns null if the
+  // file does not exist or is malformed.
+  static std::unique_ptr<ArchiveIndex> Open(const base::FilePath& path);
+
+  ~ArchiveIndex();
+
+  // The equivalents of Archive's lookups, served from the mapping.
+  // |header_size| is added to content offsets to make them absolute.
+  bool GetFileInfo(const base::FilePath& path,
+                   uint32_t header_size,
+                   Archive::FileInfo* info) const;
+  bool Stat(const base::FilePath& path,
+            uint32_t header_size,
+            Archive::Stats* stats) const;
+  bool Readdir(const base::FilePath& path,
+               std::vector<base::FilePath>* files) const;
+  bool Realpath(const base::FilePath& path, base::FilePath* realpath) const;
+
+  // Stats for every entry, produced by one linear walk over the table.
+  void GetAllStats(
+      uint32_t header_size,
+      std::vector<std::pair<base::FilePath, Archive::Stats>>* stats) const;
+
+ private:
+  ArchiveIndex();
+
+  bool Load(const base::FilePath& path);
+
+  // Binary-searches the entry table. Returns null when |path| is absent.
+  const Entry* FindEntry(base::StringPiece path) const;
+  // Follows link entries until a non-link is reached.
+  const Entry* ResolveLinks(const Entry* entry) const;
+
+  base::StringPiece PathOf(const Entry& entry) const;
+  base::StringPiece LinkTargetOf(const Entry& entry) const;
+
+  base::MemoryMappedFile mapping_;
+  const Entry* entries_ = nullptr;
+  uint32_t num_entries_ = 0;
+  const char* string_table_ = nullptr;
+  size_t string_table_size_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ArchiveIndex);
+};
+
+}  // namespace asar
+
+#endif  // SHELL_COMMON_ASAR_ARCHIVE_INDEX_H_
@@ -0,0 +1,111 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/asar/archive.h"
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/pickle.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+
+namespace asar {
+
+namespace {
+
+const int kFileCount = 1000;
+const int kLookupIterations = 100;
+
+// Writes a synthetic archive with |kFileCount| one-byte files at the top
+// level, using the same layout Archive::Init() parses: an 8-byte size
+// pickle, the pickled JSON header, then the file contents.
+base::FilePath WriteTestArchive(const base::FilePath& dir) {
+  std::string files;
+  for (int i = 0; i < kFileCount; ++i) {
+    if (i > 0)
+      files += ",";
+    files += base::StringPrintf(
+        "\"file-%d.txt\":{\"size\":1,\"offset\":\"%d\"}", i, i);
+  }
+  std::string header = "{\"files\":{" + files + "}}";
+
+  base::Pickle header_pickle;
+  header_pickle.WriteString(header);
+  base::Pickle size_pickle;
+  size_pickle.WriteUInt32(header_pickle.size());
+
+  std::string contents(kFileCount, 'x');
+  base::FilePath path = dir.Append(FILE_PATH_LITERAL("perf.asar"));
+  base::File file(path, base::File::FLAG_CREATE | base::File::FLAG_WRITE);
+  file.WriteAtCurrentPos(static_cast<const char*>(size_pickle.data()),
+                         size_pickle.size());
+  file.WriteAtCurrentPos(static_cast<const char*>(header_pickle.data()),
+                         header_pickle.size());
+  file.WriteAtCurrentPos(contents.data(), contents.size());
+  return path;
+}
+
+}  // namespace
+
+// Covers the cost every require() inside an app.asar pays: opening the
+// archive, parsing the JSON header and resolving paths against it.
+TEST(ArchivePerfTest, InitAndLookup) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = WriteTestArchive(temp_dir.GetPath());
+
+  base::ElapsedTimer init_timer;
+  Archive archive(path);
+  ASSERT_TRUE(archive.Init());
+  perf_test::PrintResult("asar", "", "init",
+                         init_timer.Elapsed().InMicrosecondsF(), "us", true);
+
+  std::vector<base::FilePath> paths;
+  for (int i = 0; i < kFileCount; ++i) {
+    paths.push_back(base::FilePath::FromUTF8Unsafe(
+        base::StringPrintf("file-%d.txt", i)));
+  }
+
+  base::ElapsedTimer lookup_timer;
+  for (int i = 0; i < kLookupIterations; ++i) {
+    for (const auto& file_path : paths) {
+      Archive::FileInfo info;
+      ASSERT_TRUE(archive.GetFileInfo(file_path, &info));
+    }
+  }
+  base::TimeDelta elapsed = lookup_timer.Elapsed();
+  perf_test::PrintResult(
+      "asar", "", "get_file_info",
+      elapsed.InMicrosecondsF() / (kLookupIterations * kFileCount),
+      "us/lookup", true);
+}
+
+// Measures streaming a file's bytes out of the archive via CopyFileOut,
+// which backs fs.copyFile and native loads from packed apps.
+TEST(ArchivePerfTest, CopyFileOut) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = WriteTestArchive(temp_dir.GetPath());
+
+  Archive archive(path);
+  ASSERT_TRUE(archive.Init());
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kFileCount; ++i) {
+    base::FilePath out;
+    ASSERT_TRUE(archive.CopyFileOut(
+        base::FilePath::FromUTF8Unsafe(base::StringPrintf("file-%d.txt", i)),
+        &out));
+  }
+  perf_test::PrintResult("asar", "", "copy_file_out",
+                         timer.Elapsed().InMicrosecondsF() / kFileCount,
+                         "us/file", true);
+}
+
+}  // namespace asar
@@ -4,14 +4,20 @@
 
 #include "shell/common/asar/asar_util.h"
 
+#include <atomic>
+#include <cstring>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/lazy_instance.h"
-#include "base/stl_util.h"
-#include "base/threading/thread_local.h"
+#include "base/pickle.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/lock.h"
 #include "base/threading/thread_restrictions.h"
 #include "shell/common/asar/archive.h"
 
@@ -19,72 +25,337 @@ namespace asar {
 
 namespace {
 
-// The global instance of ArchiveMap, will be destroyed on exit.
 typedef std::map<base::FilePath, std::shared_ptr<Archive>> ArchiveMap;
-base::LazyInstance<base::ThreadLocalPointer<ArchiveMap>>::Leaky
-    g_archive_map_tls = LAZY_INSTANCE_INITIALIZER;
+
+// Read-mostly caches shared by all threads. Reads are lock-free: the
+// current map is an immutable snapshot published through an atomically
+// accessed shared_ptr, and mutations (rare - only the first time a path
+// is seen, or on teardown) copy the map under a lock before publishing a
+// new snapshot. Readers that raced with a swap keep their old snapshot
+// alive through the shared_ptr and simply see slightly stale data.
+template <typename Map>
+class SnapshotCache {
+ public:
+  SnapshotCache() : snapshot_(std::make_shared<const Map>()) {}
+
+  std::shared_ptr<const Map> Load() const {
+    return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+  }
+
+  // Returns the value now stored for |key|: ours, or the one published by
+  // a thread that won the race.
+  typename Map::mapped_type Insert(const typename Map::key_type& key,
+                                   typename Map::mapped_type value) {
+    base::AutoLock lock(mutation_lock_);
+    auto copy = std::make_shared<Map>(*snapshot_);
+    auto result = copy->emplace(key, std::move(value));
+    std::atomic_store_explicit(&snapshot_,
+                               std::shared_ptr<const Map>(std::move(copy)),
+                               std::memory_order_release);
+    return result.first->second;
+  }
+
+  void Clear() {
+    base::AutoLock lock(mutation_lock_);
+    std::atomic_store_explicit(&snapshot_, std::make_shared<const Map>(),
+                               std::memory_order_release);
+  }
+
+ private:
+  mutable std::shared_ptr<const Map> snapshot_;
+  base::Lock mutation_lock_;
+
+  DISALLOW_COPY_AND_ASSIGN(SnapshotCache);
+};
+
+base::LazyInstance<SnapshotCache<ArchiveMap>>::Leaky g_archive_map =
+    LAZY_INSTANCE_INITIALIZER;
 
 const base::FilePath::CharType kAsarExtension[] = FILE_PATH_LITERAL(".asar");
 
-std::map<base::FilePath, bool> g_is_directory_cache;
+base::LazyInstance<SnapshotCache<std::map<base::FilePath, bool>>>::Leaky
+    g_is_directory_cache = LAZY_INSTANCE_INITIALIZER;
+
+// Per-directory classification verdicts for GetAsarArchivePath(): maps a
+// parent directory to the archive root found in its component chain, or
+// to an empty path when no component is an archive. Sibling fs calls
+// (every require/stat under the same directory) then pay one lookup
+// instead of re-scanning every component for the .asar extension.
+base::LazyInstance<SnapshotCache<std::map<base::FilePath, base::FilePath>>>::
+    Leaky g_path_classification_cache = LAZY_INSTANCE_INITIALIZER;
+
+// Raw archive headers (size pickle followed by header pickle) shared across
+// processes, keyed by archive path. In the browser this holds regions we
+// created; in child processes it holds regions received from the browser.
+// Guarded by |g_shared_header_lock| since mojo replies may register regions
+// from a worker thread.
+base::LazyInstance<std::map<base::FilePath, base::ReadOnlySharedMemoryRegion>>::
+    Leaky g_shared_headers = LAZY_INSTANCE_INITIALIZER;
+base::LazyInstance<base::Lock>::Leaky g_shared_header_lock =
+    LAZY_INSTANCE_INITIALIZER;
+base::LazyInstance<SharedHeaderFetcher>::Leaky g_shared_header_fetcher =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Returns the shared header for |path|, asking the browser process for it
+// when a fetcher is installed and we don't have one yet.
+base::ReadOnlySharedMemoryRegion GetSharedHeaderRegion(
+    const base::FilePath& path) {
+  {
+    base::AutoLock lock(g_shared_header_lock.Get());
+    auto it = g_shared_headers.Get().find(path);
+    if (it != g_shared_headers.Get().end())
+      return it->second.Duplicate();
+  }
+  if (g_shared_header_fetcher.Get()) {
+    base::ReadOnlySharedMemoryRegion region =
+        g_shared_header_fetcher.Get().Run(path);
+    if (region.IsValid()) {
+      RegisterSharedHeaderRegion(path, region.Duplicate());
+      return region;
+    }
+  }
+  return base::ReadOnlySharedMemoryRegion();
+}
 
 bool IsDirectoryCached(const base::FilePath& path) {
-  auto it = g_is_directory_cache.find(path);
-  if (it != g_is_directory_cache.end()) {
+  auto snapshot = g_is_directory_cache.Get().Load();
+  auto it = snapshot->find(path);
+  if (it != snapshot->end()) {
     return it->second;
   }
-  base::ThreadRestrictions::ScopedAllowIO allow_io;
-  return g_is_directory_cache[path] = base::DirectoryExists(path);
+  bool is_directory;
+  {
+    base::ThreadRestrictions::ScopedAllowIO allow_io;
+    is_directory = base::DirectoryExists(path);
+  }
+  return g_is_directory_cache.Get().Insert(path, is_directory);
 }
 
 }  // namespace
 
 std::shared_ptr<Archive> GetOrCreateAsarArchive(const base::FilePath& path) {
-  if (!g_archive_map_tls.Pointer()->Get())
-    g_archive_map_tls.Pointer()->Set(new ArchiveMap);
-  ArchiveMap& map = *g_archive_map_tls.Pointer()->Get();
-
   // if we have it, return it
-  const auto lower = map.lower_bound(path);
-  if (lower != std::end(map) && !map.key_comp()(path, lower->first))
-    return lower->second;
+  auto snapshot = g_archive_map.Get().Load();
+  auto iter = snapshot->find(path);
+  if (iter != snapshot->end())
+    return iter->second;
 
   // if we can create it, return it
   auto archive = std::make_shared<Archive>(path);
-  if (archive->Init()) {
-    base::TryEmplace(map, lower, path, archive);
-    return archive;
+  bool initialized = false;
+
+  // Prefer a header published over shared memory to re-reading it from
+  // disk in every process.
+  base::ReadOnlySharedMemoryRegion header = GetSharedHeaderRegion(path);
+  if (header.IsValid()) {
+    base::ReadOnlySharedMemoryMapping mapping = header.Map();
+    if (mapping.IsValid()) {
+      initialized = archive->InitWithHeaderData(base::StringPiece(
+          static_cast<const char*>(mapping.memory()), mapping.size()));
+    }
+  }
+
+  if (initialized || archive->Init()) {
+    // If another thread created the same archive first, adopt theirs so
+    // the whole process shares one instance per path.
+    return g_archive_map.Get().Insert(path, std::move(archive));
   }
 
   // didn't have it, couldn't create it
   return nullptr;
 }
 
+base::ReadOnlySharedMemoryRegion GetOrCreateSharedHeaderRegion(
+    const base::FilePath& path) {
+  {
+    base::AutoLock lock(g_shared_header_lock.Get());
+    auto it = g_shared_headers.Get().find(path);
+    if (it != g_shared_headers.Get().end())
+      return it->second.Duplicate();
+  }
+
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return base::ReadOnlySharedMemoryRegion();
+
+  char size_buf[8];
+  if (file.Read(0, size_buf, sizeof(size_buf)) != sizeof(size_buf))
+    return base::ReadOnlySharedMemoryRegion();
+
+  uint32_t header_size;
+  if (!base::PickleIterator(base::Pickle(size_buf, sizeof(size_buf)))
+           .ReadUInt32(&header_size))
+    return base::ReadOnlySharedMemoryRegion();
+
+  size_t total = 8 + header_size;
+  base::MappedReadOnlyRegion shm =
+      base::ReadOnlySharedMemoryRegion::Create(total);
+  if (!shm.IsValid())
+    return base::ReadOnlySharedMemoryRegion();
+
+  if (file.Read(0, static_cast<char*>(shm.mapping.memory()), total) !=
+      static_cast<int>(total))
+    return base::ReadOnlySharedMemoryRegion();
+
+  base::AutoLock lock(g_shared_header_lock.Get());
+  auto& region = g_shared_headers.Get()[path];
+  if (!region.IsValid())
+    region = std::move(shm.region);
+  return region.Duplicate();
+}
+
+base::ReadOnlySharedMemoryRegion CreateHeaderHandoffRegion() {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  // Snapshot the cached headers together with the identity of the file
+  // they were read from, so the importer can reject entries whose
+  // archive changed (e.g. was replaced by an update).
+  struct Entry {
+    std::string path;
+    int64_t size;
+    int64_t mtime;
+    std::string header;
+  };
+  std::vector<Entry> snapshot;
+  {
+    base::AutoLock lock(g_shared_header_lock.Get());
+    for (const auto& pair : g_shared_headers.Get()) {
+      base::ReadOnlySharedMemoryMapping mapping = pair.second.Map();
+      base::File::Info info;
+      if (!mapping.IsValid() || !base::GetFileInfo(pair.first, &info))
+        continue;
+      snapshot.push_back(
+          {pair.first.AsUTF8Unsafe(), info.size,
+           info.last_modified.since_origin().InMicroseconds(),
+           std::string(static_cast<const char*>(mapping.memory()),
+                       mapping.size())});
+    }
+  }
+  if (snapshot.empty())
+    return base::ReadOnlySharedMemoryRegion();
+
+  base::Pickle pickle;
+  pickle.WriteUInt32(static_cast<uint32_t>(snapshot.size()));
+  for (const Entry& entry : snapshot) {
+    pickle.WriteString(entry.path);
+    pickle.WriteInt64(entry.size);
+    pickle.WriteInt64(entry.mtime);
+    pickle.WriteData(entry.header.data(),
+                     static_cast<int>(entry.header.size()));
+  }
+
+  base::MappedReadOnlyRegion shm =
+      base::ReadOnlySharedMemoryRegion::Create(pickle.size());
+  if (!shm.IsValid())
+    return base::ReadOnlySharedMemoryRegion();
+  memcpy(shm.mapping.memory(), pickle.data(), pickle.size());
+  return std::move(shm.region);
+}
+
+void ImportHeaderHandoffRegion(base::ReadOnlySharedMemoryRegion region) {
+  base::ReadOnlySharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return;
+
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::Pickle pickle(static_cast<const char*>(mapping.memory()),
+                      mapping.size());
+  base::PickleIterator iter(pickle);
+  uint32_t count;
+  if (!iter.ReadUInt32(&count))
+    return;
+
+  for (uint32_t i = 0; i < count; ++i) {
+    std::string path_str;
+    int64_t size, mtime;
+    const char* data;
+    int data_len;
+    if (!iter.ReadString(&path_str) || !iter.ReadInt64(&size) ||
+        !iter.ReadInt64(&mtime) || !iter.ReadData(&data, &data_len)) {
+      return;
+    }
+
+    base::FilePath path = base::FilePath::FromUTF8Unsafe(path_str);
+    base::File::Info info;
+    if (!base::GetFileInfo(path, &info) || info.size != size ||
+        info.last_modified.since_origin().InMicroseconds() != mtime) {
+      continue;
+    }
+
+    base::MappedReadOnlyRegion shm =
+        base::ReadOnlySharedMemoryRegion::Create(data_len);
+    if (!shm.IsValid())
+      continue;
+    memcpy(shm.mapping.memory(), data, data_len);
+    RegisterSharedHeaderRegion(path, std::move(shm.region));
+  }
+}
+
+void RegisterSharedHeaderRegion(const base::FilePath& path,
+                                base::ReadOnlySharedMemoryRegion region) {
+  base::AutoLock lock(g_shared_header_lock.Get());
+  g_shared_headers.Get()[path] = std::move(region);
+}
+
+void SetSharedHeaderFetcher(SharedHeaderFetcher fetcher) {
+  g_shared_header_fetcher.Get() = std::move(fetcher);
+}
+
 void ClearArchives() {
-  if (g_archive_map_tls.Pointer()->Get())
-    delete g_archive_map_tls.Pointer()->Get();
+  g_archive_map.Get().Clear();
+  // Verdicts derive from the filesystem, but a teardown/reset should not
+  // keep serving stale classifications either.
+  g_path_classification_cache.Get().Clear();
 }
 
 bool GetAsarArchivePath(const base::FilePath& full_path,
                         base::FilePath* asar_path,
                         base::FilePath* relative_path,
                         bool allow_root) {
-  base::FilePath iter = full_path;
-  while (true) {
-    base::FilePath dirname = iter.DirName();
-    if (iter.MatchesExtension(kAsarExtension) && !IsDirectoryCached(iter))
-      break;
-    else if (iter == dirname)
+  // The path itself being an archive is only meaningful to callers that
+  // accept the archive root; files named *.asar inside an archive are not
+  // reachable, matching the historical component scan.
+  if (full_path.MatchesExtension(kAsarExtension) &&
+      !IsDirectoryCached(full_path)) {
+    if (!allow_root)
       return false;
-    iter = dirname;
+    *asar_path = full_path;
+    *relative_path = base::FilePath();
+    return true;
+  }
+
+  // The remaining scan only depends on the directory chain, so the
+  // verdict is cached per parent directory.
+  base::FilePath dirname = full_path.DirName();
+  base::FilePath root;
+  auto snapshot = g_path_classification_cache.Get().Load();
+  auto cached = snapshot->find(dirname);
+  if (cached != snapshot->end()) {
+    root = cached->second;
+  } else {
+    base::FilePath iter = dirname;
+    while (true) {
+      base::FilePath parent = iter.DirName();
+      if (iter.MatchesExtension(kAsarExtension) && !IsDirectoryCached(iter)) {
+        root = iter;
+        break;
+      } else if (iter == parent) {
+        break;
+      }
+      iter = parent;
+    }
+    root = g_path_classification_cache.Get().Insert(dirname, root);
   }
 
+  if (root.empty())
+    return false;
+
   base::FilePath tail;
-  if (!((allow_root && iter == full_path) ||
-        iter.AppendRelativePath(full_path, &tail)))
+  if (!root.AppendRelativePath(full_path, &tail))
     return false;
 
-  *asar_path = iter;
+  *asar_path = root;
   *relative_path = tail;
   return true;
 }
@@ -102,6 +373,9 @@ bool ReadFileToString(const base::FilePath& path, std::string* contents) {
   if (!archive->GetFileInfo(relative_path, &info))
     return false;
 
+  if (info.compressed)
+    return archive->DecompressToString(info, contents);
+
   if (info.unpacked) {
     base::FilePath real_path;
     // For unpacked file it will return the real path instead of doing the copy.
@@ -8,6 +8,9 @@
 #include <memory>
 #include <string>
 
+#include "base/callback.h"
+#include "base/memory/read_only_shared_memory_region.h"
+
 namespace base {
 class FilePath;
 }
@@ -19,6 +22,37 @@ class Archive;
 // Gets or creates a new Archive from the path.
 std::shared_ptr<Archive> GetOrCreateAsarArchive(const base::FilePath& path);
 
+// Browser process: returns (creating and caching on first use) a read-only
+// shared memory region holding the raw archive header, suitable for passing
+// to child processes. Returns an invalid region when the archive can't be
+// read.
+base::ReadOnlySharedMemoryRegion GetOrCreateSharedHeaderRegion(
+    const base::FilePath& path);
+
+// Child process: adopts a header region received from the browser, so
+// creating an Archive for |path| parses from memory instead of re-reading
+// the header from disk.
+void RegisterSharedHeaderRegion(const base::FilePath& path,
+                                base::ReadOnlySharedMemoryRegion region);
+
+// Packs every cached shared header, tagged with its archive's size and
+// mtime, into a single region suitable for handing off to a relaunched
+// browser process. Returns an invalid region when there is nothing to
+// hand off.
+base::ReadOnlySharedMemoryRegion CreateHeaderHandoffRegion();
+
+// Unpacks a region created by CreateHeaderHandoffRegion and registers
+// each header whose archive still matches the recorded size and mtime,
+// so the relaunched process skips re-reading unchanged headers.
+void ImportHeaderHandoffRegion(base::ReadOnlySharedMemoryRegion region);
+
+// Child process: installs a callback used to request a header region from
+// the browser the first time an archive is opened.
+using SharedHeaderFetcher =
+    base::RepeatingCallback<base::ReadOnlySharedMemoryRegion(
+        const base::FilePath&)>;
+void SetSharedHeaderFetcher(SharedHeaderFetcher fetcher);
+
 // Destroy cached Archive objects.
 void ClearArchives();
 
@@ -71,4 +71,18 @@ bool ScopedTemporaryFile::InitFromFile(base::File* src,
          static_cast<int>(size);
 }
 
+bool ScopedTemporaryFile::InitFromData(base::StringPiece data,
+                                       const base::FilePath::StringType& ext) {
+  if (!Init(ext))
+    return false;
+
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::File dest(path_, base::File::FLAG_OPEN | base::File::FLAG_WRITE);
+  if (!dest.IsValid())
+    return false;
+
+  return dest.WriteAtCurrentPos(data.data(), data.size()) ==
+         static_cast<int>(data.size());
+}
+
 }  // namespace asar
@@ -6,6 +6,7 @@
 #define SHELL_COMMON_ASAR_SCOPED_TEMPORARY_FILE_H_
 
 #include "base/files/file_path.h"
+#include "base/strings/string_piece.h"
 
 namespace base {
 class File;
@@ -31,6 +32,11 @@ class ScopedTemporaryFile {
                     uint64_t offset,
                     uint64_t size);
 
+  // Init a temporary file and fill it with |data|, e.g. content that was
+  // decompressed in memory.
+  bool InitFromData(base::StringPiece data,
+                    const base::FilePath::StringType& ext);
+
   base::FilePath path() const { return path_; }
 
  private:
@@ -4,46 +4,67 @@
 
 #include "shell/common/color_util.h"
 
-#include <vector>
-
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 
 namespace electron {
 
+namespace {
+
+bool ParseHexByte(char hi, char lo, int* byte) {
+  if (!base::IsHexDigit(hi) || !base::IsHexDigit(lo))
+    return false;
+  *byte = base::HexDigitToInt(hi) * 16 + base::HexDigitToInt(lo);
+  return true;
+}
+
+}  // namespace
+
 SkColor ParseHexColor(const std::string& color_string) {
   // Check the string for incorrect formatting.
   if (color_string.empty() || color_string[0] != '#')
     return SK_ColorWHITE;
 
-  // Prepend FF if alpha channel is not specified.
-  std::string source = color_string.substr(1);
-  if (source.size() == 3)
-    source.insert(0, "F");
-  else if (source.size() == 6)
-    source.insert(0, "FF");
-
-  // Convert the string from #FFF format to #FFFFFF format.
-  std::string formatted_color;
-  if (source.size() == 4) {
-    for (size_t i = 0; i < 4; ++i) {
-      formatted_color += source[i];
-      formatted_color += source[i];
-    }
-  } else if (source.size() == 8) {
-    formatted_color = source;
-  } else {
-    return SK_ColorWHITE;
+  // Parse the channels in place instead of expanding the string to the
+  // eight-digit form first; that built three temporary strings and a byte
+  // vector for every color parsed.
+  const char* digits = color_string.c_str() + 1;
+  size_t size = color_string.size() - 1;
+
+  int a = 0xFF, r = 0, g = 0, b = 0;
+  bool valid;
+  switch (size) {
+    case 3:  // #RGB
+      valid = ParseHexByte(digits[0], digits[0], &r) &&
+              ParseHexByte(digits[1], digits[1], &g) &&
+              ParseHexByte(digits[2], digits[2], &b);
+      break;
+    case 4:  // #ARGB
+      valid = ParseHexByte(digits[0], digits[0], &a) &&
+              ParseHexByte(digits[1], digits[1], &r) &&
+              ParseHexByte(digits[2], digits[2], &g) &&
+              ParseHexByte(digits[3], digits[3], &b);
+      break;
+    case 6:  // #RRGGBB
+      valid = ParseHexByte(digits[0], digits[1], &r) &&
+              ParseHexByte(digits[2], digits[3], &g) &&
+              ParseHexByte(digits[4], digits[5], &b);
+      break;
+    case 8:  // #AARRGGBB
+      valid = ParseHexByte(digits[0], digits[1], &a) &&
+              ParseHexByte(digits[2], digits[3], &r) &&
+              ParseHexByte(digits[4], digits[5], &g) &&
+              ParseHexByte(digits[6], digits[7], &b);
+      break;
+    default:
+      valid = false;
   }
 
-  // Convert the string to an integer and make sure it is in the correct value
-  // range.
-  std::vector<uint8_t> bytes;
-  if (!base::HexStringToBytes(formatted_color, &bytes))
+  if (!valid)
     return SK_ColorWHITE;
 
-  return SkColorSetARGB(bytes[0], bytes[1], bytes[2], bytes[3]);
+  return SkColorSetARGB(a, r, g, b);
 }
 
 std::string ToRGBHex(SkColor color) {
@@ -0,0 +1,110 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/cpu_profiler.h"
+
+#include <map>
+#include <utility>
+
+#include "base/no_destructor.h"
+#include "gin/converter.h"
+#include "v8/include/v8-profiler.h"
+
+namespace electron {
+
+namespace {
+
+const char kProfileTitle[] = "electron";
+
+// One profiler per isolate; only ever touched from the isolate's own
+// thread, so no locking is needed.
+std::map<v8::Isolate*, v8::CpuProfiler*>& GetProfilers() {
+  static base::NoDestructor<std::map<v8::Isolate*, v8::CpuProfiler*>>
+      profilers;
+  return *profilers;
+}
+
+// Flattens the call tree into |nodes|, children after their parent, each
+// entry carrying its parent's id so the tree can be rebuilt.
+void SerializeNode(const v8::CpuProfileNode* node,
+                   int parent_id,
+                   base::Value* nodes) {
+  base::Value dict(base::Value::Type::DICTIONARY);
+  dict.SetIntKey("id", node->GetNodeId());
+  if (parent_id)
+    dict.SetIntKey("parentId", parent_id);
+  dict.SetStringKey("functionName", node->GetFunctionNameStr());
+  const char* url = node->GetScriptResourceNameStr();
+  if (url && url[0])
+    dict.SetStringKey("url", url);
+  if (node->GetLineNumber() != v8::CpuProfileNode::kNoLineNumberInfo)
+    dict.SetIntKey("lineNumber", node->GetLineNumber());
+  if (node->GetHitCount())
+    dict.SetIntKey("hitCount", static_cast<int>(node->GetHitCount()));
+  nodes->GetList().push_back(std::move(dict));
+
+  for (int i = 0; i < node->GetChildrenCount(); ++i)
+    SerializeNode(node->GetChild(i), node->GetNodeId(), nodes);
+}
+
+}  // namespace
+
+bool StartCpuProfiling(v8::Isolate* isolate, int interval_us) {
+  auto& profilers = GetProfilers();
+  if (profilers.count(isolate) > 0)
+    return false;
+
+  v8::HandleScope handle_scope(isolate);
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(isolate);
+  profiler->SetSamplingInterval(interval_us);
+  profiler->StartProfiling(gin::StringToV8(isolate, kProfileTitle),
+                           true /* record_samples */);
+  profilers.emplace(isolate, profiler);
+  return true;
+}
+
+std::unique_ptr<base::Value> StopCpuProfiling(v8::Isolate* isolate) {
+  auto& profilers = GetProfilers();
+  auto it = profilers.find(isolate);
+  if (it == profilers.end())
+    return nullptr;
+  v8::CpuProfiler* profiler = it->second;
+  profilers.erase(it);
+
+  v8::HandleScope handle_scope(isolate);
+  v8::CpuProfile* profile =
+      profiler->StopProfiling(gin::StringToV8(isolate, kProfileTitle));
+  auto result = std::make_unique<base::Value>(base::Value::Type::DICTIONARY);
+  if (profile) {
+    result->SetDoubleKey("startTime",
+                         static_cast<double>(profile->GetStartTime()));
+    result->SetDoubleKey("endTime",
+                         static_cast<double>(profile->GetEndTime()));
+
+    base::Value nodes(base::Value::Type::LIST);
+    SerializeNode(profile->GetTopDownRoot(), 0, &nodes);
+    result->SetKey("nodes", std::move(nodes));
+
+    // Samples reference nodes by id, and timestamps are delta-encoded
+    // against the previous sample, so long profiles stay small on the wire.
+    base::Value samples(base::Value::Type::LIST);
+    base::Value deltas(base::Value::Type::LIST);
+    int64_t previous = profile->GetStartTime();
+    for (int i = 0; i < profile->GetSamplesCount(); ++i) {
+      samples.GetList().emplace_back(
+          static_cast<int>(profile->GetSample(i)->GetNodeId()));
+      int64_t timestamp = profile->GetSampleTimestamp(i);
+      deltas.GetList().emplace_back(static_cast<int>(timestamp - previous));
+      previous = timestamp;
+    }
+    result->SetKey("samples", std::move(samples));
+    result->SetKey("timeDeltas", std::move(deltas));
+
+    profile->Delete();
+  }
+  profiler->Dispose();
+  return result;
+}
+
+}  // namespace electron
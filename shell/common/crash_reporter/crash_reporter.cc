@@ -4,6 +4,8 @@
 
 #include "shell/common/crash_reporter/crash_reporter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "base/command_line.h"
@@ -11,6 +13,7 @@
 #include "base/files/file_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
 #include "base/threading/thread_restrictions.h"
 #include "content/public/common/content_switches.h"
 #include "electron/electron_version.h"
@@ -52,12 +55,14 @@ void CrashReporter::Start(const std::string& product_name,
                           const base::FilePath& crashes_dir,
                           bool upload_to_server,
                           bool skip_system_crash_handler,
+                          bool rate_limit,
+                          bool compress,
                           const StringMap& extra_parameters) {
   is_initialized_ = true;
   SetUploadParameters(extra_parameters);
 
   Init(product_name, company_name, submit_url, crashes_dir, upload_to_server,
-       skip_system_crash_handler);
+       skip_system_crash_handler, rate_limit, compress);
 }
 
 void CrashReporter::SetUploadParameters(const StringMap& parameters) {
@@ -77,6 +82,16 @@ bool CrashReporter::GetUploadToServer() {
   return true;
 }
 
+base::Value CrashReporter::GetUploadQueueStats() {
+  // Platforms without a local report database have nothing queued.
+  base::Value stats(base::Value::Type::DICTIONARY);
+  stats.SetIntKey("pendingCount", 0);
+  stats.SetDoubleKey("pendingSizeBytes", 0);
+  stats.SetIntKey("completedCount", 0);
+  stats.SetDoubleKey("lastUploadAttemptTime", 0);
+  return stats;
+}
+
 std::vector<CrashReporter::UploadReportResult>
 CrashReporter::GetUploadedReports(const base::FilePath& crashes_dir) {
   base::ThreadRestrictions::ScopedAllowIO allow_io;
@@ -105,10 +120,35 @@ void CrashReporter::Init(const std::string& product_name,
                          const std::string& submit_url,
                          const base::FilePath& crashes_dir,
                          bool auto_submit,
-                         bool skip_system_crash_handler) {}
+                         bool skip_system_crash_handler,
+                         bool rate_limit,
+                         bool compress) {}
 
 void CrashReporter::SetUploadParameters() {}
 
+int CrashReporter::RegisterBreadcrumbKey(const std::string& name) {
+  if (breadcrumb_count_ >= kBreadcrumbSlotCount)
+    return -1;
+  int slot = breadcrumb_count_++;
+  base::strlcpy(breadcrumb_slots_[slot].key, name.c_str(),
+                kBreadcrumbKeySize);
+  breadcrumb_slots_[slot].value[0] = '\0';
+  return slot;
+}
+
+void CrashReporter::SetBreadcrumb(int slot, base::StringPiece value) {
+  if (slot < 0 || slot >= breadcrumb_count_)
+    return;
+  BreadcrumbSlot& entry = breadcrumb_slots_[slot];
+  size_t length = std::min(value.size(), kBreadcrumbValueSize - 1);
+  memcpy(entry.value, value.data(), length);
+  entry.value[length] = '\0';
+  AnnotateBreadcrumbSlot(entry.key, entry.value);
+}
+
+void CrashReporter::AnnotateBreadcrumbSlot(const char* key,
+                                           const char* value) {}
+
 void CrashReporter::AddExtraParameter(const std::string& key,
                                       const std::string& value) {}
 
@@ -146,7 +186,7 @@ void CrashReporter::StartInstance(const gin_helper::Dictionary& options) {
   extra_parameters["_companyName"] = company_name;
 
   reporter->Start(product_name, company_name, submit_url, crashes_dir, true,
-                  false, extra_parameters);
+                  false, false, false, extra_parameters);
 }
 
 }  // namespace crash_reporter
@@ -12,6 +12,8 @@
 
 #include "base/files/file_path.h"
 #include "base/macros.h"
+#include "base/strings/string_piece.h"
+#include "base/values.h"
 
 namespace gin_helper {
 class Dictionary;
@@ -40,6 +42,8 @@ class CrashReporter {
              const base::FilePath& crashes_dir,
              bool upload_to_server,
              bool skip_system_crash_handler,
+             bool rate_limit,
+             bool compress,
              const StringMap& extra_parameters);
 
   virtual std::vector<CrashReporter::UploadReportResult> GetUploadedReports(
@@ -47,11 +51,28 @@ class CrashReporter {
 
   virtual void SetUploadToServer(bool upload_to_server);
   virtual bool GetUploadToServer();
+  // Returns counts and on-disk size of the dumps waiting for upload, so
+  // apps can schedule uploads off the critical path (e.g. pause via
+  // SetUploadToServer until idle or AC power).
+  virtual base::Value GetUploadQueueStats();
   virtual void AddExtraParameter(const std::string& key,
                                  const std::string& value);
   virtual void RemoveExtraParameter(const std::string& key);
   virtual std::map<std::string, std::string> GetParameters() const;
 
+  // Fixed-slot breadcrumb annotations. A key is registered once at
+  // startup and written by slot index afterwards; writes copy the value
+  // into preallocated storage with no heap allocation or locking, so
+  // hot paths (per-navigation breadcrumbs) can keep crash context rich
+  // without the cost of AddExtraParameter's string map.
+  static const int kBreadcrumbSlotCount = 32;
+  static const size_t kBreadcrumbKeySize = 32;
+  static const size_t kBreadcrumbValueSize = 128;
+
+  // Returns the slot index for |name|, or -1 if all slots are taken.
+  int RegisterBreadcrumbKey(const std::string& name);
+  void SetBreadcrumb(int slot, base::StringPiece value);
+
  protected:
   CrashReporter();
   virtual ~CrashReporter();
@@ -61,16 +82,31 @@ class CrashReporter {
                     const std::string& submit_url,
                     const base::FilePath& crashes_dir,
                     bool upload_to_server,
-                    bool skip_system_crash_handler);
+                    bool skip_system_crash_handler,
+                    bool rate_limit,
+                    bool compress);
   virtual void SetUploadParameters();
 
+  // Publishes a breadcrumb slot to the platform annotation store. Both
+  // backends copy into fixed storage (crashpad's SimpleStringDictionary
+  // and breakpad's NonAllocatingMap), keeping the write allocation-free.
+  virtual void AnnotateBreadcrumbSlot(const char* key, const char* value);
+
   StringMap upload_parameters_;
   std::string process_type_;
 
  private:
+  struct BreadcrumbSlot {
+    char key[kBreadcrumbKeySize];
+    char value[kBreadcrumbValueSize];
+  };
+
   bool is_initialized_ = false;
   void SetUploadParameters(const StringMap& parameters);
 
+  BreadcrumbSlot breadcrumb_slots_[kBreadcrumbSlotCount];
+  int breadcrumb_count_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(CrashReporter);
 };
 
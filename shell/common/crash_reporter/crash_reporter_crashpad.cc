@@ -34,11 +34,56 @@ void CrashReporterCrashpad::SetUploadToServer(const bool upload_to_server) {
   }
 }
 
+base::Value CrashReporterCrashpad::GetUploadQueueStats() {
+  base::Value stats = CrashReporter::GetUploadQueueStats();
+  if (!database_)
+    return stats;
+
+  std::vector<crashpad::CrashReportDatabase::Report> pending_reports;
+  if (database_->GetPendingReports(&pending_reports) ==
+      crashpad::CrashReportDatabase::kNoError) {
+    double pending_size = 0;
+    {
+      base::ThreadRestrictions::ScopedAllowIO allow_io;
+      for (const auto& report : pending_reports) {
+        int64_t size = 0;
+        if (base::GetFileSize(report.file_path, &size))
+          pending_size += size;
+      }
+    }
+    stats.SetIntKey("pendingCount", static_cast<int>(pending_reports.size()));
+    stats.SetDoubleKey("pendingSizeBytes", pending_size);
+  }
+
+  std::vector<crashpad::CrashReportDatabase::Report> completed_reports;
+  if (database_->GetCompletedReports(&completed_reports) ==
+      crashpad::CrashReportDatabase::kNoError) {
+    stats.SetIntKey("completedCount",
+                    static_cast<int>(completed_reports.size()));
+  }
+
+  time_t last_upload_attempt = 0;
+  if (database_->GetSettings()->GetLastUploadAttemptTime(
+          &last_upload_attempt)) {
+    stats.SetDoubleKey("lastUploadAttemptTime",
+                       static_cast<double>(last_upload_attempt));
+  }
+  return stats;
+}
+
 void CrashReporterCrashpad::SetCrashKeyValue(base::StringPiece key,
                                              base::StringPiece value) {
   simple_string_dictionary_->SetKeyValue(key.data(), value.data());
 }
 
+void CrashReporterCrashpad::AnnotateBreadcrumbSlot(const char* key,
+                                                   const char* value) {
+  // SimpleStringDictionary copies into fixed entries, so the whole
+  // breadcrumb write stays allocation-free.
+  if (simple_string_dictionary_)
+    simple_string_dictionary_->SetKeyValue(key, value);
+}
+
 void CrashReporterCrashpad::SetInitialCrashKeyValues() {
   for (const auto& upload_parameter : upload_parameters_)
     SetCrashKeyValue(upload_parameter.first, upload_parameter.second);
@@ -22,6 +22,7 @@ class CrashReporterCrashpad : public CrashReporter {
  public:
   void SetUploadToServer(bool upload_to_server) override;
   bool GetUploadToServer() override;
+  base::Value GetUploadQueueStats() override;
   void AddExtraParameter(const std::string& key,
                          const std::string& value) override;
   void RemoveExtraParameter(const std::string& key) override;
@@ -31,6 +32,8 @@ class CrashReporterCrashpad : public CrashReporter {
   CrashReporterCrashpad();
   ~CrashReporterCrashpad() override;
 
+  void AnnotateBreadcrumbSlot(const char* key, const char* value) override;
+
   void SetUploadsEnabled(bool enable_uploads);
   void SetCrashKeyValue(base::StringPiece key, base::StringPiece value);
   void SetInitialCrashKeyValues();
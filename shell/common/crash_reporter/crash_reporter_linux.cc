@@ -58,7 +58,11 @@ void CrashReporterLinux::Init(const std::string& product_name,
                               const std::string& submit_url,
                               const base::FilePath& crashes_dir,
                               bool upload_to_server,
-                              bool skip_system_crash_handler) {
+                              bool skip_system_crash_handler,
+                              bool rate_limit,
+                              bool compress) {
+  // Breakpad's uploader has no rate-limit or gzip support; the two
+  // options only affect the crashpad-based platforms.
   EnableCrashDumping(crashes_dir);
 
   upload_url_ = submit_url;
@@ -70,6 +74,14 @@ void CrashReporterLinux::Init(const std::string& product_name,
     crash_keys_->SetKeyValue(iter->first.c_str(), iter->second.c_str());
 }
 
+void CrashReporterLinux::AnnotateBreadcrumbSlot(const char* key,
+                                                const char* value) {
+  // NonAllocatingMap copies into fixed entries, so the breadcrumb write
+  // stays allocation-free.
+  if (crash_keys_)
+    crash_keys_->SetKeyValue(key, value);
+}
+
 void CrashReporterLinux::SetUploadParameters() {
   upload_parameters_["platform"] = "linux";
 }
@@ -33,11 +33,16 @@ class CrashReporterLinux : public CrashReporter {
             const std::string& submit_url,
             const base::FilePath& crashes_dir,
             bool upload_to_server,
-            bool skip_system_crash_handler) override;
+            bool skip_system_crash_handler,
+            bool rate_limit,
+            bool compress) override;
   void SetUploadToServer(bool upload_to_server) override;
   void SetUploadParameters() override;
   bool GetUploadToServer() override;
 
+ protected:
+  void AnnotateBreadcrumbSlot(const char* key, const char* value) override;
+
  private:
   friend struct base::DefaultSingletonTraits<CrashReporterLinux>;
 
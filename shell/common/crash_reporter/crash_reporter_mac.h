@@ -26,7 +26,9 @@ class CrashReporterMac : public CrashReporterCrashpad {
             const std::string& submit_url,
             const base::FilePath& crashes_dir,
             bool upload_to_server,
-            bool skip_system_crash_handler) override;
+            bool skip_system_crash_handler,
+            bool rate_limit,
+            bool compress) override;
   void SetUploadParameters() override;
 
  private:
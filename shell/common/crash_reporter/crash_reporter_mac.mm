@@ -27,7 +27,9 @@ void CrashReporterMac::Init(const std::string& product_name,
                             const std::string& submit_url,
                             const base::FilePath& crashes_dir,
                             bool upload_to_server,
-                            bool skip_system_crash_handler) {
+                            bool skip_system_crash_handler,
+                            bool rate_limit,
+                            bool compress) {
   // check whether crashpad has been initialized.
   // Only need to initialize once.
   if (simple_string_dictionary_)
@@ -39,10 +41,11 @@ void CrashReporterMac::Init(const std::string& product_name,
       base::FilePath handler_path =
           framework_bundle_path.Append("Resources").Append("crashpad_handler");
 
-      std::vector<std::string> args = {
-          "--no-rate-limit",
-          "--no-upload-gzip",  // not all servers accept gzip
-      };
+      std::vector<std::string> args;
+      if (!rate_limit)
+        args.push_back("--no-rate-limit");
+      if (!compress)
+        args.push_back("--no-upload-gzip");  // not all servers accept gzip
 
       crashpad::CrashpadClient crashpad_client;
       crashpad_client.StartHandler(handler_path, crashes_dir, crashes_dir,
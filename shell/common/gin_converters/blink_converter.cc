@@ -505,6 +505,13 @@ bool Converter<network::mojom::ReferrerPolicy>::FromV8(
 }
 
 namespace {
+// IPC payloads are written straight into the message buffer with
+// v8::ValueSerializer (the "new" path below), so the bytes produced here are
+// the ones that travel through mojo and are deserialized directly back into
+// v8 on the other side; no base::Value round trip is involved. The "old"
+// base::Value-based serialization only remains as a deprecated fallback for
+// values the structured clone algorithm rejects, and is scheduled for
+// removal.
 constexpr uint8_t kNewSerializationTag = 0;
 constexpr uint8_t kOldSerializationTag = 1;
 
@@ -517,7 +524,7 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
         use_old_serialization_(use_old_serialization) {}
   ~V8Serializer() override = default;
 
-  bool Serialize(v8::Local<v8::Value> value, blink::CloneableMessage* out) {
+  bool Serialize(v8::Local<v8::Value> value, std::vector<uint8_t>* out) {
     serializer_.WriteHeader();
     if (use_old_serialization_) {
       WriteTag(kOldSerializationTag);
@@ -544,8 +551,8 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
 
     std::pair<uint8_t*, size_t> buffer = serializer_.Release();
     DCHECK_EQ(buffer.first, data_.data());
-    out->encoded_message = base::make_span(buffer.first, buffer.second);
-    out->owned_encoded_message = std::move(data_);
+    data_.resize(buffer.second);
+    *out = std::move(data_);
 
     return true;
   }
@@ -601,12 +608,11 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
 
 class V8Deserializer : public v8::ValueDeserializer::Delegate {
  public:
-  V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
+  V8Deserializer(v8::Isolate* isolate, base::span<const uint8_t> data)
       : isolate_(isolate),
-        deserializer_(isolate,
-                      message.encoded_message.data(),
-                      message.encoded_message.size(),
-                      this) {}
+        deserializer_(isolate, data.data(), data.size(), this) {}
+  V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
+      : V8Deserializer(isolate, message.encoded_message) {}
 
   v8::Local<v8::Value> Deserialize() {
     v8::EscapableHandleScope scope(isolate_);
@@ -681,7 +687,31 @@ v8::Local<v8::Value> Converter<blink::CloneableMessage>::ToV8(
 bool Converter<blink::CloneableMessage>::FromV8(v8::Isolate* isolate,
                                                 v8::Handle<v8::Value> val,
                                                 blink::CloneableMessage* out) {
-  return V8Serializer(isolate).Serialize(val, out);
+  std::vector<uint8_t> data;
+  if (!V8Serializer(isolate).Serialize(val, &data))
+    return false;
+  out->owned_encoded_message = std::move(data);
+  out->encoded_message = out->owned_encoded_message;
+  return true;
+}
+
+v8::Local<v8::Value> Converter<mojo_base::BigBuffer>::ToV8(
+    v8::Isolate* isolate,
+    const mojo_base::BigBuffer& in) {
+  // Deserializes straight out of the (possibly shared-memory backed) buffer;
+  // the payload is never copied into process-local storage first.
+  return V8Deserializer(isolate, base::make_span(in.data(), in.size()))
+      .Deserialize();
+}
+
+bool Converter<mojo_base::BigBuffer>::FromV8(v8::Isolate* isolate,
+                                             v8::Handle<v8::Value> val,
+                                             mojo_base::BigBuffer* out) {
+  std::vector<uint8_t> data;
+  if (!V8Serializer(isolate).Serialize(val, &data))
+    return false;
+  *out = mojo_base::BigBuffer(data);
+  return true;
 }
 
 }  // namespace gin
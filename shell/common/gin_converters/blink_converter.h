@@ -6,6 +6,7 @@
 #define SHELL_COMMON_GIN_CONVERTERS_BLINK_CONVERTER_H_
 
 #include "gin/converter.h"
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "third_party/blink/public/common/messaging/cloneable_message.h"
 #include "third_party/blink/public/common/web_cache/web_cache_resource_type_stats.h"
 #include "third_party/blink/public/platform/web_input_event.h"
@@ -127,6 +128,19 @@ struct Converter<blink::CloneableMessage> {
                      blink::CloneableMessage* out);
 };
 
+// Structured-clone payload carried as a BigBuffer, the transport used by
+// Electron's IPC methods: small messages travel inline in the mojo message
+// while large ones ride a shared memory region that the receiver maps and
+// deserializes in place.
+template <>
+struct Converter<mojo_base::BigBuffer> {
+  static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
+                                   const mojo_base::BigBuffer& in);
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     mojo_base::BigBuffer* out);
+};
+
 v8::Local<v8::Value> EditFlagsToV8(v8::Isolate* isolate, int editFlags);
 v8::Local<v8::Value> MediaFlagsToV8(v8::Isolate* isolate, int mediaFlags);
 
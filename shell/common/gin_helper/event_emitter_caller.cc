@@ -4,6 +4,9 @@
 
 #include "shell/common/gin_helper/event_emitter_caller.h"
 
+#include <map>
+#include <memory>
+
 #include "shell/common/gin_helper/locker.h"
 #include "shell/common/node_includes.h"
 
@@ -11,6 +14,79 @@ namespace gin_helper {
 
 namespace internal {
 
+namespace {
+
+// Upper bound on idle vectors kept around per thread. Emits nest (an
+// event handler may emit again), so a small stack of spares is needed,
+// but it never grows deep.
+constexpr size_t kMaxPooledVectors = 8;
+
+std::vector<std::unique_ptr<ValueVector>>& GetValueVectorPool() {
+  static thread_local std::vector<std::unique_ptr<ValueVector>> pool;
+  return pool;
+}
+
+using EventNameTable = std::map<std::string, v8::Eternal<v8::String>>;
+
+// Each isolate runs on its own thread, so thread-local tables need no
+// locking.
+std::map<v8::Isolate*, EventNameTable>& GetEventNameTables() {
+  static thread_local std::map<v8::Isolate*, EventNameTable> tables;
+  return tables;
+}
+
+// Runs at environment teardown, while the isolate is still alive. A
+// worker's isolate dies with its environment and the allocator may hand
+// the same address to a later isolate, so a table left behind would pass
+// the isolate lookup and serve dead handles.
+void PurgeEventNameTable(void* isolate) {
+  GetEventNameTables().erase(static_cast<v8::Isolate*>(isolate));
+}
+
+}  // namespace
+
+v8::Local<v8::String> InternedEventName(v8::Isolate* isolate,
+                                        const std::string& name) {
+  auto& tables = GetEventNameTables();
+  auto tables_iter = tables.find(isolate);
+  if (tables_iter == tables.end()) {
+    // Without an environment there is no teardown signal to purge on;
+    // don't cache at all rather than risk outliving the isolate.
+    if (node::Environment::GetCurrent(isolate) == nullptr)
+      return gin::StringToV8(isolate, name);
+    node::AddEnvironmentCleanupHook(isolate, PurgeEventNameTable, isolate);
+    tables_iter = tables.emplace(isolate, EventNameTable()).first;
+  }
+  auto& table = tables_iter->second;
+  auto iter = table.find(name);
+  if (iter == table.end()) {
+    iter = table
+               .emplace(name, v8::Eternal<v8::String>(
+                                  isolate, gin::StringToV8(isolate, name)))
+               .first;
+  }
+  return iter->second.Get(isolate);
+}
+
+PooledValueVector::PooledValueVector() {
+  auto& pool = GetValueVectorPool();
+  if (pool.empty()) {
+    vector_ = new ValueVector;
+  } else {
+    vector_ = pool.back().release();
+    pool.pop_back();
+  }
+}
+
+PooledValueVector::~PooledValueVector() {
+  vector_->clear();
+  auto& pool = GetValueVectorPool();
+  if (pool.size() < kMaxPooledVectors)
+    pool.emplace_back(vector_);
+  else
+    delete vector_;
+}
+
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         v8::Local<v8::Object> obj,
                                         const char* method,
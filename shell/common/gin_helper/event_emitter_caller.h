@@ -5,9 +5,11 @@
 #ifndef SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 #define SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "base/macros.h"
 #include "gin/converter.h"
 
 namespace gin_helper {
@@ -21,6 +23,28 @@ v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         const char* method,
                                         ValueVector* args);
 
+// Returns the interned v8 string for an event name. Event names repeat
+// endlessly, so each one is created once per isolate and served from an
+// eternal handle afterwards.
+v8::Local<v8::String> InternedEventName(v8::Isolate* isolate,
+                                        const std::string& name);
+
+// A ValueVector borrowed from a small thread-local pool; it is cleared
+// (capacity kept) and returned on destruction, so steady-state emits do
+// not allocate the argument vector.
+class PooledValueVector {
+ public:
+  PooledValueVector();
+  ~PooledValueVector();
+
+  ValueVector& get() { return *vector_; }
+
+ private:
+  ValueVector* vector_;
+
+  DISALLOW_COPY_AND_ASSIGN(PooledValueVector);
+};
+
 }  // namespace internal
 
 // obj.emit.apply(obj, name, args...);
@@ -30,8 +54,10 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                const internal::ValueVector& args) {
-  internal::ValueVector concatenated_args = {gin::StringToV8(isolate, name)};
+  internal::PooledValueVector pooled;
+  internal::ValueVector& concatenated_args = pooled.get();
   concatenated_args.reserve(1 + args.size());
+  concatenated_args.push_back(internal::InternedEventName(isolate, name));
   concatenated_args.insert(concatenated_args.end(), args.begin(), args.end());
   return internal::CallMethodWithArgs(isolate, obj, "emit", &concatenated_args);
 }
@@ -43,10 +69,14 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                Args&&... args) {
-  internal::ValueVector converted_args = {
-      gin::StringToV8(isolate, name),
-      gin::ConvertToV8(isolate, std::forward<Args>(args))...,
-  };
+  internal::PooledValueVector pooled;
+  internal::ValueVector& converted_args = pooled.get();
+  converted_args.reserve(1 + sizeof...(args));
+  converted_args.push_back(internal::InternedEventName(isolate, name));
+  (void)std::initializer_list<int>{
+      (converted_args.push_back(
+           gin::ConvertToV8(isolate, std::forward<Args>(args))),
+       0)...};
   return internal::CallMethodWithArgs(isolate, obj, "emit", &converted_args);
 }
 
@@ -56,9 +86,13 @@ v8::Local<v8::Value> CustomEmit(v8::Isolate* isolate,
                                 v8::Local<v8::Object> object,
                                 const char* custom_emit,
                                 Args&&... args) {
-  internal::ValueVector converted_args = {
-      gin::ConvertToV8(isolate, std::forward<Args>(args))...,
-  };
+  internal::PooledValueVector pooled;
+  internal::ValueVector& converted_args = pooled.get();
+  converted_args.reserve(sizeof...(args));
+  (void)std::initializer_list<int>{
+      (converted_args.push_back(
+           gin::ConvertToV8(isolate, std::forward<Args>(args))),
+       0)...};
   return internal::CallMethodWithArgs(isolate, object, custom_emit,
                                       &converted_args);
 }
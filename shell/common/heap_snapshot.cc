@@ -4,37 +4,108 @@
 
 #include "shell/common/heap_snapshot.h"
 
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/sequenced_task_runner.h"
+#include "base/synchronization/atomic_flag.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/task/post_task.h"
+#include "base/threading/thread_restrictions.h"
+#include "third_party/zlib/google/compression_utils.h"
 #include "v8/include/v8-profiler.h"
 
 namespace {
 
+// Hands serialized chunks off to a blocking sequence so the isolate thread
+// keeps serializing while earlier chunks hit the disk, instead of alternating
+// between serialization and synchronous writes. This matters most for the
+// browser process, where the isolate thread is the UI thread.
 class HeapSnapshotOutputStream : public v8::OutputStream {
  public:
-  explicit HeapSnapshotOutputStream(base::File* file) : file_(file) {
+  HeapSnapshotOutputStream(base::File* file, bool compress)
+      : file_(file),
+        compress_(compress),
+        writer_task_runner_(base::CreateSequencedTaskRunner(
+            {base::ThreadPool(), base::MayBlock(),
+             base::TaskPriority::USER_VISIBLE})) {
     DCHECK(file_);
   }
 
-  bool IsComplete() const { return is_complete_; }
+  ~HeapSnapshotOutputStream() override {
+    // Serialize() skips EndOfStream() when aborted, so make sure no write
+    // task can outlive |this| or the caller's file.
+    JoinWriterSequence();
+  }
+
+  bool IsComplete() const { return is_complete_ && !write_failed_.IsSet(); }
 
   // v8::OutputStream
   int GetChunkSize() override { return 65536; }
-  void EndOfStream() override { is_complete_ = true; }
+
+  void EndOfStream() override {
+    is_complete_ = true;
+    // Join the writer sequence so the file is fully written (and any write
+    // failure observed) before the caller closes it.
+    JoinWriterSequence();
+  }
 
   v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
-    auto bytes_written = file_->WriteAtCurrentPos(data, size);
-    return bytes_written == size ? kContinue : kAbort;
+    if (write_failed_.IsSet())
+      return kAbort;
+    writer_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&HeapSnapshotOutputStream::WriteOnWriterSequence,
+                       base::Unretained(this), std::string(data, size)));
+    return kContinue;
   }
 
  private:
+  void WriteOnWriterSequence(const std::string& chunk) {
+    if (write_failed_.IsSet())
+      return;
+    const std::string* data = &chunk;
+    std::string compressed;
+    if (compress_) {
+      // Each chunk becomes its own gzip member; concatenated members form a
+      // valid gzip stream (RFC 1952), so the file decompresses as a whole.
+      if (!compression::GzipCompress(chunk, &compressed)) {
+        write_failed_.Set();
+        return;
+      }
+      data = &compressed;
+    }
+    int size = static_cast<int>(data->size());
+    if (file_->WriteAtCurrentPos(data->data(), size) != size)
+      write_failed_.Set();
+  }
+
+  void JoinWriterSequence() {
+    if (joined_)
+      return;
+    joined_ = true;
+    base::WaitableEvent done;
+    writer_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&base::WaitableEvent::Signal, base::Unretained(&done)));
+    base::ScopedAllowBaseSyncPrimitivesOutsideBlockingScope allow_wait;
+    done.Wait();
+  }
+
   base::File* file_ = nullptr;
+  bool compress_ = false;
   bool is_complete_ = false;
+  bool joined_ = false;
+  base::AtomicFlag write_failed_;
+  scoped_refptr<base::SequencedTaskRunner> writer_task_runner_;
 };
 
 }  // namespace
 
 namespace electron {
 
-bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
+bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file, bool compress) {
   DCHECK(isolate);
   DCHECK(file);
 
@@ -45,7 +116,7 @@ bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
   if (!snapshot)
     return false;
 
-  HeapSnapshotOutputStream stream(file);
+  HeapSnapshotOutputStream stream(file, compress);
   snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
 
   const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
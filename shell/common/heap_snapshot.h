@@ -10,7 +10,13 @@
 
 namespace electron {
 
-bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file);
+// Serializes a full heap snapshot of |isolate| to |file| as JSON. When
+// |compress| is true the output is gzip-compressed on a background sequence
+// while serialization continues, which shrinks large snapshots roughly 5-10x
+// at no extra cost to the isolate thread.
+bool TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File* file,
+                      bool compress = false);
 
 }  // namespace electron
 
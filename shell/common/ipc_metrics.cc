@@ -0,0 +1,44 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/ipc_metrics.h"
+
+#include "base/no_destructor.h"
+#include "base/threading/thread_local.h"
+
+namespace electron {
+
+// static
+IPCMetrics* IPCMetrics::Get() {
+  static base::NoDestructor<base::ThreadLocalPointer<IPCMetrics>> instance;
+  if (!instance->Get())
+    instance->Set(new IPCMetrics);
+  return instance->Get();
+}
+
+IPCMetrics::IPCMetrics() = default;
+
+IPCMetrics::~IPCMetrics() = default;
+
+void IPCMetrics::Record(const std::string& channel,
+                        size_t bytes,
+                        base::TimeDelta dispatch_time) {
+  ChannelMetrics& entry = metrics_[channel];
+  entry.message_count++;
+  entry.total_bytes += bytes;
+  entry.total_dispatch_time += dispatch_time;
+  if (dispatch_time > entry.max_dispatch_time)
+    entry.max_dispatch_time = dispatch_time;
+}
+
+ScopedIPCDispatchTimer::ScopedIPCDispatchTimer(const std::string& channel,
+                                               size_t bytes)
+    : channel_(channel), bytes_(bytes), start_(base::TimeTicks::Now()) {}
+
+ScopedIPCDispatchTimer::~ScopedIPCDispatchTimer() {
+  IPCMetrics::Get()->Record(channel_, bytes_,
+                            base::TimeTicks::Now() - start_);
+}
+
+}  // namespace electron
@@ -0,0 +1,66 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_IPC_METRICS_H_
+#define SHELL_COMMON_IPC_METRICS_H_
+
+#include <map>
+#include <string>
+
+#include "base/macros.h"
+#include "base/time/time.h"
+
+namespace electron {
+
+// Cheap per-channel counters for Electron's IPC dispatch: message counts,
+// byte volumes and dispatch latency. Each thread that dispatches messages
+// owns its own instance (IPC dispatch happens on a single thread in each
+// process), so recording is a couple of map operations with no locking.
+class IPCMetrics {
+ public:
+  struct ChannelMetrics {
+    uint64_t message_count = 0;
+    uint64_t total_bytes = 0;
+    base::TimeDelta total_dispatch_time;
+    base::TimeDelta max_dispatch_time;
+  };
+
+  // Returns the calling thread's instance, created on first use.
+  static IPCMetrics* Get();
+
+  void Record(const std::string& channel,
+              size_t bytes,
+              base::TimeDelta dispatch_time);
+
+  const std::map<std::string, ChannelMetrics>& metrics() const {
+    return metrics_;
+  }
+
+ private:
+  IPCMetrics();
+  ~IPCMetrics();
+
+  std::map<std::string, ChannelMetrics> metrics_;
+
+  DISALLOW_COPY_AND_ASSIGN(IPCMetrics);
+};
+
+// Measures the wall time of one message dispatch and records it, together
+// with the payload size, against |channel| when it goes out of scope.
+class ScopedIPCDispatchTimer {
+ public:
+  ScopedIPCDispatchTimer(const std::string& channel, size_t bytes);
+  ~ScopedIPCDispatchTimer();
+
+ private:
+  std::string channel_;
+  size_t bytes_;
+  base::TimeTicks start_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedIPCDispatchTimer);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_COMMON_IPC_METRICS_H_
@@ -26,12 +26,20 @@ class KeyWeakMap {
 
   KeyWeakMap() {}
   virtual ~KeyWeakMap() {
+    if (isolate_)
+      isolate_->RemoveGCEpilogueCallback(OnGCEpilogue, this);
     for (auto& p : map_)
       p.second.second.ClearWeak();
   }
 
   // Sets the object to WeakMap with the given |key|.
   void Set(v8::Isolate* isolate, const K& key, v8::Local<v8::Object> object) {
+    // Install the epilogue hook lazily so maps that never store anything
+    // don't register with the isolate.
+    if (!isolate_) {
+      isolate_ = isolate;
+      isolate->AddGCEpilogueCallback(OnGCEpilogue, this);
+    }
     KeyObject key_object = {key, this};
     auto& p = map_[key] =
         std::make_pair(key_object, v8::Global<v8::Object>(isolate, object));
@@ -69,16 +77,47 @@ class KeyWeakMap {
     map_.erase(iter);
   }
 
+  // Remove objects with |keys| in the WeakMap in one pass.
+  void RemoveMany(const std::vector<K>& keys) {
+    for (const K& key : keys)
+      Remove(key);
+  }
+
  private:
+  // Weak callbacks run inside the GC, so they only queue the dead key;
+  // the map is pruned in one pass at GC epilogue instead of once per
+  // collected entry.
   static void OnObjectGC(
       const v8::WeakCallbackInfo<typename KeyWeakMap<K>::KeyObject>& data) {
     KeyWeakMap<K>::KeyObject* key_object = data.GetParameter();
-    key_object->self->Remove(key_object->key);
+    KeyWeakMap<K>* self = key_object->self;
+    auto iter = self->map_.find(key_object->key);
+    if (iter != self->map_.end())
+      iter->second.second.Reset();
+    self->dead_keys_.push_back(key_object->key);
+  }
+
+  static void OnGCEpilogue(v8::Isolate* isolate,
+                           v8::GCType type,
+                           v8::GCCallbackFlags flags,
+                           void* data) {
+    auto* self = static_cast<KeyWeakMap<K>*>(data);
+    if (self->dead_keys_.empty())
+      return;
+    for (const K& key : self->dead_keys_)
+      self->map_.erase(key);
+    self->dead_keys_.clear();
   }
 
   // Map of stored objects.
   std::unordered_map<K, std::pair<KeyObject, v8::Global<v8::Object>>> map_;
 
+  // Keys whose objects died in the current GC, erased at epilogue.
+  std::vector<K> dead_keys_;
+
+  // The isolate whose GC epilogue we registered with; set on first Set().
+  v8::Isolate* isolate_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(KeyWeakMap);
 };
 
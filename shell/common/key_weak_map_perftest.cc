@@ -0,0 +1,55 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/key_weak_map.h"
+
+#include "base/timer/elapsed_timer.h"
+#include "gin/test/v8_test.h"
+#include "testing/perf/perf_test.h"
+
+namespace electron {
+
+namespace {
+
+const int kChurnKeys = 10000;
+
+}  // namespace
+
+using KeyWeakMapPerfTest = gin::V8Test;
+
+// The remote module assigns every proxied object an entry in a
+// KeyWeakMap, so set/get/remove churn tracks the cost of remote-heavy
+// pages creating and dropping references.
+TEST_F(KeyWeakMapPerfTest, Churn) {
+  v8::Isolate* isolate = instance_->isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context =
+      v8::Local<v8::Context>::New(isolate, context_);
+  v8::Context::Scope context_scope(context);
+
+  KeyWeakMap<int32_t> map;
+
+  base::ElapsedTimer set_timer;
+  for (int32_t i = 0; i < kChurnKeys; ++i)
+    map.Set(isolate, i, v8::Object::New(isolate));
+  perf_test::PrintResult("key_weak_map", "", "set",
+                         set_timer.Elapsed().InMicrosecondsF() / kChurnKeys,
+                         "us/op", true);
+
+  base::ElapsedTimer get_timer;
+  for (int32_t i = 0; i < kChurnKeys; ++i)
+    map.Get(isolate, i);
+  perf_test::PrintResult("key_weak_map", "", "get",
+                         get_timer.Elapsed().InMicrosecondsF() / kChurnKeys,
+                         "us/op", true);
+
+  base::ElapsedTimer remove_timer;
+  for (int32_t i = 0; i < kChurnKeys; ++i)
+    map.Remove(i);
+  perf_test::PrintResult("key_weak_map", "", "remove",
+                         remove_timer.Elapsed().InMicrosecondsF() / kChurnKeys,
+                         "us/op", true);
+}
+
+}  // namespace electron
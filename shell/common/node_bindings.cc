@@ -5,6 +5,7 @@
 #include "shell/common/node_bindings.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -13,10 +14,15 @@
 #include "base/base_paths.h"
 #include "base/command_line.h"
 #include "base/environment.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
+#include "base/process/process_metrics.h"
 #include "base/run_loop.h"
+#include "base/stl_util.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/platform_thread.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/browser/browser_thread.h"
@@ -29,6 +35,8 @@
 #include "shell/common/gin_helper/locker.h"
 #include "shell/common/mac/main_application_bundle.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/options_switches.h"
+#include "shell/common/startup_metrics.h"
 
 #define ELECTRON_BUILTIN_MODULES(V)  \
   V(atom_browser_app)                \
@@ -58,6 +66,7 @@
   V(atom_common_asar)                \
   V(atom_common_clipboard)           \
   V(atom_common_command_line)        \
+  V(atom_common_cpu_profiler)        \
   V(atom_common_crash_reporter)      \
   V(atom_common_features)            \
   V(atom_common_native_image)        \
@@ -122,6 +131,15 @@ void stop_and_close_uv_loop(uv_loop_t* loop) {
 
 bool g_is_initialized = false;
 
+// Updated from the embed thread, read from the main thread.
+std::atomic<uint32_t> g_suppressed_wakeups{0};
+
+// When the embed thread sees uv readiness it stamps the time here
+// (microseconds since the TimeTicks origin); the main thread exchanges the
+// stamp for zero when it services the loop, and the difference is the
+// scheduling delay. Zero means no wakeup is pending.
+std::atomic<int64_t> g_pending_wakeup_us{0};
+
 }  // namespace
 
 namespace electron {
@@ -140,6 +158,87 @@ std::unique_ptr<const char* []> StringVectorToArgArray(
   return array;
 }
 
+// Per-module load costs, covering the linked-in builtins registered in
+// RegisterBuiltinModules() and .node addons reported through
+// RecordModuleLoadMetric(). Both happen on the main thread, so no locking
+// is needed.
+struct ModuleLoadMetric {
+  std::string name;
+  std::string type;
+  double wall_ms;
+  double cpu_ms;
+  double memory_delta_bytes;
+};
+
+std::vector<ModuleLoadMetric>& GetModuleLoadLog() {
+  static base::NoDestructor<std::vector<ModuleLoadMetric>> log;
+  return *log;
+}
+
+// Runs a builtin module's registration function and records its cost.
+// Registration is cheap compared to addon loads, but a misbehaving static
+// initializer shows up here too; memory growth is measured as allocator
+// usage since registration does not touch enough pages to move the
+// resident set.
+void RegisterBuiltinModule(const char* name, void (*reg)()) {
+  const bool cpu_supported = base::ThreadTicks::IsSupported();
+  const size_t malloc_before = base::GetMallocUsage();
+  const base::TimeTicks wall_start = base::TimeTicks::Now();
+  const base::ThreadTicks cpu_start =
+      cpu_supported ? base::ThreadTicks::Now() : base::ThreadTicks();
+
+  reg();
+
+  ModuleLoadMetric metric;
+  metric.name = name;
+  metric.type = "builtin";
+  metric.wall_ms = (base::TimeTicks::Now() - wall_start).InMillisecondsF();
+  metric.cpu_ms =
+      cpu_supported ? (base::ThreadTicks::Now() - cpu_start).InMillisecondsF()
+                    : 0.0;
+  metric.memory_delta_bytes = static_cast<double>(base::GetMallocUsage()) -
+                              static_cast<double>(malloc_before);
+  GetModuleLoadLog().push_back(std::move(metric));
+}
+
+// Scheduling-delay and uv-tick duration statistics for the loop
+// integration. The pending wakeup stamp above is the only cross-thread
+// piece; everything here is written from UvRunOnce() on the main thread.
+// Lag is bucketed into an exponential histogram so a rare slow wakeup is
+// visible next to a healthy median.
+constexpr int64_t kLagBucketBoundsMs[] = {1, 2, 4, 8, 16, 32, 64, 128};
+constexpr size_t kLagBucketCount = base::size(kLagBucketBoundsMs) + 1;
+
+struct UvLoopMetrics {
+  uint64_t ticks = 0;
+  double tick_total_ms = 0.0;
+  double tick_max_ms = 0.0;
+  uint64_t wakeups = 0;
+  double lag_total_ms = 0.0;
+  double lag_max_ms = 0.0;
+  uint64_t lag_buckets[kLagBucketCount] = {};
+};
+
+UvLoopMetrics& GetUvLoopMetrics() {
+  static base::NoDestructor<UvLoopMetrics> metrics;
+  return *metrics;
+}
+
+void RecordUvWakeupLag(double lag_ms) {
+  UvLoopMetrics& metrics = GetUvLoopMetrics();
+  size_t bucket = kLagBucketCount - 1;
+  for (size_t i = 0; i < base::size(kLagBucketBoundsMs); ++i) {
+    if (lag_ms < kLagBucketBoundsMs[i]) {
+      bucket = i;
+      break;
+    }
+  }
+  ++metrics.lag_buckets[bucket];
+  ++metrics.wakeups;
+  metrics.lag_total_ms += lag_ms;
+  metrics.lag_max_ms = std::max(metrics.lag_max_ms, lag_ms);
+}
+
 base::FilePath GetResourcesPath() {
 #if defined(OS_MACOSX)
   return MainApplicationBundlePath().Append("Contents").Append("Resources");
@@ -167,14 +266,17 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
 NodeBindings::~NodeBindings() {
   // Quit the embed thread.
   embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
-  WakeupEmbedThread();
+  if (!polls_in_place_) {
+    uv_sem_post(&embed_sem_);
+    WakeupEmbedThread();
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
+
+    uv_sem_destroy(&embed_sem_);
+  }
 
   // Clear uv.
-  uv_sem_destroy(&embed_sem_);
   uv_close(reinterpret_cast<uv_handle_t*>(&dummy_uv_handle_), nullptr);
 
   // Clean up worker loop
@@ -182,8 +284,59 @@ NodeBindings::~NodeBindings() {
     stop_and_close_uv_loop(uv_loop_);
 }
 
+// static
+void NodeBindings::RecordModuleLoadMetric(const std::string& name,
+                                          const std::string& type,
+                                          double wall_ms,
+                                          double cpu_ms,
+                                          double memory_delta_bytes) {
+  GetModuleLoadLog().push_back(
+      {name, type, wall_ms, cpu_ms, memory_delta_bytes});
+}
+
+// static
+base::Value NodeBindings::GetModuleLoadMetrics() {
+  std::vector<base::Value> list;
+  list.reserve(GetModuleLoadLog().size());
+  for (const ModuleLoadMetric& metric : GetModuleLoadLog()) {
+    base::Value dict(base::Value::Type::DICTIONARY);
+    dict.SetStringKey("name", metric.name);
+    dict.SetStringKey("type", metric.type);
+    dict.SetDoubleKey("wallMs", metric.wall_ms);
+    dict.SetDoubleKey("cpuMs", metric.cpu_ms);
+    dict.SetDoubleKey("memoryDeltaBytes", metric.memory_delta_bytes);
+    list.push_back(std::move(dict));
+  }
+  return base::Value(std::move(list));
+}
+
+// static
+base::Value NodeBindings::GetUVMetrics() {
+  const UvLoopMetrics& metrics = GetUvLoopMetrics();
+  base::Value dict(base::Value::Type::DICTIONARY);
+  dict.SetDoubleKey("ticks", static_cast<double>(metrics.ticks));
+  dict.SetDoubleKey("tickTotalMs", metrics.tick_total_ms);
+  dict.SetDoubleKey("tickMaxMs", metrics.tick_max_ms);
+  dict.SetDoubleKey("wakeups", static_cast<double>(metrics.wakeups));
+  dict.SetDoubleKey("lagTotalMs", metrics.lag_total_ms);
+  dict.SetDoubleKey("lagMaxMs", metrics.lag_max_ms);
+
+  std::vector<base::Value> bounds;
+  bounds.reserve(base::size(kLagBucketBoundsMs));
+  for (int64_t bound : kLagBucketBoundsMs)
+    bounds.push_back(base::Value(static_cast<int>(bound)));
+  dict.SetKey("lagBucketBoundsMs", base::Value(std::move(bounds)));
+
+  std::vector<base::Value> buckets;
+  buckets.reserve(kLagBucketCount);
+  for (uint64_t count : metrics.lag_buckets)
+    buckets.push_back(base::Value(static_cast<double>(count)));
+  dict.SetKey("lagHistogram", base::Value(std::move(buckets)));
+  return dict;
+}
+
 void NodeBindings::RegisterBuiltinModules() {
-#define V(modname) _register_##modname();
+#define V(modname) RegisterBuiltinModule(#modname, _register_##modname);
   ELECTRON_BUILTIN_MODULES(V)
 #if BUILDFLAG(ENABLE_VIEW_API)
   ELECTRON_VIEW_MODULES(V)
@@ -200,6 +353,7 @@ bool NodeBindings::IsInitialized() {
 
 void NodeBindings::Initialize() {
   TRACE_EVENT0("electron", "NodeBindings::Initialize");
+  StartupMetrics::Get()->Record("nodeBindingsInitialize");
   // Open node's error reporting system for browser process.
   node::g_standalone_mode = browser_env_ == BrowserEnvironment::BROWSER;
   node::g_upstream_node_mode = false;
@@ -364,8 +518,10 @@ node::Environment* NodeBindings::CreateEnvironment(
 }
 
 void NodeBindings::LoadEnvironment(node::Environment* env) {
+  StartupMetrics::Get()->Record("loadEnvironment");
   node::LoadEnvironment(env);
   gin_helper::EmitEvent(env->isolate(), env->process_object(), "loaded");
+  StartupMetrics::Get()->Record("loadEnvironmentDone");
 }
 
 void NodeBindings::PrepareMessageLoop() {
@@ -373,6 +529,22 @@ void NodeBindings::PrepareMessageLoop() {
   // nothing to do.
   uv_async_init(uv_loop_, &dummy_uv_handle_, nullptr);
 
+  // When the main thread's pump can watch the uv backend fd itself, events
+  // are serviced in place and the embed thread with its wakeup round-trip
+  // per event is not needed.
+  polls_in_place_ = StartInPlacePolling();
+  if (polls_in_place_)
+    return;
+
+  int window_ms = 0;
+  if (base::StringToInt(
+          base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(
+              switches::kUvWakeupCoalesceWindowMs),
+          &window_ms) &&
+      window_ms > 0) {
+    wakeup_coalesce_window_ = base::TimeDelta::FromMilliseconds(window_ms);
+  }
+
   // Start worker that will interrupt main loop when having uv events.
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
@@ -406,20 +578,43 @@ void NodeBindings::UvRunOnce() {
   v8::MicrotasksScope script_scope(env->isolate(),
                                    v8::MicrotasksScope::kRunMicrotasks);
 
+  // Measure how long the wakeup sat in the task queue before we got here.
+  const int64_t wakeup_us =
+      g_pending_wakeup_us.exchange(0, std::memory_order_acquire);
+  if (wakeup_us != 0) {
+    const double lag_ms =
+        (base::TimeTicks::Now().since_origin().InMicroseconds() - wakeup_us) /
+        1000.0;
+    RecordUvWakeupLag(std::max(lag_ms, 0.0));
+  }
+
   if (browser_env_ != BrowserEnvironment::BROWSER)
     TRACE_EVENT_BEGIN0("devtools.timeline", "FunctionCall");
 
   // Deal with uv events.
+  const base::TimeTicks tick_start = base::TimeTicks::Now();
   int r = uv_run(uv_loop_, UV_RUN_NOWAIT);
+  const double tick_ms =
+      (base::TimeTicks::Now() - tick_start).InMillisecondsF();
 
   if (browser_env_ != BrowserEnvironment::BROWSER)
     TRACE_EVENT_END0("devtools.timeline", "FunctionCall");
 
+  UvLoopMetrics& metrics = GetUvLoopMetrics();
+  ++metrics.ticks;
+  metrics.tick_total_ms += tick_ms;
+  metrics.tick_max_ms = std::max(metrics.tick_max_ms, tick_ms);
+
   if (r == 0)
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
   // Tell the worker thread to continue polling.
-  uv_sem_post(&embed_sem_);
+  if (!polls_in_place_)
+    uv_sem_post(&embed_sem_);
+}
+
+bool NodeBindings::StartInPlacePolling() {
+  return false;
 }
 
 void NodeBindings::WakeupMainThread() {
@@ -432,6 +627,11 @@ void NodeBindings::WakeupEmbedThread() {
   uv_async_send(&dummy_uv_handle_);
 }
 
+// static
+uint32_t NodeBindings::suppressed_wakeup_count() {
+  return g_suppressed_wakeups.load(std::memory_order_relaxed);
+}
+
 // static
 void NodeBindings::EmbedThreadRunner(void* arg) {
   NodeBindings* self = static_cast<NodeBindings*>(arg);
@@ -447,10 +647,36 @@ void NodeBindings::EmbedThreadRunner(void* arg) {
     // this class is being destructed the PollEvents() would not be available
     // anymore. Because of it we must make sure we only invoke PollEvents()
     // when this class is alive.
-    self->PollEvents();
+    //
+    // Keep polling while the wakeup would be spurious: when the poll saw no
+    // io activity and the nearest uv timer is still in the future (timers
+    // were rescheduled while we slept), waking the main thread would only
+    // produce an empty UV_RUN_NOWAIT pass.
+    for (;;) {
+      bool io_ready = self->PollEvents();
+      if (self->embed_closed_)
+        break;
+      if (io_ready || uv_backend_timeout(self->uv_loop_) == 0)
+        break;
+      g_suppressed_wakeups.fetch_add(1, std::memory_order_relaxed);
+    }
     if (self->embed_closed_)
       break;
 
+    // Stamp uv readiness before the linger so the scheduling delay the main
+    // thread measures includes any coalesce window. Keep the earliest
+    // pending stamp: a wakeup arriving while another is still unserviced
+    // adds no delay of its own.
+    int64_t expected = 0;
+    g_pending_wakeup_us.compare_exchange_strong(
+        expected, base::TimeTicks::Now().since_origin().InMicroseconds(),
+        std::memory_order_release, std::memory_order_relaxed);
+
+    // Linger briefly so wakeups arriving close together get coalesced into
+    // a single main-thread pass.
+    if (!self->wakeup_coalesce_window_.is_zero())
+      base::PlatformThread::Sleep(self->wakeup_coalesce_window_);
+
     // Deal with event in main thread.
     self->WakeupMainThread();
   }
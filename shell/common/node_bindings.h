@@ -5,10 +5,14 @@
 #ifndef SHELL_COMMON_NODE_BINDINGS_H_
 #define SHELL_COMMON_NODE_BINDINGS_H_
 
+#include <string>
+
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/memory/weak_ptr.h"
 #include "base/single_thread_task_runner.h"
+#include "base/time/time.h"
+#include "base/values.h"
 #include "uv.h"  // NOLINT(build/include)
 #include "v8/include/v8.h"
 
@@ -35,6 +39,24 @@ class NodeBindings {
   static void RegisterBuiltinModules();
   static bool IsInitialized();
 
+  // Records the load cost of a .node addon, reported by the process.dlopen
+  // wrapper in lib/common/init.ts. Main thread only.
+  static void RecordModuleLoadMetric(const std::string& name,
+                                     const std::string& type,
+                                     double wall_ms,
+                                     double cpu_ms,
+                                     double memory_delta_bytes);
+
+  // Returns the per-module load costs recorded so far in this process:
+  // builtin registration (measured natively) plus addon loads. Bound as
+  // process.getModuleLoadMetrics().
+  static base::Value GetModuleLoadMetrics();
+
+  // Returns scheduling-delay and tick-duration statistics for the uv loop
+  // integration, accumulated in UvRunOnce(). Bound as
+  // process.getUVMetrics().
+  static base::Value GetUVMetrics();
+
   virtual ~NodeBindings();
 
   // Setup V8, libuv.
@@ -60,11 +82,23 @@ class NodeBindings {
 
   uv_loop_t* uv_loop() const { return uv_loop_; }
 
+  // Number of main-thread wakeups the embed thread suppressed because the
+  // poll returned with nothing actually due. Exposed through
+  // process.getUvWakeupStats() so reduced idle wakeups can be verified.
+  static uint32_t suppressed_wakeup_count();
+
  protected:
   explicit NodeBindings(BrowserEnvironment browser_env);
 
-  // Called to poll events in new thread.
-  virtual void PollEvents() = 0;
+  // Called to poll events in new thread. Returns true when io activity was
+  // observed on the uv backend fd, false when the poll timed out.
+  virtual bool PollEvents() = 0;
+
+  // Gives the platform a chance to register the uv backend fd with the main
+  // thread's message pump, so uv events are serviced in place rather than
+  // bounced through the embed thread. Returns true when the registration
+  // succeeded, in which case the embed thread is never started.
+  virtual bool StartInPlacePolling();
 
   // Run the libuv loop for once.
   void UvRunOnce();
@@ -91,6 +125,15 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether uv events are serviced in place on the main thread, in which
+  // case the embed thread and its semaphore are never created.
+  bool polls_in_place_ = false;
+
+  // How long the embed thread lingers before waking the main thread, so
+  // wakeups arriving close together are coalesced into one uv pass. Zero
+  // (the default) disables the linger.
+  base::TimeDelta wakeup_coalesce_window_;
+
   // Loop used when constructed in WORKER mode
   uv_loop_t worker_loop_;
 
@@ -4,10 +4,48 @@
 
 #include "shell/common/node_bindings_linux.h"
 
+#include <glib.h>
 #include <sys/epoll.h>
 
+#include "base/command_line.h"
+#include "shell/common/options_switches.h"
+
 namespace electron {
 
+namespace {
+
+// A GSource that lets the main thread's glib pump poll libuv's backend fd
+// alongside its own fds, so uv events are serviced in place instead of
+// bouncing through the embed thread's wakeup round-trip.
+struct UvGSource {
+  GSource source;
+  GPollFD poll_fd;
+  NodeBindingsLinux* bindings;
+};
+
+gboolean UvSourcePrepare(GSource* source, gint* timeout) {
+  auto* self = reinterpret_cast<UvGSource*>(source);
+  // Bound the poll by uv's next timer so uv timers fire on time.
+  *timeout = uv_backend_timeout(self->bindings->uv_loop());
+  return *timeout == 0;
+}
+
+gboolean UvSourceCheck(GSource* source) {
+  auto* self = reinterpret_cast<UvGSource*>(source);
+  return (self->poll_fd.revents & G_IO_IN) ||
+         uv_backend_timeout(self->bindings->uv_loop()) == 0;
+}
+
+gboolean UvSourceDispatch(GSource* source, GSourceFunc, gpointer) {
+  reinterpret_cast<UvGSource*>(source)->bindings->OnBackendFdReady();
+  return G_SOURCE_CONTINUE;
+}
+
+GSourceFuncs g_uv_source_funcs = {UvSourcePrepare, UvSourceCheck,
+                                  UvSourceDispatch, nullptr};
+
+}  // namespace
+
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
     : NodeBindings(browser_env), epoll_(epoll_create(1)) {
   int backend_fd = uv_backend_fd(uv_loop_);
@@ -17,7 +55,12 @@ NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
   epoll_ctl(epoll_, EPOLL_CTL_ADD, backend_fd, &ev);
 }
 
-NodeBindingsLinux::~NodeBindingsLinux() = default;
+NodeBindingsLinux::~NodeBindingsLinux() {
+  if (uv_source_) {
+    g_source_destroy(uv_source_);
+    g_source_unref(uv_source_);
+  }
+}
 
 void NodeBindingsLinux::RunMessageLoop() {
   // Get notified when libuv's watcher queue changes.
@@ -36,7 +79,7 @@ void NodeBindingsLinux::OnWatcherQueueChanged(uv_loop_t* loop) {
   self->WakeupEmbedThread();
 }
 
-void NodeBindingsLinux::PollEvents() {
+bool NodeBindingsLinux::PollEvents() {
   int timeout = uv_backend_timeout(uv_loop_);
 
   // Wait for new libuv events.
@@ -45,6 +88,36 @@ void NodeBindingsLinux::PollEvents() {
     struct epoll_event ev;
     r = epoll_wait(epoll_, &ev, 1, timeout);
   } while (r == -1 && errno == EINTR);
+  return r > 0;
+}
+
+bool NodeBindingsLinux::StartInPlacePolling() {
+  // Only the browser process drives its main thread with the glib pump;
+  // other processes keep the embed thread.
+  if (browser_env_ != BrowserEnvironment::BROWSER)
+    return false;
+
+  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kEnableInPlaceUvPolling))
+    return false;
+
+  // Watch the epoll fd created in the constructor rather than the backend fd
+  // itself: it already has the backend fd registered, and reusing it keeps
+  // PollEvents() intact for the embed-thread path.
+  auto* source = reinterpret_cast<UvGSource*>(
+      g_source_new(&g_uv_source_funcs, sizeof(UvGSource)));
+  source->bindings = this;
+  source->poll_fd.fd = epoll_;
+  source->poll_fd.events = G_IO_IN;
+  source->poll_fd.revents = 0;
+  g_source_add_poll(&source->source, &source->poll_fd);
+  g_source_attach(&source->source, g_main_context_default());
+  uv_source_ = &source->source;
+  return true;
+}
+
+void NodeBindingsLinux::OnBackendFdReady() {
+  UvRunOnce();
 }
 
 // static
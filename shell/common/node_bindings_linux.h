@@ -8,6 +8,8 @@
 #include "base/compiler_specific.h"
 #include "shell/common/node_bindings.h"
 
+typedef struct _GSource GSource;
+
 namespace electron {
 
 class NodeBindingsLinux : public NodeBindings {
@@ -17,15 +19,23 @@ class NodeBindingsLinux : public NodeBindings {
 
   void RunMessageLoop() override;
 
+  // Services pending uv events on the main thread; called by the glib
+  // source attached in StartInPlacePolling().
+  void OnBackendFdReady();
+
  private:
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
-  void PollEvents() override;
+  bool PollEvents() override;
+  bool StartInPlacePolling() override;
 
   // Epoll to poll for uv's backend fd.
   int epoll_;
 
+  // Glib source watching |epoll_| when uv events are serviced in place.
+  GSource* uv_source_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsLinux);
 };
 
@@ -36,7 +36,7 @@ void NodeBindingsMac::OnWatcherQueueChanged(uv_loop_t* loop) {
   self->WakeupEmbedThread();
 }
 
-void NodeBindingsMac::PollEvents() {
+bool NodeBindingsMac::PollEvents() {
   struct timeval tv;
   int timeout = uv_backend_timeout(uv_loop_);
   if (timeout != -1) {
@@ -55,6 +55,7 @@ void NodeBindingsMac::PollEvents() {
     r = select(fd + 1, &readset, nullptr, nullptr,
                timeout == -1 ? nullptr : &tv);
   } while (r == -1 && errno == EINTR);
+  return r > 0;
 }
 
 // static
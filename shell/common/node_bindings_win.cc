@@ -29,7 +29,7 @@ NodeBindingsWin::NodeBindingsWin(BrowserEnvironment browser_env)
 
 NodeBindingsWin::~NodeBindingsWin() {}
 
-void NodeBindingsWin::PollEvents() {
+bool NodeBindingsWin::PollEvents() {
   // If there are other kinds of events pending, uv_backend_timeout will
   // instruct us not to wait.
   DWORD bytes, timeout;
@@ -41,8 +41,11 @@ void NodeBindingsWin::PollEvents() {
   GetQueuedCompletionStatus(uv_loop_->iocp, &bytes, &key, &overlapped, timeout);
 
   // Give the event back so libuv can deal with it.
-  if (overlapped != NULL)
+  if (overlapped != NULL) {
     PostQueuedCompletionStatus(uv_loop_->iocp, bytes, key, overlapped);
+    return true;
+  }
+  return false;
 }
 
 // static
@@ -16,7 +16,7 @@ class NodeBindingsWin : public NodeBindings {
   ~NodeBindingsWin() override;
 
  private:
-  void PollEvents() override;
+  bool PollEvents() override;
 
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsWin);
 };
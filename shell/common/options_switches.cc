@@ -134,6 +134,11 @@ const char kDisableBlinkFeatures[] = "disableBlinkFeatures";
 // Enable the node integration in WebWorker.
 const char kNodeIntegrationInWorker[] = "nodeIntegrationInWorker";
 
+// Expose only the Electron process bindings in web workers, without booting
+// a Node environment per worker thread. Ignored when nodeIntegrationInWorker
+// is enabled.
+const char kLightweightNodeInWorkers[] = "lightweightNodeInWorkers";
+
 // Enable the web view tag.
 const char kWebviewTag[] = "webviewTag";
 
@@ -153,6 +158,11 @@ const char kOffscreen[] = "offscreen";
 
 const char kNodeIntegrationInSubFrames[] = "nodeIntegrationInSubFrames";
 
+// Skip running the preload script in sub-frames that are same-origin with
+// the top frame; such frames can reach the top frame's APIs directly.
+const char kDisablePreloadInSameOriginSubFrames[] =
+    "disablePreloadInSameOriginSubFrames";
+
 // Disable window resizing when HTML Fullscreen API is activated.
 const char kDisableHtmlFullscreenWindowResize[] =
     "disableHtmlFullscreenWindowResize";
@@ -173,6 +183,14 @@ const char kWebGL[] = "webgl";
 // navigation.
 const char kNavigateOnDragDrop[] = "navigateOnDragDrop";
 
+// Opt the renderer out of Chromium's background tab throttling, keeping its
+// timers and tasks at foreground priority while the window is hidden.
+const char kDisableBackgrounding[] = "disableBackgrounding";
+
+// Caps the renderer's V8 heap, in megabytes. When the heap gets close to
+// the cap the webContents emits 'heap-near-limit'.
+const char kMaxHeapSize[] = "maxHeapSize";
+
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
 const char kEnableRemoteModule[] = "enableRemoteModule";
 #endif
@@ -226,6 +244,9 @@ const char kEnableApiFilteringLogging[] = "enable-api-filtering-logging";
 const char kBackgroundColor[] = "background-color";
 const char kPreloadScript[] = "preload";
 const char kPreloadScripts[] = "preload-scripts";
+// JSON registry of URL-pattern script injections for this session's
+// renderers, matched and evaluated renderer-side at context creation.
+const char kInjectionScripts[] = "injection-scripts";
 const char kNodeIntegration[] = "node-integration";
 const char kContextIsolation[] = "context-isolation";
 const char kGuestInstanceID[] = "guest-instance-id";
@@ -241,10 +262,19 @@ const char kEnableNodeLeakageInRenderers[] = "enable-node-leakage-in-renderers";
 // Command switch passed to renderer process to control nodeIntegration.
 const char kNodeIntegrationInWorker[] = "node-integration-in-worker";
 
+// Command switch passed to renderer process to expose only the Electron
+// process bindings in web workers instead of a full Node environment.
+const char kLightweightNodeInWorkers[] = "lightweight-node-in-workers";
+
 // Command switch passed to renderer process to control whether node
 // environments will be created in sub-frames.
 const char kNodeIntegrationInSubFrames[] = "node-integration-in-subframes";
 
+// Command switch passed to renderer process to skip the preload script in
+// sub-frames that are same-origin with the top frame.
+const char kDisablePreloadInSameOriginSubFrames[] =
+    "disable-preload-in-same-origin-subframes";
+
 // Widevine options
 // Path to Widevine CDM binaries.
 const char kWidevineCdmPath[] = "widevine-cdm-path";
@@ -257,6 +287,12 @@ const char kDiskCacheSize[] = "disk-cache-size";
 // Ignore the limit of 6 connections per host.
 const char kIgnoreConnectionsLimit[] = "ignore-connections-limit";
 
+// Maximum number of concurrent sockets per origin host.
+const char kMaxSocketsPerHost[] = "max-sockets-per-host";
+
+// Maximum number of concurrent connections through one proxy server.
+const char kMaxConnectionsPerProxy[] = "max-connections-per-proxy";
+
 // Whitelist containing servers for which Integrated Authentication is enabled.
 const char kAuthServerWhitelist[] = "auth-server-whitelist";
 
@@ -267,6 +303,19 @@ const char kAuthNegotiateDelegateWhitelist[] =
 // If set, include the port in generated Kerberos SPNs.
 const char kEnableAuthNegotiatePort[] = "enable-auth-negotiate-port";
 
+// Service libuv events in place on the main thread's message pump instead of
+// bouncing every event through the embed thread.
+const char kEnableInPlaceUvPolling[] = "enable-in-place-uv-polling";
+
+// Linger this many milliseconds in the embed thread before waking the main
+// thread, coalescing uv wakeups that arrive close together into one pass.
+const char kUvWakeupCoalesceWindowMs[] = "uv-wakeup-coalesce-window-ms";
+
+// Number of worker threads for the Node/V8 platform pool, which runs V8
+// background work (compilation, GC) and Node's threadpool-backed APIs.
+// Defaults to a size derived from the number of cores.
+const char kNodeWorkerPoolSize[] = "node-worker-pool-size";
+
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
 const char kEnableRemoteModule[] = "enable-remote-module";
 #endif
@@ -68,6 +68,7 @@ extern const char kScrollBounce[];
 extern const char kEnableBlinkFeatures[];
 extern const char kDisableBlinkFeatures[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kLightweightNodeInWorkers[];
 extern const char kWebviewTag[];
 extern const char kNativeWindowOpen[];
 extern const char kCustomArgs[];
@@ -77,12 +78,15 @@ extern const char kWebSecurity[];
 extern const char kAllowRunningInsecureContent[];
 extern const char kOffscreen[];
 extern const char kNodeIntegrationInSubFrames[];
+extern const char kDisablePreloadInSameOriginSubFrames[];
 extern const char kDisableHtmlFullscreenWindowResize[];
 extern const char kJavaScript[];
 extern const char kImages[];
 extern const char kTextAreasAreResizable[];
 extern const char kWebGL[];
 extern const char kNavigateOnDragDrop[];
+extern const char kDisableBackgrounding[];
+extern const char kMaxHeapSize[];
 
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
 extern const char kEnableRemoteModule[];
@@ -112,6 +116,7 @@ extern const char kEnableApiFilteringLogging[];
 extern const char kBackgroundColor[];
 extern const char kPreloadScript[];
 extern const char kPreloadScripts[];
+extern const char kInjectionScripts[];
 extern const char kNodeIntegration[];
 extern const char kContextIsolation[];
 extern const char kGuestInstanceID[];
@@ -120,8 +125,10 @@ extern const char kScrollBounce[];
 extern const char kHiddenPage[];
 extern const char kNativeWindowOpen[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kLightweightNodeInWorkers[];
 extern const char kWebviewTag[];
 extern const char kNodeIntegrationInSubFrames[];
+extern const char kDisablePreloadInSameOriginSubFrames[];
 extern const char kDisableElectronSiteInstanceOverrides[];
 extern const char kEnableNodeLeakageInRenderers[];
 
@@ -130,9 +137,14 @@ extern const char kWidevineCdmVersion[];
 
 extern const char kDiskCacheSize[];
 extern const char kIgnoreConnectionsLimit[];
+extern const char kMaxSocketsPerHost[];
+extern const char kMaxConnectionsPerProxy[];
 extern const char kAuthServerWhitelist[];
 extern const char kAuthNegotiateDelegateWhitelist[];
 extern const char kEnableAuthNegotiatePort[];
+extern const char kEnableInPlaceUvPolling[];
+extern const char kUvWakeupCoalesceWindowMs[];
+extern const char kNodeWorkerPoolSize[];
 
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
 extern const char kEnableRemoteModule[];
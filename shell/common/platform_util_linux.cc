@@ -6,12 +6,14 @@
 
 #include <stdio.h>
 
+#include "base/bind.h"
 #include "base/cancelable_callback.h"
 #include "base/environment.h"
 #include "base/files/file_util.h"
 #include "base/nix/xdg_util.h"
 #include "base/process/kill.h"
 #include "base/process/launch.h"
+#include "base/task/post_task.h"
 #include "chrome/browser/ui/libgtkui/gtk_util.h"
 #include "url/gurl.h"
 
@@ -51,6 +53,22 @@ bool XDGEmail(const std::string& email, const bool wait_for_exit) {
   return XDGUtil({"xdg-email", email}, wait_for_exit);
 }
 
+void ShowItemInFolderOnWorkerThread(const base::FilePath& full_path) {
+  base::FilePath dir = full_path.DirName();
+  if (!base::DirectoryExists(dir))
+    return;
+
+  XDGOpen(dir.value(), false);
+}
+
+std::string OpenExternalOnWorkerThread(const GURL& url) {
+  // Don't wait for exit, since we don't want to wait for the browser/email
+  // client window to close before returning
+  const bool opened = url.SchemeIs("mailto") ? XDGEmail(url.spec(), false)
+                                             : XDGOpen(url.spec(), false);
+  return opened ? "" : "Failed to open";
+}
+
 }  // namespace
 
 namespace platform_util {
@@ -59,11 +77,10 @@ namespace platform_util {
 // manager, but that probably requires extending xdg-open. For now just
 // show the folder.
 void ShowItemInFolder(const base::FilePath& full_path) {
-  base::FilePath dir = full_path.DirName();
-  if (!base::DirectoryExists(dir))
-    return;
-
-  XDGOpen(dir.value(), false);
+  base::PostTask(FROM_HERE,
+                 {base::ThreadPool(), base::MayBlock(),
+                  base::TaskPriority::USER_BLOCKING},
+                 base::BindOnce(&ShowItemInFolderOnWorkerThread, full_path));
 }
 
 bool OpenItem(const base::FilePath& full_path) {
@@ -73,13 +90,14 @@ bool OpenItem(const base::FilePath& full_path) {
 void OpenExternal(const GURL& url,
                   const OpenExternalOptions& options,
                   OpenExternalCallback callback) {
-  // Don't wait for exit, since we don't want to wait for the browser/email
-  // client window to close before returning
-  if (url.SchemeIs("mailto"))
-    std::move(callback).Run(XDGEmail(url.spec(), false) ? ""
-                                                        : "Failed to open");
-  else
-    std::move(callback).Run(XDGOpen(url.spec(), false) ? "" : "Failed to open");
+  // Spawning the xdg helper blocks on the fork/exec, run it on the blocking
+  // pool so openExternal returns immediately and bursts of opens launch in
+  // parallel instead of serializing on the UI thread.
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::MayBlock(),
+       base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&OpenExternalOnWorkerThread, url), std::move(callback));
 }
 
 bool MoveItemToTrash(const base::FilePath& full_path, bool delete_on_fail) {
@@ -0,0 +1,127 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/pooled_array_buffer_allocator.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/bits.h"
+#include "base/no_destructor.h"
+
+namespace electron {
+
+PooledArrayBufferAllocator::PooledArrayBufferAllocator() = default;
+
+PooledArrayBufferAllocator::~PooledArrayBufferAllocator() {
+  Trim();
+}
+
+// static
+PooledArrayBufferAllocator* PooledArrayBufferAllocator::SharedInstance() {
+  static base::NoDestructor<PooledArrayBufferAllocator> instance;
+  return instance.get();
+}
+
+// static
+int PooledArrayBufferAllocator::ClassIndex(size_t length, size_t* rounded) {
+  if (length == 0 || length > kMaxPooledSize)
+    return -1;
+  int log = base::bits::Log2Ceiling(static_cast<uint32_t>(length));
+  constexpr int kMinLog = 8;  // log2(kMinPooledSize)
+  if (log < kMinLog)
+    log = kMinLog;
+  *rounded = static_cast<size_t>(1) << log;
+  return log - kMinLog;
+}
+
+void* PooledArrayBufferAllocator::Allocate(size_t length) {
+  void* data = AllocateUninitialized(length);
+  if (data)
+    memset(data, 0, length);
+  return data;
+}
+
+void* PooledArrayBufferAllocator::AllocateUninitialized(size_t length) {
+  size_t rounded;
+  int index = ClassIndex(length, &rounded);
+  if (index < 0)
+    return malloc(length);
+
+  {
+    base::AutoLock auto_lock(lock_);
+    std::vector<void*>& blocks = free_blocks_[index];
+    if (!blocks.empty()) {
+      void* data = blocks.back();
+      blocks.pop_back();
+      return data;
+    }
+  }
+  return malloc(rounded);
+}
+
+void PooledArrayBufferAllocator::Free(void* data, size_t length) {
+  size_t rounded;
+  int index = ClassIndex(length, &rounded);
+  if (index >= 0) {
+    base::AutoLock auto_lock(lock_);
+    std::vector<void*>& blocks = free_blocks_[index];
+    if (blocks.size() * rounded < pool_limit_per_class_) {
+      blocks.push_back(data);
+      return;
+    }
+  }
+  free(data);
+}
+
+void PooledArrayBufferAllocator::SetPoolLimitPerClass(size_t bytes) {
+  {
+    base::AutoLock auto_lock(lock_);
+    pool_limit_per_class_ = bytes;
+  }
+  if (bytes == 0)
+    Trim();
+}
+
+void PooledArrayBufferAllocator::Trim() {
+  std::vector<void*> doomed;
+  {
+    base::AutoLock auto_lock(lock_);
+    for (std::vector<void*>& blocks : free_blocks_) {
+      doomed.insert(doomed.end(), blocks.begin(), blocks.end());
+      blocks.clear();
+    }
+  }
+  for (void* data : doomed)
+    free(data);
+}
+
+void PooledArrayBufferAllocator::StartTrimming() {
+  if (pressure_listener_)
+    return;
+  pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      base::BindRepeating(&PooledArrayBufferAllocator::OnMemoryPressure,
+                          base::Unretained(this)));
+}
+
+size_t PooledArrayBufferAllocator::pooled_bytes() const {
+  base::AutoLock auto_lock(lock_);
+  size_t total = 0;
+  for (int i = 0; i < kNumClasses; ++i)
+    total += free_blocks_[i].size() * (kMinPooledSize << i);
+  return total;
+}
+
+void PooledArrayBufferAllocator::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level) {
+  if (level !=
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    Trim();
+  }
+}
+
+}  // namespace electron
@@ -0,0 +1,73 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
+#define SHELL_COMMON_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/synchronization/lock.h"
+#include "v8/include/v8.h"
+
+namespace electron {
+
+// v8::ArrayBuffer::Allocator that recycles backing stores through
+// power-of-two size-class freelists. Streaming code allocates thousands of
+// short-lived Buffers per second; the pool turns most of those malloc/free
+// round trips into a freelist push/pop and bounds fragmentation. Requests
+// larger than the biggest size class go straight to the system allocator.
+class PooledArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  PooledArrayBufferAllocator();
+  ~PooledArrayBufferAllocator() override;
+
+  static PooledArrayBufferAllocator* SharedInstance();
+
+  // v8::ArrayBuffer::Allocator:
+  void* Allocate(size_t length) override;
+  void* AllocateUninitialized(size_t length) override;
+  void Free(void* data, size_t length) override;
+
+  // Caps how many bytes each size class may keep pooled; frees beyond the
+  // cap go back to the system allocator. Settable at runtime.
+  void SetPoolLimitPerClass(size_t bytes);
+
+  // Releases every pooled block back to the system allocator.
+  void Trim();
+
+  // Starts releasing the pool on memory pressure. Needs a task runner on
+  // the calling thread, so it is hooked up once the message loop exists.
+  void StartTrimming();
+
+  size_t pooled_bytes() const;
+
+ private:
+  // Size classes are powers of two from kMinPooledSize to kMaxPooledSize.
+  static constexpr size_t kMinPooledSize = 256;
+  static constexpr size_t kMaxPooledSize = 1 << 20;
+  static constexpr int kNumClasses = 13;
+
+  // Returns the class index for |length| and writes the rounded-up block
+  // size to |rounded|, or returns -1 when |length| is not pooled.
+  static int ClassIndex(size_t length, size_t* rounded);
+
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level);
+
+  mutable base::Lock lock_;
+  std::vector<void*> free_blocks_[kNumClasses];
+  size_t pool_limit_per_class_ = 512 * 1024;
+  std::unique_ptr<base::MemoryPressureListener> pressure_listener_;
+
+  DISALLOW_COPY_AND_ASSIGN(PooledArrayBufferAllocator);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_COMMON_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
@@ -4,6 +4,88 @@
 
 #include "shell/common/promise_util.h"
 
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "shell/common/gin_helper/locker.h"
+
+namespace electron {
+
+namespace util {
+
+namespace {
+
+struct Settlement {
+  v8::Isolate* isolate;
+  base::OnceClosure task;
+};
+
+// Pending settlements and whether a drain task is already queued on the
+// UI thread. Guarded by GetSettlementLock().
+base::Lock& GetSettlementLock() {
+  static base::NoDestructor<base::Lock> lock;
+  return *lock;
+}
+
+std::vector<Settlement>& GetPendingSettlements() {
+  static base::NoDestructor<std::vector<Settlement>> settlements;
+  return *settlements;
+}
+
+bool g_drain_posted = false;
+
+}  // namespace
+
+// static
+void PromiseSettlementQueue::Enqueue(v8::Isolate* isolate,
+                                     base::OnceClosure task) {
+  bool should_post = false;
+  {
+    base::AutoLock lock(GetSettlementLock());
+    GetPendingSettlements().push_back({isolate, std::move(task)});
+    if (!g_drain_posted) {
+      g_drain_posted = true;
+      should_post = true;
+    }
+  }
+  if (should_post) {
+    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
+                   base::BindOnce(&PromiseSettlementQueue::Drain));
+  }
+}
+
+// static
+void PromiseSettlementQueue::Drain() {
+  std::vector<Settlement> batch;
+  {
+    base::AutoLock lock(GetSettlementLock());
+    batch.swap(GetPendingSettlements());
+    g_drain_posted = false;
+  }
+
+  // Settle runs of same-isolate promises under one HandleScope and one
+  // microtask checkpoint: the scopes the individual settlements open are
+  // nested inside these, so microtasks run once when the outer scope
+  // closes instead of once per promise.
+  size_t i = 0;
+  while (i < batch.size()) {
+    v8::Isolate* isolate = batch[i].isolate;
+    gin_helper::Locker locker(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::MicrotasksScope script_scope(isolate,
+                                     v8::MicrotasksScope::kRunMicrotasks);
+    while (i < batch.size() && batch[i].isolate == isolate)
+      std::move(batch[i++].task).Run();
+  }
+}
+
+}  // namespace util
+
+}  // namespace electron
+
 namespace mate {
 
 template <typename T>
@@ -10,6 +10,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "base/callback.h"
+#include "base/macros.h"
 #include "base/strings/string_piece.h"
 #include "base/task/post_task.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -21,6 +23,23 @@ namespace electron {
 
 namespace util {
 
+// Coalesces cross-thread promise settlements. Instead of posting one UI
+// task per resolve/reject, settlements are queued and drained by a single
+// task that settles everything pending inside one HandleScope and one
+// microtask checkpoint per isolate. Settlements that arrive while the
+// drain task is still queued ride along with it, so an IO sequence
+// completing hundreds of requests per frame wakes the main thread once.
+class PromiseSettlementQueue {
+ public:
+  // Callable from any thread; |task| runs on the UI thread.
+  static void Enqueue(v8::Isolate* isolate, base::OnceClosure task);
+
+ private:
+  static void Drain();
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(PromiseSettlementQueue);
+};
+
 // A wrapper around the v8::Promise.
 //
 // This is a move-only type that should always be `std::move`d when passed to
@@ -55,8 +74,9 @@ class Promise {
 
   static void ResolvePromise(Promise<RT> promise, RT result) {
     if (!content::BrowserThread::CurrentlyOn(content::BrowserThread::UI)) {
-      base::PostTask(
-          FROM_HERE, {content::BrowserThread::UI},
+      v8::Isolate* isolate = promise.isolate();
+      PromiseSettlementQueue::Enqueue(
+          isolate,
           base::BindOnce([](Promise<RT> promise,
                             RT result) { promise.ResolveWithGin(result); },
                          std::move(promise), std::move(result)));
@@ -67,8 +87,9 @@ class Promise {
 
   static void ResolveEmptyPromise(Promise<RT> promise) {
     if (!content::BrowserThread::CurrentlyOn(content::BrowserThread::UI)) {
-      base::PostTask(
-          FROM_HERE, {content::BrowserThread::UI},
+      v8::Isolate* isolate = promise.isolate();
+      PromiseSettlementQueue::Enqueue(
+          isolate,
           base::BindOnce([](Promise<RT> promise) { promise.Resolve(); },
                          std::move(promise)));
     } else {
@@ -78,12 +99,13 @@ class Promise {
 
   static void RejectPromise(Promise<RT> promise, base::StringPiece errmsg) {
     if (!content::BrowserThread::CurrentlyOn(content::BrowserThread::UI)) {
-      base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                     base::BindOnce(
-                         [](Promise<RT> promise, base::StringPiece err) {
-                           promise.RejectWithErrorMessage(err);
-                         },
-                         std::move(promise), std::move(errmsg)));
+      v8::Isolate* isolate = promise.isolate();
+      PromiseSettlementQueue::Enqueue(
+          isolate, base::BindOnce(
+                       [](Promise<RT> promise, base::StringPiece err) {
+                         promise.RejectWithErrorMessage(err);
+                       },
+                       std::move(promise), std::move(errmsg)));
     } else {
       promise.RejectWithErrorMessage(errmsg);
     }
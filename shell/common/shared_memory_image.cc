@@ -0,0 +1,170 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/shared_memory_image.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "base/memory/ref_counted.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "ui/gfx/image/image_skia.h"
+#include "ui/gfx/image/image_skia_rep.h"
+
+namespace electron {
+
+namespace {
+
+// On-disk layout of a region: Header, then for each representation a
+// RepHeader followed by |row_bytes * height| bytes of N32 premultiplied
+// pixels. All fields are written by the same build on the same machine, so
+// no cross-endian concerns apply.
+struct Header {
+  uint32_t rep_count;
+};
+
+struct RepHeader {
+  float scale;
+  int32_t width;
+  int32_t height;
+  uint32_t row_bytes;
+};
+
+// Representations beyond this are not transferred; no real image comes
+// close.
+constexpr uint32_t kMaxReps = 16;
+
+// Keeps the mapping alive for as long as any bitmap references its pages.
+struct MappingHolder : public base::RefCountedThreadSafe<MappingHolder> {
+  explicit MappingHolder(base::ReadOnlySharedMemoryMapping mapping)
+      : mapping(std::move(mapping)) {}
+
+  base::ReadOnlySharedMemoryMapping mapping;
+
+ private:
+  friend class base::RefCountedThreadSafe<MappingHolder>;
+  ~MappingHolder() = default;
+};
+
+// Release proc installed on each bitmap; balances the AddRef taken before
+// installPixels.
+void ReleaseMapping(void* addr, void* context) {
+  static_cast<MappingHolder*>(context)->Release();
+}
+
+// Returns |bitmap| converted to N32 premultiplied, or an empty bitmap on
+// failure.
+SkBitmap ToN32(const SkBitmap& bitmap) {
+  if (bitmap.colorType() == kN32_SkColorType)
+    return bitmap;
+  SkBitmap converted;
+  SkImageInfo info =
+      SkImageInfo::MakeN32Premul(bitmap.width(), bitmap.height());
+  if (!converted.tryAllocPixels(info) ||
+      !bitmap.readPixels(converted.pixmap(), 0, 0)) {
+    return SkBitmap();
+  }
+  return converted;
+}
+
+}  // namespace
+
+base::ReadOnlySharedMemoryRegion WriteImageToSharedMemory(
+    const gfx::Image& image) {
+  if (image.IsEmpty())
+    return base::ReadOnlySharedMemoryRegion();
+
+  std::vector<SkBitmap> bitmaps;
+  std::vector<float> scales;
+  size_t total_size = sizeof(Header);
+  for (const gfx::ImageSkiaRep& rep : image.AsImageSkia().image_reps()) {
+    SkBitmap bitmap = ToN32(rep.GetBitmap());
+    if (bitmap.drawsNothing())
+      continue;
+    total_size += sizeof(RepHeader) + bitmap.computeByteSize();
+    bitmaps.push_back(bitmap);
+    scales.push_back(rep.scale());
+  }
+  if (bitmaps.empty() || bitmaps.size() > kMaxReps)
+    return base::ReadOnlySharedMemoryRegion();
+
+  base::MappedReadOnlyRegion mapped =
+      base::ReadOnlySharedMemoryRegion::Create(total_size);
+  if (!mapped.IsValid())
+    return base::ReadOnlySharedMemoryRegion();
+
+  char* out = static_cast<char*>(mapped.mapping.memory());
+  Header header = {static_cast<uint32_t>(bitmaps.size())};
+  memcpy(out, &header, sizeof(header));
+  out += sizeof(header);
+  for (size_t i = 0; i < bitmaps.size(); ++i) {
+    const SkBitmap& bitmap = bitmaps[i];
+    RepHeader rep_header = {scales[i], bitmap.width(), bitmap.height(),
+                            static_cast<uint32_t>(bitmap.rowBytes())};
+    memcpy(out, &rep_header, sizeof(rep_header));
+    out += sizeof(rep_header);
+    memcpy(out, bitmap.getPixels(), bitmap.computeByteSize());
+    out += bitmap.computeByteSize();
+  }
+  return std::move(mapped.region);
+}
+
+gfx::Image ReadImageFromSharedMemory(
+    base::ReadOnlySharedMemoryRegion region) {
+  if (!region.IsValid())
+    return gfx::Image();
+  base::ReadOnlySharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return gfx::Image();
+
+  const char* data = static_cast<const char*>(mapping.memory());
+  const size_t size = mapping.size();
+  if (size < sizeof(Header))
+    return gfx::Image();
+  Header header;
+  memcpy(&header, data, sizeof(header));
+  if (header.rep_count == 0 || header.rep_count > kMaxReps)
+    return gfx::Image();
+
+  auto holder = base::MakeRefCounted<MappingHolder>(std::move(mapping));
+  gfx::ImageSkia image_skia;
+  size_t offset = sizeof(Header);
+  for (uint32_t i = 0; i < header.rep_count; ++i) {
+    if (offset + sizeof(RepHeader) > size)
+      return gfx::Image();
+    RepHeader rep_header;
+    memcpy(&rep_header, data + offset, sizeof(rep_header));
+    offset += sizeof(rep_header);
+    if (rep_header.width <= 0 || rep_header.height <= 0 ||
+        rep_header.row_bytes < 4 * static_cast<uint32_t>(rep_header.width)) {
+      return gfx::Image();
+    }
+    const size_t pixel_bytes =
+        static_cast<size_t>(rep_header.row_bytes) * rep_header.height;
+    if (offset + pixel_bytes > size || offset + pixel_bytes < offset)
+      return gfx::Image();
+
+    SkImageInfo info =
+        SkImageInfo::MakeN32Premul(rep_header.width, rep_header.height);
+    SkBitmap bitmap;
+    // installPixels wants mutable pixels, but the pages are read-only;
+    // setImmutable below keeps Skia from ever writing through the pointer.
+    holder->AddRef();  // Balanced by ReleaseMapping.
+    if (!bitmap.installPixels(info,
+                              const_cast<char*>(data + offset),
+                              rep_header.row_bytes, &ReleaseMapping,
+                              holder.get())) {
+      holder->Release();
+      return gfx::Image();
+    }
+    bitmap.setImmutable();
+    image_skia.AddRepresentation(gfx::ImageSkiaRep(bitmap, rep_header.scale));
+    offset += pixel_bytes;
+  }
+  return gfx::Image(image_skia);
+}
+
+}  // namespace electron
@@ -0,0 +1,29 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_SHARED_MEMORY_IMAGE_H_
+#define SHELL_COMMON_SHARED_MEMORY_IMAGE_H_
+
+#include "base/memory/read_only_shared_memory_region.h"
+#include "ui/gfx/image/image.h"
+
+namespace electron {
+
+// Serializes every representation of |image| into one read-only shared
+// memory region, so images can cross a process boundary as a handle instead
+// of bytes. Returns an invalid region for empty images or on allocation
+// failure.
+base::ReadOnlySharedMemoryRegion WriteImageToSharedMemory(
+    const gfx::Image& image);
+
+// Rebuilds an image from a region produced by WriteImageToSharedMemory. The
+// bitmaps reference the mapped pages directly instead of copying them; they
+// are marked immutable, so Skia copies the pixels before any mutation. The
+// mapping stays alive until the last bitmap referencing it is destroyed.
+// Returns an empty image when the region is invalid or malformed.
+gfx::Image ReadImageFromSharedMemory(base::ReadOnlySharedMemoryRegion region);
+
+}  // namespace electron
+
+#endif  // SHELL_COMMON_SHARED_MEMORY_IMAGE_H_
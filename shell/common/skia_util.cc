@@ -5,6 +5,7 @@
 #include <string>
 
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
 #include "base/threading/thread_restrictions.h"
@@ -121,13 +122,24 @@ bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
 bool AddImageSkiaRepFromPath(gfx::ImageSkia* image,
                              const base::FilePath& path,
                              double scale_factor) {
-  std::string file_contents;
-  {
-    base::ThreadRestrictions::ScopedAllowIO allow_io;
-    if (!asar::ReadFileToString(path, &file_contents))
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  // Map plain files instead of reading them onto the heap; the decoder reads
+  // straight out of the page cache and the mapping goes away when this
+  // returns. Files inside asar archives still go through the archive reader.
+  base::FilePath asar_path, relative_path;
+  if (!asar::GetAsarArchivePath(path, &asar_path, &relative_path)) {
+    base::MemoryMappedFile mapped;
+    if (!mapped.Initialize(path) || mapped.length() == 0)
       return false;
+    return AddImageSkiaRepFromBuffer(image, mapped.data(), mapped.length(), 0,
+                                     0, scale_factor);
   }
 
+  std::string file_contents;
+  if (!asar::ReadFileToString(path, &file_contents))
+    return false;
+
   const unsigned char* data =
       reinterpret_cast<const unsigned char*>(file_contents.data());
   size_t size = file_contents.size();
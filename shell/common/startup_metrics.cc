@@ -0,0 +1,35 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/startup_metrics.h"
+
+#include <algorithm>
+
+#include "base/no_destructor.h"
+
+namespace electron {
+
+StartupMetrics::StartupMetrics() = default;
+
+StartupMetrics::~StartupMetrics() = default;
+
+// static
+StartupMetrics* StartupMetrics::Get() {
+  static base::NoDestructor<StartupMetrics> instance;
+  return instance.get();
+}
+
+void StartupMetrics::Record(const char* phase) {
+  size_t index = count_.fetch_add(1, std::memory_order_relaxed);
+  if (index >= kMaxSamples)
+    return;
+  samples_[index].phase = phase;
+  samples_[index].ticks = base::TimeTicks::Now();
+}
+
+size_t StartupMetrics::sample_count() const {
+  return std::min(count_.load(std::memory_order_relaxed), kMaxSamples);
+}
+
+}  // namespace electron
@@ -0,0 +1,51 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_STARTUP_METRICS_H_
+#define SHELL_COMMON_STARTUP_METRICS_H_
+
+#include <stddef.h>
+
+#include <atomic>
+
+#include "base/macros.h"
+#include "base/time/time.h"
+
+namespace electron {
+
+// Records monotonic timestamps for named startup phases into a fixed-size
+// table, so a cold start can be attributed across browser main-parts phases,
+// node initialization and environment load without tracing overhead. Record()
+// does no allocation; phase names must be string literals.
+class StartupMetrics {
+ public:
+  struct Sample {
+    const char* phase;
+    base::TimeTicks ticks;
+  };
+
+  static constexpr size_t kMaxSamples = 32;
+
+  static StartupMetrics* Get();
+
+  // Stamps |phase| with the current ticks. Samples past kMaxSamples are
+  // silently dropped.
+  void Record(const char* phase);
+
+  const Sample* samples() const { return samples_; }
+  size_t sample_count() const;
+
+ private:
+  StartupMetrics();
+  ~StartupMetrics();
+
+  Sample samples_[kMaxSamples];
+  std::atomic<size_t> count_{0};
+
+  DISALLOW_COPY_AND_ASSIGN(StartupMetrics);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_COMMON_STARTUP_METRICS_H_
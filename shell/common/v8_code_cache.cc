@@ -0,0 +1,149 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/v8_code_cache.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/post_task.h"
+#include "base/threading/thread_restrictions.h"
+#include "crypto/sha2.h"
+#include "shell/common/asar/asar_util.h"
+
+namespace electron {
+
+namespace util {
+
+namespace {
+
+const base::FilePath::CharType kCacheExtension[] =
+    FILE_PATH_LITERAL("v8cache");
+
+// Returns the path of the cache blob for a script with the given source
+// living at |script_path|, or an empty path when the script isn't inside
+// an asar archive.
+base::FilePath GetCodeCachePath(const base::FilePath& script_path,
+                                const std::string& source) {
+  base::FilePath asar_path, relative_path;
+  if (!asar::GetAsarArchivePath(script_path, &asar_path, &relative_path))
+    return base::FilePath();
+
+  std::string digest = crypto::SHA256HashString(source);
+  return asar_path.AddExtension(kCacheExtension)
+      .Append(base::FilePath::FromUTF8Unsafe(
+          base::HexEncode(digest.data(), digest.size())));
+}
+
+std::unique_ptr<v8::ScriptCompiler::CachedData> ReadCachedData(
+    const base::FilePath& cache_path) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  std::string data;
+  if (!base::ReadFileToString(cache_path, &data) || data.empty())
+    return nullptr;
+
+  auto* buffer = new uint8_t[data.size()];
+  memcpy(buffer, data.data(), data.size());
+  return std::make_unique<v8::ScriptCompiler::CachedData>(
+      buffer, data.size(), v8::ScriptCompiler::CachedData::BufferOwned);
+}
+
+// Persists a freshly produced cache blob; best effort, runs on the thread
+// pool so compilation never waits on the write.
+void WriteCachedDataOnWorkerThread(const base::FilePath& cache_path,
+                                   std::string data) {
+  if (!base::CreateDirectory(cache_path.DirName()))
+    return;
+  base::FilePath temp_path;
+  if (!base::CreateTemporaryFileInDir(cache_path.DirName(), &temp_path))
+    return;
+  if (base::WriteFile(temp_path, data.data(), data.size()) !=
+      static_cast<int>(data.size())) {
+    base::DeleteFile(temp_path, false);
+    return;
+  }
+  if (!base::ReplaceFile(temp_path, cache_path, nullptr))
+    base::DeleteFile(temp_path, false);
+}
+
+void PersistCodeCache(const base::FilePath& cache_path,
+                      v8::Local<v8::UnboundScript> unbound) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data(
+      v8::ScriptCompiler::CreateCodeCache(unbound));
+  if (!cached_data || !cached_data->data || cached_data->length == 0)
+    return;
+
+  std::string data(reinterpret_cast<const char*>(cached_data->data),
+                   cached_data->length);
+  base::PostTask(FROM_HERE,
+                 {base::ThreadPool(), base::MayBlock(),
+                  base::TaskPriority::BEST_EFFORT},
+                 base::BindOnce(&WriteCachedDataOnWorkerThread, cache_path,
+                                std::move(data)));
+}
+
+}  // namespace
+
+v8::MaybeLocal<v8::Value> RunScriptWithCodeCache(
+    v8::Local<v8::Context> context,
+    v8::Local<v8::String> source,
+    const base::FilePath& path) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::EscapableHandleScope handle_scope(isolate);
+
+  v8::String::Utf8Value utf8(isolate, source);
+  base::FilePath cache_path;
+  if (utf8.length() > 0) {
+    cache_path =
+        GetCodeCachePath(path, std::string(*utf8, utf8.length()));
+  }
+
+  v8::ScriptOrigin origin(v8::String::NewFromUtf8(
+                              isolate, path.AsUTF8Unsafe().c_str(),
+                              v8::NewStringType::kNormal)
+                              .ToLocalChecked());
+
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+  if (!cache_path.empty())
+    cached_data = ReadCachedData(cache_path);
+
+  v8::Local<v8::Script> script;
+  bool consumed_cache = false;
+  if (cached_data) {
+    // |Source| takes ownership of the cached data.
+    v8::ScriptCompiler::CachedData* data = cached_data.release();
+    v8::ScriptCompiler::Source script_source(source, origin, data);
+    if (v8::ScriptCompiler::Compile(context, &script_source,
+                                    v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocal(&script)) {
+      // V8 rejects caches produced by a different version or flags; fall
+      // through and overwrite the blob below.
+      consumed_cache = !data->rejected;
+    } else {
+      return v8::MaybeLocal<v8::Value>();
+    }
+  } else {
+    v8::ScriptCompiler::Source script_source(source, origin);
+    if (!v8::ScriptCompiler::Compile(context, &script_source)
+             .ToLocal(&script)) {
+      return v8::MaybeLocal<v8::Value>();
+    }
+  }
+
+  if (!consumed_cache && !cache_path.empty())
+    PersistCodeCache(cache_path, script->GetUnboundScript());
+
+  v8::Local<v8::Value> result;
+  if (!script->Run(context).ToLocal(&result))
+    return v8::MaybeLocal<v8::Value>();
+  return handle_scope.Escape(result);
+}
+
+}  // namespace util
+
+}  // namespace electron
@@ -0,0 +1,31 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_COMMON_V8_CODE_CACHE_H_
+#define SHELL_COMMON_V8_CODE_CACHE_H_
+
+#include "base/files/file_path.h"
+#include "v8/include/v8.h"
+
+namespace electron {
+
+namespace util {
+
+// Compiles and runs |source| (loaded from |path|) with a persistent V8
+// code cache. For scripts inside an asar archive the cache blob lives in
+// a "<archive>.v8cache" sidecar directory, keyed by the SHA-256 of the
+// source so stale entries never match; cache misses compile normally and
+// persist the blob from a background task. Scripts outside an archive
+// are compiled without caching. The returned value is empty if an
+// exception is encountered.
+v8::MaybeLocal<v8::Value> RunScriptWithCodeCache(
+    v8::Local<v8::Context> context,
+    v8::Local<v8::String> source,
+    const base::FilePath& path);
+
+}  // namespace util
+
+}  // namespace electron
+
+#endif  // SHELL_COMMON_V8_CODE_CACHE_H_
@@ -361,8 +361,12 @@ std::unique_ptr<base::Value> V8ValueConverter::FromV8ValueImpl(
     return FromV8Object(val.As<v8::Object>(), state, isolate);
   }
 
-  if (node::Buffer::HasInstance(val)) {
-    return FromNodeBuffer(val, state, isolate);
+  // Binary payloads (node Buffers, ArrayBuffers and views) transfer as blob
+  // storage in bulk; without this, plain ArrayBuffers would fall through to
+  // FromV8Object and get converted property by property.
+  if (node::Buffer::HasInstance(val) || val->IsArrayBuffer() ||
+      val->IsArrayBufferView()) {
+    return FromArrayBuffer(val, isolate);
   }
 
   if (val->IsObject()) {
@@ -388,7 +392,10 @@ std::unique_ptr<base::Value> V8ValueConverter::FromV8Array(
       val->CreationContext() != isolate->GetCurrentContext())
     scope = std::make_unique<v8::Context::Scope>(val->CreationContext());
 
-  std::unique_ptr<base::ListValue> result(new base::ListValue());
+  // Reserve the final size up front; large IPC payloads otherwise grow the
+  // backing store repeatedly, one element at a time.
+  base::Value::ListStorage storage;
+  storage.reserve(val->Length());
 
   // Only fields with integer keys are carried over to the ListValue.
   for (uint32_t i = 0; i < val->Length(); ++i) {
@@ -403,30 +410,45 @@ std::unique_ptr<base::Value> V8ValueConverter::FromV8Array(
 
     if (!val->HasRealIndexedProperty(isolate->GetCurrentContext(), i)
              .FromMaybe(false)) {
-      result->Append(std::make_unique<base::Value>());
+      storage.emplace_back();
       continue;
     }
 
     std::unique_ptr<base::Value> child =
         FromV8ValueImpl(state, child_v8, isolate);
     if (child)
-      result->Append(std::move(child));
+      storage.push_back(std::move(*child));
     else
       // JSON.stringify puts null in places where values don't serialize, for
       // example undefined and functions. Emulate that behavior.
-      result->Append(std::make_unique<base::Value>());
+      storage.emplace_back();
   }
-  return std::move(result);
+  return std::make_unique<base::Value>(std::move(storage));
 }
 
-std::unique_ptr<base::Value> V8ValueConverter::FromNodeBuffer(
+std::unique_ptr<base::Value> V8ValueConverter::FromArrayBuffer(
     v8::Local<v8::Value> value,
-    FromV8ValueState* state,
     v8::Isolate* isolate) const {
-  std::vector<char> buffer(
-      node::Buffer::Data(value),
-      node::Buffer::Data(value) + node::Buffer::Length(value));
-  return std::make_unique<base::Value>(std::move(buffer));
+  const char* data = nullptr;
+  size_t length = 0;
+  if (value->IsArrayBuffer()) {
+    auto contents = value.As<v8::ArrayBuffer>()->GetContents();
+    data = static_cast<const char*>(contents.Data());
+    length = contents.ByteLength();
+  } else if (value->IsArrayBufferView()) {
+    v8::Local<v8::ArrayBufferView> view = value.As<v8::ArrayBufferView>();
+    auto contents = view->Buffer()->GetContents();
+    data = static_cast<const char*>(contents.Data()) + view->ByteOffset();
+    length = view->ByteLength();
+  } else {
+    data = node::Buffer::Data(value);
+    length = node::Buffer::Length(value);
+  }
+  // A base::Value blob owns its storage, so one bulk copy of the backing
+  // store is unavoidable; what this path avoids is walking the buffer as an
+  // object graph, element by element.
+  return std::make_unique<base::Value>(
+      base::Value::BlobStorage(data, data + length));
 }
 
 std::unique_ptr<base::Value> V8ValueConverter::FromV8Object(
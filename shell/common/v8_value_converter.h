@@ -52,9 +52,8 @@ class V8ValueConverter {
   std::unique_ptr<base::Value> FromV8Array(v8::Local<v8::Array> array,
                                            FromV8ValueState* state,
                                            v8::Isolate* isolate) const;
-  std::unique_ptr<base::Value> FromNodeBuffer(v8::Local<v8::Value> value,
-                                              FromV8ValueState* state,
-                                              v8::Isolate* isolate) const;
+  std::unique_ptr<base::Value> FromArrayBuffer(v8::Local<v8::Value> value,
+                                               v8::Isolate* isolate) const;
   std::unique_ptr<base::Value> FromV8Object(v8::Local<v8::Object> object,
                                             FromV8ValueState* state,
                                             v8::Isolate* isolate) const;
@@ -0,0 +1,105 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/v8_value_converter.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "base/values.h"
+#include "gin/test/v8_test.h"
+#include "native_mate/converter.h"
+#include "testing/perf/perf_test.h"
+
+namespace electron {
+
+namespace {
+
+const int kIterations = 1000;
+
+// Builds a payload shaped like a typical structured ipc message: a dict
+// of scalars plus a list of small dicts.
+base::Value BuildTestPayload() {
+  base::Value payload(base::Value::Type::DICTIONARY);
+  payload.SetStringKey("channel", "ELECTRON_INTERNAL_RENDERER_MESSAGE");
+  payload.SetIntKey("senderId", 42);
+  payload.SetBoolKey("internal", false);
+  base::Value items(base::Value::Type::LIST);
+  for (int i = 0; i < 32; ++i) {
+    base::Value item(base::Value::Type::DICTIONARY);
+    item.SetIntKey("id", i);
+    item.SetStringKey("name", base::StringPrintf("item-%d", i));
+    item.SetDoubleKey("weight", i * 0.5);
+    items.GetList().push_back(std::move(item));
+  }
+  payload.SetKey("items", std::move(items));
+  return payload;
+}
+
+}  // namespace
+
+using V8ValueConverterPerfTest = gin::V8Test;
+
+// Round-trips a structured payload through the converter both IPC
+// directions take: base::Value -> V8 on delivery, V8 -> base::Value on
+// send.
+TEST_F(V8ValueConverterPerfTest, RoundTrip) {
+  v8::Isolate* isolate = instance_->isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context =
+      v8::Local<v8::Context>::New(isolate, context_);
+  v8::Context::Scope context_scope(context);
+
+  base::Value payload = BuildTestPayload();
+  V8ValueConverter converter;
+
+  base::ElapsedTimer to_v8_timer;
+  v8::Local<v8::Value> v8_value;
+  for (int i = 0; i < kIterations; ++i)
+    v8_value = converter.ToV8Value(&payload, context);
+  perf_test::PrintResult("v8_value_converter", "", "to_v8",
+                         to_v8_timer.Elapsed().InMicrosecondsF() / kIterations,
+                         "us/convert", true);
+
+  base::ElapsedTimer from_v8_timer;
+  std::unique_ptr<base::Value> round_tripped;
+  for (int i = 0; i < kIterations; ++i)
+    round_tripped = converter.FromV8Value(v8_value, context);
+  perf_test::PrintResult(
+      "v8_value_converter", "", "from_v8",
+      from_v8_timer.Elapsed().InMicrosecondsF() / kIterations, "us/convert",
+      true);
+
+  ASSERT_TRUE(round_tripped);
+  EXPECT_EQ(payload, *round_tripped);
+}
+
+// mate::Converter handles every argument crossing a native binding, so
+// scalar and vector conversion speed is on the hot path of all apis.
+TEST_F(V8ValueConverterPerfTest, MateConverterRoundTrip) {
+  v8::Isolate* isolate = instance_->isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context =
+      v8::Local<v8::Context>::New(isolate, context_);
+  v8::Context::Scope context_scope(context);
+
+  std::vector<std::string> strings;
+  for (int i = 0; i < 64; ++i)
+    strings.push_back(base::StringPrintf("argument-%d", i));
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kIterations; ++i) {
+    v8::Local<v8::Value> v8_value = mate::ConvertToV8(isolate, strings);
+    std::vector<std::string> out;
+    ASSERT_TRUE(mate::ConvertFromV8(isolate, v8_value, &out));
+  }
+  perf_test::PrintResult("mate_converter", "", "string_vector_round_trip",
+                         timer.Elapsed().InMicrosecondsF() / kIterations,
+                         "us/round-trip", true);
+}
+
+}  // namespace electron
@@ -160,6 +160,15 @@ v8::MaybeLocal<v8::Value> PassValueToOtherContext(
       return v8::MaybeLocal<v8::Value>();
     }
   }
+  // Primitives pass between contexts as-is: strings, numbers, booleans, null
+  // and undefined are isolate-level values with no context-dependent state,
+  // so they need neither proxying nor cloning. Without this fast path every
+  // primitive argument pays a full V8 serializer round-trip below.
+  if (value->IsNullOrUndefined() || value->IsBoolean() || value->IsNumber() ||
+      value->IsString()) {
+    return v8::MaybeLocal<v8::Value>(value);
+  }
+
   // Check Cache
   auto cached_value = store->GetCachedProxiedObject(value);
   if (!cached_value.IsEmpty()) {
@@ -2,8 +2,12 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/bind.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
 #include "content/public/renderer/render_frame.h"
@@ -12,12 +16,15 @@
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/gin_converters/blink_converter.h"
+#include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/promise_util.h"
+#include "shell/common/shared_memory_image.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 
 using blink::WebLocalFrame;
@@ -42,7 +49,11 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
   }
 
   explicit IPCRenderer(v8::Isolate* isolate)
-      : task_runner_(base::CreateSingleThreadTaskRunner({base::ThreadPool()})) {
+      // USER_BLOCKING: the renderer main thread blocks on replies pumped by
+      // this runner (see SendSync), so any scheduling delay here is added
+      // directly to the sendSync round trip.
+      : task_runner_(base::CreateSingleThreadTaskRunner(
+            {base::ThreadPool(), base::TaskPriority::USER_BLOCKING})) {
     RenderFrame* render_frame = GetCurrentRenderFrame();
     DCHECK(render_frame);
 
@@ -64,7 +75,8 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
         .SetMethod("sendSync", &IPCRenderer::SendSync)
         .SetMethod("sendTo", &IPCRenderer::SendTo)
         .SetMethod("sendToHost", &IPCRenderer::SendToHost)
-        .SetMethod("invoke", &IPCRenderer::Invoke);
+        .SetMethod("invoke", &IPCRenderer::Invoke)
+        .SetMethod("takeSharedImage", &IPCRenderer::TakeSharedImage);
   }
 
   const char* GetTypeName() override { return "IPCRenderer"; }
@@ -74,30 +86,90 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
             bool internal,
             const std::string& channel,
             v8::Local<v8::Value> arguments) {
-    blink::CloneableMessage message;
+    mojo_base::BigBuffer message;
     if (!gin::ConvertFromV8(isolate, arguments, &message)) {
       return;
     }
-    electron_browser_ptr_->get()->Message(internal, channel,
-                                          std::move(message));
+    // Sends are not dispatched immediately; they're queued and flushed at the
+    // end of the current microtask checkpoint so that a burst of send() calls
+    // from one JS tick crosses the channel as a single MessageBatch() and is
+    // emitted browser-side in a single task. Methods that must observe
+    // ordering with respect to these sends (SendSync, Invoke, ...) flush the
+    // queue before dispatching.
+    if (pending_messages_.empty()) {
+      isolate->EnqueueMicrotask(&IPCRenderer::FlushPendingMessagesMicrotask,
+                                this);
+    }
+    pending_messages_.push_back(electron::mojom::IpcMessage::New(
+        internal, channel, std::move(message)));
+  }
+
+  static void FlushPendingMessagesMicrotask(void* self) {
+    // |self| stays alive for the lifetime of the context; the microtask runs
+    // within the same checkpoint as the Send() that enqueued it.
+    static_cast<IPCRenderer*>(self)->FlushPendingMessages();
+  }
+
+  void FlushPendingMessages() {
+    if (pending_messages_.empty())
+      return;
+    if (pending_messages_.size() == 1) {
+      // Don't pay the array framing for the common single-message case.
+      auto message = std::move(pending_messages_.front());
+      pending_messages_.clear();
+      electron_browser_ptr_->get()->Message(message->internal,
+                                            message->channel,
+                                            std::move(message->arguments));
+      return;
+    }
+    electron_browser_ptr_->get()->MessageBatch(std::move(pending_messages_));
+    pending_messages_.clear();
   }
 
   v8::Local<v8::Promise> Invoke(v8::Isolate* isolate,
                                 bool internal,
                                 const std::string& channel,
                                 v8::Local<v8::Value> arguments) {
-    blink::CloneableMessage message;
+    mojo_base::BigBuffer message;
     if (!gin::ConvertFromV8(isolate, arguments, &message)) {
       return v8::Local<v8::Promise>();
     }
-    electron::util::Promise<blink::CloneableMessage> p(isolate);
+    FlushPendingMessages();
+    electron::util::Promise<mojo_base::BigBuffer> p(isolate);
     auto handle = p.GetHandle();
 
     electron_browser_ptr_->get()->Invoke(
         internal, channel, std::move(message),
         base::BindOnce(
-            [](electron::util::Promise<blink::CloneableMessage> p,
-               blink::CloneableMessage result) { p.ResolveWithGin(result); },
+            [](electron::util::Promise<mojo_base::BigBuffer> p,
+               mojo_base::BigBuffer result) { p.ResolveWithGin(result); },
+            std::move(p)));
+
+    return handle;
+  }
+
+  // Claims a NativeImage exported in the browser process with
+  // _exportForSharedTransfer(). The pixels arrive as a read-only shared
+  // memory region and the resulting image references the mapped pages
+  // directly, so no pixel bytes cross the channel or get copied here.
+  v8::Local<v8::Promise> TakeSharedImage(v8::Isolate* isolate,
+                                         const std::string& image_id) {
+    FlushPendingMessages();
+    electron::util::Promise<gfx::Image> p(isolate);
+    auto handle = p.GetHandle();
+
+    electron_browser_ptr_->get()->TakeSharedImage(
+        image_id,
+        base::BindOnce(
+            [](electron::util::Promise<gfx::Image> p,
+               base::ReadOnlySharedMemoryRegion region) {
+              gfx::Image image =
+                  electron::ReadImageFromSharedMemory(std::move(region));
+              if (image.IsEmpty())
+                p.RejectWithErrorMessage("Could not read shared image");
+              else
+                p.ResolveWithGin(image);
+            },
             std::move(p)));
 
     return handle;
@@ -109,32 +181,74 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
               int32_t web_contents_id,
               const std::string& channel,
               v8::Local<v8::Value> arguments) {
-    blink::CloneableMessage message;
+    mojo_base::BigBuffer message;
     if (!gin::ConvertFromV8(isolate, arguments, &message)) {
       return;
     }
-    electron_browser_ptr_->get()->MessageTo(
-        internal, send_to_all, web_contents_id, channel, std::move(message));
+    FlushPendingMessages();
+    // A direct pipe only reaches the target's main frame, so send_to_all
+    // still goes through the browser relay, which fans out to all frames.
+    if (send_to_all) {
+      electron_browser_ptr_->get()->MessageTo(
+          internal, send_to_all, web_contents_id, channel, std::move(message));
+      return;
+    }
+    // Brokered direct channel: on first use ask the browser to hand the
+    // target renderer the other end of a peer pipe, then pipeline this and
+    // all subsequent messages on it. Mojo queues messages sent on a
+    // not-yet-bound pipe, so nothing waits on the broker round trip, and
+    // ordering is preserved per target. If the target doesn't exist or goes
+    // away, the entry is dropped and the next sendTo re-brokers; messages in
+    // flight are lost, just as with the browser relay.
+    auto iter = peer_channels_.find(web_contents_id);
+    if (iter == peer_channels_.end()) {
+      electron::mojom::ElectronPeerPtr peer;
+      electron_browser_ptr_->get()->CreateDirectChannel(
+          web_contents_id, mojo::MakeRequest(&peer),
+          base::BindOnce(&IPCRenderer::OnDirectChannelCreated,
+                         base::Unretained(this), web_contents_id));
+      // Unretained is safe: the error handler cannot run after the
+      // InterfacePtr it is attached to is destroyed, and the map member dies
+      // with |this|.
+      peer.set_connection_error_handler(
+          base::BindOnce(&IPCRenderer::OnDirectChannelError,
+                         base::Unretained(this), web_contents_id));
+      iter = peer_channels_.emplace(web_contents_id, std::move(peer)).first;
+    }
+    iter->second->Message(internal, channel, std::move(message));
+  }
+
+  // Runs on this (main) thread: the thread-safe pointer posts responses back
+  // to the sequence that issued the call.
+  void OnDirectChannelCreated(int32_t web_contents_id, bool success) {
+    if (!success)
+      peer_channels_.erase(web_contents_id);
+  }
+
+  void OnDirectChannelError(int32_t web_contents_id) {
+    peer_channels_.erase(web_contents_id);
   }
 
   void SendToHost(v8::Isolate* isolate,
                   const std::string& channel,
                   v8::Local<v8::Value> arguments) {
-    blink::CloneableMessage message;
+    mojo_base::BigBuffer message;
     if (!gin::ConvertFromV8(isolate, arguments, &message)) {
       return;
     }
+    FlushPendingMessages();
     electron_browser_ptr_->get()->MessageHost(channel, std::move(message));
   }
 
-  blink::CloneableMessage SendSync(v8::Isolate* isolate,
+  mojo_base::BigBuffer SendSync(v8::Isolate* isolate,
                                    bool internal,
                                    const std::string& channel,
                                    v8::Local<v8::Value> arguments) {
-    blink::CloneableMessage message;
+    mojo_base::BigBuffer message;
     if (!gin::ConvertFromV8(isolate, arguments, &message)) {
-      return blink::CloneableMessage();
+      return mojo_base::BigBuffer();
     }
+    FlushPendingMessages();
     // We aren't using a true synchronous mojo call here. We're calling an
     // asynchronous method and blocking on the result. The reason we're doing
     // this is a little complicated, so buckle up.
@@ -181,7 +295,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
     //
     // Phew. If you got this far, here's a gold star: ⭐️
 
-    blink::CloneableMessage result;
+    mojo_base::BigBuffer result;
 
     // A task is posted to a worker thread to execute the request so that
     // this thread may block on a waitable event. It is safe to pass raw
@@ -200,10 +314,10 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
   }
 
   void SendMessageSyncOnWorkerThread(base::WaitableEvent* event,
-                                     blink::CloneableMessage* result,
+                                     mojo_base::BigBuffer* result,
                                      bool internal,
                                      const std::string& channel,
-                                     blink::CloneableMessage arguments) {
+                                     mojo_base::BigBuffer arguments) {
     electron_browser_ptr_->get()->MessageSync(
         internal, channel, std::move(arguments),
         base::BindOnce(&IPCRenderer::ReturnSyncResponseToMainThread,
@@ -211,8 +325,8 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
   }
 
   static void ReturnSyncResponseToMainThread(base::WaitableEvent* event,
-                                             blink::CloneableMessage* result,
-                                             blink::CloneableMessage response) {
+                                             mojo_base::BigBuffer* result,
+                                             mojo_base::BigBuffer response) {
     *result = std::move(response);
     event->Signal();
   }
@@ -220,6 +334,13 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer> {
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   scoped_refptr<electron::mojom::ThreadSafeElectronBrowserPtr>
       electron_browser_ptr_;
+
+  // Messages queued by Send() awaiting the end-of-checkpoint flush.
+  std::vector<electron::mojom::IpcMessagePtr> pending_messages_;
+
+  // Direct sendTo pipes keyed by target WebContents ID, bound on this (main)
+  // thread and brokered lazily by the browser.
+  std::map<int32_t, electron::mojom::ElectronPeerPtr> peer_channels_;
 };
 
 gin::WrapperInfo IPCRenderer::kWrapperInfo = {gin::kEmbedderNativeGin};
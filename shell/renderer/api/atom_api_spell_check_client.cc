@@ -47,6 +47,11 @@ struct Word {
   std::vector<base::string16> contraction_words;
 };
 
+// Upper bound for |correct_word_cache_|; the cache is dropped wholesale when
+// it fills up, which is simpler than an eviction policy and still keeps the
+// working set of a typing session resident.
+constexpr size_t kMaxCachedWords = 8192;
+
 }  // namespace
 
 class SpellCheckClient::SpellcheckRequest {
@@ -182,6 +187,21 @@ void SpellCheckClient::SpellCheckText() {
     }
   }
 
+  // Words the provider has already accepted don't need another JS call;
+  // only the residue is sent.
+  for (auto it = words.begin(); it != words.end();) {
+    if (correct_word_cache_.count(*it) > 0)
+      it = words.erase(it);
+    else
+      ++it;
+  }
+
+  if (words.empty()) {
+    // Everything was known-good; complete without entering JS at all.
+    OnSpellCheckDone(std::vector<base::string16>());
+    return;
+  }
+
   // Send out all the words data to the spellchecker to check
   SpellCheckWords(scope, words);
 }
@@ -206,16 +226,29 @@ void SpellCheckClient::OnSpellCheckDone(
             break;
           }
         }
-        if (all_correct)
+        if (all_correct) {
+          CacheCorrectWord(word.text);
           continue;
+        }
       }
       results.push_back(word.result);
+    } else {
+      CacheCorrectWord(word.text);
     }
   }
   pending_request_param_->completion()->DidFinishCheckingText(results);
   pending_request_param_ = nullptr;
 }
 
+void SpellCheckClient::CacheCorrectWord(const base::string16& word) {
+  // Misspelled words are deliberately not cached: the provider may start
+  // accepting them later (e.g. after a custom dictionary addition), while
+  // a word once accepted stays correct for this client's language.
+  if (correct_word_cache_.size() >= kMaxCachedWords)
+    correct_word_cache_.clear();
+  correct_word_cache_.insert(word);
+}
+
 void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
                                        const std::set<base::string16>& words) {
   DCHECK(!scope.spell_check_.IsEmpty());
@@ -8,6 +8,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "base/callback.h"
@@ -82,6 +83,9 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // Callback for the JS API which returns the list of misspelled words.
   void OnSpellCheckDone(const std::vector<base::string16>& misspelled_words);
 
+  // Records a word the provider accepted, keeping the cache bounded.
+  void CacheCorrectWord(const base::string16& word);
+
   // Represents character attributes used for filtering out characters which
   // are not supported by this SpellCheck object.
   SpellcheckCharAttribute character_attributes_;
@@ -99,6 +103,13 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
 
+  // Words the provider has already accepted. Each keystroke re-checks the
+  // surrounding text, so without this cache every word crosses into JS on
+  // every keypress; with it only words not seen before are sent, and a
+  // request made entirely of known-good words completes without calling
+  // the provider at all.
+  std::unordered_set<base::string16> correct_word_cache_;
+
   v8::Isolate* isolate_;
   v8::Global<v8::Context> context_;
   v8::Global<v8::Object> provider_;
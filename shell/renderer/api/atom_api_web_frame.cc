@@ -19,6 +19,7 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/promise_util.h"
 #include "shell/renderer/api/atom_api_spell_check_client.h"
+#include "shell/renderer/zoom_level_cache.h"
 #include "third_party/blink/public/common/page/page_zoom.h"
 #include "third_party/blink/public/common/web_cache/web_cache_resource_type_stats.h"
 #include "third_party/blink/public/platform/web_cache.h"
@@ -241,10 +242,16 @@ void SetZoomLevel(v8::Local<v8::Value> window, double level) {
 double GetZoomLevel(v8::Local<v8::Value> window) {
   double result = 0.0;
   content::RenderFrame* render_frame = GetRenderFrame(window);
+  // The browser pushes zoom changes through ZoomLevelChanged(), so reads
+  // are usually served locally; only the first read after a view is
+  // created or navigated pays the synchronous round-trip.
+  if (ZoomLevelCache::Get(render_frame, &result))
+    return result;
   mojom::ElectronBrowserPtr browser_ptr;
   render_frame->GetRemoteInterfaces()->GetInterface(
       mojo::MakeRequest(&browser_ptr));
   browser_ptr->DoGetZoomLevel(&result);
+  ZoomLevelCache::Set(render_frame, result);
   return result;
 }
 
@@ -334,13 +341,16 @@ void SetSpellCheckProvider(gin_helper::Arguments* args,
   new SpellCheckerHolder(render_frame, std::move(spell_check_client));
 }
 
-void InsertText(v8::Local<v8::Value> window, const std::string& text) {
+// Takes the text as UTF-16: both V8 and Blink store strings as UTF-16, so
+// converting through UTF-8 here cost two transcodes and an extra copy for
+// large (e.g. synthetic-input) payloads.
+void InsertText(v8::Local<v8::Value> window, const base::string16& text) {
   blink::WebFrame* web_frame = GetRenderFrame(window)->GetWebFrame();
   if (web_frame->IsWebLocalFrame()) {
     web_frame->ToWebLocalFrame()
         ->FrameWidget()
         ->GetActiveWebInputMethodController()
-        ->CommitText(blink::WebString::FromUTF8(text),
+        ->CommitText(blink::WebString::FromUTF16(text),
                      blink::WebVector<blink::WebImeTextSpan>(),
                      blink::WebRange(), 0);
   }
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/time/time.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_view.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
@@ -25,6 +26,11 @@ namespace {
 const size_t kMaxDataLength = 1024;
 const size_t kMaxListSize = 512;
 
+// Keystrokes inside this interval keep restarting the suggestion timer,
+// so the popup query runs once per typing pause instead of per keystroke.
+constexpr base::TimeDelta kTypingPauseInterval =
+    base::TimeDelta::FromMilliseconds(100);
+
 void GetDataListSuggestions(const blink::WebInputElement& element,
                             std::vector<base::string16>* values,
                             std::vector<base::string16>* labels) {
@@ -98,7 +104,20 @@ void AutofillAgent::TextFieldDidChangeImpl(
     const blink::WebFormControlElement& element) {
   ShowSuggestionsOptions options;
   options.requires_caret_at_end = true;
-  ShowSuggestions(element, options);
+  pending_element_ = element;
+  pending_options_ = options;
+  show_suggestions_timer_.Start(
+      FROM_HERE, kTypingPauseInterval,
+      base::BindOnce(&AutofillAgent::FlushPendingSuggestions,
+                     base::Unretained(this)));
+}
+
+void AutofillAgent::FlushPendingSuggestions() {
+  if (pending_element_.IsNull())
+    return;
+  blink::WebFormControlElement element = pending_element_;
+  pending_element_.Reset();
+  ShowSuggestions(element, pending_options_);
 }
 
 void AutofillAgent::TextFieldDidReceiveKeyDown(
@@ -135,6 +154,11 @@ AutofillAgent::ShowSuggestionsOptions::ShowSuggestionsOptions()
 
 void AutofillAgent::ShowSuggestions(const blink::WebFormControlElement& element,
                                     const ShowSuggestionsOptions& options) {
+  // A direct request (focus, arrow keys, datalist chooser) supersedes any
+  // update still waiting on the typing-pause timer.
+  show_suggestions_timer_.Stop();
+  pending_element_.Reset();
+
   if (!element.IsEnabled() || element.IsReadOnly())
     return;
   const blink::WebInputElement* input_element = ToWebInputElement(&element);
@@ -180,6 +204,13 @@ bool AutofillAgent::IsUserGesture() const {
 }
 
 void AutofillAgent::HidePopup() {
+  show_suggestions_timer_.Stop();
+  pending_element_.Reset();
+  if (!popup_shown_)
+    return;
+  popup_shown_ = false;
+  last_popup_values_.clear();
+  last_popup_labels_.clear();
   GetAutofillDriver()->HideAutofillPopup();
 }
 
@@ -187,6 +218,16 @@ void AutofillAgent::ShowPopup(const blink::WebFormControlElement& element,
                               const std::vector<base::string16>& values,
                               const std::vector<base::string16>& labels) {
   gfx::RectF bounds = render_frame()->ElementBoundsInWindow(element);
+  // Skip the message when nothing observable changed; narrowing
+  // keystrokes that keep the same filtered set cost no IPC at all.
+  if (popup_shown_ && bounds == last_popup_bounds_ &&
+      values == last_popup_values_ && labels == last_popup_labels_) {
+    return;
+  }
+  popup_shown_ = true;
+  last_popup_bounds_ = bounds;
+  last_popup_values_ = values;
+  last_popup_labels_ = labels;
   GetAutofillDriver()->ShowAutofillPopup(bounds, values, labels);
 }
 
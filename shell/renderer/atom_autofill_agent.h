@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/timer/timer.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "mojo/public/cpp/bindings/associated_receiver.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -18,6 +19,7 @@
 #include "third_party/blink/public/web/web_element.h"
 #include "third_party/blink/public/web/web_form_control_element.h"
 #include "third_party/blink/public/web/web_input_element.h"
+#include "ui/gfx/geometry/rect_f.h"
 
 namespace electron {
 
@@ -68,6 +70,10 @@ class AutofillAgent : public content::RenderFrameObserver,
   void ShowSuggestions(const blink::WebFormControlElement& element,
                        const ShowSuggestionsOptions& options);
 
+  // Runs the ShowSuggestions() deferred by the typing-pause debounce in
+  // TextFieldDidChangeImpl().
+  void FlushPendingSuggestions();
+
   void DoFocusChangeComplete();
 
   const mojo::AssociatedRemote<mojom::ElectronAutofillDriver>&
@@ -84,6 +90,19 @@ class AutofillAgent : public content::RenderFrameObserver,
 
   mojo::AssociatedReceiver<mojom::ElectronAutofillAgent> receiver_{this};
 
+  // Keystroke-driven suggestion updates are deferred until typing pauses;
+  // each change restarts the timer on the stored element.
+  base::OneShotTimer show_suggestions_timer_;
+  blink::WebFormControlElement pending_element_;
+  ShowSuggestionsOptions pending_options_;
+
+  // The popup state last sent to the browser, used to drop hide messages
+  // while no popup is showing and show messages that change nothing.
+  bool popup_shown_ = false;
+  gfx::RectF last_popup_bounds_;
+  std::vector<base::string16> last_popup_values_;
+  std::vector<base::string16> last_popup_labels_;
+
   base::WeakPtrFactory<AutofillAgent> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(AutofillAgent);
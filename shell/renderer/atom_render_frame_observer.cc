@@ -8,8 +8,10 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_view.h"
@@ -41,6 +43,37 @@ scoped_refptr<base::RefCountedMemory> NetResourceProvider(int key) {
   return nullptr;
 }
 
+// Observer that forwards near-heap-limit triggers to its WebContents; reset
+// when it is destroyed so the next main frame's observer takes over.
+AtomRenderFrameObserver* g_heap_limit_observer = nullptr;
+
+// Whether the process-wide V8 callback has been installed.
+bool g_heap_limit_callback_installed = false;
+
+// Whether the one-time headroom grant has been used.
+bool g_heap_limit_raised = false;
+
+void NotifyHeapNearLimit(size_t heap_limit) {
+  if (g_heap_limit_observer)
+    g_heap_limit_observer->SendHeapNearLimit(heap_limit);
+}
+
+// Called by V8 during GC when the heap approaches its limit. Nothing may
+// allocate or run JS here, so the notification is deferred to a clean task.
+size_t NearHeapLimitCallback(void* data,
+                             size_t current_heap_limit,
+                             size_t initial_heap_limit) {
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&NotifyHeapNearLimit, current_heap_limit));
+  // Grant one quarter of the initial limit as headroom the first time, so
+  // the app gets a chance to shed load before V8 aborts the process.
+  if (!g_heap_limit_raised) {
+    g_heap_limit_raised = true;
+    return current_heap_limit + initial_heap_limit / 4;
+  }
+  return current_heap_limit;
+}
+
 }  // namespace
 
 AtomRenderFrameObserver::AtomRenderFrameObserver(
@@ -48,9 +81,22 @@ AtomRenderFrameObserver::AtomRenderFrameObserver(
     RendererClientBase* renderer_client)
     : content::RenderFrameObserver(frame),
       render_frame_(frame),
-      renderer_client_(renderer_client) {
+      renderer_client_(renderer_client),
+      weak_factory_(this) {
   // Initialise resource for directory listing.
   net::NetModule::SetResourceProvider(NetResourceProvider);
+
+  // The near-heap-limit callback is per-isolate, so the first main frame's
+  // observer installs it and forwards triggers to its WebContents.
+  if (frame->IsMainFrame()) {
+    if (!g_heap_limit_observer)
+      g_heap_limit_observer = this;
+    if (!g_heap_limit_callback_installed) {
+      g_heap_limit_callback_installed = true;
+      blink::MainThreadIsolate()->AddNearHeapLimitCallback(
+          &NearHeapLimitCallback, nullptr);
+    }
+  }
 }
 
 void AtomRenderFrameObserver::DidClearWindowObject() {
@@ -99,6 +145,19 @@ void AtomRenderFrameObserver::DidCreateScriptContext(
 }
 
 void AtomRenderFrameObserver::DraggableRegionsChanged() {
+  // Layout bursts (navigation, style recalc storms) fire this several times
+  // per task, and only the latest regions matter, so conflate the
+  // notifications into one browser message per burst.
+  if (draggable_regions_update_pending_)
+    return;
+  draggable_regions_update_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&AtomRenderFrameObserver::SendDraggableRegions,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void AtomRenderFrameObserver::SendDraggableRegions() {
+  draggable_regions_update_pending_ = false;
   blink::WebVector<blink::WebDraggableRegion> webregions =
       render_frame_->GetWebFrame()->GetDocument().DraggableRegions();
   std::vector<mojom::DraggableRegionPtr> regions;
@@ -110,10 +169,28 @@ void AtomRenderFrameObserver::DraggableRegionsChanged() {
     regions.push_back(std::move(region));
   }
 
-  mojom::ElectronBrowserPtr browser_ptr;
-  render_frame_->GetRemoteInterfaces()->GetInterface(
-      mojo::MakeRequest(&browser_ptr));
-  browser_ptr->UpdateDraggableRegions(std::move(regions));
+  GetBrowserConnection()->UpdateDraggableRegions(std::move(regions));
+}
+
+void AtomRenderFrameObserver::SendHeapNearLimit(size_t heap_limit) {
+  v8::HeapStatistics stats;
+  blink::MainThreadIsolate()->GetHeapStatistics(&stats);
+  GetBrowserConnection()->HeapNearLimit(stats.used_heap_size(), heap_limit);
+}
+
+mojom::ElectronBrowser* AtomRenderFrameObserver::GetBrowserConnection() {
+  // Bind the browser connection once and keep it; rebinding per message made
+  // every notification cost an interface round trip too.
+  if (!browser_ptr_) {
+    render_frame_->GetRemoteInterfaces()->GetInterface(
+        mojo::MakeRequest(&browser_ptr_));
+    // Unretained is safe: the handler cannot run after the InterfacePtr it
+    // is attached to is destroyed.
+    browser_ptr_.set_connection_error_handler(base::BindOnce(
+        [](mojom::ElectronBrowserPtr* ptr) { ptr->reset(); },
+        base::Unretained(&browser_ptr_)));
+  }
+  return browser_ptr_.get();
 }
 
 void AtomRenderFrameObserver::WillReleaseScriptContext(
@@ -124,6 +201,8 @@ void AtomRenderFrameObserver::WillReleaseScriptContext(
 }
 
 void AtomRenderFrameObserver::OnDestruct() {
+  if (g_heap_limit_observer == this)
+    g_heap_limit_observer = nullptr;
   delete this;
 }
 
@@ -7,8 +7,10 @@
 
 #include <string>
 
+#include "base/memory/weak_ptr.h"
 #include "base/strings/string16.h"
 #include "content/public/renderer/render_frame_observer.h"
+#include "electron/shell/common/api/api.mojom.h"
 #include "ipc/ipc_platform_file.h"
 #include "shell/renderer/renderer_client_base.h"
 #include "third_party/blink/public/platform/web_isolated_world_ids.h"
@@ -52,6 +54,11 @@ class AtomRenderFrameObserver : public content::RenderFrameObserver {
                                 int world_id) override;
   void OnDestruct() override;
 
+  // Reports a near-heap-limit trigger to the browser, which emits it as the
+  // webContents 'heap-near-limit' event. Called from a task posted by the
+  // process-wide V8 callback.
+  void SendHeapNearLimit(size_t heap_limit);
+
  private:
   bool ShouldNotifyClient(int world_id);
   void CreateIsolatedWorldContext();
@@ -59,10 +66,23 @@ class AtomRenderFrameObserver : public content::RenderFrameObserver {
   bool IsIsolatedWorld(int world_id);
   void OnTakeHeapSnapshot(IPC::PlatformFileForTransit file_handle,
                           const std::string& channel);
+  void SendDraggableRegions();
+
+  // Returns the lazily bound browser connection.
+  mojom::ElectronBrowser* GetBrowserConnection();
 
   content::RenderFrame* render_frame_;
   RendererClientBase* renderer_client_;
 
+  // Connection to the browser for draggable-region updates, bound lazily and
+  // reused across updates.
+  mojom::ElectronBrowserPtr browser_ptr_;
+
+  // Whether a conflated draggable-region update is already scheduled.
+  bool draggable_regions_update_pending_ = false;
+
+  base::WeakPtrFactory<AtomRenderFrameObserver> weak_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomRenderFrameObserver);
 };
 
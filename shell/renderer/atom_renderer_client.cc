@@ -197,16 +197,19 @@ bool AtomRendererClient::ShouldFork(blink::WebLocalFrame* frame,
 
 void AtomRendererClient::DidInitializeWorkerContextOnWorkerThread(
     v8::Local<v8::Context> context) {
-  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
-          switches::kNodeIntegrationInWorker)) {
+  auto* command_line = base::CommandLine::ForCurrentProcess();
+  if (command_line->HasSwitch(switches::kNodeIntegrationInWorker)) {
     WebWorkerObserver::GetCurrent()->ContextCreated(context);
+  } else if (command_line->HasSwitch(switches::kLightweightNodeInWorkers)) {
+    WebWorkerObserver::GetCurrent()->LightweightContextCreated(context);
   }
 }
 
 void AtomRendererClient::WillDestroyWorkerContextOnWorkerThread(
     v8::Local<v8::Context> context) {
-  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
-          switches::kNodeIntegrationInWorker)) {
+  auto* command_line = base::CommandLine::ForCurrentProcess();
+  if (command_line->HasSwitch(switches::kNodeIntegrationInWorker) ||
+      command_line->HasSwitch(switches::kLightweightNodeInWorkers)) {
     WebWorkerObserver::GetCurrent()->ContextWillDestroy(context);
   }
 }
@@ -4,9 +4,17 @@
 
 #include "shell/renderer/atom_sandboxed_renderer_client.h"
 
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "base/base_paths.h"
 #include "base/command_line.h"
 #include "base/files/file_path.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/process/process_handle.h"
 #include "content/public/renderer/render_frame.h"
@@ -19,8 +27,10 @@
 #include "shell/common/node_util.h"
 #include "shell/common/options_switches.h"
 #include "shell/renderer/atom_render_frame_observer.h"
+#include "third_party/blink/public/platform/web_security_origin.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_document.h"
+#include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/electron_node/src/node_binding.h"
 
 namespace electron {
@@ -40,6 +50,23 @@ bool IsDevToolsExtension(content::RenderFrame* render_frame) {
       "chrome-extension");
 }
 
+bool IsSameOriginWithTop(content::RenderFrame* render_frame) {
+  blink::WebLocalFrame* frame = render_frame->GetWebFrame();
+  blink::WebFrame* top = frame->Top();
+  return top &&
+         frame->GetSecurityOrigin().CanAccess(top->GetSecurityOrigin());
+}
+
+// Per-process cache of preload code-cache blobs, keyed by a hash of the
+// preload source. Every frame context in a process compiles the same preload
+// wrapper, so contexts after the first consume the blob produced by the first
+// compile even before the browser has one to hand out. A mismatched entry is
+// harmless: V8 verifies the blob against the source and rejects it.
+std::map<size_t, std::vector<uint8_t>>& PreloadCacheMap() {
+  static base::NoDestructor<std::map<size_t, std::vector<uint8_t>>> map;
+  return *map;
+}
+
 v8::Local<v8::Object> GetModuleCache(v8::Isolate* isolate) {
   auto context = isolate->GetCurrentContext();
   gin_helper::Dictionary global(isolate, context->Global());
@@ -83,10 +110,77 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
   return exports;
 }
 
+// Compiles and runs the preload wrapper, consuming a V8 code cache blob when
+// the browser has one for this preload and producing a fresh blob otherwise,
+// so later renderers can skip full compilation.
 v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
-                                         v8::Local<v8::String> preloadSrc) {
-  return RendererClientBase::RunScript(isolate->GetCurrentContext(),
-                                       preloadSrc);
+                                         v8::Local<v8::String> preloadSrc,
+                                         gin_helper::Arguments* args) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  size_t source_hash =
+      std::hash<std::string>()(gin::V8ToString(isolate, preloadSrc));
+
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  bool cache_from_caller = false;
+  v8::Local<v8::Value> cache_value;
+  if (args->GetNext(&cache_value) && cache_value->IsArrayBufferView()) {
+    auto cache_view = cache_value.As<v8::ArrayBufferView>();
+    size_t length = cache_view->ByteLength();
+    if (length > 0) {
+      auto* data = new uint8_t[length];
+      cache_view->CopyContents(data, length);
+      // CachedData takes ownership of |data|; |script_source| below takes
+      // ownership of |cached_data|.
+      cached_data = new v8::ScriptCompiler::CachedData(
+          data, length, v8::ScriptCompiler::CachedData::BufferOwned);
+      cache_from_caller = true;
+    }
+  }
+  if (!cached_data) {
+    auto iter = PreloadCacheMap().find(source_hash);
+    if (iter != PreloadCacheMap().end()) {
+      const std::vector<uint8_t>& blob = iter->second;
+      auto* data = new uint8_t[blob.size()];
+      std::copy(blob.begin(), blob.end(), data);
+      cached_data = new v8::ScriptCompiler::CachedData(
+          data, static_cast<int>(blob.size()),
+          v8::ScriptCompiler::CachedData::BufferOwned);
+    }
+  }
+
+  v8::ScriptCompiler::Source script_source(preloadSrc, cached_data);
+  auto options = cached_data ? v8::ScriptCompiler::kConsumeCodeCache
+                             : v8::ScriptCompiler::kNoCompileOptions;
+  v8::Local<v8::Script> script;
+  if (!v8::ScriptCompiler::Compile(context, &script_source, options)
+           .ToLocal(&script))
+    return v8::Local<v8::Value>();
+
+  gin_helper::Dictionary result = gin::Dictionary::CreateEmpty(isolate);
+  bool cache_rejected = cached_data && cached_data->rejected;
+  // Only report a rejection when the caller's own blob was rejected; a stale
+  // process-local entry is an internal detail and gets replaced below.
+  result.Set("cacheRejected", cache_from_caller && cache_rejected);
+  if (!cached_data || cache_rejected) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> new_cache(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (new_cache) {
+      PreloadCacheMap()[source_hash] = std::vector<uint8_t>(
+          new_cache->data, new_cache->data + new_cache->length);
+      auto buffer = v8::ArrayBuffer::New(isolate, new_cache->length);
+      memcpy(buffer->GetContents().Data(), new_cache->data, new_cache->length);
+      result.Set("cacheData",
+                 v8::Uint8Array::New(buffer, 0, new_cache->length)
+                     .As<v8::Value>());
+    }
+  }
+
+  v8::Local<v8::Value> preload_fn;
+  if (!script->Run(context).ToLocal(&preload_fn))
+    return v8::Local<v8::Value>();
+  result.Set("preloadFn", preload_fn);
+  return gin::ConvertToV8(isolate, result);
 }
 
 void InvokeHiddenCallback(v8::Handle<v8::Context> context,
@@ -212,6 +306,16 @@ void AtomSandboxedRendererClient::DidCreateScriptContext(
   if (!should_load_preload)
     return;
 
+  // Apps can opt out of running the preload in sub-frames that are
+  // same-origin with the top frame; such frames can reach the top frame's
+  // context directly, and skipping them saves a bundle evaluation per frame
+  // on iframe-heavy pages.
+  if (!is_main_frame && !is_devtools &&
+      base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kDisablePreloadInSameOriginSubFrames) &&
+      IsSameOriginWithTop(render_frame))
+    return;
+
   injected_frames_.insert(render_frame);
 
   // Wrap the bundle into a function that receives the binding object as
@@ -10,18 +10,24 @@
 
 #include "base/environment.h"
 #include "base/macros.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/threading/thread_restrictions.h"
 #include "mojo/public/cpp/system/platform_handle.h"
 #include "shell/common/atom_constants.h"
+#include "shell/common/cpu_profiler.h"
 #include "shell/common/gin_converters/blink_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/heap_snapshot.h"
+#include "shell/common/ipc_metrics.h"
+#include "shell/common/v8_value_converter.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
 #include "shell/renderer/atom_render_frame_observer.h"
 #include "shell/renderer/renderer_client_base.h"
+#include "shell/renderer/zoom_level_cache.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_local_frame.h"
+#include "third_party/blink/public/web/web_script_source.h"
 
 namespace electron {
 
@@ -90,6 +96,16 @@ void EmitIPCEvent(v8::Local<v8::Context> context,
   InvokeIpcCallback(context, "onMessage", argv);
 }
 
+// Collects |frame| and its local descendants in frame-tree order.
+void CollectLocalFrames(blink::WebFrame* frame,
+                        std::vector<blink::WebLocalFrame*>* local_frames) {
+  if (frame->IsWebLocalFrame())
+    local_frames->push_back(frame->ToWebLocalFrame());
+  for (blink::WebFrame* child = frame->FirstChild(); child;
+       child = child->NextSibling())
+    CollectLocalFrames(child, local_frames);
+}
+
 }  // namespace
 
 ElectronApiServiceImpl::~ElectronApiServiceImpl() = default;
@@ -114,6 +130,10 @@ void ElectronApiServiceImpl::BindTo(
 
 void ElectronApiServiceImpl::DidCreateDocumentElement() {
   document_created_ = true;
+  // The new document may be subject to a different per-host zoom level
+  // without any change event firing, so the cached value cannot be
+  // trusted across navigations.
+  ZoomLevelCache::Clear(render_frame());
 }
 
 void ElectronApiServiceImpl::OnDestruct() {
@@ -128,7 +148,7 @@ void ElectronApiServiceImpl::OnConnectionError() {
 void ElectronApiServiceImpl::Message(bool internal,
                                      bool send_to_all,
                                      const std::string& channel,
-                                     blink::CloneableMessage arguments,
+                                     mojo_base::BigBuffer arguments,
                                      int32_t sender_id) {
   // Don't handle browser messages before document element is created.
   //
@@ -159,6 +179,8 @@ void ElectronApiServiceImpl::Message(bool internal,
   v8::Local<v8::Context> context = renderer_client_->GetContext(frame, isolate);
   v8::Context::Scope context_scope(context);
 
+  ScopedIPCDispatchTimer timer(channel, arguments.size());
+
   v8::Local<v8::Value> args = gin::ConvertToV8(isolate, arguments);
 
   EmitIPCEvent(context, internal, channel, args, sender_id);
@@ -176,6 +198,21 @@ void ElectronApiServiceImpl::Message(bool internal,
   }
 }
 
+void ElectronApiServiceImpl::BindElectronPeer(int32_t sender_id,
+                                              mojom::ElectronPeerRequest peer) {
+  peer_bindings_.AddBinding(this, std::move(peer), sender_id);
+}
+
+void ElectronApiServiceImpl::Message(bool internal,
+                                     const std::string& channel,
+                                     mojo_base::BigBuffer arguments) {
+  // A direct sendTo message; dispatch through the regular path with the
+  // sender id the browser stamped when the pipe was brokered. Direct pipes
+  // only reach the main frame, so there is no send_to_all variant here.
+  Message(internal, false /* send_to_all */, channel, std::move(arguments),
+          peer_bindings_.dispatch_context());
+}
+
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
 void ElectronApiServiceImpl::DereferenceRemoteJSCallback(
     const std::string& context_id,
@@ -213,6 +250,7 @@ void ElectronApiServiceImpl::UpdateCrashpadPipeName(
 
 void ElectronApiServiceImpl::TakeHeapSnapshot(
     mojo::ScopedHandle file,
+    bool compress,
     TakeHeapSnapshotCallback callback) {
   base::ThreadRestrictions::ScopedAllowIO allow_io;
 
@@ -225,10 +263,67 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
   }
   base::File base_file(platform_file);
 
-  bool success =
-      electron::TakeHeapSnapshot(blink::MainThreadIsolate(), &base_file);
+  bool success = electron::TakeHeapSnapshot(blink::MainThreadIsolate(),
+                                            &base_file, compress);
 
   std::move(callback).Run(success);
 }
 
+void ElectronApiServiceImpl::ExecuteJavaScriptInAllFrames(
+    const base::string16& code,
+    ExecuteJavaScriptInAllFramesCallback callback) {
+  std::vector<base::Value> results;
+
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(std::move(results));
+    return;
+  }
+
+  std::vector<blink::WebLocalFrame*> local_frames;
+  CollectLocalFrames(frame, &local_frames);
+
+  v8::Isolate* isolate = blink::MainThreadIsolate();
+  v8::HandleScope handle_scope(isolate);
+  blink::WebScriptSource source(blink::WebString::FromUTF16(code));
+  V8ValueConverter converter;
+  for (auto* local_frame : local_frames) {
+    v8::Local<v8::Context> context = local_frame->MainWorldScriptContext();
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Value> result =
+        local_frame->ExecuteScriptAndReturnValue(source);
+    std::unique_ptr<base::Value> value;
+    if (!result.IsEmpty())
+      value = converter.FromV8Value(result, context);
+    results.push_back(value ? std::move(*value) : base::Value());
+  }
+
+  std::move(callback).Run(std::move(results));
+}
+
+void ElectronApiServiceImpl::TriggerMemoryCleanup(bool critical) {
+  // Dispatch through the renderer's memory pressure machinery so blink, V8
+  // and the allocators all react the same way as they do when the OS
+  // reports real pressure.
+  base::MemoryPressureListener::NotifyMemoryPressure(
+      critical ? base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
+               : base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+}
+
+void ElectronApiServiceImpl::StartCpuProfiling(uint32_t interval_us) {
+  electron::StartCpuProfiling(blink::MainThreadIsolate(),
+                              static_cast<int>(interval_us));
+}
+
+void ElectronApiServiceImpl::StopCpuProfiling(
+    StopCpuProfilingCallback callback) {
+  std::unique_ptr<base::Value> profile =
+      electron::StopCpuProfiling(blink::MainThreadIsolate());
+  std::move(callback).Run(profile ? std::move(*profile) : base::Value());
+}
+
+void ElectronApiServiceImpl::ZoomLevelChanged(double level) {
+  ZoomLevelCache::Set(render_frame(), level);
+}
+
 }  // namespace electron
@@ -13,6 +13,7 @@
 #include "electron/buildflags/buildflags.h"
 #include "electron/shell/common/api/api.mojom.h"
 #include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/binding_set.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
 
 namespace electron {
@@ -20,6 +21,7 @@ namespace electron {
 class RendererClientBase;
 
 class ElectronApiServiceImpl : public mojom::ElectronRenderer,
+                               public mojom::ElectronPeer,
                                public content::RenderFrameObserver {
  public:
   ElectronApiServiceImpl(content::RenderFrame* render_frame,
@@ -28,18 +30,34 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
   void BindTo(
       mojo::PendingAssociatedReceiver<mojom::ElectronRenderer> receiver);
 
+  // mojom::ElectronRenderer:
   void Message(bool internal,
                bool send_to_all,
                const std::string& channel,
-               blink::CloneableMessage arguments,
+               mojo_base::BigBuffer arguments,
                int32_t sender_id) override;
+  void BindElectronPeer(int32_t sender_id,
+                        mojom::ElectronPeerRequest peer) override;
 #if BUILDFLAG(ENABLE_REMOTE_MODULE)
   void DereferenceRemoteJSCallback(const std::string& context_id,
                                    int32_t object_id) override;
 #endif
   void UpdateCrashpadPipeName(const std::string& pipe_name) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
+                        bool compress,
                         TakeHeapSnapshotCallback callback) override;
+  void ExecuteJavaScriptInAllFrames(
+      const base::string16& code,
+      ExecuteJavaScriptInAllFramesCallback callback) override;
+  void TriggerMemoryCleanup(bool critical) override;
+  void StartCpuProfiling(uint32_t interval_us) override;
+  void StopCpuProfiling(StopCpuProfilingCallback callback) override;
+  void ZoomLevelChanged(double level) override;
+
+  // mojom::ElectronPeer:
+  void Message(bool internal,
+               const std::string& channel,
+               mojo_base::BigBuffer arguments) override;
 
   base::WeakPtr<ElectronApiServiceImpl> GetWeakPtr() {
     return weak_factory_.GetWeakPtr();
@@ -59,6 +77,10 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
 
   mojo::AssociatedReceiver<mojom::ElectronRenderer> receiver_{this};
 
+  // Direct sendTo pipes brokered by the browser; the context is the sender's
+  // WebContents ID, fixed when the pipe was brokered.
+  mojo::BindingSet<mojom::ElectronPeer, int32_t> peer_bindings_;
+
   RendererClientBase* renderer_client_;
   base::WeakPtrFactory<ElectronApiServiceImpl> weak_factory_;
 
@@ -4,13 +4,26 @@
 
 #include "shell/renderer/renderer_client_base.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/command_line.h"
+#include "base/json/json_reader.h"
+#include "base/logging.h"
+#include "base/macros.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/optional.h"
+#include "base/strings/pattern.h"
 #include "base/strings/string_split.h"
 #include "base/strings/stringprintf.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_restrictions.h"
+#include "base/values.h"
+#include "gin/converter.h"
 #include "components/network_hints/renderer/prescient_networking_dispatcher.h"
 #include "content/common/buildflags.h"
 #include "content/public/common/content_constants.h"
@@ -20,6 +33,9 @@
 #include "content/public/renderer/render_view.h"
 #include "electron/buildflags/buildflags.h"
 #include "printing/buildflags/buildflags.h"
+#include "services/service_manager/public/cpp/interface_provider.h"
+#include "shell/common/api/api.mojom.h"
+#include "shell/common/asar/asar_util.h"
 #include "shell/common/color_util.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/options_switches.h"
@@ -30,11 +46,14 @@
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_registry.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_custom_element.h"  // NOLINT(build/include_alpha)
+#include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_frame_widget.h"
+#include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_plugin_params.h"
 #include "third_party/blink/public/web/web_script_source.h"
 #include "third_party/blink/public/web/web_security_policy.h"
 #include "third_party/blink/public/web/web_view.h"
+#include "url/gurl.h"
 #include "third_party/blink/renderer/platform/weborigin/scheme_registry.h"  // nogncheck
 
 #if defined(OS_MACOSX)
@@ -81,6 +100,24 @@ std::vector<std::string> ParseSchemesCLISwitch(base::CommandLine* command_line,
                            base::SPLIT_WANT_NONEMPTY);
 }
 
+// Asks the browser process for the shared memory region holding the header
+// of the archive at |path|, so every renderer doesn't re-read it from disk.
+base::ReadOnlySharedMemoryRegion FetchAsarHeaderRegion(
+    const base::FilePath& path) {
+  blink::WebLocalFrame* frame = blink::WebLocalFrame::FrameForCurrentContext();
+  content::RenderFrame* render_frame =
+      frame ? content::RenderFrame::FromWebFrame(frame) : nullptr;
+  if (!render_frame)
+    return base::ReadOnlySharedMemoryRegion();
+
+  electron::mojom::ElectronBrowserPtr browser_ptr;
+  render_frame->GetRemoteInterfaces()->GetInterface(
+      mojo::MakeRequest(&browser_ptr));
+  base::ReadOnlySharedMemoryRegion region;
+  browser_ptr->GetAsarHeader(path, &region);
+  return region;
+}
+
 }  // namespace
 
 RendererClientBase::RendererClientBase() {
@@ -118,6 +155,85 @@ void RendererClientBase::DidCreateScriptContext(
       command_line->HasSwitch(switches::kEnableRemoteModule);
   global.SetHidden("enableRemoteModule", enableRemoteModule);
 #endif
+
+  InjectRegisteredScripts(context, render_frame);
+}
+
+void RendererClientBase::InjectRegisteredScripts(
+    v8::Handle<v8::Context> context,
+    content::RenderFrame* render_frame) {
+  if (injection_scripts_.empty())
+    return;
+
+  GURL url(render_frame->GetWebFrame()->GetDocument().Url());
+  const std::string& spec = url.possibly_invalid_spec();
+  for (const auto& entry : injection_scripts_) {
+    if (base::MatchPattern(spec, entry.first))
+      ExecuteInjectionScript(context, entry.second);
+  }
+}
+
+void RendererClientBase::ExecuteInjectionScript(v8::Handle<v8::Context> context,
+                                                const base::FilePath& path) {
+  auto iter = injection_script_cache_.find(path);
+  if (iter == injection_script_cache_.end()) {
+    CachedInjectionScript cached;
+    base::ThreadRestrictions::ScopedAllowIO allow_io;
+    if (!asar::ReadFileToString(path, &cached.source)) {
+      LOG(ERROR) << "Failed to read injection script: " << path.value();
+      cached.load_failed = true;
+    }
+    iter = injection_script_cache_.emplace(path, std::move(cached)).first;
+  }
+  CachedInjectionScript& cached = iter->second;
+  if (cached.load_failed)
+    return;
+
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::MicrotasksScope microtasks_scope(isolate,
+                                       v8::MicrotasksScope::kRunMicrotasks);
+
+  v8::Local<v8::String> source;
+  if (!v8::String::NewFromUtf8(isolate, cached.source.data(),
+                               v8::NewStringType::kNormal,
+                               static_cast<int>(cached.source.size()))
+           .ToLocal(&source))
+    return;
+
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  if (!cached.code_cache.empty()) {
+    auto* data = new uint8_t[cached.code_cache.size()];
+    std::copy(cached.code_cache.begin(), cached.code_cache.end(), data);
+    cached_data = new v8::ScriptCompiler::CachedData(
+        data, static_cast<int>(cached.code_cache.size()),
+        v8::ScriptCompiler::CachedData::BufferOwned);
+  }
+
+  v8::ScriptOrigin origin(gin::StringToV8(isolate, path.AsUTF8Unsafe()));
+  v8::ScriptCompiler::Source script_source(source, origin, cached_data);
+  auto options = cached_data ? v8::ScriptCompiler::kConsumeCodeCache
+                             : v8::ScriptCompiler::kNoCompileOptions;
+  v8::Local<v8::Script> script;
+  if (!v8::ScriptCompiler::Compile(context, &script_source, options)
+           .ToLocal(&script))
+    return;
+
+  if (!cached_data || cached_data->rejected) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> new_cache(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (new_cache) {
+      cached.code_cache.assign(new_cache->data,
+                               new_cache->data + new_cache->length);
+    }
+  }
+
+  v8::TryCatch try_catch(isolate);
+  ignore_result(script->Run(context));
+  if (try_catch.HasCaught()) {
+    LOG(ERROR) << "Injection script threw: " << path.value();
+  }
 }
 
 void RendererClientBase::AddRenderBindings(
@@ -127,6 +243,30 @@ void RendererClientBase::AddRenderBindings(
 void RendererClientBase::RenderThreadStarted() {
   auto* command_line = base::CommandLine::ForCurrentProcess();
 
+  asar::SetSharedHeaderFetcher(base::BindRepeating(&FetchAsarHeaderRegion));
+
+  // Parse the session's script-injection registry once per process; matching
+  // against it happens locally at every context creation.
+  if (command_line->HasSwitch(switches::kInjectionScripts)) {
+#if defined(OS_WIN)
+    std::string json = base::WideToUTF8(
+        command_line->GetSwitchValueNative(switches::kInjectionScripts));
+#else
+    std::string json =
+        command_line->GetSwitchValueNative(switches::kInjectionScripts);
+#endif
+    base::Optional<base::Value> parsed = base::JSONReader::Read(json);
+    if (parsed && parsed->is_list()) {
+      for (const auto& entry : parsed->GetList()) {
+        const std::string* pattern = entry.FindStringKey("urlPattern");
+        const std::string* file = entry.FindStringKey("file");
+        if (pattern && file)
+          injection_scripts_.emplace_back(
+              *pattern, base::FilePath::FromUTF8Unsafe(*file));
+      }
+    }
+  }
+
 #if BUILDFLAG(USE_EXTERNAL_POPUP_MENU)
   // On macOS, popup menus are rendered by the main process by default.
   // This causes problems in OSR, since when the popup is rendered separately,
@@ -5,10 +5,13 @@
 #ifndef SHELL_RENDERER_RENDERER_CLIENT_BASE_H_
 #define SHELL_RENDERER_RENDERER_CLIENT_BASE_H_
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "content/public/renderer/content_renderer_client.h"
 #include "electron/buildflags/buildflags.h"
 #include "third_party/blink/public/web/web_local_frame.h"
@@ -93,9 +96,29 @@ class RendererClientBase : public content::ContentRendererClient {
 #endif
 
  private:
+  // Runs every registered injection script whose URL pattern matches the
+  // frame's document URL in |context|. Sources and code caches are kept
+  // per-process, so repeated navigations neither re-read nor re-parse.
+  void InjectRegisteredScripts(v8::Handle<v8::Context> context,
+                               content::RenderFrame* render_frame);
+  void ExecuteInjectionScript(v8::Handle<v8::Context> context,
+                              const base::FilePath& path);
+
+  // A loaded injection script plus the code-cache blob from its first
+  // compile in this process.
+  struct CachedInjectionScript {
+    bool load_failed = false;
+    std::string source;
+    std::vector<uint8_t> code_cache;
+  };
+
   std::unique_ptr<network_hints::PrescientNetworkingDispatcher>
       prescient_networking_dispatcher_;
 
+  // URL pattern -> script path entries from the --injection-scripts switch.
+  std::vector<std::pair<std::string, base::FilePath>> injection_scripts_;
+  std::map<base::FilePath, CachedInjectionScript> injection_script_cache_;
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   std::unique_ptr<extensions::ExtensionsClient> extensions_client_;
   std::unique_ptr<AtomExtensionsRendererClient> extensions_renderer_client_;
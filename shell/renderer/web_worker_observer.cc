@@ -5,8 +5,10 @@
 #include "shell/renderer/web_worker_observer.h"
 
 #include "base/lazy_instance.h"
+#include "base/process/process_handle.h"
 #include "base/threading/thread_local.h"
 #include "shell/common/api/electron_bindings.h"
+#include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_bindings.h"
@@ -28,22 +30,26 @@ WebWorkerObserver* WebWorkerObserver::GetCurrent() {
   return self ? self : new WebWorkerObserver;
 }
 
-WebWorkerObserver::WebWorkerObserver()
-    : node_bindings_(
-          NodeBindings::Create(NodeBindings::BrowserEnvironment::WORKER)),
-      electron_bindings_(new ElectronBindings(node_bindings_->uv_loop())) {
+WebWorkerObserver::WebWorkerObserver() {
   lazy_tls.Pointer()->Set(this);
 }
 
 WebWorkerObserver::~WebWorkerObserver() {
   lazy_tls.Pointer()->Set(nullptr);
-  node::FreeEnvironment(node_bindings_->uv_env());
+  if (node_bindings_ && node_bindings_->uv_env())
+    node::FreeEnvironment(node_bindings_->uv_env());
   asar::ClearArchives();
 }
 
 void WebWorkerObserver::ContextCreated(v8::Local<v8::Context> worker_context) {
   v8::Context::Scope context_scope(worker_context);
 
+  // The uv loop and bindings are created here rather than in the constructor
+  // so the lightweight path never pays for them.
+  node_bindings_ =
+      NodeBindings::Create(NodeBindings::BrowserEnvironment::WORKER);
+  electron_bindings_.reset(new ElectronBindings(node_bindings_->uv_loop()));
+
   // Start the embed thread.
   node_bindings_->PrepareMessageLoop();
 
@@ -66,6 +72,25 @@ void WebWorkerObserver::ContextCreated(v8::Local<v8::Context> worker_context) {
   node_bindings_->RunMessageLoop();
 }
 
+void WebWorkerObserver::LightweightContextCreated(
+    v8::Local<v8::Context> worker_context) {
+  v8::Isolate* isolate = worker_context->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(worker_context);
+
+  // Expose the process bindings shared with sandboxed renderers on a plain
+  // object; no Node environment, uv loop or module system is created, so
+  // worker spin-up stays close to a vanilla worker.
+  gin_helper::Dictionary process = gin::Dictionary::CreateEmpty(isolate);
+  metrics_ = base::ProcessMetrics::CreateCurrentProcessMetrics();
+  ElectronBindings::BindProcess(isolate, &process, metrics_.get());
+  process.SetReadOnly("pid", base::GetCurrentProcId());
+  process.SetReadOnly("type", "worker");
+
+  gin_helper::Dictionary global(isolate, worker_context->Global());
+  global.Set("process", process);
+}
+
 void WebWorkerObserver::ContextWillDestroy(v8::Local<v8::Context> context) {
   node::Environment* env = node::Environment::GetCurrent(context);
   if (env)
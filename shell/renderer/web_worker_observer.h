@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "base/macros.h"
+#include "base/process/process_metrics.h"
 #include "v8/include/v8.h"
 
 namespace electron {
@@ -22,15 +23,23 @@ class WebWorkerObserver {
   static WebWorkerObserver* GetCurrent();
 
   void ContextCreated(v8::Local<v8::Context> context);
+  // Exposes only the Electron process bindings on a plain |process| object,
+  // without booting a Node environment or a uv loop, for workers that opt
+  // into the lightweight mode.
+  void LightweightContextCreated(v8::Local<v8::Context> context);
   void ContextWillDestroy(v8::Local<v8::Context> context);
 
  private:
   WebWorkerObserver();
   ~WebWorkerObserver();
 
+  // Created on demand by ContextCreated(); unset in lightweight mode.
   std::unique_ptr<NodeBindings> node_bindings_;
   std::unique_ptr<ElectronBindings> electron_bindings_;
 
+  // Used instead of the above in lightweight mode.
+  std::unique_ptr<base::ProcessMetrics> metrics_;
+
   DISALLOW_COPY_AND_ASSIGN(WebWorkerObserver);
 };
 
@@ -0,0 +1,45 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/renderer/zoom_level_cache.h"
+
+#include <map>
+
+#include "base/no_destructor.h"
+#include "content/public/renderer/render_frame.h"
+#include "content/public/renderer/render_view.h"
+
+namespace electron {
+
+namespace {
+
+// Only touched from the renderer main thread.
+std::map<content::RenderView*, double>& GetCache() {
+  static base::NoDestructor<std::map<content::RenderView*, double>> cache;
+  return *cache;
+}
+
+}  // namespace
+
+// static
+bool ZoomLevelCache::Get(content::RenderFrame* render_frame, double* level) {
+  auto& cache = GetCache();
+  auto it = cache.find(render_frame->GetRenderView());
+  if (it == cache.end())
+    return false;
+  *level = it->second;
+  return true;
+}
+
+// static
+void ZoomLevelCache::Set(content::RenderFrame* render_frame, double level) {
+  GetCache()[render_frame->GetRenderView()] = level;
+}
+
+// static
+void ZoomLevelCache::Clear(content::RenderFrame* render_frame) {
+  GetCache().erase(render_frame->GetRenderView());
+}
+
+}  // namespace electron
@@ -0,0 +1,39 @@
+// Copyright (c) 2019 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_RENDERER_ZOOM_LEVEL_CACHE_H_
+#define SHELL_RENDERER_ZOOM_LEVEL_CACHE_H_
+
+namespace content {
+class RenderFrame;
+}
+
+namespace electron {
+
+// Renderer-local cache of the view's zoom level, keyed by the RenderView a
+// frame belongs to. webFrame.getZoomLevel() used to be a synchronous
+// browser round-trip on every call; the browser now pushes zoom changes
+// through ElectronRenderer.ZoomLevelChanged() and reads are served from
+// here. A miss (before the first push, or right after a navigation cleared
+// the entry) falls back to the sync IPC once and re-primes the cache.
+class ZoomLevelCache {
+ public:
+  // Returns true and fills |level| when a value is cached for the view
+  // containing |render_frame|.
+  static bool Get(content::RenderFrame* render_frame, double* level);
+
+  static void Set(content::RenderFrame* render_frame, double level);
+
+  // Drops the cached value, forcing the next read to re-fetch. Called when
+  // a new document is committed, as the new origin may have a different
+  // per-host zoom level without any change event firing.
+  static void Clear(content::RenderFrame* render_frame);
+
+ private:
+  ZoomLevelCache() = delete;
+};
+
+}  // namespace electron
+
+#endif  // SHELL_RENDERER_ZOOM_LEVEL_CACHE_H_
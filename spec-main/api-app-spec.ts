@@ -9,7 +9,7 @@ import split = require('split')
 import { app, BrowserWindow, Menu } from 'electron'
 import { emittedOnce } from './events-helpers';
 import { closeWindow } from './window-helpers';
-import { ifdescribe } from './spec-helpers';
+import { delay, ifdescribe } from './spec-helpers';
 
 const features = process.electronBinding('features')
 
@@ -942,6 +942,25 @@ describe('app module', () => {
         expect(size.width).to.equal(sizes.large)
       })
     })
+
+    describe('getFileIcons()', () => {
+      it('fetches icons for every path in order', async () => {
+        const icons = await (app as any).getFileIcons([iconPath, iconPath])
+        expect(icons).to.have.lengthOf(2)
+        for (const icon of icons) {
+          expect(icon.isEmpty()).to.equal(false)
+          expect(icon.getSize()).to.deep.equal({
+            width: sizes.normal,
+            height: sizes.normal
+          })
+        }
+      })
+
+      it('resolves an empty array for an empty batch', async () => {
+        const icons = await (app as any).getFileIcons([])
+        expect(icons).to.deep.equal([])
+      })
+    })
   })
 
   describe('getAppMetrics() API', () => {
@@ -983,6 +1002,103 @@ describe('app module', () => {
     })
   })
 
+  describe('app metrics sampling', () => {
+    afterEach(() => {
+      (app as any).stopAppMetricsSampling()
+    })
+
+    it('collects samples into the history ring', async () => {
+      (app as any).startAppMetricsSampling({ interval: 100, maxSamples: 5 })
+      await delay(500)
+      const history = await (app as any).getAppMetricsHistory()
+      expect(history).to.be.an('array').with.lengthOf.at.least(1)
+      expect(history).to.have.lengthOf.at.most(5)
+
+      const sample = history[history.length - 1]
+      expect(sample.timestamp).to.be.a('number').that.is.greaterThan(0)
+      expect(sample.metrics).to.be.an('array').with.lengthOf.at.least(1)
+      for (const entry of sample.metrics) {
+        expect(entry.pid).to.be.above(0)
+        expect(entry.type).to.be.a('string').that.does.not.equal('')
+        expect(entry.percentCPUUsage).to.be.a('number')
+      }
+    })
+
+    it('resolves with an empty history when sampling never started', async () => {
+      const history = await (app as any).getAppMetricsHistory()
+      expect(history).to.be.an('array')
+    })
+  })
+
+  describe('getSocketLimits() API', () => {
+    it('returns the socket limits in effect', () => {
+      const limits = (app as any).getSocketLimits()
+      expect(limits.maxSocketsPerHost).to.be.a('number').that.is.greaterThan(0)
+      expect(limits.maxConnectionsPerProxy).to.be.a('number').that.is.greaterThan(0)
+    })
+  })
+
+  describe('getResponsivenessReport() API', () => {
+    it('returns the aggregated stall report', () => {
+      const report = (app as any).getResponsivenessReport()
+      expect(report.stallCount).to.be.a('number').that.is.at.least(0)
+      expect(report.totalStallTime).to.be.a('number').that.is.at.least(0)
+      expect(report.longestStall).to.be.a('number').that.is.at.least(0)
+      expect(report.profiles).to.be.an('array')
+      for (const profile of report.profiles) {
+        expect(profile.stack).to.be.a('string')
+        expect(profile.sampleCount).to.be.a('number').that.is.greaterThan(0)
+      }
+    })
+  })
+
+  describe('getThreadPoolMetrics() API', () => {
+    it('reports the pool sizes', () => {
+      const metrics = (app as any).getThreadPoolMetrics()
+      expect(metrics.foregroundPoolSize).to.be.a('number').that.is.greaterThan(0)
+      expect(metrics.backgroundPoolSize).to.be.a('number').that.is.greaterThan(0)
+      expect(metrics.nodeWorkerPoolSize).to.be.a('number').that.is.greaterThan(0)
+    })
+  })
+
+  describe('triggerMemoryCleanup() API', () => {
+    it('accepts the default and explicit levels', () => {
+      expect(() => (app as any).triggerMemoryCleanup()).to.not.throw()
+      expect(() => (app as any).triggerMemoryCleanup({ level: 'moderate' })).to.not.throw()
+      expect(() => (app as any).triggerMemoryCleanup({ level: 'critical' })).to.not.throw()
+    })
+
+    it('rejects an unknown level', () => {
+      expect(() => (app as any).triggerMemoryCleanup({ level: 'extreme' })).to.throw(/Invalid level/)
+    })
+  })
+
+  describe('setProcessConsolidationPolicy() API', () => {
+    afterEach(() => {
+      (app as any).setProcessConsolidationPolicy()
+    })
+
+    it('accepts a full policy', () => {
+      expect(() => (app as any).setProcessConsolidationPolicy({
+        mode: 'process-per-site',
+        maxProcessCount: 4,
+        pinnedURLPatterns: ['https://banking.example.com/*']
+      })).to.not.throw()
+    })
+
+    it('rejects an unknown mode', () => {
+      expect(() => (app as any).setProcessConsolidationPolicy({ mode: 'process-per-tab' })).to.throw(/Invalid mode/)
+    })
+
+    it('rejects a negative process count', () => {
+      expect(() => (app as any).setProcessConsolidationPolicy({ maxProcessCount: -1 })).to.throw(/must not be negative/)
+    })
+
+    it('rejects malformed pinned patterns', () => {
+      expect(() => (app as any).setProcessConsolidationPolicy({ pinnedURLPatterns: ['not-a-pattern'] })).to.throw(/Invalid url pattern/)
+    })
+  })
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus()
@@ -105,6 +105,19 @@ describe('BrowserView module', () => {
     })
   })
 
+  describe('BrowserView.setVisible()', () => {
+    it('is visible by default and toggles without detaching', () => {
+      view = new BrowserView()
+      w.setBrowserView(view)
+      expect(view.isVisible()).to.be.true('view.isVisible()')
+      view.setVisible(false)
+      expect(view.isVisible()).to.be.false('view.isVisible()')
+      expect(w.getBrowserView()).to.equal(view)
+      view.setVisible(true)
+      expect(view.isVisible()).to.be.true('view.isVisible()')
+    })
+  })
+
   describe('BrowserWindow.setBrowserView()', () => {
     it('does not throw for valid args', () => {
       view = new BrowserView()
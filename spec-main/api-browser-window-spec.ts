@@ -520,6 +520,104 @@ describe('BrowserWindow module', () => {
         w.loadURL(`${url}/navigate-302`)
       })
     })
+
+    describe('setNavigationPolicyRules', () => {
+      let server = null as unknown as http.Server
+      let url = null as unknown as string
+      before((done) => {
+        server = http.createServer((req, res) => {
+          if (req.url === '/302') {
+            res.setHeader('Location', '/200')
+            res.statusCode = 302
+            res.end()
+          } else {
+            res.end()
+          }
+        })
+        server.listen(0, '127.0.0.1', () => {
+          url = `http://127.0.0.1:${(server.address() as AddressInfo).port}`
+          done()
+        })
+      })
+
+      after(() => {
+        server.close()
+      })
+
+      it('cancels a redirect with a deny rule without emitting will-redirect', (done) => {
+        w.webContents.setNavigationPolicyRules([
+          { urlPattern: `${url}/200`, policy: 'deny' }
+        ])
+        w.webContents.on('will-redirect', () => {
+          done(new Error('will-redirect should not have been emitted'))
+        })
+        w.webContents.on('did-stop-loading', () => {
+          expect(w.webContents.getURL()).to.not.equal(`${url}/200`)
+          done()
+        })
+        w.loadURL(`${url}/302`)
+      })
+
+      it('skips will-redirect with an allow rule', (done) => {
+        w.webContents.setNavigationPolicyRules([
+          { urlPattern: `${url}/*`, policy: 'allow' }
+        ])
+        w.webContents.on('will-redirect', () => {
+          done(new Error('will-redirect should not have been emitted'))
+        })
+        w.webContents.on('did-navigate', (e, navigatedUrl) => {
+          expect(navigatedUrl).to.equal(`${url}/200`)
+          done()
+        })
+        w.loadURL(`${url}/302`)
+      })
+
+      it('throws on an invalid policy', () => {
+        expect(() => {
+          w.webContents.setNavigationPolicyRules([
+            { urlPattern: `${url}/*`, policy: 'banana' as any }
+          ])
+        }).to.throw()
+      })
+    })
+
+    describe('setWindowOpenPolicyRules', () => {
+      it('denies window.open without emitting new-window', async () => {
+        await w.loadURL('about:blank')
+        ;(w.webContents as any).setWindowOpenPolicyRules([
+          { urlPattern: 'http://*/*', policy: 'deny' }
+        ])
+        w.webContents.on('new-window', () => {
+          throw new Error('new-window should not have been emitted')
+        })
+        const opened = await w.webContents.executeJavaScript(
+          'window.open("http://127.0.0.1/denied") === null', true)
+        expect(opened).to.be.true()
+      })
+
+      it('applies rule features to an allowed popup', (done) => {
+        ;(w.webContents as any).setWindowOpenPolicyRules([
+          { urlPattern: 'http://*/*', policy: 'allow', features: ['width=333', 'height=222'] }
+        ])
+        w.webContents.once('new-window', (event, url, frameName, disposition, options) => {
+          event.preventDefault()
+          expect(options.width).to.equal(333)
+          expect(options.height).to.equal(222)
+          done()
+        })
+        w.loadURL('about:blank').then(() => {
+          w.webContents.executeJavaScript('window.open("http://127.0.0.1/allowed")', true)
+        })
+      })
+
+      it('throws on a malformed pattern', () => {
+        expect(() => {
+          ;(w.webContents as any).setWindowOpenPolicyRules([
+            { urlPattern: 'not a pattern', policy: 'deny' }
+          ])
+        }).to.throw()
+      })
+    })
   })
 
   describe('focus and visibility', () => {
@@ -720,6 +818,17 @@ describe('BrowserWindow module', () => {
       })
     })
 
+    describe('BrowserWindow.batchUpdate(fn)', () => {
+      it('applies bounds set inside the scope when it closes', () => {
+        const fullBounds = { x: 440, y: 225, width: 500, height: 400 }
+        ;(BrowserWindow as any).batchUpdate(() => {
+          w.setBounds(fullBounds)
+        })
+
+        expectBoundsEqual(w.getBounds(), fullBounds)
+      })
+    })
+
     describe('BrowserWindow.setSize(width, height)', () => {
       it('sets the window size', async () => {
         const size = [300, 400]
@@ -1634,6 +1743,49 @@ describe('BrowserWindow module', () => {
       generateSpecs('with sandbox', true)
     })
 
+    describe('session injection scripts', () => {
+      const script = path.join(fixtures, 'module', 'set-global.js')
+      const defaultSession = session.defaultSession
+
+      afterEach(() => {
+        defaultSession.setInjectionScripts([])
+      })
+
+      it('can register and read back injection scripts', () => {
+        const scripts = [{ urlPattern: 'file://*', file: script }]
+        defaultSession.setInjectionScripts(scripts)
+        expect(defaultSession.getInjectionScripts()).to.deep.equal(scripts)
+      })
+
+      it('rejects relative paths', () => {
+        expect(() => {
+          defaultSession.setInjectionScripts([
+            { urlPattern: '*', file: 'set-global.js' }
+          ])
+        }).to.throw(/absolute path/)
+      })
+
+      it('executes matching scripts when a frame context is created', async () => {
+        defaultSession.setInjectionScripts([
+          { urlPattern: 'file://*', file: script }
+        ])
+        const w = new BrowserWindow({ show: false })
+        await w.loadFile(path.join(fixtures, 'api', 'blank.html'))
+        const result = await w.webContents.executeJavaScript('window.test')
+        expect(result).to.equal('preload')
+      })
+
+      it('skips scripts whose pattern does not match', async () => {
+        defaultSession.setInjectionScripts([
+          { urlPattern: 'https://no-such-host.invalid/*', file: script }
+        ])
+        const w = new BrowserWindow({ show: false })
+        await w.loadFile(path.join(fixtures, 'api', 'blank.html'))
+        const result = await w.webContents.executeJavaScript('typeof window.test')
+        expect(result).to.equal('undefined')
+      })
+    })
+
     describe('"additionalArguments" option', () => {
       it('adds extra args to process.argv in the renderer process', async () => {
         const preload = path.join(fixtures, 'module', 'check-arguments.js')
@@ -125,5 +125,20 @@ ifdescribe(!(process.platform === 'linux' && ['arm', 'arm64'].includes(process.a
       const resultFilePath = await record(/* options */ {}, /* outputFilePath */ undefined)
       expect(resultFilePath).to.be.a('string').that.is.not.empty('result path')
     })
+
+    it('writes gzip output when compress is specified', async () => {
+      await contentTracing.startRecording({
+        categoryFilter: '*',
+        traceOptions: 'record-until-full'
+      })
+      const path = await (contentTracing as any).stopRecording(outputFilePath, { compress: true })
+      const fd = fs.openSync(path, 'r')
+      const header = Buffer.alloc(2)
+      fs.readSync(fd, header, 0, 2, 0)
+      fs.closeSync(fd)
+      // gzip magic number.
+      expect(header[0]).to.equal(0x1f)
+      expect(header[1]).to.equal(0x8b)
+    })
   })
 })
@@ -220,4 +220,48 @@ describe('debugger module', () => {
       })
     })
   })
+
+  describe('debugger.sendCommands', () => {
+    it('resolves with one entry per command, in order', async () => {
+      w.webContents.loadURL('about:blank')
+      w.webContents.debugger.attach()
+
+      const results = await (w.webContents.debugger as any).sendCommands([
+        { method: 'Runtime.evaluate', params: { expression: '4+2' } },
+        { method: 'Runtime.evaluate', params: { expression: '"a"+"b"' } }
+      ])
+
+      expect(results).to.have.lengthOf(2)
+      expect(results[0].result.result.value).to.equal(6)
+      expect(results[1].result.result.value).to.equal('ab')
+
+      w.webContents.debugger.detach()
+    })
+
+    it('reports per-command errors without rejecting the batch', async () => {
+      w.webContents.loadURL('about:blank')
+      w.webContents.debugger.attach()
+
+      const results = await (w.webContents.debugger as any).sendCommands([
+        { method: 'Test' },
+        { method: 'Runtime.evaluate', params: { expression: '4+2' } }
+      ])
+
+      expect(results).to.have.lengthOf(2)
+      expect(results[0].error).to.match(/wasn't found/)
+      expect(results[1].result.result.value).to.equal(6)
+
+      w.webContents.debugger.detach()
+    })
+
+    it('resolves with an empty array for an empty batch', async () => {
+      w.webContents.loadURL('about:blank')
+      w.webContents.debugger.attach()
+
+      const results = await (w.webContents.debugger as any).sendCommands([])
+      expect(results).to.be.an('array').that.is.empty()
+
+      w.webContents.debugger.detach()
+    })
+  })
 })
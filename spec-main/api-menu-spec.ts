@@ -719,6 +719,33 @@ describe('Menu module', function () {
     })
   })
 
+  describe('Menu.remove', () => {
+    it('should remove the item from the menu', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: '1', id: '1' },
+        { label: '2', id: '2' },
+        { label: '3', id: '3' }
+      ])
+
+      const item = menu.items[1]
+      menu.remove(item)
+
+      expect(menu.items).to.have.length(2)
+      expect(menu.items[0].label).to.equal('1')
+      expect(menu.items[1].label).to.equal('3')
+      expect(menu.getMenuItemById('2')).to.equal(null)
+    })
+
+    it('should throw when the item is not in the menu', () => {
+      const menu = Menu.buildFromTemplate([{ label: '1' }])
+      const item = new MenuItem({ label: 'other' })
+
+      expect(() => {
+        menu.remove(item)
+      }).to.throw(/The item is not in this menu/)
+    })
+  })
+
   describe('Menu.append', () => {
     it('should add the item to the end of the menu', () => {
       const menu = Menu.buildFromTemplate([
@@ -9,7 +9,8 @@ describe('Notification module', () => {
       body: 'body',
       replyPlaceholder: 'replyPlaceholder',
       sound: 'sound',
-      closeButtonText: 'closeButtonText'
+      closeButtonText: 'closeButtonText',
+      tag: 'tag'
     })
 
     expect(n.title).to.equal('title')
@@ -35,6 +36,10 @@ describe('Notification module', () => {
     expect(n.closeButtonText).to.equal('closeButtonText')
     n.closeButtonText = 'closeButtonText1'
     expect(n.closeButtonText).to.equal('closeButtonText1')
+
+    expect(n.tag).to.equal('tag')
+    n.tag = 'tag1'
+    expect(n.tag).to.equal('tag1')
   })
 
   it('inits, gets and sets basic boolean properties correctly', () => {
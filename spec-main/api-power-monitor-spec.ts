@@ -152,5 +152,32 @@ describe('powerMonitor', () => {
         expect(idleTime).to.be.at.least(0)
       })
     })
+
+    describe('powerMonitor.setIdleCacheMaxAge', () => {
+      it('does not accept a negative max age', () => {
+        expect(() => {
+          (powerMonitor as any).setIdleCacheMaxAge(-1)
+        }).to.throw(/must not be negative/)
+      })
+
+      it('accepts zero to disable caching', () => {
+        (powerMonitor as any).setIdleCacheMaxAge(0)
+        expect(powerMonitor.getSystemIdleTime()).to.be.at.least(0);
+        (powerMonitor as any).setIdleCacheMaxAge(1)
+      })
+    })
+
+    describe('powerMonitor.addIdleThreshold', () => {
+      it('does not accept non positive integer threshold', () => {
+        expect(() => {
+          (powerMonitor as any).addIdleThreshold(-1)
+        }).to.throw(/must be greater than 0/)
+      })
+
+      it('registers and removes a threshold', () => {
+        (powerMonitor as any).addIdleThreshold(60);
+        (powerMonitor as any).removeIdleThreshold(60)
+      })
+    })
   })
 })
@@ -10,4 +10,16 @@ describe('powerSaveBlocker module', () => {
     powerSaveBlocker.stop(id)
     expect(powerSaveBlocker.isStarted(id)).to.be.false('is started')
   })
+
+  it('lists active blockers', () => {
+    expect((powerSaveBlocker as any).getActiveBlockers()).to.deep.equal([])
+    const id = powerSaveBlocker.start('prevent-app-suspension')
+    const blockers = (powerSaveBlocker as any).getActiveBlockers()
+    expect(blockers).to.have.lengthOf(1)
+    expect(blockers[0].id).to.equal(id)
+    expect(blockers[0].type).to.equal('prevent-app-suspension')
+    expect(blockers[0].startTime).to.be.a('number')
+    powerSaveBlocker.stop(id)
+    expect((powerSaveBlocker as any).getActiveBlockers()).to.deep.equal([])
+  })
 })
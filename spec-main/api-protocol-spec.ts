@@ -259,6 +259,40 @@ describe('protocol module', () => {
     })
   })
 
+  describe('protocol.registerStaticDirectory', () => {
+    const rootPath = path.join(fixturesPath, 'pages')
+    const fileContent = fs.readFileSync(path.join(rootPath, 'a.html'))
+
+    it('serves files under the root directory', async () => {
+      (protocol as any).registerStaticDirectory(protocolName, rootPath)
+      const r = await ajax(protocolName + '://fake-host/a.html')
+      expect(r.data).to.equal(String(fileContent))
+    })
+
+    it('sets Access-Control-Allow-Origin', async () => {
+      (protocol as any).registerStaticDirectory(protocolName, rootPath)
+      const r = await ajax(protocolName + '://fake-host/a.html')
+      expect(r.headers).to.include('access-control-allow-origin: *')
+    })
+
+    it('fails for paths escaping the root directory', async () => {
+      (protocol as any).registerStaticDirectory(protocolName, rootPath)
+      await expect(ajax(protocolName + '://fake-host/..%2fa.html')).to.be.eventually.rejectedWith(Error, '404')
+    })
+
+    it('counts as a registered protocol', async () => {
+      (protocol as any).registerStaticDirectory(protocolName, rootPath)
+      expect((protocol as any).isProtocolRegistered(protocolName)).to.equal(true)
+      await unregisterProtocol(protocolName)
+      expect((protocol as any).isProtocolRegistered(protocolName)).to.equal(false)
+    })
+
+    it('throws error when scheme is already registered', async () => {
+      await registerStringProtocol(protocolName, (req, cb) => cb())
+      await expect(promisify((protocol as any).registerStaticDirectory)(protocolName, rootPath)).to.be.eventually.rejectedWith(Error)
+    })
+  })
+
   describe('protocol.registerHttpProtocol', () => {
     it('sends url as response', async () => {
       const server = http.createServer((req, res) => {
@@ -418,6 +418,57 @@ describe('session module', () => {
     })
   })
 
+  describe('ses.getBlobDataStream()', () => {
+    const scheme = 'cors-blob-stream'
+    const protocol = session.defaultSession.protocol
+    const url = `${scheme}://host`
+    after(async () => {
+      await protocol.unregisterProtocol(scheme)
+    })
+    afterEach(closeAllWindows)
+
+    it('streams blob data for uuid', (done) => {
+      const postData = JSON.stringify({
+        type: 'blob',
+        value: 'hello'
+      })
+      const content = `<html>
+                       <script>
+                       let fd = new FormData();
+                       fd.append('file', new Blob(['${postData}'], {type:'application/json'}));
+                       fetch('${url}', {method:'POST', body: fd });
+                       </script>
+                       </html>`
+
+      protocol.registerStringProtocol(scheme, (request, callback) => {
+        if (request.method === 'GET') {
+          callback({ data: content, mimeType: 'text/html' })
+        } else if (request.method === 'POST') {
+          const uuid = request.uploadData[1].blobUUID
+          expect(uuid).to.be.a('string')
+          const stream = (session.defaultSession as any).getBlobDataStream(uuid!)
+          const chunks: Buffer[] = []
+          stream.on('data', (chunk: Buffer) => chunks.push(chunk))
+          stream.on('error', done)
+          stream.on('end', () => {
+            expect(Buffer.concat(chunks).toString()).to.equal(postData)
+            done()
+          })
+        }
+      }, (error) => {
+        if (error) return done(error)
+        const w = new BrowserWindow({ show: false })
+        w.loadURL(url)
+      })
+    })
+
+    it('throws for an unknown uuid', () => {
+      expect(() => {
+        (session.defaultSession as any).getBlobDataStream('unknown-uuid')
+      }).to.throw('Could not get blob data handle')
+    })
+  })
+
   describe('ses.setCertificateVerifyProc(callback)', () => {
     let server: http.Server
 
@@ -888,4 +939,43 @@ describe('session module', () => {
       expect(headers!['user-agent']).to.equal(userAgent)
     })
   })
+
+  describe('ses.prefetchDNS(hosts)', () => {
+    it('resolves 0 for an empty batch', async () => {
+      const ses = session.fromPartition('' + Math.random())
+      const resolved = await (ses as any).prefetchDNS([])
+      expect(resolved).to.equal(0)
+    })
+
+    it('resolves local hosts', async () => {
+      const ses = session.fromPartition('' + Math.random())
+      const resolved = await (ses as any).prefetchDNS(['localhost'])
+      expect(resolved).to.equal(1)
+    })
+  })
+
+  describe('ses.setPreconnectLearning(options)', () => {
+    it('requires enabled', () => {
+      const ses = session.fromPartition('' + Math.random())
+      expect(() => {
+        (ses as any).setPreconnectLearning({})
+      }).to.throw(/Must pass enabled/)
+    })
+
+    it('validates the budgets', () => {
+      const ses = session.fromPartition('' + Math.random())
+      expect(() => {
+        (ses as any).setPreconnectLearning({ enabled: true, maxOrigins: 0 })
+      }).to.throw(/maxOrigins is outside range/)
+      expect(() => {
+        (ses as any).setPreconnectLearning({ enabled: true, numSockets: 7 })
+      }).to.throw(/numSocketsToPreconnect is outside range/)
+    })
+
+    it('can be enabled and disabled', () => {
+      const ses = session.fromPartition('' + Math.random());
+      (ses as any).setPreconnectLearning({ enabled: true });
+      (ses as any).setPreconnectLearning({ enabled: false })
+    })
+  })
 })
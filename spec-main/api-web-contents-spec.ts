@@ -546,6 +546,37 @@ describe('webContents module', () => {
     })
   })
 
+  describe('sendInputEvents()', () => {
+    afterEach(closeAllWindows)
+    it('delivers a batch of keyboard events in order', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true } })
+      await w.loadFile(path.join(fixturesPath, 'pages', 'key-events.html'))
+      const keys: string[] = []
+      const gotKeys = new Promise(resolve => {
+        ipcMain.on('keydown', (event, key) => {
+          keys.push(key)
+          if (keys.length === 2) resolve(keys)
+        })
+      })
+      w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'a' },
+        { type: 'keyDown', keyCode: 'b' }
+      ])
+      expect(await gotKeys).to.deep.equal(['a', 'b'])
+    })
+
+    it('rejects the whole batch when an event is invalid', async () => {
+      const w = new BrowserWindow({ show: false })
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'))
+      expect(() => {
+        w.webContents.sendInputEvents([
+          { type: 'keyDown', keyCode: 'a' },
+          { type: 'garbage' } as any
+        ])
+      }).to.throw('Invalid event object')
+    })
+  })
+
   // On Mac, zooming isn't done with the mouse wheel.
   ifdescribe(process.platform !== 'darwin')('zoom-changed', () => {
     afterEach(closeAllWindows)
@@ -1315,6 +1346,62 @@ describe('webContents module', () => {
     generateSpecs('with sandbox', true)
   })
 
+  describe('heap-near-limit event', () => {
+    afterEach(closeAllWindows)
+
+    it('is emitted when the renderer approaches its heap limit', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: { maxHeapSize: 128 } as any
+      })
+      await w.loadURL('about:blank')
+      const nearLimit = emittedOnce(w.webContents, 'heap-near-limit')
+      w.webContents.executeJavaScript(`
+        window.bloat = []
+        setInterval(() => {
+          for (let i = 0; i < 20; i++) window.bloat.push(new Array(512 * 1024).fill(i))
+        }, 16)
+      `, true)
+      const [, details] = await nearLimit
+      expect(details.usedHeapSize).to.be.a('number')
+      expect(details.heapSizeLimit).to.be.a('number')
+    })
+  })
+
+  describe('cpu profiling', () => {
+    afterEach(closeAllWindows)
+
+    it('records a profile of renderer work', async () => {
+      const w = new BrowserWindow({ show: false })
+      await w.loadURL('about:blank')
+
+      ;(w.webContents as any).startCpuProfiling()
+      await w.webContents.executeJavaScript(`
+        let total = 0
+        for (let i = 0; i < 5e6; i++) total += Math.sqrt(i)
+        total
+      `)
+      const profile = await (w.webContents as any).stopCpuProfiling()
+
+      expect(profile.startTime).to.be.a('number')
+      expect(profile.endTime).to.be.a('number').that.is.at.least(profile.startTime)
+      expect(profile.nodes).to.be.an('array').that.is.not.empty()
+      for (const node of profile.nodes) {
+        expect(node.id).to.be.a('number')
+        expect(node.functionName).to.be.a('string')
+      }
+      expect(profile.samples).to.be.an('array')
+      expect(profile.timeDeltas).to.have.lengthOf(profile.samples.length)
+    })
+
+    it('rejects stopping when no profile is being recorded', async () => {
+      const w = new BrowserWindow({ show: false })
+      await w.loadURL('about:blank')
+      await expect((w.webContents as any).stopCpuProfiling())
+        .to.be.eventually.rejectedWith(Error, 'CPU profiling is not in progress')
+    })
+  })
+
   describe('takeHeapSnapshot()', () => {
     afterEach(closeAllWindows)
 
@@ -1347,6 +1434,40 @@ describe('webContents module', () => {
       }
     })
 
+    it('writes gzip output when compress is specified', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          sandbox: true
+        }
+      })
+
+      await w.loadURL('about:blank')
+
+      const filePath = path.join(app.getPath('temp'), 'test.heapsnapshot.gz')
+
+      const cleanup = () => {
+        try {
+          fs.unlinkSync(filePath)
+        } catch (e) {
+          // ignore error
+        }
+      }
+
+      try {
+        await w.webContents.takeHeapSnapshot(filePath, { compress: true })
+        const fd = fs.openSync(filePath, 'r')
+        const header = Buffer.alloc(2)
+        fs.readSync(fd, header, 0, 2, 0)
+        fs.closeSync(fd)
+        // gzip magic number.
+        expect(header[0]).to.equal(0x1f)
+        expect(header[1]).to.equal(0x8b)
+      } finally {
+        cleanup()
+      }
+    })
+
     it('fails with invalid file path', async () => {
       const w = new BrowserWindow({
         show: false,
@@ -1380,6 +1501,30 @@ describe('webContents module', () => {
 
       w.webContents.setBackgroundThrottling(false)
     })
+
+    it('does not crash when suspending', () => {
+      const w = new BrowserWindow({ show: false });
+
+      (w.webContents.setBackgroundThrottling as any)(true, 'suspend')
+    })
+  })
+
+  describe('setProcessPriority()', () => {
+    afterEach(closeAllWindows)
+    it('accepts normal and background levels', async () => {
+      const w = new BrowserWindow({ show: false })
+      await w.loadURL('about:blank');
+      (w.webContents as any).setProcessPriority('background');
+      (w.webContents as any).setProcessPriority('normal')
+    })
+
+    it('throws on an invalid level', async () => {
+      const w = new BrowserWindow({ show: false })
+      await w.loadURL('about:blank')
+      expect(() => {
+        (w.webContents as any).setProcessPriority('realtime')
+      }).to.throw(/Invalid process priority/)
+    })
   })
 
   ifdescribe(features.isPrintingEnabled())('getPrinters()', () => {
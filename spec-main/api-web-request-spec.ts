@@ -241,6 +241,43 @@ describe('webRequest module', () => {
     })
   })
 
+  describe('webRequest.onResponseData', () => {
+    afterEach(() => {
+      (ses.webRequest as any).onResponseData(null)
+    })
+
+    it('can rewrite the response body', async () => {
+      (ses.webRequest as any).onResponseData((details: any, callback: any) => {
+        if (details.endOfStream) {
+          callback(Buffer.alloc(0))
+          return
+        }
+        callback(Buffer.from(details.data.toString().toUpperCase()))
+      })
+      const { data } = await ajax(defaultURL + 'rewrite')
+      expect(data).to.equal('/REWRITE')
+    })
+
+    it('passes the body through when the callback returns no Buffer', async () => {
+      (ses.webRequest as any).onResponseData((details: any, callback: any) => {
+        callback()
+      })
+      const { data } = await ajax(defaultURL + 'passthrough')
+      expect(data).to.equal('/passthrough')
+    })
+
+    it('can filter URLs', async () => {
+      const filter = { urls: [defaultURL + 'filter/*'] }
+      ;(ses.webRequest as any).onResponseData(filter, (details: any, callback: any) => {
+        callback(Buffer.from(details.data.toString().toUpperCase()))
+      })
+      const { data } = await ajax(`${defaultURL}nofilter/test`)
+      expect(data).to.equal('/nofilter/test')
+      const { data: filtered } = await ajax(`${defaultURL}filter/test`)
+      expect(filtered).to.equal('/FILTER/TEST')
+    })
+  })
+
   describe('webRequest.onResponseStarted', () => {
     afterEach(() => {
       ses.webRequest.onResponseStarted(null)
@@ -0,0 +1,119 @@
+// Scenario benchmarks for the paths microbenchmarks can't reach: real
+// ipc round-trips through atom_api_web_contents, stream-protocol
+// throughput through atom_url_loader_factory, and window-open latency.
+//
+// Run standalone against a build (no mocha, no ts-node):
+//
+//     ./out/Testing/electron spec-main/benchmarks/run.js
+//
+// Results are printed to stdout as one JSON document so CI can archive
+// and diff them between builds.
+
+const { app, ipcMain, protocol, BrowserWindow } = require('electron')
+const path = require('path')
+const stream = require('stream')
+
+const results = []
+
+const percentile = (samples, fraction) => {
+  const sorted = samples.slice().sort((a, b) => a - b)
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * fraction))]
+}
+
+const record = (name, unit, samples) => {
+  const mean = samples.reduce((a, b) => a + b, 0) / samples.length
+  results.push({
+    name,
+    unit,
+    samples: samples.length,
+    mean: Number(mean.toFixed(3)),
+    p50: Number(percentile(samples, 0.5).toFixed(3)),
+    p99: Number(percentile(samples, 0.99).toFixed(3))
+  })
+}
+
+const benchmarkIpc = async (iterations, payloadSize) => {
+  const w = new BrowserWindow({
+    show: false,
+    webPreferences: { nodeIntegration: true }
+  })
+  ipcMain.on('ping', event => {
+    event.reply('pong')
+  })
+  await w.loadFile(path.join(__dirname, 'fixtures', 'ipc-ping.html'))
+
+  const samples = await new Promise(resolve => {
+    ipcMain.once('done', (event, rtts) => resolve(rtts))
+    w.webContents.send('start', { iterations, payloadSize })
+  })
+  ipcMain.removeAllListeners('ping')
+  w.destroy()
+
+  record(`ipc-round-trip-${payloadSize}b`, 'ms', samples)
+}
+
+const benchmarkStreamProtocol = async (iterations, totalBytes) => {
+  const chunk = Buffer.alloc(64 * 1024, 0x62)
+  await new Promise(resolve => {
+    protocol.registerStreamProtocol('bench', (request, callback) => {
+      let sent = 0
+      const body = new stream.Readable({
+        read () {
+          if (sent >= totalBytes) {
+            this.push(null)
+            return
+          }
+          sent += chunk.length
+          this.push(chunk)
+        }
+      })
+      callback({ statusCode: 200, headers: {}, data: body })
+    }, resolve)
+  })
+
+  const w = new BrowserWindow({ show: false })
+  await w.loadURL('about:blank')
+
+  const samples = []
+  for (let i = 0; i < iterations; i++) {
+    const elapsed = await w.webContents.executeJavaScript(`(async () => {
+      const started = performance.now()
+      const response = await fetch('bench://host/${totalBytes}?i=${i}')
+      await response.arrayBuffer()
+      return performance.now() - started
+    })()`)
+    // Convert per-request time to throughput so the number stays
+    // meaningful if the transfer size changes.
+    samples.push((totalBytes / (1024 * 1024)) / (elapsed / 1000))
+  }
+  w.destroy()
+  await new Promise(resolve => protocol.unregisterProtocol('bench', resolve))
+
+  record('stream-protocol-throughput', 'MB/s', samples)
+}
+
+const benchmarkWindowOpen = async (iterations) => {
+  const samples = []
+  for (let i = 0; i < iterations; i++) {
+    const started = Date.now()
+    const w = new BrowserWindow({ show: false })
+    await w.loadURL('about:blank')
+    samples.push(Date.now() - started)
+    w.destroy()
+  }
+  record('window-open-to-load', 'ms', samples)
+}
+
+app.whenReady().then(async () => {
+  try {
+    await benchmarkIpc(2000, 64)
+    await benchmarkIpc(500, 256 * 1024)
+    await benchmarkStreamProtocol(20, 32 * 1024 * 1024)
+    await benchmarkWindowOpen(20)
+    console.log(JSON.stringify({ results }, null, 2))
+    app.exit(0)
+  } catch (error) {
+    console.error('Benchmark run failed:', error)
+    app.exit(1)
+  }
+})
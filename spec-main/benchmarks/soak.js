@@ -0,0 +1,183 @@
+// Long-session soak harness: drives synthetic window, ipc and navigation
+// churn for a configurable duration while periodically sampling process
+// metrics and the uv loop, then asserts that RSS, handle counts and
+// event-loop lag stay within bounded drift. Catches the slow leaks and
+// latency creep that per-test suites never run long enough to see.
+//
+// Run standalone against a build (no mocha, no ts-node):
+//
+//     ./out/Testing/electron spec-main/benchmarks/soak.js
+//
+// Configuration comes from the environment so CI matrices can tune it
+// without code changes:
+//
+//     SOAK_DURATION_MS          total run time (default 60000)
+//     SOAK_SAMPLE_INTERVAL_MS   sampling period (default 5000)
+//     SOAK_MAX_RSS_GROWTH_KB    allowed RSS drift across the run (65536)
+//     SOAK_MAX_HANDLE_GROWTH    allowed uv handle/request drift (32)
+//     SOAK_MAX_LOOP_LAG_MS      allowed event-loop lag drift (20)
+//
+// Results are printed to stdout as one JSON document so CI can archive
+// the samples for trend lines; the exit code reflects the assertions.
+
+const { app, ipcMain, BrowserWindow } = require('electron')
+const path = require('path')
+
+const config = {
+  durationMs: parseInt(process.env.SOAK_DURATION_MS || '60000', 10),
+  sampleIntervalMs: parseInt(process.env.SOAK_SAMPLE_INTERVAL_MS || '5000', 10),
+  maxRssGrowthKb: parseInt(process.env.SOAK_MAX_RSS_GROWTH_KB || '65536', 10),
+  maxHandleGrowth: parseInt(process.env.SOAK_MAX_HANDLE_GROWTH || '32', 10),
+  maxLoopLagMs: parseInt(process.env.SOAK_MAX_LOOP_LAG_MS || '20', 10)
+}
+
+const delay = ms => new Promise(resolve => setTimeout(resolve, ms))
+
+const median = samples => {
+  const sorted = samples.slice().sort((a, b) => a - b)
+  return sorted[Math.floor(sorted.length / 2)]
+}
+
+// Event-loop lag is measured continuously: a short timer records how far
+// past its deadline it fired, and each sample takes the worst lag seen
+// since the previous sample.
+let worstLoopLagMs = 0
+const watchLoopLag = () => {
+  const intervalMs = 100
+  let expected = Date.now() + intervalMs
+  const timer = setInterval(() => {
+    const now = Date.now()
+    worstLoopLagMs = Math.max(worstLoopLagMs, now - expected)
+    expected = now + intervalMs
+  }, intervalMs)
+  timer.unref()
+}
+
+const takeSample = () => {
+  const metrics = app.getAppMetrics()
+  let rssKb = 0
+  for (const metric of metrics) {
+    if (metric.memory) rssKb += metric.memory.workingSetSize
+  }
+  const sample = {
+    time: Date.now(),
+    processCount: metrics.length,
+    rssKb,
+    uvHandles:
+      process._getActiveHandles().length + process._getActiveRequests().length,
+    loopLagMs: worstLoopLagMs
+  }
+  worstLoopLagMs = 0
+  return sample
+}
+
+// Churn drivers: each returns a stop() function. They run concurrently
+// for the whole soak so the session resembles a real long-lived app
+// rather than an idle process.
+
+const startWindowChurn = () => {
+  let stopped = false
+  const churn = async () => {
+    while (!stopped) {
+      const w = new BrowserWindow({ show: false })
+      await w.loadURL('about:blank')
+      w.destroy()
+      await delay(250)
+    }
+  }
+  const done = churn()
+  return async () => {
+    stopped = true
+    await done
+  }
+}
+
+const startIpcChurn = async () => {
+  const w = new BrowserWindow({
+    show: false,
+    webPreferences: { nodeIntegration: true }
+  })
+  await w.loadFile(path.join(__dirname, 'fixtures', 'soak-echo.html'))
+  const payload = Buffer.alloc(16 * 1024, 0x62)
+
+  let stopped = false
+  const churn = async () => {
+    while (!stopped) {
+      await new Promise(resolve => {
+        ipcMain.once('soak-pong', resolve)
+        w.webContents.send('soak-ping', payload)
+      })
+      await delay(10)
+    }
+  }
+  const done = churn()
+  return async () => {
+    stopped = true
+    w.webContents.send('soak-ping', payload)
+    await done
+    ipcMain.removeAllListeners('soak-pong')
+    w.destroy()
+  }
+}
+
+const startNavigationChurn = async () => {
+  const w = new BrowserWindow({ show: false })
+  let stopped = false
+  const churn = async () => {
+    let i = 0
+    while (!stopped) {
+      await w.loadURL(`data:text/html,<title>soak ${i++}</title>`)
+      await delay(500)
+    }
+  }
+  const done = churn()
+  return async () => {
+    stopped = true
+    await done
+    w.destroy()
+  }
+}
+
+// Drift is the difference between the medians of the first and last
+// quarters of the samples, so a one-off spike in either tail does not
+// fail the run.
+const assertBoundedDrift = (samples, key, limit) => {
+  const quarter = Math.max(1, Math.floor(samples.length / 4))
+  const first = median(samples.slice(0, quarter).map(s => s[key]))
+  const last = median(samples.slice(-quarter).map(s => s[key]))
+  const growth = last - first
+  return { metric: key, first, last, growth, limit, ok: growth <= limit }
+}
+
+app.whenReady().then(async () => {
+  try {
+    watchLoopLag()
+    const stopWindowChurn = startWindowChurn()
+    const stopIpcChurn = await startIpcChurn()
+    const stopNavigationChurn = await startNavigationChurn()
+
+    const samples = []
+    const deadline = Date.now() + config.durationMs
+    while (Date.now() < deadline) {
+      await delay(config.sampleIntervalMs)
+      samples.push(takeSample())
+    }
+
+    await stopNavigationChurn()
+    await stopIpcChurn()
+    await stopWindowChurn()
+
+    const checks = [
+      assertBoundedDrift(samples, 'rssKb', config.maxRssGrowthKb),
+      assertBoundedDrift(samples, 'uvHandles', config.maxHandleGrowth),
+      assertBoundedDrift(samples, 'loopLagMs', config.maxLoopLagMs)
+    ]
+
+    const passed = checks.every(check => check.ok)
+    console.log(JSON.stringify({ config, samples, checks, passed }, null, 2))
+    app.exit(passed ? 0 : 1)
+  } catch (error) {
+    console.error('Soak run failed:', error)
+    app.exit(1)
+  }
+})
@@ -229,6 +229,21 @@ describe('nativeImage module', () => {
     })
   })
 
+  describe('toPNGAsync()/toJPEGAsync()/toBitmapAsync()', () => {
+    it('resolve with the same data as their synchronous counterparts', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'))
+
+      const png = await image.toPNGAsync()
+      expect(nativeImage.createFromBuffer(png).getSize()).to.deep.equal({ width: 538, height: 190 })
+
+      const jpeg = await image.toJPEGAsync(100)
+      expect(jpeg.equals(image.toJPEG(100))).to.be.true()
+
+      const bitmap = await image.toBitmapAsync()
+      expect(bitmap.equals(image.toBitmap())).to.be.true()
+    })
+  })
+
   describe('createFromDataURL(dataURL)', () => {
     it('returns an empty image from the empty string', () => {
       expect(nativeImage.createFromDataURL('').isEmpty()).to.be.true()
@@ -394,6 +409,35 @@ describe('nativeImage module', () => {
     })
   })
 
+  describe('createThumbnailFromPath(path, maxSize)', () => {
+    it('rejects when the path does not exist', async () => {
+      let error
+      try {
+        await nativeImage.createThumbnailFromPath('does-not-exist.png', { width: 64, height: 64 })
+      } catch (e) {
+        error = e
+      }
+      expect(error).to.be.an('error')
+    })
+
+    it('rejects when the size is empty', async () => {
+      const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png')
+      let error
+      try {
+        await nativeImage.createThumbnailFromPath(imagePath, { width: 0, height: 0 })
+      } catch (e) {
+        error = e
+      }
+      expect(error).to.be.an('error')
+    })
+
+    it('resolves with a non-empty thumbnail', async () => {
+      const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png')
+      const thumbnail = await nativeImage.createThumbnailFromPath(imagePath, { width: 64, height: 64 })
+      expect(thumbnail.isEmpty()).to.be.false()
+    })
+  })
+
   describe('createFromNamedImage(name)', () => {
     it('returns empty for invalid options', () => {
       const image = nativeImage.createFromNamedImage('totally_not_real')
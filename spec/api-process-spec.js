@@ -20,6 +20,34 @@ describe('process module', () => {
     })
   })
 
+  describe('process.getModuleLoadMetrics()', () => {
+    it('returns metrics for builtin modules', () => {
+      const metrics = process.getModuleLoadMetrics()
+      expect(metrics).to.be.an('array').that.is.not.empty()
+      const builtin = metrics.find(metric => metric.name === 'atom_common_asar')
+      expect(builtin).to.be.an('object')
+      expect(builtin.type).to.equal('builtin')
+      expect(builtin.wallMs).to.be.a('number').and.be.at.least(0)
+      expect(builtin.cpuMs).to.be.a('number')
+      expect(builtin.memoryDeltaBytes).to.be.a('number')
+    })
+  })
+
+  describe('process.getUVMetrics()', () => {
+    it('returns libuv loop statistics', () => {
+      const metrics = process.getUVMetrics()
+      expect(metrics.ticks).to.be.a('number').and.be.at.least(0)
+      expect(metrics.tickTotalMs).to.be.a('number').and.be.at.least(0)
+      expect(metrics.tickMaxMs).to.be.a('number').and.be.at.least(0)
+      expect(metrics.wakeups).to.be.a('number').and.be.at.least(0)
+      expect(metrics.lagTotalMs).to.be.a('number').and.be.at.least(0)
+      expect(metrics.lagMaxMs).to.be.a('number').and.be.at.least(0)
+      expect(metrics.lagBucketBoundsMs).to.be.an('array').that.is.not.empty()
+      expect(metrics.lagHistogram).to.be.an('array')
+        .with.lengthOf(metrics.lagBucketBoundsMs.length + 1)
+    })
+  })
+
   describe('process.getIOCounters()', () => {
     before(function () {
       if (process.platform === 'darwin') {
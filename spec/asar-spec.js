@@ -1448,6 +1448,140 @@ describe('asar package', function () {
     })
   })
 
+  describe('archive index', function () {
+    const asarBinding = process._linkedBinding('atom_common_asar')
+
+    const ENTRY_SIZE = 28
+    const INDEX_HEADER_SIZE = 16
+
+    const FLAG_DIRECTORY = 1 << 0
+    const FLAG_LINK = 1 << 3
+
+    // Writes a minimal real asar whose JSON header only knows about
+    // from-json.txt, so lookups answered by the sidecar index (which does
+    // not contain that file) are distinguishable from the fallback path.
+    const writeArchive = (archivePath) => {
+      const header = JSON.stringify({
+        files: { 'from-json.txt': { size: 6, offset: '0' } }
+      })
+      const padded = Math.ceil(header.length / 4) * 4
+      const headerPickle = Buffer.alloc(8 + padded)
+      headerPickle.writeUInt32LE(4 + padded, 0)
+      headerPickle.writeUInt32LE(header.length, 4)
+      headerPickle.write(header, 8)
+      const sizePickle = Buffer.alloc(8)
+      sizePickle.writeUInt32LE(4, 0)
+      sizePickle.writeUInt32LE(headerPickle.length, 4)
+      const contents = Buffer.from('hello\nnested\n')
+      fs.writeFileSync(archivePath, Buffer.concat([sizePickle, headerPickle, contents]))
+    }
+
+    // Builds an "ASARIDX1" index buffer; entries are sorted and their
+    // paths and link targets laid out in the trailing string table.
+    const buildIndex = (entries) => {
+      entries = entries.slice().sort((a, b) => (a.path < b.path ? -1 : 1))
+      let strings = ''
+      const stringOffsets = new Map()
+      const internString = (value) => {
+        if (!stringOffsets.has(value)) {
+          stringOffsets.set(value, strings.length)
+          strings += value
+        }
+        return stringOffsets.get(value)
+      }
+
+      const header = Buffer.alloc(INDEX_HEADER_SIZE)
+      header.write('ASARIDX1', 0)
+      header.writeUInt32LE(entries.length, 8)
+      header.writeUInt32LE(INDEX_HEADER_SIZE + entries.length * ENTRY_SIZE, 12)
+
+      const table = Buffer.alloc(entries.length * ENTRY_SIZE)
+      entries.forEach((entry, i) => {
+        const base = i * ENTRY_SIZE
+        table.writeUInt32LE(internString(entry.path), base)
+        table.writeUInt32LE(entry.path.length, base + 4)
+        table.writeUInt32LE(entry.flags || 0, base + 8)
+        if (entry.link != null) {
+          table.writeUInt32LE(entry.link.length, base + 12)
+          table.writeBigUInt64LE(BigInt(internString(entry.link)), base + 20)
+        } else {
+          table.writeUInt32LE(entry.size || 0, base + 12)
+          table.writeBigUInt64LE(BigInt(entry.offset || 0), base + 20)
+        }
+      })
+      return Buffer.concat([header, table, Buffer.from(strings)])
+    }
+
+    const validIndex = () => buildIndex([
+      { path: 'dir', flags: FLAG_DIRECTORY },
+      { path: 'dir/nested.txt', size: 7, offset: 6 },
+      { path: 'file.txt', size: 6, offset: 0 },
+      { path: 'link.txt', flags: FLAG_LINK, link: 'file.txt' },
+      { path: 'link2.txt', flags: FLAG_LINK, link: 'link.txt' },
+      { path: 'loop.txt', flags: FLAG_LINK, link: 'loop.txt' }
+    ])
+
+    const createIndexedArchive = (indexBuffer) => {
+      const dir = temp.mkdirSync('electron-asar-index-spec')
+      const archivePath = path.join(dir, 'indexed.asar')
+      writeArchive(archivePath)
+      if (indexBuffer != null) {
+        fs.writeFileSync(`${archivePath}.index`, indexBuffer)
+      }
+      return archivePath
+    }
+
+    it('serves file lookups from the index', function () {
+      const archivePath = createIndexedArchive(validIndex())
+      const archive = asarBinding.createArchive(archivePath)
+      const info = archive.getFileInfo('file.txt')
+      expect(info).to.be.an('object')
+      expect(info.size).to.equal(6)
+      expect(info.unpacked).to.be.false()
+      // Known only to the JSON header, so the index answered the lookup.
+      expect(archive.getFileInfo('from-json.txt')).to.be.false()
+      expect(fs.readFileSync(path.join(archivePath, 'file.txt')).toString()).to.equal('hello\n')
+    })
+
+    it('lists root and nested directories', function () {
+      const archive = asarBinding.createArchive(createIndexedArchive(validIndex()))
+      expect(archive.readdir('').map(String)).to.deep.equal(
+        ['dir', 'file.txt', 'link.txt', 'link2.txt', 'loop.txt'])
+      expect(archive.readdir('dir').map(String)).to.deep.equal(['nested.txt'])
+      expect(archive.readdir('missing')).to.be.false()
+      expect(archive.readdir('file.txt')).to.be.false()
+    })
+
+    it('resolves link chains', function () {
+      const archivePath = createIndexedArchive(validIndex())
+      const archive = asarBinding.createArchive(archivePath)
+      expect(archive.stat('link.txt').isLink).to.be.true()
+      expect(String(archive.realpath('link.txt'))).to.equal('file.txt')
+      expect(archive.getFileInfo('link2.txt').size).to.equal(6)
+      expect(fs.readFileSync(path.join(archivePath, 'link2.txt')).toString()).to.equal('hello\n')
+      // Self-referencing links hit the depth cap instead of looping.
+      expect(archive.getFileInfo('loop.txt')).to.be.false()
+    })
+
+    it('falls back to the JSON header when the index is malformed', function () {
+      const badMagic = validIndex()
+      badMagic.write('X', 0)
+      const truncated = validIndex().slice(0, 10)
+      const overlapping = validIndex()
+      // String table offset inside the entry table.
+      overlapping.writeUInt32LE(0, 12)
+      const danglingPath = validIndex()
+      // First entry's path offset points far beyond the string table.
+      danglingPath.writeUInt32LE(0xffffff, INDEX_HEADER_SIZE)
+
+      for (const index of [badMagic, truncated, overlapping, danglingPath]) {
+        const archive = asarBinding.createArchive(createIndexedArchive(index))
+        expect(archive.readdir('').map(String)).to.deep.equal(['from-json.txt'])
+        expect(archive.getFileInfo('file.txt')).to.be.false()
+      }
+    })
+  })
+
   describe('native-image', function () {
     it('reads image from asar archive', function () {
       const p = path.join(asarDir, 'logo.asar', 'logo.png')
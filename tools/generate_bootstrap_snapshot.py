@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+"""Generates a custom V8 startup snapshot containing Electron's JS bootstrap.
+
+Concatenates the given bootstrap bundles into a single script and feeds it
+to mksnapshot, producing a snapshot blob that processes deserialize at
+launch instead of parsing and executing the bootstrap.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__)
+  parser.add_argument('--mksnapshot-dir', required=True,
+                      help='Directory containing the mksnapshot binary')
+  parser.add_argument('--output', required=True,
+                      help='Path of the snapshot blob to write')
+  parser.add_argument('inputs', nargs='+',
+                      help='Bootstrap scripts, executed in order')
+  args = parser.parse_args()
+
+  mksnapshot = os.path.join(args.mksnapshot_dir, 'mksnapshot')
+  if sys.platform == 'win32':
+    mksnapshot += '.exe'
+
+  fd, script_path = tempfile.mkstemp(suffix='.js')
+  try:
+    with os.fdopen(fd, 'wb') as script:
+      for input_path in args.inputs:
+        with open(input_path, 'rb') as input_file:
+          script.write(input_file.read())
+          script.write(b'\n')
+    subprocess.check_call([
+        mksnapshot,
+        '--turbo_instruction_scheduling',
+        '--startup_blob=' + args.output,
+        script_path,
+    ])
+  finally:
+    os.remove(script_path)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
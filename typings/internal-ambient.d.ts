@@ -22,6 +22,7 @@ declare namespace NodeJS {
     sendToHost(channel: string, args: any[]): void;
     sendTo(internal: boolean, sendToAll: boolean, webContentsId: number, channel: string, args: any[]): void;
     invoke<T>(internal: boolean, channel: string, args: any[]): Promise<{ error: string, result: T }>;
+    takeSharedImage(imageId: string): Promise<Electron.NativeImage>;
   }
 
   interface V8UtilBinding {
@@ -47,6 +48,10 @@ declare namespace NodeJS {
     electronBinding(name: 'desktop_capturer'): { createDesktopCapturer(): ElectronInternal.DesktopCapturer };
     log: NodeJS.WriteStream['write'];
     activateUvLoop(): void;
+    dlopen(module: any, filename: string, flags?: number): void;
+    _recordModuleLoadMetric(name: string, type: string, wallMs: number, cpuMs: number, memoryDeltaBytes: number): void;
+    getModuleLoadMetrics(): Array<{ name: string, type: string, wallMs: number, cpuMs: number, memoryDeltaBytes: number }>;
+    getUVMetrics(): { ticks: number, tickTotalMs: number, tickMaxMs: number, wakeups: number, lagTotalMs: number, lagMaxMs: number, lagBucketBoundsMs: number[], lagHistogram: number[] };
 
     // Additional events
     once(event: 'document-start', listener: () => any): this;
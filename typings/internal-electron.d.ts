@@ -103,6 +103,8 @@ declare namespace ElectronInternal {
 
   interface DesktopCapturer {
     startHandling(captureWindow: boolean, captureScreen: boolean, thumbnailSize: Electron.Size, fetchWindowIcons: boolean): void;
+    startListening(captureWindow: boolean, captureScreen: boolean, thumbnailSize: Electron.Size, fetchWindowIcons: boolean, updateInterval: number): void;
+    stopListening(): void;
     emit: typeof NodeJS.EventEmitter.prototype.emit | null;
   }
 
@@ -113,9 +115,14 @@ declare namespace ElectronInternal {
     fetchWindowIcons: boolean;
   }
 
+  interface SubscribeToSourcesOptions extends GetSourcesOptions {
+    updateInterval: number;
+  }
+
   interface GetSourcesResult {
     id: string;
     name: string;
+    // Shared-memory transfer tokens claimed with ipc.takeSharedImage().
     thumbnail: string;
     display_id: string;
     appIcon: string | null;